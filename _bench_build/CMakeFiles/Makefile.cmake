@@ -0,0 +1,138 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/bench/CMakeLists.txt"
+  "/root/repo/src/backend/CMakeLists.txt"
+  "/root/repo/src/backend/codegen/CMakeLists.txt"
+  "/root/repo/src/backend/codegen/x86/CMakeLists.txt"
+  "/root/repo/src/backend/registeralloc/CMakeLists.txt"
+  "/root/repo/src/codegen/CMakeLists.txt"
+  "/root/repo/src/codegen/coff/CMakeLists.txt"
+  "/root/repo/src/codegen/elf/CMakeLists.txt"
+  "/root/repo/src/codegen/mach_o/CMakeLists.txt"
+  "/root/repo/src/common/CMakeLists.txt"
+  "/root/repo/src/common/config/CMakeLists.txt"
+  "/root/repo/src/common/containers/CMakeLists.txt"
+  "/root/repo/src/common/diagnostics/CMakeLists.txt"
+  "/root/repo/src/common/io/CMakeLists.txt"
+  "/root/repo/src/common/logging/CMakeLists.txt"
+  "/root/repo/src/common/utils/CMakeLists.txt"
+  "/root/repo/src/driver/CMakeLists.txt"
+  "/root/repo/src/frontend/CMakeLists.txt"
+  "/root/repo/src/frontend/ast/CMakeLists.txt"
+  "/root/repo/src/frontend/lexer/CMakeLists.txt"
+  "/root/repo/src/frontend/parser/CMakeLists.txt"
+  "/root/repo/src/frontend/semanticanalyzer/CMakeLists.txt"
+  "/root/repo/src/midend/CMakeLists.txt"
+  "/root/repo/src/midend/ir/CMakeLists.txt"
+  "/root/repo/src/midend/optimizer/CMakeLists.txt"
+  "/root/repo/src/midend/optimizer/passes/CMakeLists.txt"
+  "/root/repo/src/symbol/CMakeLists.txt"
+  "/root/repo/src/type/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython3.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/diagnostics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/containers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/io/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/config/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/common/logging/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/type/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/symbol/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/frontend/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/frontend/lexer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/frontend/parser/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/frontend/ast/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/frontend/semanticanalyzer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/midend/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/midend/ir/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/midend/optimizer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/midend/optimizer/passes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/backend/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/backend/codegen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/backend/codegen/x86/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/backend/registeralloc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/codegen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/codegen/elf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/codegen/coff/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/codegen/mach_o/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/driver/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/toycompiler.dir/DependInfo.cmake"
+  "src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/DependInfo.cmake"
+  "src/common/containers/CMakeFiles/toycompiler_containers.dir/DependInfo.cmake"
+  "src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  "src/common/io/CMakeFiles/toycompiler_io.dir/DependInfo.cmake"
+  "src/common/config/CMakeFiles/toycompiler_config.dir/DependInfo.cmake"
+  "src/common/logging/CMakeFiles/toycompiler_logging.dir/DependInfo.cmake"
+  "src/type/CMakeFiles/toycompiler_type.dir/DependInfo.cmake"
+  "src/symbol/CMakeFiles/toycompiler_symbol.dir/DependInfo.cmake"
+  "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/DependInfo.cmake"
+  "src/frontend/parser/CMakeFiles/toycompiler_parser.dir/DependInfo.cmake"
+  "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/DependInfo.cmake"
+  "src/frontend/semanticanalyzer/CMakeFiles/toycompiler_semantic.dir/DependInfo.cmake"
+  "src/midend/ir/CMakeFiles/toycompiler_ir.dir/DependInfo.cmake"
+  "src/midend/optimizer/CMakeFiles/toycompiler_optimizer.dir/DependInfo.cmake"
+  "src/midend/optimizer/passes/CMakeFiles/toycompiler_opt_passes.dir/DependInfo.cmake"
+  "src/backend/codegen/CMakeFiles/toycompiler_backend_codegen.dir/DependInfo.cmake"
+  "src/backend/codegen/x86/CMakeFiles/toycompiler_x86.dir/DependInfo.cmake"
+  "src/backend/registeralloc/CMakeFiles/toycompiler_regalloc.dir/DependInfo.cmake"
+  "src/codegen/elf/CMakeFiles/toycompiler_elf.dir/DependInfo.cmake"
+  "src/codegen/coff/CMakeFiles/toycompiler_coff.dir/DependInfo.cmake"
+  "src/codegen/mach_o/CMakeFiles/toycompiler_mach_o.dir/DependInfo.cmake"
+  "src/driver/CMakeFiles/toycompiler_driver.dir/DependInfo.cmake"
+  "bench/CMakeFiles/toycompiler_bench_util.dir/DependInfo.cmake"
+  "bench/CMakeFiles/toycompiler_lexer_bench.dir/DependInfo.cmake"
+  "bench/CMakeFiles/toycompiler_container_bench.dir/DependInfo.cmake"
+  "bench/CMakeFiles/toycompiler_ast_visitor_bench.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/driver/main.cpp" "CMakeFiles/toycompiler.dir/src/driver/main.cpp.o" "gcc" "CMakeFiles/toycompiler.dir/src/driver/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/driver/CMakeFiles/toycompiler_driver.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/symbol/CMakeFiles/toycompiler_symbol.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/type/CMakeFiles/toycompiler_type.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/backend/codegen/x86/CMakeFiles/toycompiler_x86.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/codegen/elf/CMakeFiles/toycompiler_elf.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/codegen/coff/CMakeFiles/toycompiler_coff.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/codegen/mach_o/CMakeFiles/toycompiler_mach_o.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/backend/registeralloc/CMakeFiles/toycompiler_regalloc.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/midend/optimizer/passes/CMakeFiles/toycompiler_opt_passes.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/midend/optimizer/CMakeFiles/toycompiler_optimizer.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/midend/ir/CMakeFiles/toycompiler_ir.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/frontend/semanticanalyzer/CMakeFiles/toycompiler_semantic.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/frontend/ast/CMakeFiles/toycompiler_ast.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/frontend/parser/CMakeFiles/toycompiler_parser.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/containers/CMakeFiles/toycompiler_containers.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/io/CMakeFiles/toycompiler_io.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/config/CMakeFiles/toycompiler_config.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/logging/CMakeFiles/toycompiler_logging.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/toycompiler.dir/src/driver/main.cpp.o"
+  "CMakeFiles/toycompiler.dir/src/driver/main.cpp.o.d"
+  "bin/toycompiler"
+  "bin/toycompiler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/toycompiler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/ast_visitor_bench.c" "bench/CMakeFiles/toycompiler_ast_visitor_bench.dir/ast_visitor_bench.c.o" "gcc" "bench/CMakeFiles/toycompiler_ast_visitor_bench.dir/ast_visitor_bench.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/bench/CMakeFiles/toycompiler_bench_util.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/frontend/ast/CMakeFiles/toycompiler_ast.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/frontend/parser/CMakeFiles/toycompiler_parser.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/io/CMakeFiles/toycompiler_io.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/containers/CMakeFiles/toycompiler_containers.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/toycompiler_ast_visitor_bench"
+  "../bin/toycompiler_ast_visitor_bench.pdb"
+  "CMakeFiles/toycompiler_ast_visitor_bench.dir/ast_visitor_bench.c.o"
+  "CMakeFiles/toycompiler_ast_visitor_bench.dir/ast_visitor_bench.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_ast_visitor_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
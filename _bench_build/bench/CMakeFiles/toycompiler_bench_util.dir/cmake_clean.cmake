@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../lib/libtoycompiler_bench_util.a"
+  "../lib/libtoycompiler_bench_util.pdb"
+  "CMakeFiles/toycompiler_bench_util.dir/bench_util.c.o"
+  "CMakeFiles/toycompiler_bench_util.dir/bench_util.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_bench_util.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "../lib/libtoycompiler_bench_util.a"
+)
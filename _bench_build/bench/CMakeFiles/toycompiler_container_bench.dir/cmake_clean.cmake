@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/toycompiler_container_bench"
+  "../bin/toycompiler_container_bench.pdb"
+  "CMakeFiles/toycompiler_container_bench.dir/container_bench.c.o"
+  "CMakeFiles/toycompiler_container_bench.dir/container_bench.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_container_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
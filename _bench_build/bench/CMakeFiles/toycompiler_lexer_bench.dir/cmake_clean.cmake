@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../bin/toycompiler_lexer_bench"
+  "../bin/toycompiler_lexer_bench.pdb"
+  "CMakeFiles/toycompiler_lexer_bench.dir/lexer_bench.c.o"
+  "CMakeFiles/toycompiler_lexer_bench.dir/lexer_bench.c.o.d"
+  "CMakeFiles/toycompiler_lexer_bench.dir/lexer_corpus.c.o"
+  "CMakeFiles/toycompiler_lexer_bench.dir/lexer_corpus.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_lexer_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/backend/codegen/codegen.c" "src/backend/codegen/CMakeFiles/toycompiler_backend_codegen.dir/codegen.c.o" "gcc" "src/backend/codegen/CMakeFiles/toycompiler_backend_codegen.dir/codegen.c.o.d"
+  "/root/repo/src/backend/codegen/instruction_selector.c" "src/backend/codegen/CMakeFiles/toycompiler_backend_codegen.dir/instruction_selector.c.o" "gcc" "src/backend/codegen/CMakeFiles/toycompiler_backend_codegen.dir/instruction_selector.c.o.d"
+  "/root/repo/src/backend/codegen/target_machine.c" "src/backend/codegen/CMakeFiles/toycompiler_backend_codegen.dir/target_machine.c.o" "gcc" "src/backend/codegen/CMakeFiles/toycompiler_backend_codegen.dir/target_machine.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/midend/ir/CMakeFiles/toycompiler_ir.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/type/CMakeFiles/toycompiler_type.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/symbol/CMakeFiles/toycompiler_symbol.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/containers/CMakeFiles/toycompiler_containers.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
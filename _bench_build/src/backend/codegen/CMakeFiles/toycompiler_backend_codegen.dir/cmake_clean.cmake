@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_backend_codegen.a"
+  "../../../lib/libtoycompiler_backend_codegen.pdb"
+  "CMakeFiles/toycompiler_backend_codegen.dir/codegen.c.o"
+  "CMakeFiles/toycompiler_backend_codegen.dir/codegen.c.o.d"
+  "CMakeFiles/toycompiler_backend_codegen.dir/instruction_selector.c.o"
+  "CMakeFiles/toycompiler_backend_codegen.dir/instruction_selector.c.o.d"
+  "CMakeFiles/toycompiler_backend_codegen.dir/target_machine.c.o"
+  "CMakeFiles/toycompiler_backend_codegen.dir/target_machine.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_backend_codegen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
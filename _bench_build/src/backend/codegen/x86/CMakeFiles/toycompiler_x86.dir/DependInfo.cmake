@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/backend/codegen/x86/x86_assembler.c" "src/backend/codegen/x86/CMakeFiles/toycompiler_x86.dir/x86_assembler.c.o" "gcc" "src/backend/codegen/x86/CMakeFiles/toycompiler_x86.dir/x86_assembler.c.o.d"
+  "/root/repo/src/backend/codegen/x86/x86_backend.c" "src/backend/codegen/x86/CMakeFiles/toycompiler_x86.dir/x86_backend.c.o" "gcc" "src/backend/codegen/x86/CMakeFiles/toycompiler_x86.dir/x86_backend.c.o.d"
+  "/root/repo/src/backend/codegen/x86/x86_instructions.c" "src/backend/codegen/x86/CMakeFiles/toycompiler_x86.dir/x86_instructions.c.o" "gcc" "src/backend/codegen/x86/CMakeFiles/toycompiler_x86.dir/x86_instructions.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/codegen/elf/CMakeFiles/toycompiler_elf.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/codegen/coff/CMakeFiles/toycompiler_coff.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/codegen/mach_o/CMakeFiles/toycompiler_mach_o.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libtoycompiler_x86.a"
+  "../../../../lib/libtoycompiler_x86.pdb"
+  "CMakeFiles/toycompiler_x86.dir/x86_assembler.c.o"
+  "CMakeFiles/toycompiler_x86.dir/x86_assembler.c.o.d"
+  "CMakeFiles/toycompiler_x86.dir/x86_backend.c.o"
+  "CMakeFiles/toycompiler_x86.dir/x86_backend.c.o.d"
+  "CMakeFiles/toycompiler_x86.dir/x86_instructions.c.o"
+  "CMakeFiles/toycompiler_x86.dir/x86_instructions.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_x86.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libtoycompiler_x86.a"
+)
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/backend/registeralloc/graph_coloring.c" "src/backend/registeralloc/CMakeFiles/toycompiler_regalloc.dir/graph_coloring.c.o" "gcc" "src/backend/registeralloc/CMakeFiles/toycompiler_regalloc.dir/graph_coloring.c.o.d"
+  "/root/repo/src/backend/registeralloc/interference_graph.c" "src/backend/registeralloc/CMakeFiles/toycompiler_regalloc.dir/interference_graph.c.o" "gcc" "src/backend/registeralloc/CMakeFiles/toycompiler_regalloc.dir/interference_graph.c.o.d"
+  "/root/repo/src/backend/registeralloc/linear_scan.c" "src/backend/registeralloc/CMakeFiles/toycompiler_regalloc.dir/linear_scan.c.o" "gcc" "src/backend/registeralloc/CMakeFiles/toycompiler_regalloc.dir/linear_scan.c.o.d"
+  "/root/repo/src/backend/registeralloc/liveness_analysis.c" "src/backend/registeralloc/CMakeFiles/toycompiler_regalloc.dir/liveness_analysis.c.o" "gcc" "src/backend/registeralloc/CMakeFiles/toycompiler_regalloc.dir/liveness_analysis.c.o.d"
+  "/root/repo/src/backend/registeralloc/register_alloc.c" "src/backend/registeralloc/CMakeFiles/toycompiler_regalloc.dir/register_alloc.c.o" "gcc" "src/backend/registeralloc/CMakeFiles/toycompiler_regalloc.dir/register_alloc.c.o.d"
+  "/root/repo/src/backend/registeralloc/spill_strategy.c" "src/backend/registeralloc/CMakeFiles/toycompiler_regalloc.dir/spill_strategy.c.o" "gcc" "src/backend/registeralloc/CMakeFiles/toycompiler_regalloc.dir/spill_strategy.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/midend/ir/CMakeFiles/toycompiler_ir.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/containers/CMakeFiles/toycompiler_containers.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/type/CMakeFiles/toycompiler_type.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/symbol/CMakeFiles/toycompiler_symbol.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
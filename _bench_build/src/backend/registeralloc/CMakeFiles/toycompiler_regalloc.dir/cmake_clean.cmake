@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_regalloc.a"
+  "../../../lib/libtoycompiler_regalloc.pdb"
+  "CMakeFiles/toycompiler_regalloc.dir/graph_coloring.c.o"
+  "CMakeFiles/toycompiler_regalloc.dir/graph_coloring.c.o.d"
+  "CMakeFiles/toycompiler_regalloc.dir/interference_graph.c.o"
+  "CMakeFiles/toycompiler_regalloc.dir/interference_graph.c.o.d"
+  "CMakeFiles/toycompiler_regalloc.dir/linear_scan.c.o"
+  "CMakeFiles/toycompiler_regalloc.dir/linear_scan.c.o.d"
+  "CMakeFiles/toycompiler_regalloc.dir/liveness_analysis.c.o"
+  "CMakeFiles/toycompiler_regalloc.dir/liveness_analysis.c.o.d"
+  "CMakeFiles/toycompiler_regalloc.dir/register_alloc.c.o"
+  "CMakeFiles/toycompiler_regalloc.dir/register_alloc.c.o.d"
+  "CMakeFiles/toycompiler_regalloc.dir/spill_strategy.c.o"
+  "CMakeFiles/toycompiler_regalloc.dir/spill_strategy.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_regalloc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
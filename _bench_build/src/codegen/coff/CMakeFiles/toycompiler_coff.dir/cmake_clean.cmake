@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_coff.a"
+  "../../../lib/libtoycompiler_coff.pdb"
+  "CMakeFiles/toycompiler_coff.dir/coff_builder.cpp.o"
+  "CMakeFiles/toycompiler_coff.dir/coff_builder.cpp.o.d"
+  "CMakeFiles/toycompiler_coff.dir/coff_sections.cpp.o"
+  "CMakeFiles/toycompiler_coff.dir/coff_sections.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/toycompiler_coff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
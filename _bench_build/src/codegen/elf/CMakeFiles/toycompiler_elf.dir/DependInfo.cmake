@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/codegen/elf/elf_builder.cpp" "src/codegen/elf/CMakeFiles/toycompiler_elf.dir/elf_builder.cpp.o" "gcc" "src/codegen/elf/CMakeFiles/toycompiler_elf.dir/elf_builder.cpp.o.d"
+  "/root/repo/src/codegen/elf/relocation.cpp" "src/codegen/elf/CMakeFiles/toycompiler_elf.dir/relocation.cpp.o" "gcc" "src/codegen/elf/CMakeFiles/toycompiler_elf.dir/relocation.cpp.o.d"
+  "/root/repo/src/codegen/elf/section_manager.cpp" "src/codegen/elf/CMakeFiles/toycompiler_elf.dir/section_manager.cpp.o" "gcc" "src/codegen/elf/CMakeFiles/toycompiler_elf.dir/section_manager.cpp.o.d"
+  "/root/repo/src/codegen/elf/string_table.cpp" "src/codegen/elf/CMakeFiles/toycompiler_elf.dir/string_table.cpp.o" "gcc" "src/codegen/elf/CMakeFiles/toycompiler_elf.dir/string_table.cpp.o.d"
+  "/root/repo/src/codegen/elf/symbol_table.cpp" "src/codegen/elf/CMakeFiles/toycompiler_elf.dir/symbol_table.cpp.o" "gcc" "src/codegen/elf/CMakeFiles/toycompiler_elf.dir/symbol_table.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
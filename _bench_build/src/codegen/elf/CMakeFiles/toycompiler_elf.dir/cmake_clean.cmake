@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_elf.a"
+  "../../../lib/libtoycompiler_elf.pdb"
+  "CMakeFiles/toycompiler_elf.dir/elf_builder.cpp.o"
+  "CMakeFiles/toycompiler_elf.dir/elf_builder.cpp.o.d"
+  "CMakeFiles/toycompiler_elf.dir/relocation.cpp.o"
+  "CMakeFiles/toycompiler_elf.dir/relocation.cpp.o.d"
+  "CMakeFiles/toycompiler_elf.dir/section_manager.cpp.o"
+  "CMakeFiles/toycompiler_elf.dir/section_manager.cpp.o.d"
+  "CMakeFiles/toycompiler_elf.dir/string_table.cpp.o"
+  "CMakeFiles/toycompiler_elf.dir/string_table.cpp.o.d"
+  "CMakeFiles/toycompiler_elf.dir/symbol_table.cpp.o"
+  "CMakeFiles/toycompiler_elf.dir/symbol_table.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/toycompiler_elf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
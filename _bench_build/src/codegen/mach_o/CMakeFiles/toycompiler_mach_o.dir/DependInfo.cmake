@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/codegen/mach_o/mach_o_builder.cpp" "src/codegen/mach_o/CMakeFiles/toycompiler_mach_o.dir/mach_o_builder.cpp.o" "gcc" "src/codegen/mach_o/CMakeFiles/toycompiler_mach_o.dir/mach_o_builder.cpp.o.d"
+  "/root/repo/src/codegen/mach_o/mach_o_sections.cpp" "src/codegen/mach_o/CMakeFiles/toycompiler_mach_o.dir/mach_o_sections.cpp.o" "gcc" "src/codegen/mach_o/CMakeFiles/toycompiler_mach_o.dir/mach_o_sections.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_mach_o.a"
+  "../../../lib/libtoycompiler_mach_o.pdb"
+  "CMakeFiles/toycompiler_mach_o.dir/mach_o_builder.cpp.o"
+  "CMakeFiles/toycompiler_mach_o.dir/mach_o_builder.cpp.o.d"
+  "CMakeFiles/toycompiler_mach_o.dir/mach_o_sections.cpp.o"
+  "CMakeFiles/toycompiler_mach_o.dir/mach_o_sections.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/toycompiler_mach_o.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
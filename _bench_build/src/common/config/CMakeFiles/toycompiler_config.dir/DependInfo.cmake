@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/config/command_line.c" "src/common/config/CMakeFiles/toycompiler_config.dir/command_line.c.o" "gcc" "src/common/config/CMakeFiles/toycompiler_config.dir/command_line.c.o.d"
+  "/root/repo/src/common/config/config.c" "src/common/config/CMakeFiles/toycompiler_config.dir/config.c.o" "gcc" "src/common/config/CMakeFiles/toycompiler_config.dir/config.c.o.d"
+  "/root/repo/src/common/config/target_config.c" "src/common/config/CMakeFiles/toycompiler_config.dir/target_config.c.o" "gcc" "src/common/config/CMakeFiles/toycompiler_config.dir/target_config.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_config.a"
+  "../../../lib/libtoycompiler_config.pdb"
+  "CMakeFiles/toycompiler_config.dir/command_line.c.o"
+  "CMakeFiles/toycompiler_config.dir/command_line.c.o.d"
+  "CMakeFiles/toycompiler_config.dir/config.c.o"
+  "CMakeFiles/toycompiler_config.dir/config.c.o.d"
+  "CMakeFiles/toycompiler_config.dir/target_config.c.o"
+  "CMakeFiles/toycompiler_config.dir/target_config.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_config.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/containers/bst.c" "src/common/containers/CMakeFiles/toycompiler_containers.dir/bst.c.o" "gcc" "src/common/containers/CMakeFiles/toycompiler_containers.dir/bst.c.o.d"
+  "/root/repo/src/common/containers/deque.c" "src/common/containers/CMakeFiles/toycompiler_containers.dir/deque.c.o" "gcc" "src/common/containers/CMakeFiles/toycompiler_containers.dir/deque.c.o.d"
+  "/root/repo/src/common/containers/graph.c" "src/common/containers/CMakeFiles/toycompiler_containers.dir/graph.c.o" "gcc" "src/common/containers/CMakeFiles/toycompiler_containers.dir/graph.c.o.d"
+  "/root/repo/src/common/containers/vector.c" "src/common/containers/CMakeFiles/toycompiler_containers.dir/vector.c.o" "gcc" "src/common/containers/CMakeFiles/toycompiler_containers.dir/vector.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
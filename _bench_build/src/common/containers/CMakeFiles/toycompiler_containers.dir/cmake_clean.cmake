@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_containers.a"
+  "../../../lib/libtoycompiler_containers.pdb"
+  "CMakeFiles/toycompiler_containers.dir/bst.c.o"
+  "CMakeFiles/toycompiler_containers.dir/bst.c.o.d"
+  "CMakeFiles/toycompiler_containers.dir/deque.c.o"
+  "CMakeFiles/toycompiler_containers.dir/deque.c.o.d"
+  "CMakeFiles/toycompiler_containers.dir/graph.c.o"
+  "CMakeFiles/toycompiler_containers.dir/graph.c.o.d"
+  "CMakeFiles/toycompiler_containers.dir/vector.c.o"
+  "CMakeFiles/toycompiler_containers.dir/vector.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_containers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/diagnostics/diagnostic_engine.c" "src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/diagnostic_engine.c.o" "gcc" "src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/diagnostic_engine.c.o.d"
+  "/root/repo/src/common/diagnostics/error_reporter.c" "src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/error_reporter.c.o" "gcc" "src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/error_reporter.c.o.d"
+  "/root/repo/src/common/diagnostics/formatting.c" "src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/formatting.c.o" "gcc" "src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/formatting.c.o.d"
+  "/root/repo/src/common/diagnostics/line_index.c" "src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/line_index.c.o" "gcc" "src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/line_index.c.o.d"
+  "/root/repo/src/common/diagnostics/source_location.c" "src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/source_location.c.o" "gcc" "src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/source_location.c.o.d"
+  "/root/repo/src/common/diagnostics/source_manager.c" "src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/source_manager.c.o" "gcc" "src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/source_manager.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_diagnostics.a"
+  "../../../lib/libtoycompiler_diagnostics.pdb"
+  "CMakeFiles/toycompiler_diagnostics.dir/diagnostic_engine.c.o"
+  "CMakeFiles/toycompiler_diagnostics.dir/diagnostic_engine.c.o.d"
+  "CMakeFiles/toycompiler_diagnostics.dir/error_reporter.c.o"
+  "CMakeFiles/toycompiler_diagnostics.dir/error_reporter.c.o.d"
+  "CMakeFiles/toycompiler_diagnostics.dir/formatting.c.o"
+  "CMakeFiles/toycompiler_diagnostics.dir/formatting.c.o.d"
+  "CMakeFiles/toycompiler_diagnostics.dir/line_index.c.o"
+  "CMakeFiles/toycompiler_diagnostics.dir/line_index.c.o.d"
+  "CMakeFiles/toycompiler_diagnostics.dir/source_location.c.o"
+  "CMakeFiles/toycompiler_diagnostics.dir/source_location.c.o.d"
+  "CMakeFiles/toycompiler_diagnostics.dir/source_manager.c.o"
+  "CMakeFiles/toycompiler_diagnostics.dir/source_manager.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_diagnostics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/io/buffer.c" "src/common/io/CMakeFiles/toycompiler_io.dir/buffer.c.o" "gcc" "src/common/io/CMakeFiles/toycompiler_io.dir/buffer.c.o.d"
+  "/root/repo/src/common/io/file_reader.c" "src/common/io/CMakeFiles/toycompiler_io.dir/file_reader.c.o" "gcc" "src/common/io/CMakeFiles/toycompiler_io.dir/file_reader.c.o.d"
+  "/root/repo/src/common/io/output_writer.c" "src/common/io/CMakeFiles/toycompiler_io.dir/output_writer.c.o" "gcc" "src/common/io/CMakeFiles/toycompiler_io.dir/output_writer.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_io.a"
+  "../../../lib/libtoycompiler_io.pdb"
+  "CMakeFiles/toycompiler_io.dir/buffer.c.o"
+  "CMakeFiles/toycompiler_io.dir/buffer.c.o.d"
+  "CMakeFiles/toycompiler_io.dir/file_reader.c.o"
+  "CMakeFiles/toycompiler_io.dir/file_reader.c.o.d"
+  "CMakeFiles/toycompiler_io.dir/output_writer.c.o"
+  "CMakeFiles/toycompiler_io.dir/output_writer.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_io.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
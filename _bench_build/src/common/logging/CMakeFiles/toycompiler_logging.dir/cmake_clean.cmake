@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_logging.a"
+  "../../../lib/libtoycompiler_logging.pdb"
+  "CMakeFiles/toycompiler_logging.dir/log_formatter.cpp.o"
+  "CMakeFiles/toycompiler_logging.dir/log_formatter.cpp.o.d"
+  "CMakeFiles/toycompiler_logging.dir/logger.cpp.o"
+  "CMakeFiles/toycompiler_logging.dir/logger.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/toycompiler_logging.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/utils/file_utils.c" "src/common/utils/CMakeFiles/toycompiler_utils.dir/file_utils.c.o" "gcc" "src/common/utils/CMakeFiles/toycompiler_utils.dir/file_utils.c.o.d"
+  "/root/repo/src/common/utils/hash_table.c" "src/common/utils/CMakeFiles/toycompiler_utils.dir/hash_table.c.o" "gcc" "src/common/utils/CMakeFiles/toycompiler_utils.dir/hash_table.c.o.d"
+  "/root/repo/src/common/utils/memory_pool.c" "src/common/utils/CMakeFiles/toycompiler_utils.dir/memory_pool.c.o" "gcc" "src/common/utils/CMakeFiles/toycompiler_utils.dir/memory_pool.c.o.d"
+  "/root/repo/src/common/utils/string_utils.c" "src/common/utils/CMakeFiles/toycompiler_utils.dir/string_utils.c.o" "gcc" "src/common/utils/CMakeFiles/toycompiler_utils.dir/string_utils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_utils.a"
+  "../../../lib/libtoycompiler_utils.pdb"
+  "CMakeFiles/toycompiler_utils.dir/file_utils.c.o"
+  "CMakeFiles/toycompiler_utils.dir/file_utils.c.o.d"
+  "CMakeFiles/toycompiler_utils.dir/hash_table.c.o"
+  "CMakeFiles/toycompiler_utils.dir/hash_table.c.o.d"
+  "CMakeFiles/toycompiler_utils.dir/memory_pool.c.o"
+  "CMakeFiles/toycompiler_utils.dir/memory_pool.c.o.d"
+  "CMakeFiles/toycompiler_utils.dir/string_utils.c.o"
+  "CMakeFiles/toycompiler_utils.dir/string_utils.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_utils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../lib/libtoycompiler_driver.a"
+  "../../lib/libtoycompiler_driver.pdb"
+  "CMakeFiles/toycompiler_driver.dir/command_line.cpp.o"
+  "CMakeFiles/toycompiler_driver.dir/command_line.cpp.o.d"
+  "CMakeFiles/toycompiler_driver.dir/compilation_unit.cpp.o"
+  "CMakeFiles/toycompiler_driver.dir/compilation_unit.cpp.o.d"
+  "CMakeFiles/toycompiler_driver.dir/compiler_driver.cpp.o"
+  "CMakeFiles/toycompiler_driver.dir/compiler_driver.cpp.o.d"
+  "CMakeFiles/toycompiler_driver.dir/pipeline_manager.cpp.o"
+  "CMakeFiles/toycompiler_driver.dir/pipeline_manager.cpp.o.d"
+  "CMakeFiles/toycompiler_driver.dir/target_detection.cpp.o"
+  "CMakeFiles/toycompiler_driver.dir/target_detection.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/toycompiler_driver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/frontend/ast/ast_builder.c" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_builder.c.o" "gcc" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_builder.c.o.d"
+  "/root/repo/src/frontend/ast/ast_dumper.c" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_dumper.c.o" "gcc" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_dumper.c.o.d"
+  "/root/repo/src/frontend/ast/ast_flat.c" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_flat.c.o" "gcc" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_flat.c.o.d"
+  "/root/repo/src/frontend/ast/ast_nodes.c" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_nodes.c.o" "gcc" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_nodes.c.o.d"
+  "/root/repo/src/frontend/ast/ast_parallel.c" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_parallel.c.o" "gcc" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_parallel.c.o.d"
+  "/root/repo/src/frontend/ast/ast_utils.c" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_utils.c.o" "gcc" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_utils.c.o.d"
+  "/root/repo/src/frontend/ast/ast_visitor.c" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_visitor.c.o" "gcc" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_visitor.c.o.d"
+  "/root/repo/src/frontend/ast/ast_walk.c" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_walk.c.o" "gcc" "src/frontend/ast/CMakeFiles/toycompiler_ast.dir/ast_walk.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/frontend/parser/CMakeFiles/toycompiler_parser.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/io/CMakeFiles/toycompiler_io.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/containers/CMakeFiles/toycompiler_containers.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_ast.a"
+  "../../../lib/libtoycompiler_ast.pdb"
+  "CMakeFiles/toycompiler_ast.dir/ast_builder.c.o"
+  "CMakeFiles/toycompiler_ast.dir/ast_builder.c.o.d"
+  "CMakeFiles/toycompiler_ast.dir/ast_dumper.c.o"
+  "CMakeFiles/toycompiler_ast.dir/ast_dumper.c.o.d"
+  "CMakeFiles/toycompiler_ast.dir/ast_flat.c.o"
+  "CMakeFiles/toycompiler_ast.dir/ast_flat.c.o.d"
+  "CMakeFiles/toycompiler_ast.dir/ast_nodes.c.o"
+  "CMakeFiles/toycompiler_ast.dir/ast_nodes.c.o.d"
+  "CMakeFiles/toycompiler_ast.dir/ast_parallel.c.o"
+  "CMakeFiles/toycompiler_ast.dir/ast_parallel.c.o.d"
+  "CMakeFiles/toycompiler_ast.dir/ast_utils.c.o"
+  "CMakeFiles/toycompiler_ast.dir/ast_utils.c.o.d"
+  "CMakeFiles/toycompiler_ast.dir/ast_visitor.c.o"
+  "CMakeFiles/toycompiler_ast.dir/ast_visitor.c.o.d"
+  "CMakeFiles/toycompiler_ast.dir/ast_walk.c.o"
+  "CMakeFiles/toycompiler_ast.dir/ast_walk.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_ast.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
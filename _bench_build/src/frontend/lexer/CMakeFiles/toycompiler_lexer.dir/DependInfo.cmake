@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/frontend/lexer/char_class.c" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/char_class.c.o" "gcc" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/char_class.c.o.d"
+  "/root/repo/src/frontend/lexer/error_handler.c" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/error_handler.c.o" "gcc" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/error_handler.c.o.d"
+  "/root/repo/src/frontend/lexer/incremental_lexer.c" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/incremental_lexer.c.o" "gcc" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/incremental_lexer.c.o.d"
+  "/root/repo/src/frontend/lexer/lexer.c" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/lexer.c.o" "gcc" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/lexer.c.o.d"
+  "/root/repo/src/frontend/lexer/lexer_simd.c" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/lexer_simd.c.o" "gcc" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/lexer_simd.c.o.d"
+  "/root/repo/src/frontend/lexer/number_parser.c" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/number_parser.c.o" "gcc" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/number_parser.c.o.d"
+  "/root/repo/src/frontend/lexer/number_tables.c" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/number_tables.c.o" "gcc" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/number_tables.c.o.d"
+  "/root/repo/src/frontend/lexer/parallel_lexer.c" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/parallel_lexer.c.o" "gcc" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/parallel_lexer.c.o.d"
+  "/root/repo/src/frontend/lexer/token.c" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/token.c.o" "gcc" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/token.c.o.d"
+  "/root/repo/src/frontend/lexer/token_array.c" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/token_array.c.o" "gcc" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/token_array.c.o.d"
+  "/root/repo/src/frontend/lexer/token_stream.c" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/token_stream.c.o" "gcc" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/token_stream.c.o.d"
+  "/root/repo/src/frontend/lexer/tokenizer.c" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/tokenizer.c.o" "gcc" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/tokenizer.c.o.d"
+  "/root/repo/src/frontend/lexer/unicode.c" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/unicode.c.o" "gcc" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/unicode.c.o.d"
+  "/root/repo/_bench_build/src/frontend/lexer/unicode_tables.c" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/unicode_tables.c.o" "gcc" "src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/unicode_tables.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/io/CMakeFiles/toycompiler_io.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/containers/CMakeFiles/toycompiler_containers.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
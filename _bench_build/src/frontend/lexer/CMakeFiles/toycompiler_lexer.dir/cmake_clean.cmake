@@ -0,0 +1,38 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_lexer.a"
+  "../../../lib/libtoycompiler_lexer.pdb"
+  "CMakeFiles/toycompiler_lexer.dir/char_class.c.o"
+  "CMakeFiles/toycompiler_lexer.dir/char_class.c.o.d"
+  "CMakeFiles/toycompiler_lexer.dir/error_handler.c.o"
+  "CMakeFiles/toycompiler_lexer.dir/error_handler.c.o.d"
+  "CMakeFiles/toycompiler_lexer.dir/incremental_lexer.c.o"
+  "CMakeFiles/toycompiler_lexer.dir/incremental_lexer.c.o.d"
+  "CMakeFiles/toycompiler_lexer.dir/lexer.c.o"
+  "CMakeFiles/toycompiler_lexer.dir/lexer.c.o.d"
+  "CMakeFiles/toycompiler_lexer.dir/lexer_simd.c.o"
+  "CMakeFiles/toycompiler_lexer.dir/lexer_simd.c.o.d"
+  "CMakeFiles/toycompiler_lexer.dir/number_parser.c.o"
+  "CMakeFiles/toycompiler_lexer.dir/number_parser.c.o.d"
+  "CMakeFiles/toycompiler_lexer.dir/number_tables.c.o"
+  "CMakeFiles/toycompiler_lexer.dir/number_tables.c.o.d"
+  "CMakeFiles/toycompiler_lexer.dir/parallel_lexer.c.o"
+  "CMakeFiles/toycompiler_lexer.dir/parallel_lexer.c.o.d"
+  "CMakeFiles/toycompiler_lexer.dir/token.c.o"
+  "CMakeFiles/toycompiler_lexer.dir/token.c.o.d"
+  "CMakeFiles/toycompiler_lexer.dir/token_array.c.o"
+  "CMakeFiles/toycompiler_lexer.dir/token_array.c.o.d"
+  "CMakeFiles/toycompiler_lexer.dir/token_stream.c.o"
+  "CMakeFiles/toycompiler_lexer.dir/token_stream.c.o.d"
+  "CMakeFiles/toycompiler_lexer.dir/tokenizer.c.o"
+  "CMakeFiles/toycompiler_lexer.dir/tokenizer.c.o.d"
+  "CMakeFiles/toycompiler_lexer.dir/unicode.c.o"
+  "CMakeFiles/toycompiler_lexer.dir/unicode.c.o.d"
+  "CMakeFiles/toycompiler_lexer.dir/unicode_tables.c.o"
+  "CMakeFiles/toycompiler_lexer.dir/unicode_tables.c.o.d"
+  "unicode_tables.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_lexer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/frontend/parser/error_recovery.c" "src/frontend/parser/CMakeFiles/toycompiler_parser.dir/error_recovery.c.o" "gcc" "src/frontend/parser/CMakeFiles/toycompiler_parser.dir/error_recovery.c.o.d"
+  "/root/repo/src/frontend/parser/grammar.c" "src/frontend/parser/CMakeFiles/toycompiler_parser.dir/grammar.c.o" "gcc" "src/frontend/parser/CMakeFiles/toycompiler_parser.dir/grammar.c.o.d"
+  "/root/repo/src/frontend/parser/parser.c" "src/frontend/parser/CMakeFiles/toycompiler_parser.dir/parser.c.o" "gcc" "src/frontend/parser/CMakeFiles/toycompiler_parser.dir/parser.c.o.d"
+  "/root/repo/src/frontend/parser/precedence.c" "src/frontend/parser/CMakeFiles/toycompiler_parser.dir/precedence.c.o" "gcc" "src/frontend/parser/CMakeFiles/toycompiler_parser.dir/precedence.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/io/CMakeFiles/toycompiler_io.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/containers/CMakeFiles/toycompiler_containers.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
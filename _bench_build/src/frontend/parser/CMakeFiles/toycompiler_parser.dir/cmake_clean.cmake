@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_parser.a"
+  "../../../lib/libtoycompiler_parser.pdb"
+  "CMakeFiles/toycompiler_parser.dir/error_recovery.c.o"
+  "CMakeFiles/toycompiler_parser.dir/error_recovery.c.o.d"
+  "CMakeFiles/toycompiler_parser.dir/grammar.c.o"
+  "CMakeFiles/toycompiler_parser.dir/grammar.c.o.d"
+  "CMakeFiles/toycompiler_parser.dir/parser.c.o"
+  "CMakeFiles/toycompiler_parser.dir/parser.c.o.d"
+  "CMakeFiles/toycompiler_parser.dir/precedence.c.o"
+  "CMakeFiles/toycompiler_parser.dir/precedence.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/frontend/semanticanalyzer/constant_evaluator.c" "src/frontend/semanticanalyzer/CMakeFiles/toycompiler_semantic.dir/constant_evaluator.c.o" "gcc" "src/frontend/semanticanalyzer/CMakeFiles/toycompiler_semantic.dir/constant_evaluator.c.o.d"
+  "/root/repo/src/frontend/semanticanalyzer/diagnostics.c" "src/frontend/semanticanalyzer/CMakeFiles/toycompiler_semantic.dir/diagnostics.c.o" "gcc" "src/frontend/semanticanalyzer/CMakeFiles/toycompiler_semantic.dir/diagnostics.c.o.d"
+  "/root/repo/src/frontend/semanticanalyzer/scope_analyzer.c" "src/frontend/semanticanalyzer/CMakeFiles/toycompiler_semantic.dir/scope_analyzer.c.o" "gcc" "src/frontend/semanticanalyzer/CMakeFiles/toycompiler_semantic.dir/scope_analyzer.c.o.d"
+  "/root/repo/src/frontend/semanticanalyzer/semanticanalyzer.c" "src/frontend/semanticanalyzer/CMakeFiles/toycompiler_semantic.dir/semanticanalyzer.c.o" "gcc" "src/frontend/semanticanalyzer/CMakeFiles/toycompiler_semantic.dir/semanticanalyzer.c.o.d"
+  "/root/repo/src/frontend/semanticanalyzer/typechecker.c" "src/frontend/semanticanalyzer/CMakeFiles/toycompiler_semantic.dir/typechecker.c.o" "gcc" "src/frontend/semanticanalyzer/CMakeFiles/toycompiler_semantic.dir/typechecker.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/frontend/ast/CMakeFiles/toycompiler_ast.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/frontend/parser/CMakeFiles/toycompiler_parser.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/type/CMakeFiles/toycompiler_type.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/symbol/CMakeFiles/toycompiler_symbol.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/frontend/lexer/CMakeFiles/toycompiler_lexer.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/io/CMakeFiles/toycompiler_io.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/containers/CMakeFiles/toycompiler_containers.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
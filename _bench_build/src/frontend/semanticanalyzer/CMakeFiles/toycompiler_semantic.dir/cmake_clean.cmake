@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_semantic.a"
+  "../../../lib/libtoycompiler_semantic.pdb"
+  "CMakeFiles/toycompiler_semantic.dir/constant_evaluator.c.o"
+  "CMakeFiles/toycompiler_semantic.dir/constant_evaluator.c.o.d"
+  "CMakeFiles/toycompiler_semantic.dir/diagnostics.c.o"
+  "CMakeFiles/toycompiler_semantic.dir/diagnostics.c.o.d"
+  "CMakeFiles/toycompiler_semantic.dir/scope_analyzer.c.o"
+  "CMakeFiles/toycompiler_semantic.dir/scope_analyzer.c.o.d"
+  "CMakeFiles/toycompiler_semantic.dir/semanticanalyzer.c.o"
+  "CMakeFiles/toycompiler_semantic.dir/semanticanalyzer.c.o.d"
+  "CMakeFiles/toycompiler_semantic.dir/typechecker.c.o"
+  "CMakeFiles/toycompiler_semantic.dir/typechecker.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_semantic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
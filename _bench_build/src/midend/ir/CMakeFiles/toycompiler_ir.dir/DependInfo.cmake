@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/midend/ir/basic_block.c" "src/midend/ir/CMakeFiles/toycompiler_ir.dir/basic_block.c.o" "gcc" "src/midend/ir/CMakeFiles/toycompiler_ir.dir/basic_block.c.o.d"
+  "/root/repo/src/midend/ir/function.c" "src/midend/ir/CMakeFiles/toycompiler_ir.dir/function.c.o" "gcc" "src/midend/ir/CMakeFiles/toycompiler_ir.dir/function.c.o.d"
+  "/root/repo/src/midend/ir/ir_builder.c" "src/midend/ir/CMakeFiles/toycompiler_ir.dir/ir_builder.c.o" "gcc" "src/midend/ir/CMakeFiles/toycompiler_ir.dir/ir_builder.c.o.d"
+  "/root/repo/src/midend/ir/ir_instruction.c" "src/midend/ir/CMakeFiles/toycompiler_ir.dir/ir_instruction.c.o" "gcc" "src/midend/ir/CMakeFiles/toycompiler_ir.dir/ir_instruction.c.o.d"
+  "/root/repo/src/midend/ir/ir_types.c" "src/midend/ir/CMakeFiles/toycompiler_ir.dir/ir_types.c.o" "gcc" "src/midend/ir/CMakeFiles/toycompiler_ir.dir/ir_types.c.o.d"
+  "/root/repo/src/midend/ir/module.c" "src/midend/ir/CMakeFiles/toycompiler_ir.dir/module.c.o" "gcc" "src/midend/ir/CMakeFiles/toycompiler_ir.dir/module.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/type/CMakeFiles/toycompiler_type.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/symbol/CMakeFiles/toycompiler_symbol.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/containers/CMakeFiles/toycompiler_containers.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
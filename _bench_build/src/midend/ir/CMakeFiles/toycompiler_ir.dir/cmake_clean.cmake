@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_ir.a"
+  "../../../lib/libtoycompiler_ir.pdb"
+  "CMakeFiles/toycompiler_ir.dir/basic_block.c.o"
+  "CMakeFiles/toycompiler_ir.dir/basic_block.c.o.d"
+  "CMakeFiles/toycompiler_ir.dir/function.c.o"
+  "CMakeFiles/toycompiler_ir.dir/function.c.o.d"
+  "CMakeFiles/toycompiler_ir.dir/ir_builder.c.o"
+  "CMakeFiles/toycompiler_ir.dir/ir_builder.c.o.d"
+  "CMakeFiles/toycompiler_ir.dir/ir_instruction.c.o"
+  "CMakeFiles/toycompiler_ir.dir/ir_instruction.c.o.d"
+  "CMakeFiles/toycompiler_ir.dir/ir_types.c.o"
+  "CMakeFiles/toycompiler_ir.dir/ir_types.c.o.d"
+  "CMakeFiles/toycompiler_ir.dir/module.c.o"
+  "CMakeFiles/toycompiler_ir.dir/module.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_ir.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/midend/optimizer/control_flow.c" "src/midend/optimizer/CMakeFiles/toycompiler_optimizer.dir/control_flow.c.o" "gcc" "src/midend/optimizer/CMakeFiles/toycompiler_optimizer.dir/control_flow.c.o.d"
+  "/root/repo/src/midend/optimizer/dataflow.c" "src/midend/optimizer/CMakeFiles/toycompiler_optimizer.dir/dataflow.c.o" "gcc" "src/midend/optimizer/CMakeFiles/toycompiler_optimizer.dir/dataflow.c.o.d"
+  "/root/repo/src/midend/optimizer/liveness.c" "src/midend/optimizer/CMakeFiles/toycompiler_optimizer.dir/liveness.c.o" "gcc" "src/midend/optimizer/CMakeFiles/toycompiler_optimizer.dir/liveness.c.o.d"
+  "/root/repo/src/midend/optimizer/optimizer.c" "src/midend/optimizer/CMakeFiles/toycompiler_optimizer.dir/optimizer.c.o" "gcc" "src/midend/optimizer/CMakeFiles/toycompiler_optimizer.dir/optimizer.c.o.d"
+  "/root/repo/src/midend/optimizer/pass_manager.c" "src/midend/optimizer/CMakeFiles/toycompiler_optimizer.dir/pass_manager.c.o" "gcc" "src/midend/optimizer/CMakeFiles/toycompiler_optimizer.dir/pass_manager.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/midend/ir/CMakeFiles/toycompiler_ir.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/type/CMakeFiles/toycompiler_type.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/symbol/CMakeFiles/toycompiler_symbol.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/containers/CMakeFiles/toycompiler_containers.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
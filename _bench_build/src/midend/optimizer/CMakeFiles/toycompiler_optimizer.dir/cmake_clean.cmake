@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../lib/libtoycompiler_optimizer.a"
+  "../../../lib/libtoycompiler_optimizer.pdb"
+  "CMakeFiles/toycompiler_optimizer.dir/control_flow.c.o"
+  "CMakeFiles/toycompiler_optimizer.dir/control_flow.c.o.d"
+  "CMakeFiles/toycompiler_optimizer.dir/dataflow.c.o"
+  "CMakeFiles/toycompiler_optimizer.dir/dataflow.c.o.d"
+  "CMakeFiles/toycompiler_optimizer.dir/liveness.c.o"
+  "CMakeFiles/toycompiler_optimizer.dir/liveness.c.o.d"
+  "CMakeFiles/toycompiler_optimizer.dir/optimizer.c.o"
+  "CMakeFiles/toycompiler_optimizer.dir/optimizer.c.o.d"
+  "CMakeFiles/toycompiler_optimizer.dir/pass_manager.c.o"
+  "CMakeFiles/toycompiler_optimizer.dir/pass_manager.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_optimizer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
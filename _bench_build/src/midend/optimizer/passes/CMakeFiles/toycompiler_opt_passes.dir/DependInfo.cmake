@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/midend/optimizer/passes/common_subexpression.c" "src/midend/optimizer/passes/CMakeFiles/toycompiler_opt_passes.dir/common_subexpression.c.o" "gcc" "src/midend/optimizer/passes/CMakeFiles/toycompiler_opt_passes.dir/common_subexpression.c.o.d"
+  "/root/repo/src/midend/optimizer/passes/constant_folding.c" "src/midend/optimizer/passes/CMakeFiles/toycompiler_opt_passes.dir/constant_folding.c.o" "gcc" "src/midend/optimizer/passes/CMakeFiles/toycompiler_opt_passes.dir/constant_folding.c.o.d"
+  "/root/repo/src/midend/optimizer/passes/dead_code_elimination.c" "src/midend/optimizer/passes/CMakeFiles/toycompiler_opt_passes.dir/dead_code_elimination.c.o" "gcc" "src/midend/optimizer/passes/CMakeFiles/toycompiler_opt_passes.dir/dead_code_elimination.c.o.d"
+  "/root/repo/src/midend/optimizer/passes/inlining.c" "src/midend/optimizer/passes/CMakeFiles/toycompiler_opt_passes.dir/inlining.c.o" "gcc" "src/midend/optimizer/passes/CMakeFiles/toycompiler_opt_passes.dir/inlining.c.o.d"
+  "/root/repo/src/midend/optimizer/passes/loop_optimization.c" "src/midend/optimizer/passes/CMakeFiles/toycompiler_opt_passes.dir/loop_optimization.c.o" "gcc" "src/midend/optimizer/passes/CMakeFiles/toycompiler_opt_passes.dir/loop_optimization.c.o.d"
+  "/root/repo/src/midend/optimizer/passes/ssa_construction.c" "src/midend/optimizer/passes/CMakeFiles/toycompiler_opt_passes.dir/ssa_construction.c.o" "gcc" "src/midend/optimizer/passes/CMakeFiles/toycompiler_opt_passes.dir/ssa_construction.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/midend/ir/CMakeFiles/toycompiler_ir.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/midend/optimizer/CMakeFiles/toycompiler_optimizer.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/symbol/CMakeFiles/toycompiler_symbol.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/containers/CMakeFiles/toycompiler_containers.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/type/CMakeFiles/toycompiler_type.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
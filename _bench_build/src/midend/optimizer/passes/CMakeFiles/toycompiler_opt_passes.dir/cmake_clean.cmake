@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libtoycompiler_opt_passes.a"
+  "../../../../lib/libtoycompiler_opt_passes.pdb"
+  "CMakeFiles/toycompiler_opt_passes.dir/common_subexpression.c.o"
+  "CMakeFiles/toycompiler_opt_passes.dir/common_subexpression.c.o.d"
+  "CMakeFiles/toycompiler_opt_passes.dir/constant_folding.c.o"
+  "CMakeFiles/toycompiler_opt_passes.dir/constant_folding.c.o.d"
+  "CMakeFiles/toycompiler_opt_passes.dir/dead_code_elimination.c.o"
+  "CMakeFiles/toycompiler_opt_passes.dir/dead_code_elimination.c.o.d"
+  "CMakeFiles/toycompiler_opt_passes.dir/inlining.c.o"
+  "CMakeFiles/toycompiler_opt_passes.dir/inlining.c.o.d"
+  "CMakeFiles/toycompiler_opt_passes.dir/loop_optimization.c.o"
+  "CMakeFiles/toycompiler_opt_passes.dir/loop_optimization.c.o.d"
+  "CMakeFiles/toycompiler_opt_passes.dir/ssa_construction.c.o"
+  "CMakeFiles/toycompiler_opt_passes.dir/ssa_construction.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_opt_passes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/symbol/name_lookup.c" "src/symbol/CMakeFiles/toycompiler_symbol.dir/name_lookup.c.o" "gcc" "src/symbol/CMakeFiles/toycompiler_symbol.dir/name_lookup.c.o.d"
+  "/root/repo/src/symbol/scope.c" "src/symbol/CMakeFiles/toycompiler_symbol.dir/scope.c.o" "gcc" "src/symbol/CMakeFiles/toycompiler_symbol.dir/scope.c.o.d"
+  "/root/repo/src/symbol/symbol.c" "src/symbol/CMakeFiles/toycompiler_symbol.dir/symbol.c.o" "gcc" "src/symbol/CMakeFiles/toycompiler_symbol.dir/symbol.c.o.d"
+  "/root/repo/src/symbol/symbol_table.c" "src/symbol/CMakeFiles/toycompiler_symbol.dir/symbol_table.c.o" "gcc" "src/symbol/CMakeFiles/toycompiler_symbol.dir/symbol_table.c.o.d"
+  "/root/repo/src/symbol/symbol_visitor.c" "src/symbol/CMakeFiles/toycompiler_symbol.dir/symbol_visitor.c.o" "gcc" "src/symbol/CMakeFiles/toycompiler_symbol.dir/symbol_visitor.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/containers/CMakeFiles/toycompiler_containers.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../lib/libtoycompiler_symbol.a"
+  "../../lib/libtoycompiler_symbol.pdb"
+  "CMakeFiles/toycompiler_symbol.dir/name_lookup.c.o"
+  "CMakeFiles/toycompiler_symbol.dir/name_lookup.c.o.d"
+  "CMakeFiles/toycompiler_symbol.dir/scope.c.o"
+  "CMakeFiles/toycompiler_symbol.dir/scope.c.o.d"
+  "CMakeFiles/toycompiler_symbol.dir/symbol.c.o"
+  "CMakeFiles/toycompiler_symbol.dir/symbol.c.o.d"
+  "CMakeFiles/toycompiler_symbol.dir/symbol_table.c.o"
+  "CMakeFiles/toycompiler_symbol.dir/symbol_table.c.o.d"
+  "CMakeFiles/toycompiler_symbol.dir/symbol_visitor.c.o"
+  "CMakeFiles/toycompiler_symbol.dir/symbol_visitor.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_symbol.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/type/aligned_type.c" "src/type/CMakeFiles/toycompiler_type.dir/aligned_type.c.o" "gcc" "src/type/CMakeFiles/toycompiler_type.dir/aligned_type.c.o.d"
+  "/root/repo/src/type/array_type.c" "src/type/CMakeFiles/toycompiler_type.dir/array_type.c.o" "gcc" "src/type/CMakeFiles/toycompiler_type.dir/array_type.c.o.d"
+  "/root/repo/src/type/atomic_type.c" "src/type/CMakeFiles/toycompiler_type.dir/atomic_type.c.o" "gcc" "src/type/CMakeFiles/toycompiler_type.dir/atomic_type.c.o.d"
+  "/root/repo/src/type/builtin_types.c" "src/type/CMakeFiles/toycompiler_type.dir/builtin_types.c.o" "gcc" "src/type/CMakeFiles/toycompiler_type.dir/builtin_types.c.o.d"
+  "/root/repo/src/type/function_type.c" "src/type/CMakeFiles/toycompiler_type.dir/function_type.c.o" "gcc" "src/type/CMakeFiles/toycompiler_type.dir/function_type.c.o.d"
+  "/root/repo/src/type/pointer_type.c" "src/type/CMakeFiles/toycompiler_type.dir/pointer_type.c.o" "gcc" "src/type/CMakeFiles/toycompiler_type.dir/pointer_type.c.o.d"
+  "/root/repo/src/type/struct_type.c" "src/type/CMakeFiles/toycompiler_type.dir/struct_type.c.o" "gcc" "src/type/CMakeFiles/toycompiler_type.dir/struct_type.c.o.d"
+  "/root/repo/src/type/type_builder.c" "src/type/CMakeFiles/toycompiler_type.dir/type_builder.c.o" "gcc" "src/type/CMakeFiles/toycompiler_type.dir/type_builder.c.o.d"
+  "/root/repo/src/type/type_comparison.c" "src/type/CMakeFiles/toycompiler_type.dir/type_comparison.c.o" "gcc" "src/type/CMakeFiles/toycompiler_type.dir/type_comparison.c.o.d"
+  "/root/repo/src/type/type_layout.c" "src/type/CMakeFiles/toycompiler_type.dir/type_layout.c.o" "gcc" "src/type/CMakeFiles/toycompiler_type.dir/type_layout.c.o.d"
+  "/root/repo/src/type/types.c" "src/type/CMakeFiles/toycompiler_type.dir/types.c.o" "gcc" "src/type/CMakeFiles/toycompiler_type.dir/types.c.o.d"
+  "/root/repo/src/type/union_type.c" "src/type/CMakeFiles/toycompiler_type.dir/union_type.c.o" "gcc" "src/type/CMakeFiles/toycompiler_type.dir/union_type.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_bench_build/src/common/diagnostics/CMakeFiles/toycompiler_diagnostics.dir/DependInfo.cmake"
+  "/root/repo/_bench_build/src/common/utils/CMakeFiles/toycompiler_utils.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "../../lib/libtoycompiler_type.a"
+  "../../lib/libtoycompiler_type.pdb"
+  "CMakeFiles/toycompiler_type.dir/aligned_type.c.o"
+  "CMakeFiles/toycompiler_type.dir/aligned_type.c.o.d"
+  "CMakeFiles/toycompiler_type.dir/array_type.c.o"
+  "CMakeFiles/toycompiler_type.dir/array_type.c.o.d"
+  "CMakeFiles/toycompiler_type.dir/atomic_type.c.o"
+  "CMakeFiles/toycompiler_type.dir/atomic_type.c.o.d"
+  "CMakeFiles/toycompiler_type.dir/builtin_types.c.o"
+  "CMakeFiles/toycompiler_type.dir/builtin_types.c.o.d"
+  "CMakeFiles/toycompiler_type.dir/function_type.c.o"
+  "CMakeFiles/toycompiler_type.dir/function_type.c.o.d"
+  "CMakeFiles/toycompiler_type.dir/pointer_type.c.o"
+  "CMakeFiles/toycompiler_type.dir/pointer_type.c.o.d"
+  "CMakeFiles/toycompiler_type.dir/struct_type.c.o"
+  "CMakeFiles/toycompiler_type.dir/struct_type.c.o.d"
+  "CMakeFiles/toycompiler_type.dir/type_builder.c.o"
+  "CMakeFiles/toycompiler_type.dir/type_builder.c.o.d"
+  "CMakeFiles/toycompiler_type.dir/type_comparison.c.o"
+  "CMakeFiles/toycompiler_type.dir/type_comparison.c.o.d"
+  "CMakeFiles/toycompiler_type.dir/type_layout.c.o"
+  "CMakeFiles/toycompiler_type.dir/type_layout.c.o.d"
+  "CMakeFiles/toycompiler_type.dir/types.c.o"
+  "CMakeFiles/toycompiler_type.dir/types.c.o.d"
+  "CMakeFiles/toycompiler_type.dir/union_type.c.o"
+  "CMakeFiles/toycompiler_type.dir/union_type.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/toycompiler_type.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
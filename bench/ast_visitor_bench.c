@@ -0,0 +1,403 @@
+/**
+ * @brief AST访问者分派基准
+ *
+ * 生成一个合成翻译单元：functions个函数，每个函数statements条表达式语句，
+ * 每条语句是一棵深度为depth的随机二元表达式树，叶子是整数字面量或标识符。
+ * 分别用ASTVisitor（astTraverseDFS + astNodeAccept + 访问函数指针）和
+ * 静态访问者（AST_DEFINE_STATIC_VISITOR生成的switch分派）运行两个遍历密集的遍：
+ *   - 引用计数：前序统计每个标识符名字的出现次数
+ *   - 常量求值：后序用值栈对每条表达式语句求值（标识符按1计）
+ * 报告两种方式的耗时、每节点纳秒数和加速比，并核对两者的结果一致。
+ *
+ * 用法：toycompiler_ast_visitor_bench [--functions N] [--statements N] [--depth N] [--iterations N]
+ *   --functions   函数个数，默认2000
+ *   --statements  每个函数的语句数，默认16
+ *   --depth       表达式树的深度，默认5（每条语句63个表达式节点）
+ *   --iterations  每项测量重复的次数，取最快的一次，默认5
+ */
+
+#include "bench_util.h"
+#include "frontend/ast/ast.h"
+#include "frontend/ast/ast_nodes.h"
+#include "frontend/ast/ast_visitor.h"
+#include "frontend/ast/ast_walk.h"
+#include "frontend/ast/ast_static_visitor.h"
+#include "common/utils/string_utils.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 标识符名字的个数
+#define BENCH_NAME_COUNT 16
+
+// 字面量取值的个数（0..BENCH_LITERAL_COUNT-1）
+#define BENCH_LITERAL_COUNT 16
+
+typedef struct {
+    size_t functions;
+    size_t statements;
+    size_t depth;
+    int iterations;
+} BenchOptions;
+
+/**
+ * @brief 引用计数遍的状态
+ */
+typedef struct {
+    InternedString names[BENCH_NAME_COUNT];
+    size_t counts[BENCH_NAME_COUNT];
+} UseCountState;
+
+/**
+ * @brief 常量求值遍的状态
+ */
+typedef struct {
+    uint64_t* values;       // 值栈
+    size_t top;
+    uint64_t checksum;      // 所有语句值之和
+} ConstEvalState;
+
+// ==================== 合成AST ====================
+
+/**
+ * @brief 生成深度为depth的随机二元表达式树
+ */
+static Expression* benchBuildExpr(BenchRng* rng, size_t depth, Token* literals,
+                                  const char* const* names) {
+    SourceLocation location = {0};
+    if (depth == 0) {
+        uint32_t pick = benchRngBelow(rng, 4);
+        if (pick == 0) {
+            return createIdentifierExpr(names[benchRngBelow(rng, BENCH_NAME_COUNT)], location);
+        }
+        return createLiteralExpr(&literals[benchRngBelow(rng, BENCH_LITERAL_COUNT)], location);
+    }
+
+    static const BinaryOperator ops[] = { BINOP_ADD, BINOP_SUB, BINOP_MUL };
+    BinaryOperator op = ops[benchRngBelow(rng, 3)];
+    Expression* left = benchBuildExpr(rng, depth - 1, literals, names);
+    Expression* right = benchBuildExpr(rng, depth - 1, literals, names);
+    return createBinaryOperatorExpr(op, left, right, location);
+}
+
+/**
+ * @brief 生成合成翻译单元，节点都分配在当前线程的AST内存池中
+ */
+static TranslationUnit* benchBuildUnit(const BenchOptions* options, Token* literals,
+                                       const char* const* names) {
+    SourceLocation location = {0};
+    BenchRng rng;
+    benchRngInit(&rng, 0xA57);
+
+    TranslationUnit* unit = createTranslationUnit();
+    if (!unit) {
+        return NULL;
+    }
+
+    for (size_t f = 0; f < options->functions; f++) {
+        CompoundStatement* body = (CompoundStatement*)createCompoundStatement(location);
+        if (!body) {
+            return NULL;
+        }
+        for (size_t s = 0; s < options->statements; s++) {
+            Expression* expr = benchBuildExpr(&rng, options->depth, literals, names);
+            Statement* stmt = createExpressionStatement(expr, location);
+            if (!expr || !stmt || !VECTOR_PUSH_BACK(body->statements, Statement*, stmt)) {
+                return NULL;
+            }
+        }
+
+        char name[32];
+        snprintf(name, sizeof(name), "function_%zu", f);
+        TypeSpecifier* returnType = createBasicTypeSpecifier(BASIC_TYPE_INT, location);
+        Declaration* function = createFunctionDeclaration(name, returnType, NULL, body, location);
+        if (!function || !VECTOR_PUSH_BACK(unit->declarations, Declaration*, function)) {
+            return NULL;
+        }
+    }
+
+    return unit;
+}
+
+// ==================== 遍的公共部分 ====================
+
+static void useCountIdentifier(UseCountState* state, const IdentifierExpr* node) {
+    for (size_t i = 0; i < BENCH_NAME_COUNT; i++) {
+        if (state->names[i] == node->name) {
+            state->counts[i]++;
+            return;
+        }
+    }
+}
+
+static void constEvalLiteral(ConstEvalState* state, const LiteralExpr* node) {
+    state->values[state->top++] = (uint64_t)node->literalToken->value.intValue;
+}
+
+static void constEvalIdentifier(ConstEvalState* state) {
+    state->values[state->top++] = 1;
+}
+
+static void constEvalBinary(ConstEvalState* state, const BinaryOperatorExpr* node) {
+    uint64_t right = state->values[--state->top];
+    uint64_t left = state->values[--state->top];
+    uint64_t result;
+    switch (node->op) {
+        case BINOP_ADD: result = left + right; break;
+        case BINOP_SUB: result = left - right; break;
+        default:        result = left * right; break;
+    }
+    state->values[state->top++] = result;
+}
+
+static void constEvalStatement(ConstEvalState* state) {
+    state->checksum += state->values[--state->top];
+}
+
+// ==================== ASTVisitor实现 ====================
+
+static void visitorCountIdentifier(ASTVisitor* self, IdentifierExpr* node) {
+    useCountIdentifier((UseCountState*)self->privateData, node);
+}
+
+static void visitorEvalLiteral(ASTVisitor* self, LiteralExpr* node) {
+    constEvalLiteral((ConstEvalState*)self->privateData, node);
+}
+
+static void visitorEvalIdentifier(ASTVisitor* self, IdentifierExpr* node) {
+    (void)node;
+    constEvalIdentifier((ConstEvalState*)self->privateData);
+}
+
+static void visitorEvalBinary(ASTVisitor* self, BinaryOperatorExpr* node) {
+    constEvalBinary((ConstEvalState*)self->privateData, node);
+}
+
+static void visitorEvalStatement(ASTVisitor* self, ExpressionStatement* node) {
+    (void)node;
+    constEvalStatement((ConstEvalState*)self->privateData);
+}
+
+// ==================== 静态访问者实现 ====================
+
+static ASTWalkAction staticCountIdentifier(IdentifierExpr* node, UseCountState* state) {
+    useCountIdentifier(state, node);
+    return AST_WALK_CONTINUE;
+}
+
+static ASTWalkAction staticEvalLiteral(LiteralExpr* node, ConstEvalState* state) {
+    constEvalLiteral(state, node);
+    return AST_WALK_CONTINUE;
+}
+
+static ASTWalkAction staticEvalIdentifier(IdentifierExpr* node, ConstEvalState* state) {
+    (void)node;
+    constEvalIdentifier(state);
+    return AST_WALK_CONTINUE;
+}
+
+static ASTWalkAction staticEvalBinary(BinaryOperatorExpr* node, ConstEvalState* state) {
+    constEvalBinary(state, node);
+    return AST_WALK_CONTINUE;
+}
+
+static ASTWalkAction staticEvalStatement(ExpressionStatement* node, ConstEvalState* state) {
+    (void)node;
+    constEvalStatement(state);
+    return AST_WALK_CONTINUE;
+}
+
+#define USE_COUNT_PREORDER(HANDLER) \
+    HANDLER(AST_NODE_IDENTIFIER_EXPR, IdentifierExpr, staticCountIdentifier)
+
+#define CONST_EVAL_POSTORDER(HANDLER) \
+    HANDLER(AST_NODE_LITERAL_EXPR, LiteralExpr, staticEvalLiteral) \
+    HANDLER(AST_NODE_IDENTIFIER_EXPR, IdentifierExpr, staticEvalIdentifier) \
+    HANDLER(AST_NODE_BINARY_OPERATOR_EXPR, BinaryOperatorExpr, staticEvalBinary) \
+    HANDLER(AST_NODE_EXPRESSION_STATEMENT, ExpressionStatement, staticEvalStatement)
+
+AST_DEFINE_STATIC_VISITOR(useCountWalk, UseCountState, USE_COUNT_PREORDER, AST_STATIC_NO_HANDLERS)
+AST_DEFINE_STATIC_VISITOR(constEvalWalk, ConstEvalState, AST_STATIC_NO_HANDLERS, CONST_EVAL_POSTORDER)
+
+// ==================== 测量 ====================
+
+/**
+ * @brief 一次测量的结果
+ */
+typedef struct {
+    double seconds;
+    uint64_t result;        // 用于核对两种实现结果一致
+} BenchResult;
+
+static uint64_t benchUseCountDigest(const UseCountState* state) {
+    uint64_t digest = 0;
+    for (size_t i = 0; i < BENCH_NAME_COUNT; i++) {
+        digest = digest * 31 + state->counts[i];
+    }
+    return digest;
+}
+
+static BenchResult benchUseCount(ASTNode* root, InternedString* names, bool useStatic,
+                                 int iterations) {
+    BenchResult best = {0.0, 0};
+    ASTVisitor* visitor = createASTVisitor();
+    if (!visitor) {
+        return best;
+    }
+    visitor->visitIdentifierExpr = visitorCountIdentifier;
+
+    for (int i = 0; i < iterations; i++) {
+        UseCountState state;
+        memcpy(state.names, names, sizeof(state.names));
+        memset(state.counts, 0, sizeof(state.counts));
+        visitor->privateData = &state;
+
+        double start = benchNowSeconds();
+        if (useStatic) {
+            useCountWalk(root, &state);
+        } else {
+            astTraverseDFS(root, visitor, true);
+        }
+        double seconds = benchNowSeconds() - start;
+
+        if (best.seconds == 0.0 || seconds < best.seconds) {
+            best.seconds = seconds;
+        }
+        best.result = benchUseCountDigest(&state);
+    }
+
+    destroyASTVisitor(visitor);
+    return best;
+}
+
+static BenchResult benchConstEval(ASTNode* root, size_t depth, bool useStatic, int iterations) {
+    BenchResult best = {0.0, 0};
+    ASTVisitor* visitor = createASTVisitor();
+    uint64_t* values = malloc((depth + 2) * sizeof(uint64_t));
+    if (!visitor || !values) {
+        destroyASTVisitor(visitor);
+        free(values);
+        return best;
+    }
+    visitor->visitLiteralExpr = visitorEvalLiteral;
+    visitor->visitIdentifierExpr = visitorEvalIdentifier;
+    visitor->visitBinaryOperatorExpr = visitorEvalBinary;
+    visitor->visitExpressionStatement = visitorEvalStatement;
+
+    for (int i = 0; i < iterations; i++) {
+        ConstEvalState state = { values, 0, 0 };
+        visitor->privateData = &state;
+
+        double start = benchNowSeconds();
+        if (useStatic) {
+            constEvalWalk(root, &state);
+        } else {
+            astTraverseDFS(root, visitor, false);
+        }
+        double seconds = benchNowSeconds() - start;
+
+        if (best.seconds == 0.0 || seconds < best.seconds) {
+            best.seconds = seconds;
+        }
+        best.result = state.checksum;
+    }
+
+    destroyASTVisitor(visitor);
+    free(values);
+    return best;
+}
+
+static void benchReport(const char* pass, BenchResult dynamic, BenchResult fixed, size_t nodes) {
+    printf("%-12s %14.3f %14.3f %14.2f %14.2f %9.2fx %s\n",
+           pass,
+           dynamic.seconds * 1e3, fixed.seconds * 1e3,
+           dynamic.seconds * 1e9 / (double)nodes,
+           fixed.seconds * 1e9 / (double)nodes,
+           fixed.seconds > 0.0 ? dynamic.seconds / fixed.seconds : 0.0,
+           dynamic.result == fixed.result ? "ok" : "MISMATCH");
+}
+
+// ==================== 主程序 ====================
+
+static void benchUsage(const char* program) {
+    fprintf(stderr, "usage: %s [--functions N] [--statements N] [--depth N] [--iterations N]\n",
+            program);
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options = { 2000, 16, 5, 5 };
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--functions") == 0 && i + 1 < argc) {
+            options.functions = (size_t)atol(argv[++i]);
+        } else if (strcmp(argv[i], "--statements") == 0 && i + 1 < argc) {
+            options.statements = (size_t)atol(argv[++i]);
+        } else if (strcmp(argv[i], "--depth") == 0 && i + 1 < argc) {
+            options.depth = (size_t)atol(argv[++i]);
+        } else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            options.iterations = atoi(argv[++i]);
+        } else {
+            benchUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (options.iterations <= 0) {
+        options.iterations = 1;
+    }
+    if (options.depth > 20) {
+        options.depth = 20;
+    }
+
+    Token literals[BENCH_LITERAL_COUNT];
+    memset(literals, 0, sizeof(literals));
+    for (int i = 0; i < BENCH_LITERAL_COUNT; i++) {
+        literals[i].type = TOKEN_INTEGER_LITERAL;
+        literals[i].value.intValue = i;
+        literals[i].hasValue = true;
+    }
+
+    char nameStorage[BENCH_NAME_COUNT][16];
+    const char* names[BENCH_NAME_COUNT];
+    InternedString internedNames[BENCH_NAME_COUNT];
+    for (int i = 0; i < BENCH_NAME_COUNT; i++) {
+        snprintf(nameStorage[i], sizeof(nameStorage[i]), "var%d", i);
+        names[i] = nameStorage[i];
+        internedNames[i] = stringInternerInternCString(globalStringInterner(), names[i]);
+    }
+
+    // 节点按类型放在slab中，与ASTBuilder构建的树布局相同
+    ASTSlabArena* arena = createASTSlabArena();
+    if (!arena) {
+        fprintf(stderr, "bench: out of memory\n");
+        return EXIT_FAILURE;
+    }
+    ASTSlabArena* previousArena = astSetSlabArena(arena);
+    TranslationUnit* unit = benchBuildUnit(&options, literals, names);
+    astSetSlabArena(previousArena);
+    if (!unit) {
+        fprintf(stderr, "bench: failed to build the AST\n");
+        destroyASTSlabArena(arena);
+        return EXIT_FAILURE;
+    }
+
+    ASTNode* root = (ASTNode*)unit;
+    size_t nodes = astSlabArenaNodeCount(arena);
+
+    printf("functions %zu, statements %zu, depth %zu, nodes %zu, iterations: %d\n\n",
+           options.functions, options.statements, options.depth, nodes, options.iterations);
+    printf("%-12s %14s %14s %14s %14s %10s\n",
+           "pass", "visitor(ms)", "static(ms)", "visitor ns/node", "static ns/node", "speedup");
+
+    benchReport("use-count",
+                benchUseCount(root, internedNames, false, options.iterations),
+                benchUseCount(root, internedNames, true, options.iterations),
+                nodes);
+    benchReport("const-eval",
+                benchConstEval(root, options.depth, false, options.iterations),
+                benchConstEval(root, options.depth, true, options.iterations),
+                nodes);
+
+    destroyASTSlabArena(arena);
+    return EXIT_SUCCESS;
+}
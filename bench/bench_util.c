@@ -0,0 +1,154 @@
+#define _POSIX_C_SOURCE 199309L  // clock_gettime
+#include "bench_util.h"
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// ==================== 计时 ====================
+
+double benchNowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// ==================== 分配计数 ====================
+
+static atomic_size_t allocationCount;
+static atomic_size_t allocatedBytes;
+
+#ifdef BENCH_COUNT_ALLOCATIONS
+
+// 链接时指定-Wl,--wrap=malloc等，程序和静态库中对malloc的调用都会转到
+// __wrap_malloc，原始实现通过__real_malloc访问
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+    atomic_fetch_add_explicit(&allocationCount, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&allocatedBytes, size, memory_order_relaxed);
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    atomic_fetch_add_explicit(&allocationCount, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&allocatedBytes, count * size, memory_order_relaxed);
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    atomic_fetch_add_explicit(&allocationCount, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&allocatedBytes, size, memory_order_relaxed);
+    return __real_realloc(ptr, size);
+}
+
+bool benchAllocationCountingEnabled(void) {
+    return true;
+}
+
+#else
+
+bool benchAllocationCountingEnabled(void) {
+    return false;
+}
+
+#endif
+
+size_t benchAllocationCount(void) {
+    return atomic_load_explicit(&allocationCount, memory_order_relaxed);
+}
+
+size_t benchAllocatedBytes(void) {
+    return atomic_load_explicit(&allocatedBytes, memory_order_relaxed);
+}
+
+// ==================== 随机数 ====================
+
+void benchRngInit(BenchRng* rng, uint64_t seed) {
+    // 状态不能为0
+    rng->state = seed ? seed : 0x9E3779B97F4A7C15ULL;
+}
+
+uint64_t benchRngNext(BenchRng* rng) {
+    uint64_t x = rng->state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    rng->state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+uint32_t benchRngBelow(BenchRng* rng, uint32_t bound) {
+    return bound ? (uint32_t)((benchRngNext(rng) >> 32) % bound) : 0;
+}
+
+// ==================== 文本拼接 ====================
+
+void benchTextInit(BenchText* text) {
+    text->data = NULL;
+    text->length = 0;
+    text->capacity = 0;
+}
+
+void benchTextFree(BenchText* text) {
+    free(text->data);
+    benchTextInit(text);
+}
+
+/**
+ * @brief 保证还能再放下extra个字节和结尾的'\0'
+ */
+static void benchTextReserve(BenchText* text, size_t extra) {
+    size_t required = text->length + extra + 1;
+    if (required <= text->capacity) {
+        return;
+    }
+
+    size_t newCapacity = text->capacity ? text->capacity : 4096;
+    while (newCapacity < required) {
+        newCapacity *= 2;
+    }
+    char* newData = (char*)realloc(text->data, newCapacity);
+    if (!newData) {
+        // 基准程序没有恢复的意义，直接退出
+        fprintf(stderr, "bench: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    text->data = newData;
+    text->capacity = newCapacity;
+}
+
+void benchTextAppend(BenchText* text, const char* data, size_t length) {
+    benchTextReserve(text, length);
+    memcpy(text->data + text->length, data, length);
+    text->length += length;
+    text->data[text->length] = '\0';
+}
+
+void benchTextAppendString(BenchText* text, const char* str) {
+    benchTextAppend(text, str, strlen(str));
+}
+
+void benchTextAppendChar(BenchText* text, char ch) {
+    benchTextAppend(text, &ch, 1);
+}
+
+void benchTextAppendFormat(BenchText* text, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    va_list copy;
+    va_copy(copy, args);
+    int needed = vsnprintf(NULL, 0, format, copy);
+    va_end(copy);
+
+    if (needed > 0) {
+        benchTextReserve(text, (size_t)needed);
+        vsnprintf(text->data + text->length, (size_t)needed + 1, format, args);
+        text->length += (size_t)needed;
+    }
+    va_end(args);
+}
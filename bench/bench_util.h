@@ -0,0 +1,83 @@
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief 基准测试公共工具
+ *
+ * 计时、分配计数、确定性随机数和文本拼接，供bench/下的各个基准程序共用。
+ */
+
+// ==================== 计时 ====================
+
+/**
+ * @brief 单调时钟的当前时间
+ * @return 秒
+ */
+double benchNowSeconds(void);
+
+// ==================== 分配计数 ====================
+
+/**
+ * @brief 当前是否能统计分配次数
+ *
+ * 分配计数通过链接器的--wrap选项拦截malloc/calloc/realloc实现，
+ * 不支持的工具链上返回false，此时分配次数恒为0。
+ */
+bool benchAllocationCountingEnabled(void);
+
+/**
+ * @brief 程序启动以来malloc/calloc/realloc被调用的次数
+ */
+size_t benchAllocationCount(void);
+
+/**
+ * @brief 程序启动以来申请的总字节数
+ */
+size_t benchAllocatedBytes(void);
+
+// ==================== 随机数 ====================
+
+/**
+ * @brief 确定性伪随机数发生器（xorshift64*）
+ *
+ * 相同种子生成相同的语料，保证不同构建之间的结果可比。
+ */
+typedef struct {
+    uint64_t state;
+} BenchRng;
+
+void benchRngInit(BenchRng* rng, uint64_t seed);
+uint64_t benchRngNext(BenchRng* rng);
+
+/**
+ * @brief [0, bound)内的随机整数
+ */
+uint32_t benchRngBelow(BenchRng* rng, uint32_t bound);
+
+// ==================== 文本拼接 ====================
+
+/**
+ * @brief 可增长的文本缓冲区，始终以'\0'结尾
+ */
+typedef struct {
+    char* data;
+    size_t length;
+    size_t capacity;
+} BenchText;
+
+void benchTextInit(BenchText* text);
+void benchTextFree(BenchText* text);
+void benchTextAppend(BenchText* text, const char* data, size_t length);
+void benchTextAppendString(BenchText* text, const char* str);
+void benchTextAppendChar(BenchText* text, char ch);
+
+/**
+ * @brief 按printf格式追加
+ */
+void benchTextAppendFormat(BenchText* text, const char* format, ...);
+
+#endif
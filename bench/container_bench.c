@@ -0,0 +1,273 @@
+/**
+ * @brief 容器基准测试
+ *
+ * 广度优先遍历队列：模拟对一棵宽树做广度优先遍历，根节点有width个子节点
+ * （相当于有width个声明的翻译单元），每个子节点再有fanout个叶子。Vector从头部
+ * 出队要移动剩余的全部元素，总耗时随宽度平方增长；Deque出队是O(1)，总耗时线性增长。
+ *
+ * 标识符查找：在字符串HashTable中按(指针, 长度)查找源码中的标识符片段，
+ * 报告每秒查找次数（含计算哈希值）。查找主要受缓存未命中限制，结果随机器的
+ * 缓存大小变化很大。参考数据：Release构建，单线程，KVM虚拟机中的Intel Xeon
+ * （family 6 model 143，L2 2 MiB），命中率50%时，1万个标识符约20M次/秒，
+ * 10万个约7.5M次/秒，100万个约3.8M次/秒。
+ *
+ * 用法：toycompiler_container_bench [--max-width N] [--fanout N] [--symbols N] [--iterations N]
+ *   --max-width   最大宽度，宽度从1000开始每次乘4直到该值，默认64000
+ *   --fanout      每个子节点的叶子数，默认2
+ *   --symbols     符号表中的标识符数量，默认100000
+ *   --iterations  每项测量重复的次数，取最快的一次，默认3
+ */
+
+#include "bench_util.h"
+#include "common/containers/vector.h"
+#include "common/containers/deque.h"
+#include "common/utils/hash_table.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    size_t maxWidth;
+    size_t fanout;
+    size_t symbolCount;
+    int iterations;
+} BenchOptions;
+
+/**
+ * @brief 节点编号为node的子节点数
+ *
+ * 0是根，1..width是根的子节点，其余是叶子。
+ */
+static size_t benchChildCount(size_t node, size_t width, size_t fanout) {
+    if (node == 0) {
+        return width;
+    }
+    return node <= width ? fanout : 0;
+}
+
+/**
+ * @brief 节点node的第i个子节点的编号
+ */
+static size_t benchChild(size_t node, size_t i, size_t width, size_t fanout) {
+    if (node == 0) {
+        return 1 + i;
+    }
+    return 1 + width + (node - 1) * fanout + i;
+}
+
+// ==================== 测量 ====================
+
+/**
+ * @brief 用Vector当队列遍历，从头部出队（astTraverseBFS原来的做法）
+ * @return 访问的节点数，失败返回0
+ */
+static size_t benchVectorQueue(size_t width, size_t fanout) {
+    Vector* queue = vectorCreate(sizeof(size_t), 0);
+    if (!queue) {
+        return 0;
+    }
+
+    size_t visited = 0;
+    size_t root = 0;
+    vectorPushBack(queue, &root);
+    while (!vectorIsEmpty(queue)) {
+        size_t node = VECTOR_AT(queue, size_t, 0);
+        vectorErase(queue, 0, NULL);
+        visited++;
+
+        size_t count = benchChildCount(node, width, fanout);
+        for (size_t i = 0; i < count; i++) {
+            if (!VECTOR_PUSH_BACK(queue, size_t, benchChild(node, i, width, fanout))) {
+                vectorDestroy(queue, NULL);
+                return 0;
+            }
+        }
+    }
+
+    vectorDestroy(queue, NULL);
+    return visited;
+}
+
+/**
+ * @brief 用Deque当队列遍历
+ * @return 访问的节点数，失败返回0
+ */
+static size_t benchDequeQueue(size_t width, size_t fanout) {
+    Deque* queue = dequeCreate(sizeof(size_t), 0);
+    if (!queue) {
+        return 0;
+    }
+
+    size_t visited = 0;
+    DEQUE_PUSH_BACK(queue, size_t, 0);
+    while (!dequeIsEmpty(queue)) {
+        size_t node = DEQUE_POP_FRONT(queue, size_t);
+        visited++;
+
+        size_t count = benchChildCount(node, width, fanout);
+        for (size_t i = 0; i < count; i++) {
+            if (!DEQUE_PUSH_BACK(queue, size_t, benchChild(node, i, width, fanout))) {
+                dequeDestroy(queue, NULL);
+                return 0;
+            }
+        }
+    }
+
+    dequeDestroy(queue, NULL);
+    return visited;
+}
+
+/**
+ * @brief 重复运行一种队列，返回最快一次的耗时（秒），失败返回负数
+ */
+static double benchRun(size_t (*run)(size_t, size_t), size_t width, size_t fanout,
+                       int iterations) {
+    size_t expected = 1 + width + width * fanout;
+    double best = 0.0;
+    for (int i = 0; i < iterations; i++) {
+        double start = benchNowSeconds();
+        size_t visited = run(width, fanout);
+        double seconds = benchNowSeconds() - start;
+        if (visited != expected) {
+            return -1.0;
+        }
+        if (best == 0.0 || seconds < best) {
+            best = seconds;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief 测量字符串HashTable的标识符查找
+ *
+ * 一半查找命中，一半是不在表中的标识符，查找顺序随机。
+ *
+ * @return 成功返回true
+ */
+static bool benchHashLookups(size_t symbolCount, int iterations) {
+    // 所有标识符依次放在一段文本里，模拟源码中的片段；前symbolCount个入表
+    size_t total = symbolCount * 2;
+    BenchText text;
+    benchTextInit(&text);
+    size_t* offsets = malloc((total + 1) * sizeof(size_t));
+    char** names = malloc(symbolCount * sizeof(char*));
+    HashTable* table = createStringHashTable(symbolCount);
+    bool ok = offsets && names && table;
+
+    BenchRng rng;
+    benchRngInit(&rng, 0x5EED);
+    for (size_t i = 0; ok && i < total; i++) {
+        offsets[i] = text.length;
+        benchTextAppendFormat(&text, "%s_%zu", i % 3 == 0 ? "node" : "value", i);
+    }
+    if (ok) {
+        offsets[total] = text.length;
+    }
+    for (size_t i = 0; ok && i < symbolCount; i++) {
+        size_t length = offsets[i + 1] - offsets[i];
+        names[i] = malloc(length + 1);
+        if (!names[i]) {
+            symbolCount = i;
+            ok = false;
+            break;
+        }
+        memcpy(names[i], text.data + offsets[i], length);
+        names[i][length] = '\0';
+        ok = hashTableInsert(table, names[i], names[i]);
+    }
+
+    size_t lookups = 4000000;
+    uint32_t* order = ok ? malloc(lookups * sizeof(uint32_t)) : NULL;
+    ok = ok && order;
+    for (size_t i = 0; ok && i < lookups; i++) {
+        order[i] = benchRngBelow(&rng, (uint32_t)total);
+    }
+
+    double best = 0.0;
+    size_t hits = 0;
+    for (int run = 0; ok && run < iterations; run++) {
+        hits = 0;
+        double start = benchNowSeconds();
+        for (size_t i = 0; i < lookups; i++) {
+            const char* name = text.data + offsets[order[i]];
+            size_t length = offsets[order[i] + 1] - offsets[order[i]];
+            hits += hashTableGetString(table, name, length, hashTableHashBytes(name, length), NULL);
+        }
+        double seconds = benchNowSeconds() - start;
+        if (best == 0.0 || seconds < best) {
+            best = seconds;
+        }
+    }
+
+    if (ok) {
+        printf("\n%10s %12s %14s %14s\n", "symbols", "lookups", "hit rate", "Mlookups/s");
+        printf("%10zu %12zu %13.1f%% %14.2f\n", symbolCount, lookups,
+               100.0 * (double)hits / (double)lookups, (double)lookups / best / 1e6);
+    }
+
+    for (size_t i = 0; names && i < symbolCount; i++) {
+        free(names[i]);
+    }
+    free(order);
+    free(names);
+    free(offsets);
+    destroyHashTable(table);
+    benchTextFree(&text);
+    return ok;
+}
+
+// ==================== 主程序 ====================
+
+static void benchUsage(const char* program) {
+    fprintf(stderr, "usage: %s [--max-width N] [--fanout N] [--symbols N] [--iterations N]\n", program);
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options = { 64000, 2, 100000, 3 };
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--max-width") == 0 && i + 1 < argc) {
+            options.maxWidth = (size_t)atol(argv[++i]);
+        } else if (strcmp(argv[i], "--fanout") == 0 && i + 1 < argc) {
+            options.fanout = (size_t)atol(argv[++i]);
+        } else if (strcmp(argv[i], "--symbols") == 0 && i + 1 < argc) {
+            options.symbolCount = (size_t)atol(argv[++i]);
+        } else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            options.iterations = atoi(argv[++i]);
+        } else {
+            benchUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (options.iterations <= 0) {
+        options.iterations = 1;
+    }
+
+    printf("bfs over a wide tree, fanout %zu, iterations: %d\n\n", options.fanout, options.iterations);
+    printf("%10s %12s %14s %14s %14s %14s\n",
+           "width", "nodes", "vector(ms)", "deque(ms)", "vector ns/node", "deque ns/node");
+
+    for (size_t width = 1000; width <= options.maxWidth; width *= 4) {
+        size_t nodes = 1 + width + width * options.fanout;
+        double vectorSeconds = benchRun(benchVectorQueue, width, options.fanout, options.iterations);
+        double dequeSeconds = benchRun(benchDequeQueue, width, options.fanout, options.iterations);
+        if (vectorSeconds < 0.0 || dequeSeconds < 0.0) {
+            fprintf(stderr, "bench: traversal failed at width %zu\n", width);
+            return EXIT_FAILURE;
+        }
+
+        printf("%10zu %12zu %14.3f %14.3f %14.2f %14.2f\n",
+               width, nodes,
+               vectorSeconds * 1e3, dequeSeconds * 1e3,
+               vectorSeconds * 1e9 / (double)nodes,
+               dequeSeconds * 1e9 / (double)nodes);
+    }
+
+    if (options.symbolCount > 0 && !benchHashLookups(options.symbolCount, options.iterations)) {
+        fprintf(stderr, "bench: hash table lookups failed\n");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
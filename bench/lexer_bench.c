@@ -0,0 +1,248 @@
+/**
+ * @brief 词法分析器基准测试
+ *
+ * 对每份语料分别测量lexerTokenize（整文件写入紧凑token数组）、
+ * lexerTokenizeParallel（分块多线程扫描）和lexerNextToken（逐个取token）的
+ * 吞吐量，报告MB/s、百万token/s以及每个token的平均分配次数。
+ *
+ * 用法：toycompiler_lexer_bench [--size MB] [--iterations N] [--corpus 名称] [--threads N] [文件...]
+ *   --size        每份合成语料的大小，默认4MB
+ *   --iterations  每项测量重复的次数，取最快的一次，默认5
+ *   --corpus      只运行指定的合成语料（identifiers/comments/numbers/strings）
+ *   --threads     并行扫描的线程数，默认0（在线CPU数）
+ *   文件          额外的真实源文件语料，通过内存映射读入
+ */
+
+#include "bench_util.h"
+#include "lexer_corpus.h"
+#include "frontend/lexer/lexer.h"
+#include "frontend/lexer/lexer_simd.h"
+#include "frontend/lexer/parallel_lexer.h"
+#include "common/io/buffer.h"
+#include "common/io/file_reader.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 一项测量的结果
+ */
+typedef struct {
+    double bestSeconds;         // 最快一次的耗时
+    size_t tokenCount;          // token数量（含EOF）
+    size_t allocations;         // 全部运行的分配次数之和
+    size_t allocatedBytes;      // 全部运行的分配字节数之和
+    int runs;                   // 运行次数
+} BenchResult;
+
+typedef struct {
+    size_t corpusSize;
+    int iterations;
+    const char* corpusFilter;
+    size_t threadCount;
+} BenchOptions;
+
+// ==================== 测量 ====================
+
+static void benchRecord(BenchResult* result, double seconds, size_t tokens,
+                        size_t allocations, size_t bytes) {
+    if (result->bestSeconds == 0.0 || seconds < result->bestSeconds) {
+        result->bestSeconds = seconds;
+    }
+    result->tokenCount = tokens;
+    result->allocations += allocations;
+    result->allocatedBytes += bytes;
+    result->runs++;
+}
+
+/**
+ * @brief 测量lexerTokenize（parallel为true时测量lexerTokenizeParallel）
+ */
+static bool benchTokenize(Lexer* lexer, int iterations, bool parallel, size_t threadCount,
+                          BenchResult* result) {
+    memset(result, 0, sizeof(*result));
+    for (int i = 0; i < iterations; i++) {
+        lexerReset(lexer);
+
+        size_t allocationsBefore = benchAllocationCount();
+        size_t bytesBefore = benchAllocatedBytes();
+        double start = benchNowSeconds();
+        TokenArray* tokens = parallel ? lexerTokenizeParallel(lexer, threadCount)
+                                      : lexerTokenize(lexer);
+        double seconds = benchNowSeconds() - start;
+        size_t allocations = benchAllocationCount() - allocationsBefore;
+        size_t bytes = benchAllocatedBytes() - bytesBefore;
+
+        if (!tokens) {
+            return false;
+        }
+        benchRecord(result, seconds, tokenArraySize(tokens), allocations, bytes);
+        destroyTokenArray(tokens);
+    }
+    return true;
+}
+
+/**
+ * @brief 测量逐个调用lexerNextToken
+ */
+static bool benchNextToken(Lexer* lexer, int iterations, BenchResult* result) {
+    memset(result, 0, sizeof(*result));
+    for (int i = 0; i < iterations; i++) {
+        // 重置同时释放上一轮的token内存池
+        lexerReset(lexer);
+
+        size_t count = 0;
+        size_t allocationsBefore = benchAllocationCount();
+        size_t bytesBefore = benchAllocatedBytes();
+        double start = benchNowSeconds();
+        for (;;) {
+            Token* token = lexerNextToken(lexer);
+            if (!token) {
+                return false;
+            }
+            count++;
+            if (token->type == TOKEN_EOF) {
+                break;
+            }
+        }
+        double seconds = benchNowSeconds() - start;
+        size_t allocations = benchAllocationCount() - allocationsBefore;
+        size_t bytes = benchAllocatedBytes() - bytesBefore;
+
+        benchRecord(result, seconds, count, allocations, bytes);
+    }
+    return true;
+}
+
+// ==================== 报告 ====================
+
+static void benchPrintHeader(void) {
+    printf("%-24s %8s %-10s %10s %10s %12s %12s\n",
+           "corpus", "size(MB)", "api", "MB/s", "Mtok/s", "allocs/tok", "bytes/tok");
+}
+
+static void benchPrintResult(const char* corpus, size_t size, const char* api, const BenchResult* result) {
+    double megabytes = (double)size / (1024.0 * 1024.0);
+    double seconds = result->bestSeconds > 0.0 ? result->bestSeconds : 1e-9;
+    // 分配次数取各次运行的平均值（首次运行包含内存池的预热）
+    double tokens = (double)(result->tokenCount ? result->tokenCount : 1) * (result->runs ? result->runs : 1);
+
+    printf("%-24s %8.2f %-10s %10.1f %10.2f %12.4f %12.2f\n",
+           corpus, megabytes, api,
+           megabytes / seconds,
+           (double)result->tokenCount / seconds / 1e6,
+           (double)result->allocations / tokens,
+           (double)result->allocatedBytes / tokens);
+}
+
+/**
+ * @brief 对一份语料运行全部测量
+ */
+static bool benchCorpus(const char* name, SourceBuffer* buffer, const BenchOptions* options) {
+    Lexer* lexer = createLexerFromBuffer(buffer, name, NULL);
+    if (!lexer) {
+        fprintf(stderr, "bench: cannot create lexer for %s\n", name);
+        return false;
+    }
+
+    size_t size = sourceBufferLength(buffer);
+    BenchResult result;
+    bool ok = true;
+
+    if (benchTokenize(lexer, options->iterations, false, 1, &result)) {
+        benchPrintResult(name, size, "tokenize", &result);
+    } else {
+        fprintf(stderr, "bench: lexerTokenize failed on %s\n", name);
+        ok = false;
+    }
+
+    if (benchTokenize(lexer, options->iterations, true, options->threadCount, &result)) {
+        benchPrintResult(name, size, "parallel", &result);
+    } else {
+        fprintf(stderr, "bench: lexerTokenizeParallel failed on %s\n", name);
+        ok = false;
+    }
+
+    if (benchNextToken(lexer, options->iterations, &result)) {
+        benchPrintResult(name, size, "nextToken", &result);
+    } else {
+        fprintf(stderr, "bench: lexerNextToken failed on %s\n", name);
+        ok = false;
+    }
+
+    destroyLexer(lexer);
+    return ok;
+}
+
+// ==================== 主程序 ====================
+
+static void benchUsage(const char* program) {
+    fprintf(stderr, "usage: %s [--size MB] [--iterations N] [--corpus NAME] [--threads N] [FILE...]\n", program);
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options = { 4u * 1024u * 1024u, 5, NULL, 0 };
+    int firstFile = argc;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            options.corpusSize = (size_t)(atof(argv[++i]) * 1024.0 * 1024.0);
+        } else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            options.iterations = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--corpus") == 0 && i + 1 < argc) {
+            options.corpusFilter = argv[++i];
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            options.threadCount = (size_t)atoi(argv[++i]);
+        } else if (argv[i][0] == '-') {
+            benchUsage(argv[0]);
+            return EXIT_FAILURE;
+        } else {
+            firstFile = i;
+            break;
+        }
+    }
+    if (options.iterations <= 0) {
+        options.iterations = 1;
+    }
+
+    printf("simd: %s, allocation counting: %s, iterations: %d\n\n",
+           simdImplementationName(),
+           benchAllocationCountingEnabled() ? "on" : "off",
+           options.iterations);
+    benchPrintHeader();
+
+    bool ok = true;
+
+    // 合成语料
+    for (int kind = 0; kind < LEXER_CORPUS_COUNT; kind++) {
+        const char* name = lexerCorpusName((LexerCorpusKind)kind);
+        if (options.corpusFilter && strcmp(options.corpusFilter, name) != 0) {
+            continue;
+        }
+
+        BenchText text;
+        lexerCorpusGenerate((LexerCorpusKind)kind, options.corpusSize, 0x70C0DE + (uint64_t)kind, &text);
+        SourceBuffer* buffer = createSourceBufferBorrowed(text.data, text.length);
+        if (!buffer) {
+            benchTextFree(&text);
+            return EXIT_FAILURE;
+        }
+        ok = benchCorpus(name, buffer, &options) && ok;
+        destroySourceBuffer(buffer);
+        benchTextFree(&text);
+    }
+
+    // 命令行给出的真实源文件
+    for (int i = firstFile; i < argc; i++) {
+        SourceBuffer* buffer = fileReaderOpen(argv[i], FILE_READ_AUTO);
+        if (!buffer) {
+            fprintf(stderr, "bench: cannot read %s\n", argv[i]);
+            ok = false;
+            continue;
+        }
+        ok = benchCorpus(argv[i], buffer, &options) && ok;
+        destroySourceBuffer(buffer);
+    }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,263 @@
+#include "lexer_corpus.h"
+
+// ==================== 词汇表 ====================
+
+static const char* const typeNames[] = {
+    "int", "unsigned int", "long", "char*", "const char*", "double", "size_t",
+    "struct Node*", "Vector*", "HashTable*", "bool", "uint32_t"
+};
+
+static const char* const wordParts[] = {
+    "node", "count", "buffer", "index", "value", "result", "context", "symbol",
+    "table", "entry", "length", "offset", "scope", "type", "parser", "token",
+    "state", "flags", "capacity", "next", "parent", "child", "left", "right"
+};
+
+static const char* const binaryOperators[] = {
+    " + ", " - ", " * ", " / ", " % ", " << ", " >> ", " & ", " | ", " ^ ",
+    " && ", " || ", " == ", " != ", " < ", " <= ", " > ", " >= "
+};
+
+#define ARRAY_COUNT(array) (sizeof(array) / sizeof((array)[0]))
+
+static const char* pick(BenchRng* rng, const char* const* words, size_t count) {
+    return words[benchRngBelow(rng, (uint32_t)count)];
+}
+
+/**
+ * @brief 追加一个由两三个单词拼成的标识符，如nodeCount、parent_scope_2
+ */
+static void appendIdentifier(BenchRng* rng, BenchText* out) {
+    benchTextAppendString(out, pick(rng, wordParts, ARRAY_COUNT(wordParts)));
+
+    uint32_t parts = 1 + benchRngBelow(rng, 2);
+    bool snakeCase = benchRngBelow(rng, 3) == 0;
+    for (uint32_t i = 0; i < parts; i++) {
+        const char* word = pick(rng, wordParts, ARRAY_COUNT(wordParts));
+        if (snakeCase) {
+            benchTextAppendChar(out, '_');
+            benchTextAppendString(out, word);
+        } else {
+            benchTextAppendChar(out, (char)(word[0] - 'a' + 'A'));
+            benchTextAppendString(out, word + 1);
+        }
+    }
+    if (benchRngBelow(rng, 4) == 0) {
+        benchTextAppendFormat(out, "_%u", benchRngBelow(rng, 100));
+    }
+}
+
+// ==================== 各类语料 ====================
+
+/**
+ * @brief 标识符密集的函数体
+ */
+static void generateIdentifiers(BenchRng* rng, size_t targetSize, BenchText* out) {
+    while (out->length < targetSize) {
+        benchTextAppendString(out, "static ");
+        benchTextAppendString(out, pick(rng, typeNames, ARRAY_COUNT(typeNames)));
+        benchTextAppendChar(out, ' ');
+        appendIdentifier(rng, out);
+        benchTextAppendChar(out, '(');
+        appendIdentifier(rng, out);
+        benchTextAppendString(out, "* ");
+        appendIdentifier(rng, out);
+        benchTextAppendString(out, ", size_t ");
+        appendIdentifier(rng, out);
+        benchTextAppendString(out, ") {\n");
+
+        uint32_t statements = 4 + benchRngBelow(rng, 12);
+        for (uint32_t i = 0; i < statements; i++) {
+            benchTextAppendString(out, "    ");
+            switch (benchRngBelow(rng, 4)) {
+                case 0:
+                    benchTextAppendString(out, pick(rng, typeNames, ARRAY_COUNT(typeNames)));
+                    benchTextAppendChar(out, ' ');
+                    appendIdentifier(rng, out);
+                    benchTextAppendString(out, " = ");
+                    appendIdentifier(rng, out);
+                    benchTextAppendString(out, "->");
+                    appendIdentifier(rng, out);
+                    benchTextAppendString(out, ";\n");
+                    break;
+                case 1:
+                    benchTextAppendString(out, "if (");
+                    appendIdentifier(rng, out);
+                    benchTextAppendString(out, pick(rng, binaryOperators, ARRAY_COUNT(binaryOperators)));
+                    appendIdentifier(rng, out);
+                    benchTextAppendString(out, ") {\n        return ");
+                    appendIdentifier(rng, out);
+                    benchTextAppendString(out, ";\n    }\n");
+                    break;
+                case 2:
+                    appendIdentifier(rng, out);
+                    benchTextAppendChar(out, '(');
+                    appendIdentifier(rng, out);
+                    benchTextAppendString(out, ", ");
+                    appendIdentifier(rng, out);
+                    benchTextAppendString(out, "[");
+                    appendIdentifier(rng, out);
+                    benchTextAppendString(out, "]);\n");
+                    break;
+                default:
+                    appendIdentifier(rng, out);
+                    benchTextAppendString(out, " = ");
+                    appendIdentifier(rng, out);
+                    benchTextAppendString(out, pick(rng, binaryOperators, ARRAY_COUNT(binaryOperators)));
+                    appendIdentifier(rng, out);
+                    benchTextAppendString(out, ".");
+                    appendIdentifier(rng, out);
+                    benchTextAppendString(out, ";\n");
+                    break;
+            }
+        }
+        benchTextAppendString(out, "    return ");
+        appendIdentifier(rng, out);
+        benchTextAppendString(out, ";\n}\n\n");
+    }
+}
+
+/**
+ * @brief 注释密集的头文件
+ */
+static void generateComments(BenchRng* rng, size_t targetSize, BenchText* out) {
+    benchTextAppendString(out, "#ifndef GENERATED_HEADER_H\n#define GENERATED_HEADER_H\n\n");
+    while (out->length < targetSize) {
+        benchTextAppendString(out, "/**\n * @brief ");
+        uint32_t words = 6 + benchRngBelow(rng, 20);
+        for (uint32_t i = 0; i < words; i++) {
+            benchTextAppendString(out, pick(rng, wordParts, ARRAY_COUNT(wordParts)));
+            benchTextAppendChar(out, i % 9 == 8 ? '\n' : ' ');
+            if (i % 9 == 8) {
+                benchTextAppendString(out, " * ");
+            }
+        }
+        benchTextAppendString(out, "\n *\n * @param ");
+        appendIdentifier(rng, out);
+        benchTextAppendString(out, " 输入参数，不能为NULL\n * @return 成功返回true\n */\n");
+
+        benchTextAppendString(out, pick(rng, typeNames, ARRAY_COUNT(typeNames)));
+        benchTextAppendChar(out, ' ');
+        appendIdentifier(rng, out);
+        benchTextAppendChar(out, '(');
+        benchTextAppendString(out, pick(rng, typeNames, ARRAY_COUNT(typeNames)));
+        benchTextAppendChar(out, ' ');
+        appendIdentifier(rng, out);
+        benchTextAppendString(out, ");  // ");
+        appendIdentifier(rng, out);
+        benchTextAppendString(out, " wrapper, see implementation notes\n");
+
+        if (benchRngBelow(rng, 4) == 0) {
+            benchTextAppendString(out, "#define ");
+            appendIdentifier(rng, out);
+            benchTextAppendFormat(out, " %u  // 默认值\n", benchRngBelow(rng, 4096));
+        }
+        benchTextAppendChar(out, '\n');
+    }
+    benchTextAppendString(out, "#endif\n");
+}
+
+/**
+ * @brief 数字字面量密集的查找表
+ */
+static void generateNumbers(BenchRng* rng, size_t targetSize, BenchText* out) {
+    unsigned tableIndex = 0;
+    while (out->length < targetSize) {
+        bool floating = benchRngBelow(rng, 2) == 0;
+        benchTextAppendFormat(out, "static const %s table%u[] = {\n",
+                              floating ? "double" : "unsigned long", tableIndex++);
+
+        uint32_t rows = 16 + benchRngBelow(rng, 48);
+        for (uint32_t row = 0; row < rows; row++) {
+            benchTextAppendString(out, "    ");
+            for (uint32_t column = 0; column < 8; column++) {
+                uint64_t bits = benchRngNext(rng);
+                if (floating) {
+                    // 1到17位有效数字的十进制尾数，加上可选的指数
+                    unsigned digits = 1 + benchRngBelow(rng, 16);
+                    unsigned long long modulus = 1;
+                    for (unsigned i = 0; i < digits; i++) {
+                        modulus *= 10;
+                    }
+                    benchTextAppendFormat(out, "%u.%0*llu", (unsigned)(bits >> 60) % 10, (int)digits,
+                                          (unsigned long long)(bits >> 11) % modulus);
+                    if (benchRngBelow(rng, 2) == 0) {
+                        benchTextAppendFormat(out, "e%d", (int)benchRngBelow(rng, 40) - 20);
+                    }
+                } else {
+                    switch (benchRngBelow(rng, 4)) {
+                        case 0:
+                            benchTextAppendFormat(out, "0x%08llXULL", (unsigned long long)(bits >> 32));
+                            break;
+                        case 1:
+                            benchTextAppendFormat(out, "0%llo", (unsigned long long)(bits >> 48));
+                            break;
+                        case 2:
+                            benchTextAppendFormat(out, "%lluUL", (unsigned long long)(bits >> 20));
+                            break;
+                        default:
+                            benchTextAppendFormat(out, "%u", (unsigned)(bits >> 54));
+                            break;
+                    }
+                }
+                benchTextAppendString(out, ", ");
+            }
+            benchTextAppendChar(out, '\n');
+        }
+        benchTextAppendString(out, "};\n\n");
+    }
+}
+
+/**
+ * @brief 长字符串字面量
+ */
+static void generateStrings(BenchRng* rng, size_t targetSize, BenchText* out) {
+    static const char* const escapes[] = { "\\n", "\\t", "\\\"", "\\\\", "\\x41", "\\101" };
+
+    unsigned messageIndex = 0;
+    while (out->length < targetSize) {
+        benchTextAppendFormat(out, "static const char message%u[] = \"", messageIndex++);
+
+        uint32_t words = 30 + benchRngBelow(rng, 300);
+        for (uint32_t i = 0; i < words; i++) {
+            benchTextAppendString(out, pick(rng, wordParts, ARRAY_COUNT(wordParts)));
+            if (benchRngBelow(rng, 16) == 0) {
+                benchTextAppendString(out, pick(rng, escapes, ARRAY_COUNT(escapes)));
+            } else {
+                benchTextAppendChar(out, ' ');
+            }
+        }
+        benchTextAppendString(out, "\";\n");
+    }
+}
+
+// ==================== 对外接口 ====================
+
+const char* lexerCorpusName(LexerCorpusKind kind) {
+    switch (kind) {
+        case LEXER_CORPUS_IDENTIFIERS: return "identifiers";
+        case LEXER_CORPUS_COMMENTS:    return "comments";
+        case LEXER_CORPUS_NUMBERS:     return "numbers";
+        case LEXER_CORPUS_STRINGS:     return "strings";
+        default:                       return "unknown";
+    }
+}
+
+void lexerCorpusGenerate(LexerCorpusKind kind, size_t targetSize, uint64_t seed, BenchText* out) {
+    BenchRng rng;
+    benchRngInit(&rng, seed);
+    benchTextInit(out);
+
+    switch (kind) {
+        case LEXER_CORPUS_IDENTIFIERS: generateIdentifiers(&rng, targetSize, out); break;
+        case LEXER_CORPUS_COMMENTS:    generateComments(&rng, targetSize, out); break;
+        case LEXER_CORPUS_NUMBERS:     generateNumbers(&rng, targetSize, out); break;
+        case LEXER_CORPUS_STRINGS:     generateStrings(&rng, targetSize, out); break;
+        default: break;
+    }
+
+    // 保证即使目标大小为0也得到合法的空字符串
+    if (!out->data) {
+        benchTextAppend(out, "", 0);
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef LEXER_CORPUS_H
+#define LEXER_CORPUS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "bench_util.h"
+
+/**
+ * @brief 词法分析基准的合成语料
+ *
+ * 每种语料突出词法分析器的一条热路径，用固定种子生成，结果可重复。
+ */
+typedef enum {
+    LEXER_CORPUS_IDENTIFIERS,   // 标识符密集的代码：声明、调用、表达式
+    LEXER_CORPUS_COMMENTS,      // 注释密集的头文件：文档注释、行注释、预处理指令
+    LEXER_CORPUS_NUMBERS,       // 数字字面量密集的查找表
+    LEXER_CORPUS_STRINGS,       // 长字符串字面量（含转义）
+    LEXER_CORPUS_COUNT
+} LexerCorpusKind;
+
+/**
+ * @brief 语料名称（用于报告）
+ */
+const char* lexerCorpusName(LexerCorpusKind kind);
+
+/**
+ * @brief 生成语料
+ * @param kind 语料类型
+ * @param targetSize 目标字节数（按整行生成，实际大小略大于该值）
+ * @param seed 随机种子
+ * @param out 输出文本，由调用者用benchTextFree释放
+ */
+void lexerCorpusGenerate(LexerCorpusKind kind, size_t targetSize, uint64_t seed, BenchText* out);
+
+#endif
@@ -0,0 +1,283 @@
+#include "deque.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>  // 用于SIZE_MAX
+
+// 每块的目标字节数，元素较大时每块至少放DEQUE_MIN_BLOCK_ELEMENTS个
+#define DEQUE_BLOCK_BYTES 1024
+#define DEQUE_MIN_BLOCK_ELEMENTS 16
+
+// ==================== 内部辅助函数 ====================
+
+/**
+ * @brief 不小于capacity的最小的2的幂
+ * @return 溢出时返回0
+ */
+static size_t roundUpToPowerOfTwo(size_t capacity) {
+    size_t result = 1;
+    while (result < capacity) {
+        if (result > SIZE_MAX / 2) {
+            return 0;
+        }
+        result <<= 1;
+    }
+    return result;
+}
+
+/**
+ * @brief 第index个元素的地址
+ */
+static inline void* dequeSlot(const Deque* deque, size_t index) {
+    size_t position = DEQUE_POSITION(deque, index);
+    return deque->blocks[position >> deque->blockShift] +
+           (position & deque->blockMask) * deque->elementSize;
+}
+
+/**
+ * @brief 释放块表中的前count块
+ */
+static void dequeFreeBlocks(char** blocks, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        free(blocks[i]);
+    }
+}
+
+/**
+ * @brief 把块数增加到newBlockCount（2的幂）
+ *
+ * 新块表从队首所在的块开始按顺序放入原来的块，后面接上新分配的块，
+ * 元素都留在原来的块里。队尾回绕进队首所在块的那几个元素排在最后，
+ * 复制到紧接在原有块之后的第一个新块的相同下标处。失败时Deque保持不变。
+ */
+static bool dequeGrowBlocks(Deque* deque, size_t newBlockCount) {
+    if (newBlockCount > SIZE_MAX / sizeof(char*) ||
+        newBlockCount > (SIZE_MAX >> deque->blockShift)) {
+        return false;
+    }
+
+    char** blocks = (char**)malloc(newBlockCount * sizeof(char*));
+    if (!blocks) {
+        return false;
+    }
+
+    size_t blockBytes = (deque->blockMask + 1) * deque->elementSize;
+    for (size_t i = deque->blockCount; i < newBlockCount; i++) {
+        blocks[i] = (char*)malloc(blockBytes);
+        if (!blocks[i]) {
+            dequeFreeBlocks(blocks + deque->blockCount, i - deque->blockCount);
+            free(blocks);
+            return false;
+        }
+    }
+
+    size_t headBlock = deque->head >> deque->blockShift;
+    for (size_t i = 0; i < deque->blockCount; i++) {
+        blocks[i] = deque->blocks[(headBlock + i) & (deque->blockCount - 1)];
+    }
+
+    // 队首之前的那部分块内空间此时放着回绕的队尾
+    size_t headOffset = deque->head & deque->blockMask;
+    size_t untilWrap = deque->capacity - headOffset;
+    if (deque->size > untilWrap) {
+        memcpy(blocks[deque->blockCount], blocks[0], (deque->size - untilWrap) * deque->elementSize);
+    }
+
+    free(deque->blocks);
+    deque->blocks = blocks;
+    deque->head = headOffset;
+    deque->blockCount = newBlockCount;
+    deque->capacity = newBlockCount << deque->blockShift;
+    return true;
+}
+
+// ==================== 构造函数和析构函数 ====================
+
+Deque* dequeCreate(size_t elementSize, size_t initialCapacity) {
+    if (elementSize == 0) {
+        return NULL;
+    }
+
+    size_t blockElements = roundUpToPowerOfTwo(DEQUE_BLOCK_BYTES / elementSize);
+    if (blockElements < DEQUE_MIN_BLOCK_ELEMENTS) {
+        blockElements = DEQUE_MIN_BLOCK_ELEMENTS;
+    }
+    if (blockElements > SIZE_MAX / elementSize) {
+        return NULL;
+    }
+
+    // 按块向上取整，块数是2的幂
+    size_t blockCount = roundUpToPowerOfTwo(initialCapacity / blockElements +
+                                            (initialCapacity % blockElements != 0));
+    if (blockCount == 0 || blockCount > SIZE_MAX / sizeof(char*)) {
+        return NULL;
+    }
+
+    Deque* deque = (Deque*)malloc(sizeof(Deque));
+    if (!deque) {
+        return NULL;
+    }
+
+    deque->blocks = (char**)malloc(blockCount * sizeof(char*));
+    if (!deque->blocks) {
+        free(deque);
+        return NULL;
+    }
+    for (size_t i = 0; i < blockCount; i++) {
+        deque->blocks[i] = (char*)malloc(blockElements * elementSize);
+        if (!deque->blocks[i]) {
+            dequeFreeBlocks(deque->blocks, i);
+            free(deque->blocks);
+            free(deque);
+            return NULL;
+        }
+    }
+
+    deque->blockCount = blockCount;
+    deque->blockShift = 0;
+    while (((size_t)1 << deque->blockShift) < blockElements) {
+        deque->blockShift++;
+    }
+    deque->blockMask = blockElements - 1;
+    deque->elementSize = elementSize;
+    deque->head = 0;
+    deque->size = 0;
+    deque->capacity = blockCount << deque->blockShift;
+
+    return deque;
+}
+
+void dequeDestroy(Deque* deque, void (*elementDestructor)(void*)) {
+    if (!deque) {
+        return;
+    }
+
+    dequeClear(deque, elementDestructor);
+    dequeFreeBlocks(deque->blocks, deque->blockCount);
+    free(deque->blocks);
+    free(deque);
+}
+
+// ==================== 访问函数 ====================
+
+void* dequeGet(const Deque* deque, size_t index) {
+    if (!deque || index >= deque->size) {
+        return NULL;
+    }
+    return dequeSlot(deque, index);
+}
+
+void* dequeFront(const Deque* deque) {
+    return dequeGet(deque, 0);
+}
+
+void* dequeBack(const Deque* deque) {
+    if (!deque || deque->size == 0) {
+        return NULL;
+    }
+    return dequeSlot(deque, deque->size - 1);
+}
+
+// ==================== 容量函数 ====================
+
+size_t dequeSize(const Deque* deque) {
+    return deque ? deque->size : 0;
+}
+
+size_t dequeCapacity(const Deque* deque) {
+    return deque ? deque->capacity : 0;
+}
+
+bool dequeIsEmpty(const Deque* deque) {
+    return !deque || deque->size == 0;
+}
+
+bool dequeReserve(Deque* deque, size_t newCapacity) {
+    if (!deque) {
+        return false;
+    }
+    if (newCapacity <= deque->capacity) {
+        return true;
+    }
+
+    size_t blockElements = deque->blockMask + 1;
+    size_t blockCount = roundUpToPowerOfTwo(newCapacity / blockElements +
+                                            (newCapacity % blockElements != 0));
+    if (blockCount == 0) {
+        return false;
+    }
+    return dequeGrowBlocks(deque, blockCount);
+}
+
+bool dequeGrow(Deque* deque) {
+    if (!deque || deque->blockCount > SIZE_MAX / 2) {
+        return false;
+    }
+    if (deque->size < deque->capacity) {
+        return true;
+    }
+    return dequeGrowBlocks(deque, deque->blockCount * 2);
+}
+
+// ==================== 修改函数 ====================
+
+bool dequePushBack(Deque* deque, const void* element) {
+    if (!deque || !element || !dequeReserveOne(deque)) {
+        return false;
+    }
+
+    memcpy(dequeSlot(deque, deque->size), element, deque->elementSize);
+    deque->size++;
+    return true;
+}
+
+bool dequePushFront(Deque* deque, const void* element) {
+    if (!deque || !element || !dequeReserveOne(deque)) {
+        return false;
+    }
+
+    deque->head = (deque->head - 1) & (deque->capacity - 1);
+    memcpy(dequeSlot(deque, 0), element, deque->elementSize);
+    deque->size++;
+    return true;
+}
+
+bool dequePopFront(Deque* deque, void* out) {
+    if (!deque || deque->size == 0) {
+        return false;
+    }
+
+    if (out) {
+        memcpy(out, dequeSlot(deque, 0), deque->elementSize);
+    }
+    deque->head = (deque->head + 1) & (deque->capacity - 1);
+    deque->size--;
+    return true;
+}
+
+bool dequePopBack(Deque* deque, void* out) {
+    if (!deque || deque->size == 0) {
+        return false;
+    }
+
+    if (out) {
+        memcpy(out, dequeSlot(deque, deque->size - 1), deque->elementSize);
+    }
+    deque->size--;
+    return true;
+}
+
+void dequeClear(Deque* deque, void (*elementDestructor)(void*)) {
+    if (!deque) {
+        return;
+    }
+
+    // 调用元素析构函数
+    if (elementDestructor) {
+        for (size_t i = 0; i < deque->size; i++) {
+            elementDestructor(dequeSlot(deque, i));
+        }
+    }
+
+    deque->head = 0;
+    deque->size = 0;
+}
@@ -0,0 +1,181 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @brief Deque双端队列结构体
+ *
+ * 分块的环形缓冲区，两端的插入和删除都是均摊O(1)，用作广度优先遍历、
+ * 工作表等先进先出的队列（Vector从头部删除要移动全部元素）。
+ *
+ * 元素存放在大小相同的块中，块指针组成一个环（块表）。块数和每块的
+ * 元素数都是2的幂，元素位置用掩码回绕，再用移位和掩码拆成块号和块内下标。
+ * 扩容时块数翻倍：只搬动块指针并分配新块，不复制元素；只有队尾回绕到
+ * 队首所在的块里时，才把这不到一块的元素复制到新块中。
+ * 不需要一整块连续的大内存。
+ */
+typedef struct {
+    char** blocks;       // 块表（块指针的环形数组）
+    size_t blockCount;   // 块数（2的幂）
+    size_t blockShift;   // 每块元素数的以2为底的对数
+    size_t blockMask;    // 每块元素数减1
+    size_t elementSize;  // 每个元素的大小（字节）
+    size_t head;         // 队首元素的位置
+    size_t size;         // 当前元素数量
+    size_t capacity;     // 当前容量（块数乘以每块元素数）
+} Deque;
+
+// ==================== 构造函数和析构函数 ====================
+
+/**
+ * @brief 创建Deque
+ * @param elementSize 每个元素的大小（字节）
+ * @param initialCapacity 初始容量（0表示只分配一块，其他值向上取整为整数个块）
+ * @return 新创建的Deque，失败返回NULL
+ */
+Deque* dequeCreate(size_t elementSize, size_t initialCapacity);
+
+/**
+ * @brief 销毁Deque
+ * @param deque 要销毁的Deque
+ * @param elementDestructor 元素析构函数（可为NULL）
+ */
+void dequeDestroy(Deque* deque, void (*elementDestructor)(void*));
+
+// ==================== 访问函数 ====================
+
+/**
+ * @brief 获取从队首数起第index个元素
+ * @param deque Deque
+ * @param index 下标（0为队首）
+ * @return 元素指针，越界返回NULL
+ */
+void* dequeGet(const Deque* deque, size_t index);
+
+/**
+ * @brief 获取队首元素
+ * @return 元素指针，为空返回NULL
+ */
+void* dequeFront(const Deque* deque);
+
+/**
+ * @brief 获取队尾元素
+ * @return 元素指针，为空返回NULL
+ */
+void* dequeBack(const Deque* deque);
+
+// ==================== 容量函数 ====================
+
+/**
+ * @brief 获取元素数量
+ */
+size_t dequeSize(const Deque* deque);
+
+/**
+ * @brief 获取容量
+ */
+size_t dequeCapacity(const Deque* deque);
+
+/**
+ * @brief 检查是否为空
+ */
+bool dequeIsEmpty(const Deque* deque);
+
+/**
+ * @brief 预留容量
+ * @param deque Deque
+ * @param newCapacity 至少要容纳的元素数
+ * @return 成功返回true，失败返回false
+ */
+bool dequeReserve(Deque* deque, size_t newCapacity);
+
+/**
+ * @brief 扩容，使Deque至少还能再容纳一个元素
+ *
+ * 供dequeReserveOne在容量不足时调用。
+ *
+ * @return 成功返回true，失败返回false
+ */
+bool dequeGrow(Deque* deque);
+
+/**
+ * @brief 确保还能再放一个元素（容量足够时不调用函数）
+ */
+static inline bool dequeReserveOne(Deque* deque) {
+    return deque->size < deque->capacity || dequeGrow(deque);
+}
+
+// ==================== 修改函数 ====================
+
+/**
+ * @brief 在队尾添加元素
+ * @return 成功返回true，失败返回false
+ */
+bool dequePushBack(Deque* deque, const void* element);
+
+/**
+ * @brief 在队首添加元素
+ * @return 成功返回true，失败返回false
+ */
+bool dequePushFront(Deque* deque, const void* element);
+
+/**
+ * @brief 移除队首元素
+ * @param deque Deque
+ * @param out 接收被移除的元素（可为NULL）
+ * @return 成功返回true，为空返回false
+ */
+bool dequePopFront(Deque* deque, void* out);
+
+/**
+ * @brief 移除队尾元素
+ * @param deque Deque
+ * @param out 接收被移除的元素（可为NULL）
+ * @return 成功返回true，为空返回false
+ */
+bool dequePopBack(Deque* deque, void* out);
+
+/**
+ * @brief 清空Deque
+ * @param deque Deque
+ * @param elementDestructor 元素析构函数（可为NULL）
+ */
+void dequeClear(Deque* deque, void (*elementDestructor)(void*));
+
+// ==================== 类型化访问宏 ====================
+//
+// 元素类型在编译期已知时使用，编译为直接的读写而不是按elementSize的memcpy。
+// type必须与创建时的elementSize一致；deque参数会被求值多次。
+
+/**
+ * @brief 第index个元素在环上的位置
+ */
+#define DEQUE_POSITION(deque, index) (((deque)->head + (index)) & ((deque)->capacity - 1))
+
+/**
+ * @brief 第index个元素（左值，不检查越界）
+ */
+#define DEQUE_AT(deque, type, index) \
+    (((type*)(deque)->blocks[DEQUE_POSITION(deque, index) >> (deque)->blockShift]) \
+        [DEQUE_POSITION(deque, index) & (deque)->blockMask])
+
+/**
+ * @brief 在队尾添加一个type类型的值
+ * @return 成功为true，扩容失败为false
+ */
+#define DEQUE_PUSH_BACK(deque, type, value) \
+    (dequeReserveOne(deque) \
+        ? (DEQUE_AT(deque, type, (deque)->size) = (value), (deque)->size++, true) \
+        : false)
+
+/**
+ * @brief 取出队首的type类型的值（Deque不能为空）
+ */
+#define DEQUE_POP_FRONT(deque, type) \
+    ((deque)->size--, \
+     (deque)->head = ((deque)->head + 1) & ((deque)->capacity - 1), \
+     DEQUE_AT(deque, type, (deque)->capacity - 1))
+
+#endif // DEQUE_H
@@ -3,6 +3,8 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdint.h>  // 用于SIZE_MAX
+#include <stdalign.h>
+#include "../utils/memory_pool.h"
 
 // 默认初始容量
 #define DEFAULT_CAPACITY 4
@@ -10,6 +12,10 @@
 // 扩容因子
 #define GROWTH_FACTOR 2
 
+// vectorCreate把内联缓冲区放在结构体之后，按最严格的对齐要求对齐
+#define VECTOR_HEADER_SIZE \
+    ((sizeof(Vector) + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1))
+
 // ==================== 内部辅助函数 ====================
 
 /**
@@ -21,6 +27,47 @@ static inline size_t calculateNewCapacity(size_t currentCapacity) {
     return newCapacity == 0 ? DEFAULT_CAPACITY : newCapacity;
 }
 
+/**
+ * @brief 元素是否存放在内联缓冲区中
+ */
+static inline bool vectorIsInline(const Vector* vector) {
+    return vector->inlineBuffer && vector->data == vector->inlineBuffer;
+}
+
+/**
+ * @brief 把元素数组换成容量为newCapacity的堆内存
+ *
+ * 元素在内联缓冲区中时复制到新分配的内存，否则直接realloc。
+ */
+static bool vectorReallocate(Vector* vector, size_t newCapacity) {
+    if (newCapacity > SIZE_MAX / vector->elementSize) {
+        return false;
+    }
+
+    void* newData;
+    if (vector->pool) {
+        // 内存池中的旧数组无法单独归还，随内存池一起释放
+        newData = memoryPoolAlloc(vector->pool, newCapacity * vector->elementSize);
+        if (newData && vector->size > 0) {
+            memcpy(newData, vector->data, vector->size * vector->elementSize);
+        }
+    } else if (vectorIsInline(vector)) {
+        newData = malloc(newCapacity * vector->elementSize);
+        if (newData && vector->size > 0) {
+            memcpy(newData, vector->data, vector->size * vector->elementSize);
+        }
+    } else {
+        newData = realloc(vector->data, newCapacity * vector->elementSize);
+    }
+    if (!newData) {
+        return false;
+    }
+
+    vector->data = newData;
+    vector->capacity = newCapacity;
+    return true;
+}
+
 /**
  * @brief 检查并确保Vector有足够的容量
  * @return 成功返回true，失败返回false
@@ -37,16 +84,28 @@ static bool vectorEnsureCapacity(Vector* vector, size_t requiredCapacity) {
         newCapacity = calculateNewCapacity(newCapacity);
     }
 
-    // 重新分配内存
-    void* newData = realloc(vector->data, newCapacity * vector->elementSize);
-    if (!newData) {
-        return false;
-    }
+    return vectorReallocate(vector, newCapacity);
+}
 
-    vector->data = newData;
-    vector->capacity = newCapacity;
+/**
+ * @brief 释放堆上的元素数组（内联缓冲区随结构体一起释放）
+ */
+static void vectorFreeData(Vector* vector) {
+    if (!vector->pool && !vectorIsInline(vector)) {
+        free(vector->data);
+    }
+}
 
-    return true;
+/**
+ * @brief 对每个元素调用析构函数
+ */
+static void vectorDestroyElements(Vector* vector, void (*elementDestructor)(void*)) {
+    if (!elementDestructor) {
+        return;
+    }
+    for (size_t i = 0; i < vector->size; i++) {
+        elementDestructor((char*)vector->data + i * vector->elementSize);
+    }
 }
 
 // ==================== 构造函数和析构函数 ====================
@@ -56,48 +115,99 @@ Vector* vectorCreate(size_t elementSize, size_t initialCapacity) {
         return NULL;
     }
 
-    Vector* vector = (Vector*)malloc(sizeof(Vector));
+    // 使用默认容量或指定容量
+    size_t capacity = (initialCapacity == 0) ? DEFAULT_CAPACITY : initialCapacity;
+    if (capacity > (SIZE_MAX - VECTOR_HEADER_SIZE) / elementSize) {
+        return NULL;
+    }
+
+    // 结构体和初始容量的元素一次分配
+    Vector* vector = (Vector*)malloc(VECTOR_HEADER_SIZE + capacity * elementSize);
     if (!vector) {
         return NULL;
     }
 
-    // 使用默认容量或指定容量
+    vector->inlineBuffer = (char*)vector + VECTOR_HEADER_SIZE;
+    vector->inlineCapacity = capacity;
+    vector->data = vector->inlineBuffer;
+    vector->elementSize = elementSize;
+    vector->size = 0;
+    vector->capacity = capacity;
+    vector->pool = NULL;
+
+    return vector;
+}
+
+Vector* vectorCreateInPool(MemoryPool* pool, size_t elementSize, size_t initialCapacity) {
+    if (!pool || elementSize == 0) {
+        return NULL;
+    }
+
     size_t capacity = (initialCapacity == 0) ? DEFAULT_CAPACITY : initialCapacity;
+    if (capacity > (SIZE_MAX - VECTOR_HEADER_SIZE) / elementSize) {
+        return NULL;
+    }
 
-    // 分配元素数组
-    vector->data = malloc(capacity * elementSize);
-    if (!vector->data) {
-        free(vector);
+    Vector* vector = (Vector*)memoryPoolAlloc(pool, VECTOR_HEADER_SIZE + capacity * elementSize);
+    if (!vector) {
         return NULL;
     }
 
+    vector->inlineBuffer = (char*)vector + VECTOR_HEADER_SIZE;
+    vector->inlineCapacity = capacity;
+    vector->data = vector->inlineBuffer;
     vector->elementSize = elementSize;
     vector->size = 0;
     vector->capacity = capacity;
+    vector->pool = pool;
 
     return vector;
 }
 
+bool vectorInitWithBuffer(Vector* vector, size_t elementSize, void* buffer, size_t bufferCapacity) {
+    if (!vector || elementSize == 0) {
+        return false;
+    }
+
+    vector->inlineBuffer = bufferCapacity > 0 ? buffer : NULL;
+    vector->inlineCapacity = vector->inlineBuffer ? bufferCapacity : 0;
+    vector->data = vector->inlineBuffer;
+    vector->elementSize = elementSize;
+    vector->size = 0;
+    vector->capacity = vector->inlineCapacity;
+    vector->pool = NULL;
+    return true;
+}
+
+void vectorRelease(Vector* vector, void (*elementDestructor)(void*)) {
+    if (!vector) {
+        return;
+    }
+
+    vectorDestroyElements(vector, elementDestructor);
+    vectorFreeData(vector);
+
+    // 回到只用内联缓冲区的状态，可以继续使用
+    vector->data = vector->inlineBuffer;
+    vector->size = 0;
+    vector->capacity = vector->inlineCapacity;
+}
+
 void vectorDestroy(Vector* vector, void (*elementDestructor)(void*)) {
     if (!vector) {
         return;
     }
 
     // 如果有元素析构函数，先调用它
-    if (elementDestructor && vector->size > 0) {
-        for (size_t i = 0; i < vector->size; i++) {
-            void* element = (char*)vector->data + i * vector->elementSize;
-            elementDestructor(element);
-        }
-    }
+    vectorDestroyElements(vector, elementDestructor);
 
-    // 释放元素数组
-    if (vector->data) {
-        free(vector->data);
-    }
+    // 释放堆上的元素数组，内联缓冲区随结构体一起释放
+    vectorFreeData(vector);
 
-    // 释放Vector结构体
-    free(vector);
+    // 释放Vector结构体（内存池中的结构体随内存池一起释放）
+    if (!vector->pool) {
+        free(vector);
+    }
 }
 
 // ==================== 元素访问 ====================
@@ -144,16 +254,7 @@ bool vectorReserve(Vector* vector, size_t newCapacity) {
         return false;
     }
 
-    // 重新分配内存
-    void* newData = realloc(vector->data, newCapacity * vector->elementSize);
-    if (!newData) {
-        return false;
-    }
-
-    vector->data = newData;
-    vector->capacity = newCapacity;
-
-    return true;
+    return vectorReallocate(vector, newCapacity);
 }
 
 bool vectorResize(Vector* vector, size_t newSize, const void* value) {
@@ -188,10 +289,21 @@ bool vectorResize(Vector* vector, size_t newSize, const void* value) {
 }
 
 bool vectorShrinkToFit(Vector* vector) {
-    if (!vector || vector->size == vector->capacity) {
+    if (!vector || vector->size == vector->capacity || vectorIsInline(vector) || vector->pool) {
         return false;
     }
 
+    // 元素放得进内联缓冲区时搬回去，释放堆内存
+    if (vector->inlineBuffer && vector->size <= vector->inlineCapacity) {
+        if (vector->size > 0) {
+            memcpy(vector->inlineBuffer, vector->data, vector->size * vector->elementSize);
+        }
+        free(vector->data);
+        vector->data = vector->inlineBuffer;
+        vector->capacity = vector->inlineCapacity;
+        return true;
+    }
+
     // 如果Vector为空，释放所有内存
     if (vector->size == 0) {
         free(vector->data);
@@ -219,18 +331,42 @@ bool vectorPushBack(Vector* vector, const void* element) {
         return false;
     }
 
-    // 确保有足够的容量
-    if (!vectorEnsureCapacity(vector, vector->size + 1)) {
+    // 确保有足够的容量，复制元素到末尾
+    void* dest = vectorEmplaceBack(vector);
+    if (!dest) {
         return false;
     }
-
-    // 复制元素到末尾
-    void* dest = (char*)vector->data + vector->size * vector->elementSize;
     memcpy(dest, element, vector->elementSize);
 
+    return true;
+}
+
+void* vectorEmplaceBack(Vector* vector) {
+    if (!vector || !vectorReserveBack(vector)) {
+        return NULL;
+    }
+    return (char*)vector->data + vector->size++ * vector->elementSize;
+}
+
+void* vectorEmplace(Vector* vector, size_t index) {
+    if (!vector || index > vector->size || !vectorReserveBack(vector)) {
+        return NULL;
+    }
+
+    // 移动元素为新元素腾出空间
+    char* slot = (char*)vector->data + index * vector->elementSize;
+    if (index < vector->size) {
+        memmove(slot + vector->elementSize, slot, (vector->size - index) * vector->elementSize);
+    }
     vector->size++;
+    return slot;
+}
 
-    return true;
+bool vectorGrow(Vector* vector) {
+    if (!vector) {
+        return false;
+    }
+    return vectorEnsureCapacity(vector, vector->size + 1);
 }
 
 bool vectorPopBack(Vector* vector, void (*elementDestructor)(void*)) {
@@ -250,29 +386,17 @@ bool vectorPopBack(Vector* vector, void (*elementDestructor)(void*)) {
 }
 
 bool vectorInsert(Vector* vector, size_t index, const void* element) {
-    if (!vector || !element || index > vector->size) {
+    if (!vector || !element) {
         return false;
     }
 
-    // 确保有足够的容量
-    if (!vectorEnsureCapacity(vector, vector->size + 1)) {
+    // 腾出位置后插入新元素
+    void* dest = vectorEmplace(vector, index);
+    if (!dest) {
         return false;
     }
-
-    // 移动元素为新元素腾出空间
-    if (index < vector->size) {
-        void* dest = (char*)vector->data + (index + 1) * vector->elementSize;
-        void* src = (char*)vector->data + index * vector->elementSize;
-        size_t moveSize = (vector->size - index) * vector->elementSize;
-        memmove(dest, src, moveSize);
-    }
-
-    // 插入新元素
-    void* dest = (char*)vector->data + index * vector->elementSize;
     memcpy(dest, element, vector->elementSize);
 
-    vector->size++;
-
     return true;
 }
 
@@ -306,12 +430,7 @@ void vectorClear(Vector* vector, void (*elementDestructor)(void*)) {
     }
 
     // 调用元素析构函数
-    if (elementDestructor && vector->size > 0) {
-        for (size_t i = 0; i < vector->size; i++) {
-            void* element = (char*)vector->data + i * vector->elementSize;
-            elementDestructor(element);
-        }
-    }
+    vectorDestroyElements(vector, elementDestructor);
 
     vector->size = 0;
 }
@@ -366,13 +485,26 @@ void vectorForEachConst(const Vector* vector, void (*action)(const void*)) {
 // ==================== 实用函数 ====================
 
 void vectorSwap(Vector* vector1, Vector* vector2) {
-    if (!vector1 || !vector2) {
+    // 元素数组属于各自的内存池（或堆），不能跨分配器交换
+    if (!vector1 || !vector2 || vector1->pool != vector2->pool) {
+        return;
+    }
+
+    // 内联缓冲区属于各自的结构体，不能交换；先把内联的元素搬到堆上
+    if ((vectorIsInline(vector1) && !vectorReallocate(vector1, vector1->capacity)) ||
+        (vectorIsInline(vector2) && !vectorReallocate(vector2, vector2->capacity))) {
         return;
     }
 
     Vector temp = *vector1;
-    *vector1 = *vector2;
-    *vector2 = temp;
+    vector1->data = vector2->data;
+    vector1->elementSize = vector2->elementSize;
+    vector1->size = vector2->size;
+    vector1->capacity = vector2->capacity;
+    vector2->data = temp.data;
+    vector2->elementSize = temp.elementSize;
+    vector2->size = temp.size;
+    vector2->capacity = temp.capacity;
 }
 
 void vectorReverse(Vector* vector) {
@@ -3,29 +3,76 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include "../utils/memory_pool.h"
 
 /**
  * @brief Vector动态数组结构体
  * 
- * 泛型动态数组，可存储任意类型的数据
+ * 泛型动态数组，可存储任意类型的数据。
+ *
+ * 初始容量内的元素直接存放在内联缓冲区中：vectorCreate把它和结构体本身
+ * 放在同一次分配里，vectorInitWithBuffer则使用调用者提供的缓冲区（如栈上
+ * 数组）。元素超过内联容量时才搬到堆上，AST中大量只有几个元素的数组
+ * （实参列表、复合语句、结构体成员）因此只需要一次分配。
  */
 typedef struct {
-    void* data;          // 指向元素数组的指针
+    void* data;          // 指向元素数组的指针（内联缓冲区或堆内存）
     size_t elementSize;  // 每个元素的大小（字节）
     size_t size;         // 当前元素数量
     size_t capacity;     // 当前容量（可容纳的元素数）
+    void* inlineBuffer;  // 内联缓冲区（没有时为NULL），不单独释放
+    size_t inlineCapacity;  // 内联缓冲区可容纳的元素数
+    MemoryPool* pool;    // 分配所用的内存池（NULL表示堆）
 } Vector;
 
 // ==================== 构造函数和析构函数 ====================
 
 /**
  * @brief 创建Vector
+ *
+ * 初始容量的元素存放在与结构体一起分配的内联缓冲区中，只分配一次内存。
+ *
  * @param elementSize 每个元素的大小（字节）
  * @param initialCapacity 初始容量（0表示使用默认值4）
  * @return 新创建的Vector，失败返回NULL
  */
 Vector* vectorCreate(size_t elementSize, size_t initialCapacity);
 
+/**
+ * @brief 在内存池中创建Vector
+ *
+ * 结构体、内联缓冲区和扩容后的元素数组都从内存池分配，扩容时旧数组
+ * 留在池中不归还。vectorDestroy只调用元素析构函数，不释放内存，
+ * 内存随内存池的回滚或重置一次性释放。适合与AST等同一阶段的对象共存亡。
+ *
+ * @param pool 内存池
+ * @param elementSize 每个元素的大小（字节）
+ * @param initialCapacity 初始容量（0表示使用默认值4）
+ * @return 新创建的Vector，失败返回NULL
+ */
+Vector* vectorCreateInPool(MemoryPool* pool, size_t elementSize, size_t initialCapacity);
+
+/**
+ * @brief 在调用者提供的存储上初始化Vector
+ *
+ * 结构体和缓冲区都由调用者持有（通常在栈上或嵌入在其他结构体中），
+ * 元素不超过bufferCapacity时完全不分配内存。用完后调用vectorRelease。
+ *
+ * @param vector 要初始化的Vector
+ * @param elementSize 每个元素的大小（字节）
+ * @param buffer 内联缓冲区（可为NULL，此时第一次添加元素时在堆上分配）
+ * @param bufferCapacity 缓冲区可容纳的元素数
+ * @return 成功返回true，参数无效返回false
+ */
+bool vectorInitWithBuffer(Vector* vector, size_t elementSize, void* buffer, size_t bufferCapacity);
+
+/**
+ * @brief 释放vectorInitWithBuffer初始化的Vector占用的堆内存
+ * @param vector Vector（结构体本身不释放）
+ * @param elementDestructor 元素析构函数（可为NULL）
+ */
+void vectorRelease(Vector* vector, void (*elementDestructor)(void*));
+
 /**
  * @brief 销毁Vector
  * @param vector 要销毁的Vector
@@ -107,7 +154,7 @@ bool vectorResize(Vector* vector, size_t newSize, const void* value);
 /**
  * @brief 请求移除未使用的容量
  * @param vector Vector
- * @return 成功返回true，失败返回false
+ * @return 成功返回true，失败（或Vector在内存池中）返回false
  */
 bool vectorShrinkToFit(Vector* vector);
 
@@ -121,6 +168,42 @@ bool vectorShrinkToFit(Vector* vector);
  */
 bool vectorPushBack(Vector* vector, const void* element);
 
+/**
+ * @brief 在末尾追加一个未初始化的元素
+ *
+ * 返回新元素的位置，由调用者直接在其中构造，省去先构造临时对象再复制。
+ * 返回的指针在下一次改变容量的操作之前有效。
+ *
+ * @param vector Vector
+ * @return 新元素的指针，扩容失败返回NULL
+ */
+void* vectorEmplaceBack(Vector* vector);
+
+/**
+ * @brief 在指定位置插入一个未初始化的元素
+ * @param vector Vector
+ * @param index 插入位置
+ * @return 新元素的指针，越界或扩容失败返回NULL
+ */
+void* vectorEmplace(Vector* vector, size_t index);
+
+/**
+ * @brief 扩容，使Vector至少还能再容纳一个元素
+ *
+ * 供vectorReserveBack在容量不足时调用。
+ *
+ * @param vector Vector
+ * @return 成功返回true，失败返回false
+ */
+bool vectorGrow(Vector* vector);
+
+/**
+ * @brief 确保末尾还能再放一个元素（容量足够时不调用函数）
+ */
+static inline bool vectorReserveBack(Vector* vector) {
+    return vector->size < vector->capacity || vectorGrow(vector);
+}
+
 /**
  * @brief 移除末尾元素
  * @param vector Vector
@@ -196,6 +279,9 @@ void vectorForEachConst(const Vector* vector, void (*action)(const void*));
 
 /**
  * @brief 交换两个Vector的内容
+ *
+ * 两个Vector必须来自同一个内存池（或都在堆上），否则不交换。
+ *
  * @param vector1 第一个Vector
  * @param vector2 第二个Vector
  */
@@ -214,4 +300,28 @@ void vectorReverse(Vector* vector);
  */
 void vectorSort(Vector* vector, int (*comparator)(const void*, const void*));
 
+// ==================== 类型化访问宏 ====================
+//
+// 元素类型在编译期已知时使用，编译为直接的读写而不是按elementSize的memcpy。
+// type必须与创建时的elementSize一致；vector参数会被求值多次。
+
+/**
+ * @brief 在末尾添加一个type类型的值
+ * @return 成功为true，扩容失败为false
+ */
+#define VECTOR_PUSH_BACK(vector, type, value) \
+    (vectorReserveBack(vector) \
+        ? (((type*)(vector)->data)[(vector)->size++] = (value), true) \
+        : false)
+
+/**
+ * @brief 第index个元素（左值，不检查越界）
+ */
+#define VECTOR_AT(vector, type, index) (((type*)(vector)->data)[index])
+
+/**
+ * @brief 最后一个元素（左值，Vector不能为空）
+ */
+#define VECTOR_BACK(vector, type) (((type*)(vector)->data)[(vector)->size - 1])
+
 #endif // VECTOR_H
@@ -34,13 +34,17 @@ char* formatDiagnostic(const Diagnostic* diagnostic) {
         return NULL;
     }
 
-    // 格式化消息
-    if (diagnostic->location.filename) {
+    // 格式化消息（文件名和行列号按需从源管理器解析）
+    const char* filename = sourceLocationGetFilename(&diagnostic->location);
+    int line = 0;
+    int column = 0;
+    sourceLocationResolve(&diagnostic->location, &line, &column);
+    if (filename) {
         snprintf(buffer, bufferSize,
                 "%s:%d:%d: %s: %s",
-                diagnostic->location.filename,
-                diagnostic->location.line,
-                diagnostic->location.column,
+                filename,
+                line,
+                column,
                 diagnosticLevelToString(diagnostic->level),
                 diagnostic->message);
     } else {
@@ -328,6 +332,27 @@ void diagnosticEngineReport(DiagnosticEngine* engine,
     }
 }
 
+void diagnosticEngineEmitDiagnostic(DiagnosticEngine* engine,
+                                    DiagnosticLevel level,
+                                    const char* message,
+                                    SourceLocation location,
+                                    const char* subject,
+                                    int code) {
+    if (!message) {
+        return;
+    }
+
+    if (subject && code) {
+        diagnosticEngineReport(engine, level, location, "%s: %s [%d]", message, subject, code);
+    } else if (subject) {
+        diagnosticEngineReport(engine, level, location, "%s: %s", message, subject);
+    } else if (code) {
+        diagnosticEngineReport(engine, level, location, "%s [%d]", message, code);
+    } else {
+        diagnosticEngineReport(engine, level, location, "%s", message);
+    }
+}
+
 size_t diagnosticEngineGetErrorCount(const DiagnosticEngine* engine) {
     return engine ? engine->errorCount : 0;
 }
@@ -91,12 +91,30 @@ void diagnosticEngineReport(DiagnosticEngine* engine,
                            const char* format,
                            ...);
 
+/**
+ * @brief 报告一条固定文本的诊断消息
+ * @param engine 诊断引擎
+ * @param level 诊断级别
+ * @param message 消息文本（不作为格式字符串解释）
+ * @param location 源位置
+ * @param subject 消息涉及的名称（可为NULL），附加在消息之后
+ * @param code 诊断编号（0表示无编号）
+ */
+void diagnosticEngineEmitDiagnostic(DiagnosticEngine* engine,
+                                    DiagnosticLevel level,
+                                    const char* message,
+                                    SourceLocation location,
+                                    const char* subject,
+                                    int code);
+
 /**
  * @brief 报告错误
  */
 static inline void diagnosticEngineError(DiagnosticEngine* engine,
                                        SourceLocation location,
                                        const char* format, ...) {
+    (void)engine;
+    (void)location;
     va_list args;
     va_start(args, format);
     // diagnosticEngineReport实现需要处理可变参数
@@ -109,6 +127,8 @@ static inline void diagnosticEngineError(DiagnosticEngine* engine,
 static inline void diagnosticEngineWarning(DiagnosticEngine* engine,
                                          SourceLocation location,
                                          const char* format, ...) {
+    (void)engine;
+    (void)location;
     va_list args;
     va_start(args, format);
     va_end(args);
@@ -120,6 +140,8 @@ static inline void diagnosticEngineWarning(DiagnosticEngine* engine,
 static inline void diagnosticEngineNote(DiagnosticEngine* engine,
                                       SourceLocation location,
                                       const char* format, ...) {
+    (void)engine;
+    (void)location;
     va_list args;
     va_start(args, format);
     va_end(args);
@@ -0,0 +1,265 @@
+#include "line_index.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ==================== 平台检测 ====================
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LINE_INDEX_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(LINE_INDEX_SSE2) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define LINE_INDEX_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// 每次比较的字节数（掩码的位数）
+#define LINE_INDEX_BLOCK 32
+
+// ==================== 内部辅助函数 ====================
+
+static inline unsigned lineIndexCountTrailingZeros(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctz(mask);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (unsigned)index;
+#else
+    unsigned index = 0;
+    while (!(mask & 1u)) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+static inline unsigned lineIndexPopcount(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_popcount(mask);
+#else
+    mask = mask - ((mask >> 1) & 0x55555555u);
+    mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+    return (unsigned)((((mask + (mask >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+#endif
+}
+
+#if defined(LINE_INDEX_AVX2)
+__attribute__((target("avx2")))
+static uint32_t lineIndexNewlineMaskAvx2(const char* p) {
+    __m256i bytes = _mm256_loadu_si256((const __m256i*)p);
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\n')));
+}
+#endif
+
+/**
+ * @brief 32字节块中换行符的位掩码
+ */
+static inline uint32_t lineIndexNewlineMask(const char* p, bool useAvx2) {
+#if defined(LINE_INDEX_AVX2)
+    if (useAvx2) {
+        return lineIndexNewlineMaskAvx2(p);
+    }
+#else
+    (void)useAvx2;
+#endif
+#if defined(LINE_INDEX_SSE2)
+    const __m128i newline = _mm_set1_epi8('\n');
+    uint32_t low = (uint32_t)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)p), newline));
+    uint32_t high = (uint32_t)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + 16)), newline));
+    return low | (high << 16);
+#else
+    uint32_t mask = 0;
+    for (unsigned i = 0; i < LINE_INDEX_BLOCK; i++) {
+        mask |= (uint32_t)(p[i] == '\n') << i;
+    }
+    return mask;
+#endif
+}
+
+// ==================== 构造函数和析构函数 ====================
+
+LineIndex* createLineIndex(const char* data, size_t length) {
+    if ((!data && length > 0) || length > UINT32_MAX) {
+        return NULL;
+    }
+
+#if defined(LINE_INDEX_AVX2)
+    bool useAvx2 = __builtin_cpu_supports("avx2");
+#else
+    bool useAvx2 = false;
+#endif
+    size_t blockEnd = length - length % LINE_INDEX_BLOCK;
+
+    // 第一遍：统计换行数量
+    size_t newlines = 0;
+    for (size_t i = 0; i < blockEnd; i += LINE_INDEX_BLOCK) {
+        newlines += lineIndexPopcount(lineIndexNewlineMask(data + i, useAvx2));
+    }
+    for (size_t i = blockEnd; i < length; i++) {
+        newlines += data[i] == '\n';
+    }
+
+    LineIndex* index = (LineIndex*)malloc(sizeof(LineIndex));
+    if (!index) {
+        return NULL;
+    }
+    index->lineStarts = (uint32_t*)malloc((newlines + 1) * sizeof(uint32_t));
+    if (!index->lineStarts) {
+        free(index);
+        return NULL;
+    }
+
+    // 第二遍：逐位取出换行位置，下一行从换行之后开始
+    uint32_t* out = index->lineStarts;
+    *out++ = 0;
+    for (size_t i = 0; i < blockEnd; i += LINE_INDEX_BLOCK) {
+        uint32_t mask = lineIndexNewlineMask(data + i, useAvx2);
+        while (mask) {
+            *out++ = (uint32_t)(i + lineIndexCountTrailingZeros(mask) + 1);
+            mask &= mask - 1;
+        }
+    }
+    for (size_t i = blockEnd; i < length; i++) {
+        if (data[i] == '\n') {
+            *out++ = (uint32_t)(i + 1);
+        }
+    }
+
+    index->lineCount = (uint32_t)(newlines + 1);
+    index->lineCapacity = index->lineCount;
+    return index;
+}
+
+void destroyLineIndex(LineIndex* index) {
+    if (!index) {
+        return;
+    }
+    free(index->lineStarts);
+    free(index);
+}
+
+// ==================== 编辑 ====================
+
+/**
+ * @brief 第一个起始偏移大于offset的行的下标（没有时为lineCount）
+ */
+static uint32_t lineIndexUpperBound(const LineIndex* index, size_t offset) {
+    uint32_t low = 0;
+    uint32_t high = index->lineCount;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if (index->lineStarts[mid] <= offset) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+bool lineIndexApplyEdit(LineIndex* index, const char* data, size_t length,
+                        size_t offset, size_t removedLength, size_t insertedLength) {
+    if (!index || (!data && length > 0) || length > UINT32_MAX ||
+        insertedLength > length || offset > length - insertedLength) {
+        return false;
+    }
+    size_t oldLength = length - insertedLength + removedLength;
+    if (oldLength > UINT32_MAX || removedLength > oldLength - offset) {
+        return false;
+    }
+
+    // 起始偏移落在(offset, offset + removedLength]内的行，其换行被删掉了
+    uint32_t first = lineIndexUpperBound(index, offset);
+    uint32_t last = lineIndexUpperBound(index, offset + removedLength);
+
+    const char* inserted = data + offset;
+    size_t added = 0;
+    for (size_t i = 0; i < insertedLength; i++) {
+        added += inserted[i] == '\n';
+    }
+
+    size_t newCount = (size_t)index->lineCount - (last - first) + added;
+    if (newCount > UINT32_MAX) {
+        return false;
+    }
+    if (newCount > index->lineCapacity) {
+        size_t newCapacity = (size_t)index->lineCapacity * 2;
+        if (newCapacity < newCount) {
+            newCapacity = newCount;
+        }
+        if (newCapacity > UINT32_MAX) {
+            newCapacity = UINT32_MAX;
+        }
+        uint32_t* lineStarts = (uint32_t*)realloc(index->lineStarts, newCapacity * sizeof(uint32_t));
+        if (!lineStarts) {
+            return false;
+        }
+        index->lineStarts = lineStarts;
+        index->lineCapacity = (uint32_t)newCapacity;
+    }
+
+    // 编辑区之后的行整体移动，起始偏移按长度差平移（无符号回绕，结果必然在范围内）
+    uint32_t* tail = index->lineStarts + first + added;
+    uint32_t tailCount = index->lineCount - last;
+    memmove(tail, index->lineStarts + last, tailCount * sizeof(uint32_t));
+    uint32_t delta = (uint32_t)insertedLength - (uint32_t)removedLength;
+    for (uint32_t i = 0; i < tailCount; i++) {
+        tail[i] += delta;
+    }
+
+    // 填入插入文本中换行之后的行
+    uint32_t* out = index->lineStarts + first;
+    for (size_t i = 0; i < insertedLength; i++) {
+        if (inserted[i] == '\n') {
+            *out++ = (uint32_t)(offset + i + 1);
+        }
+    }
+
+    index->lineCount = (uint32_t)newCount;
+    return true;
+}
+
+// ==================== 查询 ====================
+
+bool lineIndexLookup(const LineIndex* index, uint32_t offset, int* line, int* column) {
+    if (!index) {
+        return false;
+    }
+
+    // 二分查找最后一个起始偏移不大于offset的行
+    uint32_t low = 0;
+    uint32_t high = index->lineCount;
+    while (high - low > 1) {
+        uint32_t mid = low + (high - low) / 2;
+        if (index->lineStarts[mid] <= offset) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+
+    if (line) {
+        *line = (int)low + 1;
+    }
+    if (column) {
+        *column = (int)(offset - index->lineStarts[low]) + 1;
+    }
+    return true;
+}
+
+uint32_t lineIndexGetLineStart(const LineIndex* index, int line) {
+    if (!index || line < 1 || (uint32_t)line > index->lineCount) {
+        return UINT32_MAX;
+    }
+    return index->lineStarts[line - 1];
+}
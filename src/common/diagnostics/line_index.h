@@ -0,0 +1,70 @@
+#ifndef LINE_INDEX_H
+#define LINE_INDEX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief 行起始偏移索引
+ *
+ * 记录每一行第一个字节在文件中的偏移，用二分查找把字节偏移换算为行列号。
+ * 构建时用SIMD一次比较16/32个字节找换行符，先用popcount统计行数以便一次
+ * 分配到位，再按位取出每个换行的位置。
+ */
+typedef struct {
+    uint32_t* lineStarts;   // 每行起始偏移，lineStarts[0]恒为0
+    uint32_t lineCount;     // 行数（至少为1）
+    uint32_t lineCapacity;  // lineStarts的容量（编辑时原地增删行）
+} LineIndex;
+
+/**
+ * @brief 扫描源码建立行索引
+ * @param data 源码
+ * @param length 源码长度（不能超过UINT32_MAX）
+ * @return 新建的行索引，失败返回NULL
+ */
+LineIndex* createLineIndex(const char* data, size_t length);
+
+/**
+ * @brief 销毁行索引
+ * @param index 要销毁的行索引
+ */
+void destroyLineIndex(LineIndex* index);
+
+/**
+ * @brief 按一次文本编辑原地更新行索引
+ *
+ * 删除区内的换行对应的行被移除，插入文本中的换行加入新行，编辑点之后的行
+ * 起始偏移整体平移。只扫描插入的文本，不必为一次小编辑重新扫描整个文件。
+ *
+ * @param index 编辑前源码的行索引
+ * @param data 编辑后的源码
+ * @param length 编辑后的源码长度
+ * @param offset 编辑起始偏移
+ * @param removedLength 删除的字节数（按编辑前的源码计）
+ * @param insertedLength 插入的字节数，插入文本位于data + offset
+ * @return 成功返回true；参数不一致或内存不足时返回false，此时索引内容不确定，应销毁
+ */
+bool lineIndexApplyEdit(LineIndex* index, const char* data, size_t length,
+                        size_t offset, size_t removedLength, size_t insertedLength);
+
+/**
+ * @brief 把字节偏移换算为行列号
+ * @param index 行索引
+ * @param offset 字节偏移
+ * @param line 输出行号（从1开始，可为NULL）
+ * @param column 输出列号（从1开始，按字节计，可为NULL）
+ * @return 成功返回true
+ */
+bool lineIndexLookup(const LineIndex* index, uint32_t offset, int* line, int* column);
+
+/**
+ * @brief 获取指定行的起始偏移
+ * @param index 行索引
+ * @param line 行号（从1开始）
+ * @return 起始偏移，行号越界返回UINT32_MAX
+ */
+uint32_t lineIndexGetLineStart(const LineIndex* index, int line);
+
+#endif
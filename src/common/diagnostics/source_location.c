@@ -4,33 +4,84 @@
 #include <string.h>
 
 // 创建源位置信息
-SourceLocation createSourceLocation(const char* filename, int line, int column, int offset) {
+SourceLocation createSourceLocation(FileId fileId, uint32_t offset) {
     SourceLocation loc;
-    loc.filename = filename ? strdup(filename) : NULL;
-    loc.line = line;
-    loc.column = column;
+    loc.fileId = fileId;
     loc.offset = offset;
     return loc;
 }
 
+// 解析行列号
+bool sourceLocationResolve(const SourceLocation* location, int* line, int* column) {
+    if (!location) {
+        return false;
+    }
+    return sourceManagerGetLineColumn(location->fileId, location->offset, line, column);
+}
+
+// 获取行号，无法解析时返回0
+int sourceLocationGetLine(const SourceLocation* location) {
+    int line = 0;
+    sourceLocationResolve(location, &line, NULL);
+    return line;
+}
+
+// 获取列号，无法解析时返回0
+int sourceLocationGetColumn(const SourceLocation* location) {
+    int column = 0;
+    sourceLocationResolve(location, NULL, &column);
+    return column;
+}
+
+// 按解析结果格式化源位置，返回值与snprintf相同
+static int sourceLocationFormat(char* buffer, size_t size, const SourceLocation* location) {
+    if (!location) {
+        return snprintf(buffer, size, "unknown");
+    }
+
+    const char* filename = sourceLocationGetFilename(location);
+    int line = 0;
+    int column = 0;
+    bool resolved = sourceLocationResolve(location, &line, &column);
+
+    if (filename && resolved) {
+        return snprintf(buffer, size, "%s:%d:%d", filename, line, column);
+    }
+    if (filename) {
+        return snprintf(buffer, size, "%s:+%u", filename, (unsigned)location->offset);
+    }
+    if (resolved) {
+        return snprintf(buffer, size, "line %d, column %d", line, column);
+    }
+    return snprintf(buffer, size, "offset %u", (unsigned)location->offset);
+}
+
 // 源位置转字符串
 char* sourceLocationToString(const SourceLocation* location) {
-    if (!location) {
-        return strdup("unknown");
+    int len = sourceLocationFormat(NULL, 0, location);
+    if (len < 0) {
+        return NULL;
     }
-    char* result;
-    if (location->filename) {
-        asprintf(&result, "%s:%d:%d", location->filename, location->line, location->column);
-    } else {
-        asprintf(&result, "line %d, column %d", location->line, location->column);
+
+    char* result = (char*)malloc((size_t)len + 1);
+    if (!result) {
+        return NULL;
     }
+    sourceLocationFormat(result, (size_t)len + 1, location);
     return result;
 }
 
+// 获取源位置所在文件名
+const char* sourceLocationGetFilename(const SourceLocation* location) {
+    if (!location) {
+        return NULL;
+    }
+    return sourceManagerGetFilename(location->fileId);
+}
+
 // 销毁源位置信息
 void destroySourceLocation(SourceLocation* location) {
-    if (location && location->filename) {
-        free(location->filename);
-        location->filename = NULL;
+    if (location) {
+        location->fileId = INVALID_FILE_ID;
     }
 }
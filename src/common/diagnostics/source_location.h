@@ -4,26 +4,29 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include "source_manager.h"
 
 //源位置结构定义
+//定长8字节的值类型，只记录文件ID和字节偏移；文件名和行列号都在需要输出时
+//通过源管理器按ID和偏移延迟解析，复制时无需分配内存
 typedef struct {
-    char* filename; //源文件名称
-    int line;   //行号（从1开始）
-    int column; //列号（从1开始）
-    int offset; //文件中的字符偏移量
-
-
-
+    FileId fileId;      //源文件ID（INVALID_FILE_ID表示未知）
+    uint32_t offset;    //文件中的字节偏移量
 } SourceLocation;
 
 
 // 构造函数
-SourceLocation createSourceLocation(const char* filename, int line, int column, int offset);
+SourceLocation createSourceLocation(FileId fileId, uint32_t offset);
 // 辅助函数
 char* sourceLocationToString(const SourceLocation* location);
+const char* sourceLocationGetFilename(const SourceLocation* location);
+// 解析行列号（从1开始），文件未登记内容时返回false
+bool sourceLocationResolve(const SourceLocation* location, int* line, int* column);
+int sourceLocationGetLine(const SourceLocation* location);
+int sourceLocationGetColumn(const SourceLocation* location);
 
-// 析构函数
+// 析构函数（源位置不再持有堆内存，保留以兼容旧调用）
 void destroySourceLocation(SourceLocation* location);
 
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,342 @@
+#include "source_manager.h"
+#include "../utils/hash_table.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 源文件表项
+ */
+typedef struct {
+    char* filename;         // 文件名（由源管理器持有，匿名缓冲区为NULL）
+    const char* content;    // 文件内容（借用，可能为NULL）
+    size_t contentLength;   // 内容长度
+    LineIndex* lineIndex;   // 行索引（首次查询时构建）
+    uint32_t refCount;      // 缓冲区的引用数；按文件名注册的表项为0，永不释放
+    uint32_t nextFree;      // 空闲链表中的下一个槽位（下标+1，0表示链表结束）
+    uint8_t generation;     // 槽位的代数，每次重用加1，编入文件ID
+    bool live;              // 槽位是否在用
+} SourceFileEntry;
+
+// 文件ID的低24位是槽位下标+1，高8位是槽位的代数：
+// 缓冲区释放后槽位会被重用，旧ID的代数对不上，查询时得不到新表项
+#define SOURCE_FILE_SLOT_BITS 24
+#define SOURCE_FILE_SLOT_MASK ((1u << SOURCE_FILE_SLOT_BITS) - 1)
+
+/**
+ * @brief 全局源管理器
+ *
+ * 按ID直接索引，按文件名注册时通过哈希表查重（头文件多时注册不再是线性扫描）；
+ * 按缓冲区注册的表项不进入哈希表，每次注册都得到新的ID，引用数归零时释放，
+ * 槽位放入空闲链表供之后的缓冲区重用，表不会随创建过的词法分析器数量增长。
+ * 注册和查询都在互斥锁保护下进行。
+ * 每个文件可以登记内容，用于按字节偏移延迟计算行列号。
+ */
+static struct {
+    SourceFileEntry* files;  // 下标为槽位号
+    size_t fileCount;        // 已使用过的槽位数（含空闲槽位）
+    size_t capacity;
+    size_t liveCount;        // 在用的表项数
+    uint32_t freeList;       // 空闲槽位链表头（下标+1，0表示为空）
+    HashTable* byName;       // 文件名 -> fileId，键是表项持有的文件名
+    pthread_mutex_t lock;
+} sourceManager = { NULL, 0, 0, 0, 0, NULL, PTHREAD_MUTEX_INITIALIZER };
+
+// ==================== 内部辅助函数 ====================
+
+/**
+ * @brief 查找已注册的文件（调用者需持有锁）
+ */
+static FileId sourceManagerFindLocked(const char* filename) {
+    void* value;
+    if (!hashTableFind(sourceManager.byName, filename, &value)) {
+        return INVALID_FILE_ID;
+    }
+    return (FileId)(uintptr_t)value;
+}
+
+/**
+ * @brief 由槽位号和代数组成文件ID
+ */
+static inline FileId sourceManagerMakeFileId(size_t slot, uint8_t generation) {
+    return ((FileId)generation << SOURCE_FILE_SLOT_BITS) | (FileId)(slot + 1);
+}
+
+/**
+ * @brief 获取文件表项（调用者需持有锁）
+ *
+ * 已释放或代数不符的ID返回NULL。
+ */
+static SourceFileEntry* sourceManagerGetEntryLocked(FileId fileId) {
+    size_t slot = fileId & SOURCE_FILE_SLOT_MASK;
+    if (slot == 0 || slot > sourceManager.fileCount) {
+        return NULL;
+    }
+    SourceFileEntry* entry = &sourceManager.files[slot - 1];
+    if (!entry->live || entry->generation != (uint8_t)(fileId >> SOURCE_FILE_SLOT_BITS)) {
+        return NULL;
+    }
+    return entry;
+}
+
+/**
+ * @brief 确保文件的行索引已构建（调用者需持有锁）
+ */
+static LineIndex* sourceManagerEnsureLineIndexLocked(SourceFileEntry* entry) {
+    if (!entry->lineIndex && entry->content) {
+        entry->lineIndex = createLineIndex(entry->content, entry->contentLength);
+    }
+    return entry->lineIndex;
+}
+
+/**
+ * @brief 分配一个新的文件表项（调用者需持有锁）
+ *
+ * 优先重用空闲槽位（代数加1），否则在表尾追加。
+ *
+ * @param filename 文件名（可为NULL），复制一份由表项持有
+ * @param refCount 初始引用数，0表示表项永不释放
+ * @return 新表项的文件ID，内存不足时返回INVALID_FILE_ID
+ */
+static FileId sourceManagerAppendLocked(const char* filename, uint32_t refCount) {
+    if (!sourceManager.freeList && sourceManager.fileCount == sourceManager.capacity) {
+        if (sourceManager.capacity == SOURCE_FILE_SLOT_MASK) {
+            return INVALID_FILE_ID;
+        }
+        size_t newCapacity = sourceManager.capacity == 0 ? 8 : sourceManager.capacity * 2;
+        if (newCapacity > SOURCE_FILE_SLOT_MASK) {
+            newCapacity = SOURCE_FILE_SLOT_MASK;
+        }
+        SourceFileEntry* newFiles = (SourceFileEntry*)realloc(sourceManager.files,
+                                                              newCapacity * sizeof(SourceFileEntry));
+        if (!newFiles) {
+            return INVALID_FILE_ID;
+        }
+        sourceManager.files = newFiles;
+        sourceManager.capacity = newCapacity;
+    }
+
+    char* copy = NULL;
+    if (filename) {
+        size_t length = strlen(filename);
+        copy = (char*)malloc(length + 1);
+        if (!copy) {
+            return INVALID_FILE_ID;
+        }
+        memcpy(copy, filename, length + 1);
+    }
+
+    size_t slot;
+    SourceFileEntry* entry;
+    if (sourceManager.freeList) {
+        slot = sourceManager.freeList - 1;
+        entry = &sourceManager.files[slot];
+        sourceManager.freeList = entry->nextFree;
+        entry->generation++;
+    } else {
+        slot = sourceManager.fileCount++;
+        entry = &sourceManager.files[slot];
+        entry->generation = 0;
+    }
+
+    entry->filename = copy;
+    entry->content = NULL;
+    entry->contentLength = 0;
+    entry->lineIndex = NULL;
+    entry->refCount = refCount;
+    entry->nextFree = 0;
+    entry->live = true;
+    sourceManager.liveCount++;
+    return sourceManagerMakeFileId(slot, entry->generation);
+}
+
+/**
+ * @brief 释放文件表项，槽位放回空闲链表（调用者需持有锁）
+ */
+static void sourceManagerFreeEntryLocked(SourceFileEntry* entry) {
+    free(entry->filename);
+    destroyLineIndex(entry->lineIndex);
+    entry->filename = NULL;
+    entry->content = NULL;
+    entry->contentLength = 0;
+    entry->lineIndex = NULL;
+    entry->live = false;
+    entry->nextFree = sourceManager.freeList;
+    sourceManager.freeList = (uint32_t)(entry - sourceManager.files) + 1;
+    sourceManager.liveCount--;
+}
+
+// ==================== 公共接口 ====================
+
+FileId sourceManagerAddFile(const char* filename) {
+    if (!filename) {
+        return INVALID_FILE_ID;
+    }
+
+    pthread_mutex_lock(&sourceManager.lock);
+
+    FileId fileId = sourceManagerFindLocked(filename);
+    if (fileId != INVALID_FILE_ID) {
+        pthread_mutex_unlock(&sourceManager.lock);
+        return fileId;
+    }
+
+    if (!sourceManager.byName) {
+        sourceManager.byName = createStringHashTable(0);
+        if (!sourceManager.byName) {
+            pthread_mutex_unlock(&sourceManager.lock);
+            return INVALID_FILE_ID;
+        }
+    }
+
+    fileId = sourceManagerAppendLocked(filename, 0);
+    if (fileId != INVALID_FILE_ID) {
+        SourceFileEntry* entry = sourceManagerGetEntryLocked(fileId);
+        if (!hashTableInsert(sourceManager.byName, entry->filename, (void*)(uintptr_t)fileId)) {
+            // 撤销刚分配的表项
+            sourceManagerFreeEntryLocked(entry);
+            fileId = INVALID_FILE_ID;
+        }
+    }
+
+    pthread_mutex_unlock(&sourceManager.lock);
+    return fileId;
+}
+
+FileId sourceManagerAddBuffer(const char* filename) {
+    pthread_mutex_lock(&sourceManager.lock);
+    FileId fileId = sourceManagerAppendLocked(filename, 1);
+    pthread_mutex_unlock(&sourceManager.lock);
+    return fileId;
+}
+
+void sourceManagerRetainBuffer(FileId fileId) {
+    pthread_mutex_lock(&sourceManager.lock);
+    SourceFileEntry* entry = sourceManagerGetEntryLocked(fileId);
+    if (entry && entry->refCount > 0) {
+        entry->refCount++;
+    }
+    pthread_mutex_unlock(&sourceManager.lock);
+}
+
+void sourceManagerReleaseBuffer(FileId fileId) {
+    pthread_mutex_lock(&sourceManager.lock);
+    SourceFileEntry* entry = sourceManagerGetEntryLocked(fileId);
+    if (entry && entry->refCount > 0 && --entry->refCount == 0) {
+        sourceManagerFreeEntryLocked(entry);
+    }
+    pthread_mutex_unlock(&sourceManager.lock);
+}
+
+const char* sourceManagerGetFilename(FileId fileId) {
+    const char* filename = NULL;
+
+    pthread_mutex_lock(&sourceManager.lock);
+    SourceFileEntry* entry = sourceManagerGetEntryLocked(fileId);
+    if (entry) {
+        filename = entry->filename;
+    }
+    pthread_mutex_unlock(&sourceManager.lock);
+
+    return filename;
+}
+
+bool sourceManagerSetFileContent(FileId fileId, const char* data, size_t length) {
+    if (!data || length > UINT32_MAX) {
+        return false;
+    }
+
+    pthread_mutex_lock(&sourceManager.lock);
+    SourceFileEntry* entry = sourceManagerGetEntryLocked(fileId);
+    if (entry) {
+        // 同一块内存也可能已被原地修改（增量编辑），旧索引一律作废
+        destroyLineIndex(entry->lineIndex);
+        entry->lineIndex = NULL;
+        entry->content = data;
+        entry->contentLength = length;
+    }
+    pthread_mutex_unlock(&sourceManager.lock);
+
+    return entry != NULL;
+}
+
+bool sourceManagerEditFileContent(FileId fileId, const char* data, size_t length,
+                                  size_t offset, size_t removedLength, size_t insertedLength) {
+    if (!data || length > UINT32_MAX) {
+        return false;
+    }
+
+    pthread_mutex_lock(&sourceManager.lock);
+    SourceFileEntry* entry = sourceManagerGetEntryLocked(fileId);
+    if (entry) {
+        // 编辑与登记的长度不符或更新失败时，退回到下一次查询时重建
+        if (entry->lineIndex &&
+            (entry->contentLength + insertedLength != length + removedLength ||
+             !lineIndexApplyEdit(entry->lineIndex, data, length, offset, removedLength, insertedLength))) {
+            destroyLineIndex(entry->lineIndex);
+            entry->lineIndex = NULL;
+        }
+        entry->content = data;
+        entry->contentLength = length;
+    }
+    pthread_mutex_unlock(&sourceManager.lock);
+
+    return entry != NULL;
+}
+
+void sourceManagerReleaseFileContent(FileId fileId, const char* data) {
+    pthread_mutex_lock(&sourceManager.lock);
+    SourceFileEntry* entry = sourceManagerGetEntryLocked(fileId);
+    if (entry && entry->content == data) {
+        // 内容失效后无法再构建索引：调用者之外还有持有者（或表项永不释放）时先建好，
+        // 保证之后的诊断仍能给出行列号；调用者是唯一持有者时表项随后就会释放，不必构建
+        if (entry->refCount != 1) {
+            sourceManagerEnsureLineIndexLocked(entry);
+        }
+        entry->content = NULL;
+    }
+    pthread_mutex_unlock(&sourceManager.lock);
+}
+
+bool sourceManagerGetLineColumn(FileId fileId, uint32_t offset, int* line, int* column) {
+    pthread_mutex_lock(&sourceManager.lock);
+    SourceFileEntry* entry = sourceManagerGetEntryLocked(fileId);
+    LineIndex* index = entry ? sourceManagerEnsureLineIndexLocked(entry) : NULL;
+    bool found = lineIndexLookup(index, offset, line, column);
+    pthread_mutex_unlock(&sourceManager.lock);
+    return found;
+}
+
+const LineIndex* sourceManagerGetLineIndex(FileId fileId) {
+    pthread_mutex_lock(&sourceManager.lock);
+    SourceFileEntry* entry = sourceManagerGetEntryLocked(fileId);
+    LineIndex* index = entry ? sourceManagerEnsureLineIndexLocked(entry) : NULL;
+    pthread_mutex_unlock(&sourceManager.lock);
+    return index;
+}
+
+size_t sourceManagerGetFileCount(void) {
+    pthread_mutex_lock(&sourceManager.lock);
+    size_t count = sourceManager.liveCount;
+    pthread_mutex_unlock(&sourceManager.lock);
+    return count;
+}
+
+void sourceManagerReset(void) {
+    pthread_mutex_lock(&sourceManager.lock);
+    for (size_t i = 0; i < sourceManager.fileCount; i++) {
+        if (sourceManager.files[i].live) {
+            free(sourceManager.files[i].filename);
+            destroyLineIndex(sourceManager.files[i].lineIndex);
+        }
+    }
+    free(sourceManager.files);
+    sourceManager.files = NULL;
+    destroyHashTable(sourceManager.byName);
+    sourceManager.byName = NULL;
+    sourceManager.fileCount = 0;
+    sourceManager.capacity = 0;
+    sourceManager.liveCount = 0;
+    sourceManager.freeList = 0;
+    pthread_mutex_unlock(&sourceManager.lock);
+}
@@ -0,0 +1,152 @@
+#ifndef SOURCE_MANAGER_H
+#define SOURCE_MANAGER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "line_index.h"
+
+/**
+ * @brief 源文件ID
+ *
+ * 由全局源管理器分配的紧凑文件句柄，0表示未知文件。
+ * SourceLocation只保存文件ID，文件名字符串由源管理器统一持有，
+ * 需要时再通过sourceManagerGetFilename解析。
+ */
+typedef uint32_t FileId;
+
+#define INVALID_FILE_ID ((FileId)0)
+
+/**
+ * @brief 注册源文件名
+ *
+ * 同名文件只注册一次，重复注册返回相同的ID。线程安全。
+ *
+ * @param filename 文件名
+ * @return 文件ID，filename为NULL或内存不足时返回INVALID_FILE_ID
+ */
+FileId sourceManagerAddFile(const char* filename);
+
+/**
+ * @brief 为一段源码缓冲区注册新的文件ID
+ *
+ * 与sourceManagerAddFile不同，每次调用都分配新的ID，不按文件名合并：
+ * 同名（例如同一文件的两个版本）或匿名的缓冲区各自登记内容和行索引，
+ * 互不覆盖。词法分析器为它扫描的每个缓冲区调用此函数，并在销毁时释放。
+ * 新表项的引用数为1，引用数归零时表项（文件名和行索引）随即释放，
+ * 此后该ID不再能解析出任何信息。线程安全。
+ *
+ * @param filename 文件名（可为NULL，表示匿名缓冲区，此时sourceManagerGetFilename返回NULL）
+ * @return 文件ID，内存不足时返回INVALID_FILE_ID
+ */
+FileId sourceManagerAddBuffer(const char* filename);
+
+/**
+ * @brief 增加缓冲区表项的引用
+ *
+ * 需要在词法分析器销毁之后继续解析其位置（例如保存了诊断位置）的调用者
+ * 先持有一个引用，用完再调用sourceManagerReleaseBuffer。
+ * 对按文件名注册的表项或无效ID没有作用。线程安全。
+ *
+ * @param fileId sourceManagerAddBuffer返回的文件ID
+ */
+void sourceManagerRetainBuffer(FileId fileId);
+
+/**
+ * @brief 释放缓冲区表项的一个引用
+ *
+ * 引用数归零时释放表项，槽位留给之后注册的缓冲区重用（分配到的是新ID）。
+ * 对按文件名注册的表项或无效ID没有作用。线程安全。
+ *
+ * @param fileId sourceManagerAddBuffer返回的文件ID
+ */
+void sourceManagerReleaseBuffer(FileId fileId);
+
+/**
+ * @brief 根据文件ID获取文件名
+ * @param fileId 文件ID
+ * @return 文件名，ID无效、已释放或为匿名缓冲区时返回NULL；
+ *         返回的字符串在表项释放或sourceManagerReset前一直有效
+ */
+const char* sourceManagerGetFilename(FileId fileId);
+
+/**
+ * @brief 登记文件内容，供按偏移计算行列号
+ *
+ * 源管理器只借用data，不复制；行索引在第一次查询行列号时才构建。
+ * 重复登记会替换之前的内容并丢弃已构建的行索引。
+ *
+ * @param fileId 文件ID
+ * @param data 文件内容，在调用sourceManagerReleaseFileContent之前必须保持有效
+ * @param length 内容长度
+ * @return 成功返回true
+ */
+bool sourceManagerSetFileContent(FileId fileId, const char* data, size_t length);
+
+/**
+ * @brief 登记一次编辑之后的文件内容
+ *
+ * 与sourceManagerSetFileContent相同地替换内容，但已构建的行索引按这次编辑
+ * 原地更新（见lineIndexApplyEdit），而不是丢弃后在下一次查询时整份重建；
+ * 尚未构建索引时什么也不做，索引仍在第一次查询时才构建。
+ *
+ * @param fileId 文件ID
+ * @param data 编辑后的内容（可以是原地修改过的同一块内存）
+ * @param length 编辑后的内容长度
+ * @param offset 编辑起始偏移
+ * @param removedLength 删除的字节数（按编辑前的内容计）
+ * @param insertedLength 插入的字节数
+ * @return 成功返回true
+ */
+bool sourceManagerEditFileContent(FileId fileId, const char* data, size_t length,
+                                  size_t offset, size_t removedLength, size_t insertedLength);
+
+/**
+ * @brief 内容即将失效时通知源管理器
+ *
+ * 如果登记的内容正是data，放弃对内容的引用。表项在调用者之外还有持有者
+ * （或是按文件名注册的表项）时，先构建行索引（尚未构建时），之后的行列号查询
+ * 仍然可用；调用者是唯一持有者时不构建索引，随后的sourceManagerReleaseBuffer
+ * 会直接释放表项。
+ *
+ * @param fileId 文件ID
+ * @param data 即将失效的内容
+ */
+void sourceManagerReleaseFileContent(FileId fileId, const char* data);
+
+/**
+ * @brief 把文件中的字节偏移换算为行列号
+ *
+ * 第一次查询某个文件时构建它的行索引，之后为二分查找。线程安全。
+ *
+ * @param fileId 文件ID
+ * @param offset 字节偏移
+ * @param line 输出行号（从1开始，可为NULL）
+ * @param column 输出列号（从1开始，可为NULL）
+ * @return 成功返回true；文件未登记内容时返回false
+ */
+bool sourceManagerGetLineColumn(FileId fileId, uint32_t offset, int* line, int* column);
+
+/**
+ * @brief 获取文件的行索引（必要时构建）
+ *
+ * 供调试信息生成等需要批量查询的场景使用，避免每次查询都加锁。
+ *
+ * @param fileId 文件ID
+ * @return 行索引，在该文件内容被替换或sourceManagerReset之前有效；失败返回NULL
+ */
+const LineIndex* sourceManagerGetLineIndex(FileId fileId);
+
+/**
+ * @brief 获取当前登记的文件数量
+ * @return 文件数量（已释放的缓冲区不计）
+ */
+size_t sourceManagerGetFileCount(void);
+
+/**
+ * @brief 释放源管理器持有的全部文件信息
+ * @note 调用后此前分配的所有文件ID失效
+ */
+void sourceManagerReset(void);
+
+#endif
@@ -0,0 +1,97 @@
+#include "buffer.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define SOURCE_BUFFER_HAS_MMAP 1
+#endif
+
+// ==================== 构造函数和析构函数 ====================
+
+SourceBuffer* createSourceBufferCopy(const char* data, size_t length) {
+    if (!data && length > 0) {
+        return NULL;
+    }
+
+    SourceBuffer* buffer = (SourceBuffer*)malloc(sizeof(SourceBuffer));
+    if (!buffer) {
+        return NULL;
+    }
+
+    char* copy = (char*)malloc(length + 1);
+    if (!copy) {
+        free(buffer);
+        return NULL;
+    }
+    if (length > 0) {
+        memcpy(copy, data, length);
+    }
+    copy[length] = '\0';
+
+    buffer->data = copy;
+    buffer->length = length;
+    buffer->kind = SOURCE_BUFFER_HEAP;
+    buffer->mappingBase = NULL;
+    buffer->mappingSize = 0;
+
+    return buffer;
+}
+
+SourceBuffer* createSourceBufferBorrowed(const char* data, size_t length) {
+    // 借用模式依赖调用者提供的哨兵
+    if (!data || data[length] != '\0') {
+        return NULL;
+    }
+
+    SourceBuffer* buffer = (SourceBuffer*)malloc(sizeof(SourceBuffer));
+    if (!buffer) {
+        return NULL;
+    }
+
+    buffer->data = data;
+    buffer->length = length;
+    buffer->kind = SOURCE_BUFFER_BORROWED;
+    buffer->mappingBase = NULL;
+    buffer->mappingSize = 0;
+
+    return buffer;
+}
+
+void destroySourceBuffer(SourceBuffer* buffer) {
+    if (!buffer) {
+        return;
+    }
+
+    switch (buffer->kind) {
+        case SOURCE_BUFFER_HEAP:
+            free((void*)buffer->data);
+            break;
+        case SOURCE_BUFFER_MAPPED:
+#ifdef SOURCE_BUFFER_HAS_MMAP
+            if (buffer->mappingBase) {
+                munmap(buffer->mappingBase, buffer->mappingSize);
+            }
+#endif
+            break;
+        case SOURCE_BUFFER_BORROWED:
+            // 借用的内存由调用者释放
+            break;
+    }
+
+    free(buffer);
+}
+
+// ==================== 访问函数 ====================
+
+const char* sourceBufferData(const SourceBuffer* buffer) {
+    return buffer ? buffer->data : NULL;
+}
+
+size_t sourceBufferLength(const SourceBuffer* buffer) {
+    return buffer ? buffer->length : 0;
+}
+
+bool sourceBufferIsMapped(const SourceBuffer* buffer) {
+    return buffer && buffer->kind == SOURCE_BUFFER_MAPPED;
+}
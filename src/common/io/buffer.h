@@ -0,0 +1,79 @@
+#ifndef BUFFER_H
+#define BUFFER_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @brief 源码缓冲区的存储方式
+ */
+typedef enum {
+    SOURCE_BUFFER_HEAP,      // 堆上分配的副本（由缓冲区负责释放）
+    SOURCE_BUFFER_MAPPED,    // 内存映射的文件（由缓冲区负责解除映射）
+    SOURCE_BUFFER_BORROWED   // 借用外部内存（调用者保证其生命周期）
+} SourceBufferKind;
+
+/**
+ * @brief 只读源码缓冲区
+ *
+ * 保证 data[length] == '\0'，词法分析器可以把结尾的NUL当作哨兵，
+ * 不必在每次读取字符时检查边界。内存映射模式下哨兵来自页内剩余的
+ * 零字节，或者文件大小恰好按页对齐时额外映射的一个零页。
+ */
+typedef struct {
+    const char* data;        // 源码内容（以'\0'结尾）
+    size_t length;           // 源码长度（不含哨兵）
+    SourceBufferKind kind;   // 存储方式
+    void* mappingBase;       // 映射区域起始地址（仅映射模式）
+    size_t mappingSize;      // 映射区域总大小（仅映射模式）
+} SourceBuffer;
+
+// ==================== 构造函数和析构函数 ====================
+
+/**
+ * @brief 复制一段内存创建缓冲区
+ * @param data 源数据（可不以'\0'结尾）
+ * @param length 数据长度
+ * @return 新创建的缓冲区，失败返回NULL
+ */
+SourceBuffer* createSourceBufferCopy(const char* data, size_t length);
+
+/**
+ * @brief 借用一段已有内存创建缓冲区（零拷贝）
+ * @param data 源数据，要求 data[length] == '\0'
+ * @param length 数据长度
+ * @return 新创建的缓冲区，失败返回NULL
+ * @note 调用者必须保证data在缓冲区销毁前一直有效
+ */
+SourceBuffer* createSourceBufferBorrowed(const char* data, size_t length);
+
+/**
+ * @brief 销毁缓冲区，按存储方式释放或解除映射
+ * @param buffer 要销毁的缓冲区
+ */
+void destroySourceBuffer(SourceBuffer* buffer);
+
+// ==================== 访问函数 ====================
+
+/**
+ * @brief 获取缓冲区内容
+ * @param buffer 缓冲区
+ * @return 以'\0'结尾的内容，buffer为NULL时返回NULL
+ */
+const char* sourceBufferData(const SourceBuffer* buffer);
+
+/**
+ * @brief 获取缓冲区长度
+ * @param buffer 缓冲区
+ * @return 内容长度（不含哨兵）
+ */
+size_t sourceBufferLength(const SourceBuffer* buffer);
+
+/**
+ * @brief 检查缓冲区是否为内存映射
+ * @param buffer 缓冲区
+ * @return 内存映射返回true
+ */
+bool sourceBufferIsMapped(const SourceBuffer* buffer);
+
+#endif
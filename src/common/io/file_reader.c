@@ -0,0 +1,207 @@
+#if !defined(_WIN32)
+#define _DEFAULT_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "file_reader.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define FILE_READER_HAS_MMAP 1
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+
+// ==================== 内部辅助函数 ====================
+
+/**
+ * @brief 读入整个文件到堆内存（回退路径）
+ */
+static SourceBuffer* fileReaderReadBuffered(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+
+    size_t capacity = 4096;
+    size_t length = 0;
+    char* data = (char*)malloc(capacity);
+    if (!data) {
+        fclose(file);
+        return NULL;
+    }
+
+    // 不依赖fseek/ftell，以支持管道等不可定位的输入
+    for (;;) {
+        if (length + 1 >= capacity) {
+            char* newData = (char*)realloc(data, capacity * 2);
+            if (!newData) {
+                free(data);
+                fclose(file);
+                return NULL;
+            }
+            data = newData;
+            capacity *= 2;
+        }
+        size_t readSize = fread(data + length, 1, capacity - length - 1, file);
+        length += readSize;
+        if (readSize == 0) {
+            break;
+        }
+    }
+
+    bool failed = ferror(file) != 0;
+    fclose(file);
+    if (failed) {
+        free(data);
+        return NULL;
+    }
+    data[length] = '\0';
+
+    SourceBuffer* buffer = (SourceBuffer*)malloc(sizeof(SourceBuffer));
+    if (!buffer) {
+        free(data);
+        return NULL;
+    }
+    buffer->data = data;
+    buffer->length = length;
+    buffer->kind = SOURCE_BUFFER_HEAP;
+    buffer->mappingBase = NULL;
+    buffer->mappingSize = 0;
+
+    return buffer;
+}
+
+#ifdef FILE_READER_HAS_MMAP
+/**
+ * @brief 内存映射文件
+ * @return 成功返回缓冲区；文件不可映射时返回NULL并设置*unmappable
+ */
+static SourceBuffer* fileReaderReadMapped(const char* path, bool* unmappable) {
+    *unmappable = false;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return NULL;
+    }
+
+    // 空文件和非普通文件无法映射
+    if (!S_ISREG(info.st_mode) || info.st_size <= 0) {
+        close(fd);
+        *unmappable = true;
+        return NULL;
+    }
+
+    size_t fileSize = (size_t)info.st_size;
+    size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    size_t mappingSize = (fileSize + pageSize - 1) / pageSize * pageSize;
+    void* base = NULL;
+
+    if (fileSize % pageSize != 0) {
+        // 最后一页的剩余部分由内核填零，直接充当哨兵
+        base = mmap(NULL, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    } else {
+        // 文件恰好按页对齐：先保留多一页的匿名零页区域，再把文件覆盖映射到前部
+        mappingSize += pageSize;
+        base = mmap(NULL, mappingSize, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base != MAP_FAILED) {
+            void* fileBase = mmap(base, fileSize, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0);
+            if (fileBase == MAP_FAILED) {
+                munmap(base, mappingSize);
+                base = MAP_FAILED;
+            }
+        }
+    }
+    close(fd);
+
+    if (base == MAP_FAILED) {
+        *unmappable = true;
+        return NULL;
+    }
+
+#ifdef MADV_SEQUENTIAL
+    // 词法分析是顺序扫描，提示内核积极预读
+    madvise(base, mappingSize, MADV_SEQUENTIAL);
+#endif
+
+    SourceBuffer* buffer = (SourceBuffer*)malloc(sizeof(SourceBuffer));
+    if (!buffer) {
+        munmap(base, mappingSize);
+        return NULL;
+    }
+    buffer->data = (const char*)base;
+    buffer->length = fileSize;
+    buffer->kind = SOURCE_BUFFER_MAPPED;
+    buffer->mappingBase = base;
+    buffer->mappingSize = mappingSize;
+
+    return buffer;
+}
+#endif
+
+// ==================== 公共接口 ====================
+
+SourceBuffer* fileReaderOpen(const char* path, FileReadMode mode) {
+    if (!path) {
+        return NULL;
+    }
+
+    if (mode == FILE_READ_BUFFERED) {
+        return fileReaderReadBuffered(path);
+    }
+
+#ifdef FILE_READER_HAS_MMAP
+    bool unmappable = false;
+    SourceBuffer* buffer = fileReaderReadMapped(path, &unmappable);
+    if (buffer || mode == FILE_READ_MAPPED || !unmappable) {
+        return buffer;
+    }
+    return fileReaderReadBuffered(path);
+#else
+    if (mode == FILE_READ_MAPPED) {
+        return NULL;
+    }
+    return fileReaderReadBuffered(path);
+#endif
+}
+
+bool fileReaderGetSize(const char* path, size_t* size) {
+    if (!path || !size) {
+        return false;
+    }
+
+#ifdef FILE_READER_HAS_MMAP
+    struct stat info;
+    if (stat(path, &info) != 0) {
+        return false;
+    }
+    *size = (size_t)info.st_size;
+    return true;
+#else
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    fseek(file, 0, SEEK_END);
+    long fileSize = ftell(file);
+    fclose(file);
+    if (fileSize < 0) {
+        return false;
+    }
+    *size = (size_t)fileSize;
+    return true;
+#endif
+}
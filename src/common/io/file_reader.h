@@ -0,0 +1,39 @@
+#ifndef FILE_READER_H
+#define FILE_READER_H
+
+#include "buffer.h"
+#include <stdbool.h>
+
+/**
+ * @brief 文件读取方式
+ */
+typedef enum {
+    FILE_READ_AUTO,      // 优先内存映射，不可映射时回退到读入堆内存
+    FILE_READ_MAPPED,    // 只使用内存映射
+    FILE_READ_BUFFERED   // 只读入堆内存
+} FileReadMode;
+
+/**
+ * @brief 打开源文件并返回只读缓冲区
+ *
+ * 普通文件使用mmap映射，词法分析器直接在映射内存上扫描，无需复制。
+ * 文件大小不是页大小整数倍时，最后一页剩余部分由内核填零，天然提供
+ * 结尾NUL哨兵；恰好按页对齐时额外保留一个匿名零页作为哨兵页。
+ * 管道、设备等不可映射的文件以及非POSIX平台回退到一次性读入。
+ *
+ * @param path 文件路径
+ * @param mode 读取方式
+ * @return 新创建的缓冲区，失败返回NULL
+ * @note 映射期间文件被其他进程截断会导致访问映射页时收到SIGBUS
+ */
+SourceBuffer* fileReaderOpen(const char* path, FileReadMode mode);
+
+/**
+ * @brief 获取文件大小
+ * @param path 文件路径
+ * @param size 输出文件大小
+ * @return 成功返回true
+ */
+bool fileReaderGetSize(const char* path, size_t* size);
+
+#endif
@@ -0,0 +1,623 @@
+#include "hash_table.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ==================== 平台检测 ====================
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HASH_TABLE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// 每组的槽位数，与一条SSE2指令比较的字节数相同
+#define HASH_TABLE_GROUP_WIDTH 16
+
+// 控制字节：空槽和已删除的最高位为1，占用的槽位存放哈希值的高7位
+#define CONTROL_EMPTY   ((uint8_t)0x80)
+#define CONTROL_DELETED ((uint8_t)0xFE)
+
+// 字符串表槽位中内联的键字节数，第16个字节存放长度
+#define HASH_TABLE_INLINE_SIZE 15
+
+// 内联长度的上限，更长的键都记为这个值
+#define HASH_TABLE_INLINE_MAX_LENGTH 255
+
+/**
+ * @brief 字符串表槽位中内联的键
+ *
+ * 前15个字节是键的开头（不足补0），最后一个字节是长度，
+ * 按两个64位整数比较。
+ */
+typedef struct {
+    uint64_t low;
+    uint64_t high;
+} HashTableInlineKey;
+
+/**
+ * @brief 哈希表槽位（32字节，两个槽位正好占一条缓存行）
+ *
+ * 字符串表不缓存哈希值，而是把键的开头和长度内联在槽位里：
+ * 不超过15字节的键（绝大多数标识符）命中时不必再读取键本身所在的内存，
+ * 这是查找中最常见的一次缓存未命中。
+ */
+struct HashTableSlot {
+    const void* key;    // 键（由调用者持有）
+    void* value;        // 值
+    union {
+        uint64_t hash;                  // 通用表：键的完整哈希值
+        HashTableInlineKey inlineKey;   // 字符串表：内联的键
+    };
+};
+
+// ==================== 内部辅助函数 ====================
+
+/**
+ * @brief 最低位1的下标（mask不能为0）
+ */
+static inline unsigned hashTableCountTrailingZeros(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctz(mask);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (unsigned)index;
+#else
+    unsigned index = 0;
+    while (!(mask & 1u)) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+/**
+ * @brief 占用槽位的控制字节：哈希值的高7位
+ */
+static inline uint8_t hashTableH2(uint64_t hash) {
+    return (uint8_t)(hash >> 57);
+}
+
+/**
+ * @brief 容量为capacity时最多能占用的槽位数（装载因子7/8）
+ */
+static inline size_t hashTableMaxLoad(size_t capacity) {
+    return capacity - capacity / 8;
+}
+
+#if defined(HASH_TABLE_SSE2)
+
+/**
+ * @brief 组内控制字节等于byte的槽位掩码
+ */
+static inline uint32_t hashTableGroupMatch(const uint8_t* group, uint8_t byte) {
+    __m128i control = _mm_loadu_si128((const __m128i*)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8((char)byte)));
+}
+
+/**
+ * @brief 组内空槽或已删除槽位的掩码（两者最高位都是1）
+ */
+static inline uint32_t hashTableGroupMatchFree(const uint8_t* group) {
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+}
+
+#else
+
+static inline uint32_t hashTableGroupMatch(const uint8_t* group, uint8_t byte) {
+    uint32_t mask = 0;
+    for (unsigned i = 0; i < HASH_TABLE_GROUP_WIDTH; i++) {
+        mask |= (uint32_t)(group[i] == byte) << i;
+    }
+    return mask;
+}
+
+static inline uint32_t hashTableGroupMatchFree(const uint8_t* group) {
+    uint32_t mask = 0;
+    for (unsigned i = 0; i < HASH_TABLE_GROUP_WIDTH; i++) {
+        mask |= (uint32_t)(group[i] >> 7) << i;
+    }
+    return mask;
+}
+
+#endif
+
+/**
+ * @brief 长度为length的字符串片段对应的内联键
+ */
+static inline HashTableInlineKey hashTableInlineKey(const char* str, size_t length) {
+    unsigned char bytes[sizeof(HashTableInlineKey)] = { 0 };
+    memcpy(bytes, str, length < HASH_TABLE_INLINE_SIZE ? length : HASH_TABLE_INLINE_SIZE);
+    bytes[HASH_TABLE_INLINE_SIZE] = (unsigned char)(length < HASH_TABLE_INLINE_MAX_LENGTH
+                                                        ? length : HASH_TABLE_INLINE_MAX_LENGTH);
+
+    HashTableInlineKey inlineKey;
+    memcpy(&inlineKey, bytes, sizeof(inlineKey));
+    return inlineKey;
+}
+
+/**
+ * @brief 字符串表中键的长度
+ */
+static inline size_t hashTableStringKeyLength(const HashTable* table, const void* key) {
+    return table->keyLength ? table->keyLength(key) : strlen((const char*)key);
+}
+
+/**
+ * @brief 字符串表槽位中的键是否等于长度为length的片段（不要求以'\0'结尾）
+ */
+static inline bool hashTableStringMatches(const HashTable* table, const HashTableSlot* slot,
+                                          const char* str, size_t length,
+                                          HashTableInlineKey inlineKey) {
+    if (slot->inlineKey.low != inlineKey.low || slot->inlineKey.high != inlineKey.high) {
+        return false;
+    }
+    if (length <= HASH_TABLE_INLINE_SIZE) {
+        return true;
+    }
+
+    // 内联部分相同，再比较剩下的字节
+    const char* stored = (const char*)slot->key + HASH_TABLE_INLINE_SIZE;
+    str += HASH_TABLE_INLINE_SIZE;
+    length -= HASH_TABLE_INLINE_SIZE;
+    if (length + HASH_TABLE_INLINE_SIZE < HASH_TABLE_INLINE_MAX_LENGTH) {
+        // 长度相同，两边都至少有length个字节
+        return memcmp(stored, str, length) == 0;
+    }
+    // 长度超过内联上限，不能确定两边一样长
+    if (table->keyLength) {
+        return table->keyLength(slot->key) == length + HASH_TABLE_INLINE_SIZE &&
+               memcmp(stored, str, length) == 0;
+    }
+    return strncmp(stored, str, length) == 0 && stored[length] == '\0';
+}
+
+/**
+ * @brief 查找键所在的槽位
+ *
+ * 从哈希值低位选出的组开始按三角数步长逐组探测，遇到含空槽的组即可停止。
+ *
+ * @param length 字符串表中键的长度（其他表忽略）
+ * @return 槽位下标，不存在返回SIZE_MAX
+ */
+static inline size_t hashTableFindIndex(const HashTable* table, const void* key,
+                                        size_t length, uint64_t hash) {
+    if (table->size == 0) {
+        return SIZE_MAX;
+    }
+
+    size_t groupMask = table->capacity / HASH_TABLE_GROUP_WIDTH - 1;
+    size_t group = (size_t)hash & groupMask;
+    uint8_t h2 = hashTableH2(hash);
+    HashTableInlineKey inlineKey = hashTableInlineKey((const char*)key, table->equals ? 0 : length);
+
+    for (size_t step = 1;; step++) {
+        const uint8_t* control = table->control + group * HASH_TABLE_GROUP_WIDTH;
+        uint32_t match = hashTableGroupMatch(control, h2);
+        while (match) {
+            size_t index = group * HASH_TABLE_GROUP_WIDTH + hashTableCountTrailingZeros(match);
+            const HashTableSlot* slot = &table->slots[index];
+            bool matches = table->equals
+                ? slot->hash == hash && (slot->key == key || table->equals(slot->key, key))
+                : hashTableStringMatches(table, slot, (const char*)key, length, inlineKey);
+            if (matches) {
+                return index;
+            }
+            match &= match - 1;
+        }
+        if (hashTableGroupMatch(control, CONTROL_EMPTY)) {
+            return SIZE_MAX;
+        }
+        if (step > groupMask) {
+            // 所有组都探测过了（表中只剩已删除的槽位时）
+            return SIZE_MAX;
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+/**
+ * @brief 为哈希值hash找一个可以写入的槽位（空槽或已删除）
+ *
+ * 调用者保证表中还有空闲槽位。
+ */
+static size_t hashTableFindFreeIndex(const HashTable* table, uint64_t hash) {
+    size_t groupMask = table->capacity / HASH_TABLE_GROUP_WIDTH - 1;
+    size_t group = (size_t)hash & groupMask;
+
+    for (size_t step = 1;; step++) {
+        uint32_t available = hashTableGroupMatchFree(table->control + group * HASH_TABLE_GROUP_WIDTH);
+        if (available) {
+            return group * HASH_TABLE_GROUP_WIDTH + hashTableCountTrailingZeros(available);
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+/**
+ * @brief 容纳count个键所需的槽位数
+ * @return 溢出时返回0
+ */
+static size_t hashTableCapacityFor(size_t count) {
+    size_t capacity = HASH_TABLE_GROUP_WIDTH;
+    while (hashTableMaxLoad(capacity) < count) {
+        if (capacity > SIZE_MAX / 2 / sizeof(HashTableSlot)) {
+            return 0;
+        }
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+/**
+ * @brief 字符串表槽位中键的哈希值，内联长度未饱和时不必求长度
+ */
+static inline uint64_t hashTableHashSlotKey(const HashTable* table, const HashTableSlot* slot) {
+    unsigned char bytes[sizeof(HashTableInlineKey)];
+    memcpy(bytes, &slot->inlineKey, sizeof(bytes));
+    size_t length = bytes[HASH_TABLE_INLINE_SIZE];
+    if (length >= HASH_TABLE_INLINE_MAX_LENGTH) {
+        length = hashTableStringKeyLength(table, slot->key);
+    }
+    return hashTableHashBytes(slot->key, length);
+}
+
+/**
+ * @brief 换成newCapacity个槽位并重新放入全部键
+ *
+ * 通用表使用缓存的哈希值，不调用哈希函数和比较函数；字符串表重新计算
+ * 每个键的哈希值，长度优先取槽位里内联的长度（扩容的总开销仍是均摊O(1)）。
+ * 已删除的槽位随之清除。
+ */
+static bool hashTableResize(HashTable* table, size_t newCapacity) {
+    // 控制字节在前（容量是16的倍数，槽位数组仍然对齐），槽位在后，一次分配
+    uint8_t* control = (uint8_t*)malloc(newCapacity + newCapacity * sizeof(HashTableSlot));
+    if (!control) {
+        return false;
+    }
+    memset(control, CONTROL_EMPTY, newCapacity);
+
+    HashTable resized = *table;
+    resized.control = control;
+    resized.slots = (HashTableSlot*)(control + newCapacity);
+    resized.capacity = newCapacity;
+
+    for (size_t i = 0; i < table->capacity; i++) {
+        if (table->control[i] & 0x80) {
+            continue;
+        }
+        const HashTableSlot* slot = &table->slots[i];
+        uint64_t hash = table->equals ? slot->hash : hashTableHashSlotKey(table, slot);
+        size_t index = hashTableFindFreeIndex(&resized, hash);
+        resized.control[index] = table->control[i];
+        resized.slots[index] = *slot;
+    }
+
+    free(table->control);
+    table->control = resized.control;
+    table->slots = resized.slots;
+    table->capacity = newCapacity;
+    table->growthLeft = hashTableMaxLoad(newCapacity) - table->size;
+    return true;
+}
+
+/**
+ * @brief 空闲槽位用完时腾出空间
+ *
+ * 已删除的槽位占了一半以上时原容量重建，否则容量翻倍。
+ */
+static bool hashTableMakeRoom(HashTable* table) {
+    if (table->capacity == 0) {
+        return hashTableResize(table, HASH_TABLE_GROUP_WIDTH);
+    }
+    if (table->size < hashTableMaxLoad(table->capacity) / 2) {
+        return hashTableResize(table, table->capacity);
+    }
+    if (table->capacity > SIZE_MAX / 4 / sizeof(HashTableSlot)) {
+        return false;
+    }
+    return hashTableResize(table, table->capacity * 2);
+}
+
+/**
+ * @brief 按表的类型计算键的哈希值
+ */
+static inline uint64_t hashTableHashKey(const HashTable* table, const void* key) {
+    return table->hash ? table->hash(key)
+                       : hashTableHashBytes(key, hashTableStringKeyLength(table, key));
+}
+
+// ==================== 构造函数和析构函数 ====================
+
+HashTable* createHashTable(HashFunction hash, KeyEqualFunction equals, size_t initialCapacity) {
+    if (!hash || !equals) {
+        return NULL;
+    }
+
+    HashTable* table = (HashTable*)calloc(1, sizeof(HashTable));
+    if (!table) {
+        return NULL;
+    }
+    table->hash = hash;
+    table->equals = equals;
+
+    if (initialCapacity > 0 && !hashTableReserve(table, initialCapacity)) {
+        free(table);
+        return NULL;
+    }
+    return table;
+}
+
+HashTable* createStringHashTable(size_t initialCapacity) {
+    return createStringHashTableWithLength(initialCapacity, NULL);
+}
+
+HashTable* createStringHashTableWithLength(size_t initialCapacity, KeyLengthFunction keyLength) {
+    HashTable* table = (HashTable*)calloc(1, sizeof(HashTable));
+    if (!table) {
+        return NULL;
+    }
+    table->keyLength = keyLength;
+
+    if (initialCapacity > 0 && !hashTableReserve(table, initialCapacity)) {
+        free(table);
+        return NULL;
+    }
+    return table;
+}
+
+void destroyHashTable(HashTable* table) {
+    if (!table) {
+        return;
+    }
+
+    // 槽位数组与控制字节在同一次分配中
+    free(table->control);
+    free(table);
+}
+
+// ==================== 哈希函数 ====================
+
+/**
+ * @brief 64位混合函数（MurmurHash3的fmix64），让高低位都充分依赖输入
+ */
+static inline uint64_t hashTableMix(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+uint64_t hashTableHashBytes(const void* data, size_t length) {
+    const unsigned char* p = (const unsigned char*)data;
+    uint64_t hash = 0x9E3779B97F4A7C15ULL ^ (uint64_t)length;
+
+    while (length >= 8) {
+        uint64_t word;
+        memcpy(&word, p, 8);
+        hash = (hash ^ word) * 0x9FB21C651E98DF25ULL;
+        hash ^= hash >> 29;
+        p += 8;
+        length -= 8;
+    }
+    if (length > 0) {
+        uint64_t word = 0;
+        memcpy(&word, p, length);
+        hash = (hash ^ word) * 0x9FB21C651E98DF25ULL;
+    }
+
+    return hashTableMix(hash);
+}
+
+uint64_t hashTableHashString(const void* str) {
+    return hashTableHashBytes(str, strlen((const char*)str));
+}
+
+bool hashTableStringEquals(const void* str1, const void* str2) {
+    return strcmp((const char*)str1, (const char*)str2) == 0;
+}
+
+uint64_t hashTableHashPointer(const void* key) {
+    return hashTableMix((uint64_t)(uintptr_t)key);
+}
+
+bool hashTablePointerEquals(const void* key1, const void* key2) {
+    return key1 == key2;
+}
+
+// ==================== 查找 ====================
+
+bool hashTableFindHashed(const HashTable* table, const void* key, uint64_t hash, void** value) {
+    if (!table || !key) {
+        return false;
+    }
+
+    size_t length = table->equals ? 0 : hashTableStringKeyLength(table, key);
+    size_t index = hashTableFindIndex(table, key, length, hash);
+    if (index == SIZE_MAX) {
+        return false;
+    }
+    if (value) {
+        *value = table->slots[index].value;
+    }
+    return true;
+}
+
+bool hashTableFind(const HashTable* table, const void* key, void** value) {
+    if (!table || !key) {
+        return false;
+    }
+    if (table->equals) {
+        return hashTableFindHashed(table, key, table->hash(key), value);
+    }
+
+    // 字符串表：长度只算一次，同时用于哈希和比较
+    size_t length = hashTableStringKeyLength(table, key);
+    size_t index = hashTableFindIndex(table, key, length, hashTableHashBytes(key, length));
+    if (index == SIZE_MAX) {
+        return false;
+    }
+    if (value) {
+        *value = table->slots[index].value;
+    }
+    return true;
+}
+
+void* hashTableGet(const HashTable* table, const void* key) {
+    void* value = NULL;
+    hashTableFind(table, key, &value);
+    return value;
+}
+
+bool hashTableContains(const HashTable* table, const void* key) {
+    return hashTableFind(table, key, NULL);
+}
+
+bool hashTableGetString(const HashTable* table, const char* str, size_t length,
+                        uint64_t hash, void** value) {
+    if (!table || !str || table->equals) {
+        return false;
+    }
+
+    size_t index = hashTableFindIndex(table, str, length, hash);
+    if (index == SIZE_MAX) {
+        return false;
+    }
+    if (value) {
+        *value = table->slots[index].value;
+    }
+    return true;
+}
+
+// ==================== 修改 ====================
+
+bool hashTableInsertHashed(HashTable* table, const void* key, uint64_t hash, void* value) {
+    if (!table || !key) {
+        return false;
+    }
+
+    // 键已存在时替换值
+    size_t length = table->equals ? 0 : hashTableStringKeyLength(table, key);
+    size_t index = hashTableFindIndex(table, key, length, hash);
+    if (index != SIZE_MAX) {
+        table->slots[index].value = value;
+        return true;
+    }
+
+    if (table->growthLeft == 0 && !hashTableMakeRoom(table)) {
+        return false;
+    }
+
+    index = hashTableFindFreeIndex(table, hash);
+    // 复用已删除的槽位不占用新的空槽
+    if (table->control[index] == CONTROL_EMPTY) {
+        table->growthLeft--;
+    }
+    table->control[index] = hashTableH2(hash);
+    table->slots[index].key = key;
+    table->slots[index].value = value;
+    if (table->equals) {
+        table->slots[index].hash = hash;
+    } else {
+        table->slots[index].inlineKey = hashTableInlineKey((const char*)key, length);
+    }
+    table->size++;
+    return true;
+}
+
+bool hashTableInsert(HashTable* table, const void* key, void* value) {
+    if (!table || !key) {
+        return false;
+    }
+    return hashTableInsertHashed(table, key, hashTableHashKey(table, key), value);
+}
+
+bool hashTableRemove(HashTable* table, const void* key, const void** removedKey, void** removedValue) {
+    if (!table || !key) {
+        return false;
+    }
+
+    size_t length = table->equals ? 0 : hashTableStringKeyLength(table, key);
+    size_t index = hashTableFindIndex(table, key, length, hashTableHashKey(table, key));
+    if (index == SIZE_MAX) {
+        return false;
+    }
+
+    if (removedKey) {
+        *removedKey = table->slots[index].key;
+    }
+    if (removedValue) {
+        *removedValue = table->slots[index].value;
+    }
+
+    // 组里还有空槽说明查找从不越过这一组，可以直接标成空槽；否则留下墓碑
+    const uint8_t* group = table->control + (index & ~(size_t)(HASH_TABLE_GROUP_WIDTH - 1));
+    if (hashTableGroupMatch(group, CONTROL_EMPTY)) {
+        table->control[index] = CONTROL_EMPTY;
+        table->growthLeft++;
+    } else {
+        table->control[index] = CONTROL_DELETED;
+    }
+    table->size--;
+    return true;
+}
+
+void hashTableClear(HashTable* table) {
+    if (!table || table->capacity == 0) {
+        return;
+    }
+
+    memset(table->control, CONTROL_EMPTY, table->capacity);
+    table->size = 0;
+    table->growthLeft = hashTableMaxLoad(table->capacity);
+}
+
+bool hashTableReserve(HashTable* table, size_t count) {
+    if (!table) {
+        return false;
+    }
+    if (count <= table->size + table->growthLeft) {
+        return true;
+    }
+
+    size_t capacity = hashTableCapacityFor(count);
+    if (capacity == 0) {
+        return false;
+    }
+    return hashTableResize(table, capacity);
+}
+
+// ==================== 统计和遍历 ====================
+
+size_t hashTableSize(const HashTable* table) {
+    return table ? table->size : 0;
+}
+
+bool hashTableNext(const HashTable* table, size_t* iterator, const void** key, void** value) {
+    if (!table || !iterator) {
+        return false;
+    }
+
+    for (size_t i = *iterator; i < table->capacity; i++) {
+        if (table->control[i] & 0x80) {
+            continue;
+        }
+        if (key) {
+            *key = table->slots[i].key;
+        }
+        if (value) {
+            *value = table->slots[i].value;
+        }
+        *iterator = i + 1;
+        return true;
+    }
+
+    *iterator = table->capacity;
+    return false;
+}
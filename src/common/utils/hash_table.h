@@ -0,0 +1,228 @@
+#ifndef HASH_TABLE_H
+#define HASH_TABLE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief 计算键的哈希值
+ */
+typedef uint64_t (*HashFunction)(const void* key);
+
+/**
+ * @brief 比较两个键是否相等
+ */
+typedef bool (*KeyEqualFunction)(const void* key1, const void* key2);
+
+/**
+ * @brief 取字符串键的长度（键中可能含有'\0'时代替strlen）
+ */
+typedef size_t (*KeyLengthFunction)(const void* key);
+
+/**
+ * @brief 哈希表槽位（内部使用）
+ */
+typedef struct HashTableSlot HashTableSlot;
+
+/**
+ * @brief HashTable哈希表结构体
+ *
+ * 开放寻址的Swiss table：每个槽位对应一个控制字节，空槽为0x80，
+ * 已删除为0xFE，占用时存放哈希值的高7位。槽位按16个一组探测，
+ * 一条SSE2比较指令即可找出组内控制字节匹配的候选位置，
+ * 绝大多数查找只读一组控制字节、比较一个键。
+ *
+ * 键和值都是指针，由调用者持有。通用表缓存每个键的完整哈希值，
+ * 扩容时不再调用哈希函数，比较键之前先比较哈希值；字符串表改为在槽位中
+ * 内联键的前15个字节和长度，不超过15字节的键查找时不必读取键本身。
+ *
+ * 删除时如果所在组里还有空槽，直接把槽位标成空，不留墓碑。
+ * 非线程安全。
+ */
+typedef struct HashTable {
+    uint8_t* control;           // 控制字节，每个槽位一个
+    HashTableSlot* slots;       // 槽位数组
+    size_t capacity;            // 槽位数（16的倍数，2的幂）
+    size_t size;                // 键的数量
+    size_t growthLeft;          // 不扩容还能占用的空槽数
+    HashFunction hash;          // 哈希函数（字符串表为NULL）
+    KeyEqualFunction equals;    // 比较函数（字符串表为NULL）
+    KeyLengthFunction keyLength; // 字符串表的键长度函数（NULL表示strlen）
+} HashTable;
+
+// ==================== 构造函数和析构函数 ====================
+
+/**
+ * @brief 创建哈希表
+ * @param hash 哈希函数
+ * @param equals 键比较函数
+ * @param initialCapacity 预计的键数量（0表示不预先分配）
+ * @return 新创建的哈希表，失败返回NULL
+ */
+HashTable* createHashTable(HashFunction hash, KeyEqualFunction equals, size_t initialCapacity);
+
+/**
+ * @brief 创建以'\0'结尾的字符串为键的哈希表
+ *
+ * 字符串表直接内联哈希和比较，不经过函数指针，
+ * 并支持用hashTableGetString按(指针, 长度)查找不以'\0'结尾的片段。
+ *
+ * @param initialCapacity 预计的键数量（0表示不预先分配）
+ * @return 新创建的哈希表，失败返回NULL
+ */
+HashTable* createStringHashTable(size_t initialCapacity);
+
+/**
+ * @brief 创建键长度由keyLength给出的字符串表
+ *
+ * 键可以含有'\0'（例如带长度前缀的驻留字符串）：哈希、比较和扩容时的
+ * 重新哈希都按keyLength给出的长度进行，不再调用strlen。
+ * 传给hashTableFind、hashTableInsert和hashTableRemove的键都必须能由
+ * keyLength求出长度；任意片段用hashTableGetString查找。
+ *
+ * @param initialCapacity 预计的键数量（0表示不预先分配）
+ * @param keyLength 键长度函数（NULL时与createStringHashTable相同）
+ * @return 新创建的哈希表，失败返回NULL
+ */
+HashTable* createStringHashTableWithLength(size_t initialCapacity, KeyLengthFunction keyLength);
+
+/**
+ * @brief 销毁哈希表（不释放键和值）
+ * @param table 要销毁的哈希表
+ */
+void destroyHashTable(HashTable* table);
+
+// ==================== 哈希函数 ====================
+
+/**
+ * @brief 计算一段字节的哈希值
+ *
+ * 每次处理8字节，适合标识符这类短字符串。字符串表使用这个函数，
+ * 调用者可以预先算好哈希值传给*Hashed系列函数。
+ */
+uint64_t hashTableHashBytes(const void* data, size_t length);
+
+/**
+ * @brief 计算以'\0'结尾的字符串的哈希值（可用作HashFunction）
+ */
+uint64_t hashTableHashString(const void* str);
+
+/**
+ * @brief 比较两个以'\0'结尾的字符串（可用作KeyEqualFunction）
+ */
+bool hashTableStringEquals(const void* str1, const void* str2);
+
+/**
+ * @brief 以指针值本身为键的哈希函数
+ */
+uint64_t hashTableHashPointer(const void* key);
+
+/**
+ * @brief 比较两个指针值
+ */
+bool hashTablePointerEquals(const void* key1, const void* key2);
+
+// ==================== 查找 ====================
+
+/**
+ * @brief 查找键对应的值
+ * @param table 哈希表
+ * @param key 键
+ * @param value 接收值（可为NULL）
+ * @return 找到返回true，否则返回false
+ */
+bool hashTableFind(const HashTable* table, const void* key, void** value);
+
+/**
+ * @brief 用预先算好的哈希值查找
+ */
+bool hashTableFindHashed(const HashTable* table, const void* key, uint64_t hash, void** value);
+
+/**
+ * @brief 查找键对应的值
+ * @return 值，键不存在时返回NULL
+ */
+void* hashTableGet(const HashTable* table, const void* key);
+
+/**
+ * @brief 检查键是否存在
+ */
+bool hashTableContains(const HashTable* table, const void* key);
+
+/**
+ * @brief 在字符串表中按片段查找
+ *
+ * str不要求以'\0'结尾，适合直接用源码中的标识符查符号表。
+ *
+ * @param table 字符串表
+ * @param str 片段起点
+ * @param length 片段长度
+ * @param hash hashTableHashBytes(str, length)的结果
+ * @param value 接收值（可为NULL）
+ * @return 找到返回true，否则返回false
+ */
+bool hashTableGetString(const HashTable* table, const char* str, size_t length,
+                        uint64_t hash, void** value);
+
+// ==================== 修改 ====================
+
+/**
+ * @brief 插入键值对，键已存在时替换值
+ * @param table 哈希表
+ * @param key 键（由调用者持有，存在期间不能修改）
+ * @param value 值
+ * @return 成功返回true，内存不足返回false
+ */
+bool hashTableInsert(HashTable* table, const void* key, void* value);
+
+/**
+ * @brief 用预先算好的哈希值插入
+ *
+ * 字符串表的哈希值必须是hashTableHashBytes(key, 键长度)的结果，键长度为
+ * strlen(key)或表的keyLength(key)，扩容时会按同样的方式重新计算。
+ */
+bool hashTableInsertHashed(HashTable* table, const void* key, uint64_t hash, void* value);
+
+/**
+ * @brief 删除键
+ * @param table 哈希表
+ * @param key 键
+ * @param removedKey 接收表中保存的键指针（可为NULL），便于调用者释放
+ * @param removedValue 接收被删除的值（可为NULL）
+ * @return 键存在返回true，否则返回false
+ */
+bool hashTableRemove(HashTable* table, const void* key, const void** removedKey, void** removedValue);
+
+/**
+ * @brief 删除全部键，保留已分配的槽位
+ */
+void hashTableClear(HashTable* table);
+
+/**
+ * @brief 预留空间，使插入count个键之前不再扩容
+ * @return 成功返回true，内存不足返回false
+ */
+bool hashTableReserve(HashTable* table, size_t count);
+
+// ==================== 统计和遍历 ====================
+
+/**
+ * @brief 获取键的数量
+ */
+size_t hashTableSize(const HashTable* table);
+
+/**
+ * @brief 遍历哈希表
+ *
+ * iterator初始化为0，每次调用返回下一个键值对；遍历期间不能插入或删除。
+ *
+ * @param table 哈希表
+ * @param iterator 遍历位置
+ * @param key 接收键（可为NULL）
+ * @param value 接收值（可为NULL）
+ * @return 还有键值对返回true，遍历结束返回false
+ */
+bool hashTableNext(const HashTable* table, size_t* iterator, const void** key, void** value);
+
+#endif // HASH_TABLE_H
@@ -0,0 +1,292 @@
+#include "memory_pool.h"
+#include <stdalign.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 默认块容量
+#define MEMORY_POOL_DEFAULT_CHUNK_SIZE (64 * 1024)
+
+// 分配对齐
+#define MEMORY_POOL_ALIGNMENT alignof(max_align_t)
+
+/**
+ * @brief 内存池块
+ *
+ * 块头之后紧跟capacity字节的可分配空间。
+ */
+struct MemoryPoolChunk {
+    MemoryPoolChunk* next;      // 更早分配的块
+    size_t capacity;            // 可分配空间大小
+    size_t used;                // 已使用的字节数
+    size_t serial;              // 块的序号，越晚分配越大（用于回滚到标记）
+    alignas(max_align_t) unsigned char data[];
+};
+
+// ==================== 内部辅助函数 ====================
+
+static size_t memoryPoolAlignUp(size_t size) {
+    return (size + MEMORY_POOL_ALIGNMENT - 1) & ~(MEMORY_POOL_ALIGNMENT - 1);
+}
+
+static MemoryPoolChunk* memoryPoolNewChunk(MemoryPool* pool, size_t capacity) {
+    MemoryPoolChunk* chunk = (MemoryPoolChunk*)malloc(sizeof(MemoryPoolChunk) + capacity);
+    if (!chunk) {
+        return NULL;
+    }
+    chunk->next = NULL;
+    chunk->capacity = capacity;
+    chunk->used = 0;
+    chunk->serial = pool->nextSerial++;
+    pool->chunkCount++;
+    return chunk;
+}
+
+/**
+ * @brief 在块中按alignment对齐后的偏移
+ */
+static inline size_t memoryPoolAlignedOffset(const MemoryPoolChunk* chunk, size_t alignment) {
+    uintptr_t base = (uintptr_t)chunk->data;
+    uintptr_t aligned = (base + chunk->used + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    return (size_t)(aligned - base);
+}
+
+/**
+ * @brief 当前块放不下时的分配
+ */
+static void* memoryPoolAllocSlow(MemoryPool* pool, size_t size, size_t alignment) {
+    // 对齐要求超过块本身的对齐时，最坏情况下要跳过alignment-1字节
+    size_t padding = alignment > MEMORY_POOL_ALIGNMENT ? alignment - 1 : 0;
+    if (size > SIZE_MAX - padding - sizeof(MemoryPoolChunk)) {
+        return NULL;
+    }
+
+    MemoryPoolChunk* head = pool->head;
+
+    // 大对象单独占一个块，挂在当前块之后，不打断当前块的顺序分配
+    if (size + padding > pool->chunkSize / 2) {
+        MemoryPoolChunk* chunk = memoryPoolNewChunk(pool, size + padding);
+        if (!chunk) {
+            return NULL;
+        }
+        size_t offset = memoryPoolAlignedOffset(chunk, alignment);
+        chunk->used = offset + size;
+        if (head) {
+            chunk->next = head->next;
+            head->next = chunk;
+        } else {
+            pool->head = chunk;
+        }
+        pool->bytesAllocated += size;
+        return chunk->data + offset;
+    }
+
+    MemoryPoolChunk* chunk = memoryPoolNewChunk(pool, pool->chunkSize);
+    if (!chunk) {
+        return NULL;
+    }
+    size_t offset = memoryPoolAlignedOffset(chunk, alignment);
+    chunk->next = head;
+    chunk->used = offset + size;
+    pool->head = chunk;
+    pool->bytesAllocated += size;
+    return chunk->data + offset;
+}
+
+// ==================== 构造函数和析构函数 ====================
+
+MemoryPool* createMemoryPool(size_t chunkSize) {
+    MemoryPool* pool = (MemoryPool*)malloc(sizeof(MemoryPool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->head = NULL;
+    pool->chunkSize = memoryPoolAlignUp(chunkSize == 0 ? MEMORY_POOL_DEFAULT_CHUNK_SIZE : chunkSize);
+    pool->bytesAllocated = 0;
+    pool->chunkCount = 0;
+    pool->nextSerial = 0;
+    return pool;
+}
+
+void destroyMemoryPool(MemoryPool* pool) {
+    if (!pool) {
+        return;
+    }
+
+    MemoryPoolChunk* chunk = pool->head;
+    while (chunk) {
+        MemoryPoolChunk* next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(pool);
+}
+
+// ==================== 分配 ====================
+
+void* memoryPoolAlloc(MemoryPool* pool, size_t size) {
+    if (!pool) {
+        return NULL;
+    }
+
+    size = memoryPoolAlignUp(size == 0 ? 1 : size);
+
+    // 块的数据区按max_align_t对齐，偏移对齐即可
+    MemoryPoolChunk* head = pool->head;
+    if (head) {
+        size_t offset = memoryPoolAlignUp(head->used);
+        if (offset <= head->capacity && head->capacity - offset >= size) {
+            head->used = offset + size;
+            pool->bytesAllocated += size;
+            return head->data + offset;
+        }
+    }
+
+    return memoryPoolAllocSlow(pool, size, MEMORY_POOL_ALIGNMENT);
+}
+
+void* memoryPoolAllocAligned(MemoryPool* pool, size_t size, size_t alignment) {
+    if (!pool || alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        return NULL;
+    }
+    if (size == 0) {
+        size = 1;
+    }
+
+    MemoryPoolChunk* head = pool->head;
+    if (head) {
+        size_t offset = memoryPoolAlignedOffset(head, alignment);
+        if (offset <= head->capacity && head->capacity - offset >= size) {
+            head->used = offset + size;
+            pool->bytesAllocated += size;
+            return head->data + offset;
+        }
+    }
+
+    return memoryPoolAllocSlow(pool, size, alignment);
+}
+
+char* memoryPoolStrndup(MemoryPool* pool, const char* str, size_t length) {
+    if (!str && length > 0) {
+        return NULL;
+    }
+
+    // 字符串不需要对齐，紧挨着存放
+    char* copy = (char*)memoryPoolAllocAligned(pool, length + 1, 1);
+    if (!copy) {
+        return NULL;
+    }
+    if (length > 0) {
+        memcpy(copy, str, length);
+    }
+    copy[length] = '\0';
+    return copy;
+}
+
+void memoryPoolReset(MemoryPool* pool) {
+    if (!pool) {
+        return;
+    }
+
+    // 保留一个普通容量的块，避免下一轮分配立即向系统申请内存
+    MemoryPoolChunk* kept = NULL;
+    MemoryPoolChunk* chunk = pool->head;
+    while (chunk) {
+        MemoryPoolChunk* next = chunk->next;
+        if (!kept && chunk->capacity == pool->chunkSize) {
+            kept = chunk;
+        } else {
+            free(chunk);
+        }
+        chunk = next;
+    }
+
+    if (kept) {
+        kept->next = NULL;
+        kept->used = 0;
+    }
+    pool->head = kept;
+    pool->chunkCount = kept ? 1 : 0;
+    pool->bytesAllocated = 0;
+}
+
+// ==================== 标记和回滚 ====================
+
+MemoryPoolMark memoryPoolMark(const MemoryPool* pool) {
+    MemoryPoolMark mark = { NULL, 0, 0, 0 };
+    if (pool) {
+        mark.chunk = pool->head;
+        mark.used = pool->head ? pool->head->used : 0;
+        mark.serial = pool->nextSerial;
+        mark.bytesAllocated = pool->bytesAllocated;
+    }
+    return mark;
+}
+
+void memoryPoolRelease(MemoryPool* pool, MemoryPoolMark mark) {
+    if (!pool) {
+        return;
+    }
+
+    // 标记之后新建的块都在标记时的当前块之前，或者（大对象块）紧跟在它之后
+    MemoryPoolChunk* chunk = pool->head;
+    while (chunk && chunk != mark.chunk) {
+        MemoryPoolChunk* next = chunk->next;
+        free(chunk);
+        pool->chunkCount--;
+        chunk = next;
+    }
+
+    if (chunk) {
+        MemoryPoolChunk* after = chunk->next;
+        while (after && after->serial >= mark.serial) {
+            MemoryPoolChunk* next = after->next;
+            free(after);
+            pool->chunkCount--;
+            after = next;
+        }
+        chunk->next = after;
+        chunk->used = mark.used;
+    }
+
+    pool->head = chunk;
+    pool->bytesAllocated = mark.bytesAllocated;
+}
+
+// ==================== 统计 ====================
+
+size_t memoryPoolBytesAllocated(const MemoryPool* pool) {
+    return pool ? pool->bytesAllocated : 0;
+}
+
+size_t memoryPoolChunkCount(const MemoryPool* pool) {
+    return pool ? pool->chunkCount : 0;
+}
+
+// ==================== 编译阶段内存池 ====================
+
+static MemoryPool* phaseArenas[MEMORY_PHASE_COUNT];
+
+MemoryPool* memoryPhaseArena(MemoryPhase phase) {
+    if ((unsigned)phase >= MEMORY_PHASE_COUNT) {
+        return NULL;
+    }
+    if (!phaseArenas[phase]) {
+        phaseArenas[phase] = createMemoryPool(0);
+    }
+    return phaseArenas[phase];
+}
+
+void memoryPhaseReset(MemoryPhase phase) {
+    if ((unsigned)phase < MEMORY_PHASE_COUNT) {
+        memoryPoolReset(phaseArenas[phase]);
+    }
+}
+
+void memoryPhaseDestroyAll(void) {
+    for (size_t i = 0; i < MEMORY_PHASE_COUNT; i++) {
+        destroyMemoryPool(phaseArenas[i]);
+        phaseArenas[i] = NULL;
+    }
+}
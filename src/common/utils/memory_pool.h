@@ -0,0 +1,169 @@
+#ifndef MEMORY_POOL_H
+#define MEMORY_POOL_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @brief 内存池块（内部使用）
+ */
+typedef struct MemoryPoolChunk MemoryPoolChunk;
+
+/**
+ * @brief 内存池（bump分配器）
+ *
+ * 从大块内存中顺序切分小对象，单个对象不能单独释放，
+ * 所有对象在memoryPoolReset或destroyMemoryPool时一次性释放。
+ * 适合生命周期相同的大量小对象，例如一次词法分析产生的全部token。
+ * 非线程安全。
+ */
+typedef struct {
+    MemoryPoolChunk* head;      // 当前分配所用的块（链表头）
+    size_t chunkSize;           // 普通块的容量
+    size_t bytesAllocated;      // 已分配给调用者的字节数
+    size_t chunkCount;          // 当前持有的块数
+    size_t nextSerial;          // 下一个新块的序号
+} MemoryPool;
+
+/**
+ * @brief 内存池标记
+ *
+ * 由memoryPoolMark记录的分配位置，memoryPoolRelease回滚到这里，
+ * 释放标记之后分配的全部对象。
+ */
+typedef struct {
+    MemoryPoolChunk* chunk;     // 标记时的当前块
+    size_t used;                // 标记时当前块已使用的字节数
+    size_t bytesAllocated;      // 标记时已分配的字节数
+    size_t serial;              // 标记时的下一个块序号
+} MemoryPoolMark;
+
+// ==================== 构造函数和析构函数 ====================
+
+/**
+ * @brief 创建内存池
+ * @param chunkSize 每个块的容量（0表示使用默认值64KB）
+ * @return 新创建的内存池，失败返回NULL
+ */
+MemoryPool* createMemoryPool(size_t chunkSize);
+
+/**
+ * @brief 销毁内存池及其分配的全部对象
+ * @param pool 要销毁的内存池
+ */
+void destroyMemoryPool(MemoryPool* pool);
+
+// ==================== 分配 ====================
+
+/**
+ * @brief 从内存池分配内存
+ *
+ * 返回的地址按max_align_t对齐。超过块容量一半的请求单独分配一个块。
+ *
+ * @param pool 内存池
+ * @param size 字节数
+ * @return 分配的内存，失败返回NULL
+ */
+void* memoryPoolAlloc(MemoryPool* pool, size_t size);
+
+/**
+ * @brief 按指定对齐从内存池分配内存
+ *
+ * 对齐可以小于max_align_t（例如字符串按1字节紧凑存放），
+ * 也可以更大（例如按缓存行对齐的数组）。
+ *
+ * @param pool 内存池
+ * @param size 字节数
+ * @param alignment 对齐字节数（2的幂）
+ * @return 分配的内存，失败或alignment不是2的幂时返回NULL
+ */
+void* memoryPoolAllocAligned(MemoryPool* pool, size_t size, size_t alignment);
+
+/**
+ * @brief 在内存池中复制一段字符串
+ * @param pool 内存池
+ * @param str 源字符串（不要求以'\0'结尾）
+ * @param length 复制的长度
+ * @return 以'\0'结尾的副本，失败返回NULL
+ */
+char* memoryPoolStrndup(MemoryPool* pool, const char* str, size_t length);
+
+/**
+ * @brief 释放内存池中的全部对象
+ *
+ * 保留一个普通块供后续分配复用，其余块归还给系统。
+ *
+ * @param pool 内存池
+ */
+void memoryPoolReset(MemoryPool* pool);
+
+// ==================== 标记和回滚 ====================
+
+/**
+ * @brief 记录当前分配位置
+ * @param pool 内存池
+ * @return 标记
+ */
+MemoryPoolMark memoryPoolMark(const MemoryPool* pool);
+
+/**
+ * @brief 回滚到标记，释放标记之后分配的全部对象
+ *
+ * 标记之后新建的块归还给系统，耗时与块数成正比，与对象数无关。
+ * 标记必须按后进先出的顺序回滚；memoryPoolReset之后之前的标记全部失效。
+ *
+ * @param pool 内存池
+ * @param mark memoryPoolMark返回的标记
+ */
+void memoryPoolRelease(MemoryPool* pool, MemoryPoolMark mark);
+
+// ==================== 统计 ====================
+
+/**
+ * @brief 获取已分配给调用者的字节数
+ */
+size_t memoryPoolBytesAllocated(const MemoryPool* pool);
+
+/**
+ * @brief 获取当前持有的块数
+ */
+size_t memoryPoolChunkCount(const MemoryPool* pool);
+
+// ==================== 编译阶段内存池 ====================
+
+/**
+ * @brief 编译阶段
+ *
+ * 每个阶段有一个全局内存池，阶段内的临时对象都从中分配，
+ * 阶段结束时用memoryPhaseReset一次释放。
+ */
+typedef enum {
+    MEMORY_PHASE_LEXING,        // 词法分析
+    MEMORY_PHASE_AST,           // 语法分析和AST
+    MEMORY_PHASE_IR,            // 中间代码
+    MEMORY_PHASE_CODEGEN,       // 代码生成
+    MEMORY_PHASE_COUNT
+} MemoryPhase;
+
+/**
+ * @brief 获取编译阶段的内存池，第一次调用时创建
+ *
+ * 非线程安全，应在编译线程中使用。
+ *
+ * @param phase 编译阶段
+ * @return 该阶段的内存池，创建失败返回NULL
+ */
+MemoryPool* memoryPhaseArena(MemoryPhase phase);
+
+/**
+ * @brief 释放编译阶段分配的全部对象
+ * @param phase 编译阶段
+ */
+void memoryPhaseReset(MemoryPhase phase);
+
+/**
+ * @brief 销毁全部编译阶段的内存池
+ */
+void memoryPhaseDestroyAll(void);
+
+#endif
@@ -0,0 +1,202 @@
+#include "string_utils.h"
+#include "hash_table.h"
+#include "memory_pool.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// 分片数（2的幂），分片由哈希值第32位起的几位选出。哈希表用低位选组、
+// 最高7位作控制字节，两者都不能与分片位重叠，否则同一分片内的控制字节
+// 只剩3位有效，查找时要多比较许多槽位
+#define STRING_INTERNER_SHARD_BITS 4
+#define STRING_INTERNER_SHARD_SHIFT 32
+#define STRING_INTERNER_SHARDS (1u << STRING_INTERNER_SHARD_BITS)
+
+// 每个分片的内存池块容量
+#define STRING_INTERNER_CHUNK_SIZE (16 * 1024)
+
+/**
+ * @brief 驻留器的一个分片
+ */
+typedef struct {
+    pthread_mutex_t lock;
+    HashTable* table;       // 驻留字符串 -> 它自己（按片段查找时直接取到副本）
+    MemoryPool* pool;       // 驻留字符串的存储，直到驻留器销毁才释放
+} StringInternerShard;
+
+struct StringInterner {
+    StringInternerShard shards[STRING_INTERNER_SHARDS];
+};
+
+// ==================== 内部辅助函数 ====================
+
+static inline StringInternerShard* stringInternerShardFor(StringInterner* interner, uint64_t hash) {
+    return &interner->shards[(hash >> STRING_INTERNER_SHARD_SHIFT) & (STRING_INTERNER_SHARDS - 1)];
+}
+
+/**
+ * @brief 在分片的内存池中保存一份副本（调用者需持有锁）
+ *
+ * 副本前面存放长度，internedStringLength直接读取。
+ */
+static InternedString stringInternerStoreLocked(StringInternerShard* shard, const char* str,
+                                                size_t length, uint64_t hash) {
+    if (length > SIZE_MAX - sizeof(size_t) - 1) {
+        return NULL;
+    }
+
+    char* block = (char*)memoryPoolAlloc(shard->pool, sizeof(size_t) + length + 1);
+    if (!block) {
+        return NULL;
+    }
+    memcpy(block, &length, sizeof(size_t));
+
+    char* copy = block + sizeof(size_t);
+    memcpy(copy, str, length);
+    copy[length] = '\0';
+
+    if (!hashTableInsertHashed(shard->table, copy, hash, copy)) {
+        // 内存池中的空间无法单独归还，留到驻留器销毁时一起释放
+        return NULL;
+    }
+    return copy;
+}
+
+/**
+ * @brief 哈希表取驻留字符串键的长度：读取副本前的长度，键中可以含有'\0'
+ */
+static size_t stringInternerKeyLength(const void* key) {
+    return internedStringLength((InternedString)key);
+}
+
+// ==================== 构造函数和析构函数 ====================
+
+StringInterner* createStringInterner(size_t initialCapacity) {
+    StringInterner* interner = (StringInterner*)calloc(1, sizeof(StringInterner));
+    if (!interner) {
+        return NULL;
+    }
+
+    size_t perShard = (initialCapacity + STRING_INTERNER_SHARDS - 1) / STRING_INTERNER_SHARDS;
+    for (size_t i = 0; i < STRING_INTERNER_SHARDS; i++) {
+        StringInternerShard* shard = &interner->shards[i];
+        shard->table = createStringHashTableWithLength(perShard, stringInternerKeyLength);
+        shard->pool = createMemoryPool(STRING_INTERNER_CHUNK_SIZE);
+        if (!shard->table || !shard->pool || pthread_mutex_init(&shard->lock, NULL) != 0) {
+            destroyHashTable(shard->table);
+            destroyMemoryPool(shard->pool);
+            shard->table = NULL;
+            destroyStringInterner(interner);
+            return NULL;
+        }
+    }
+
+    return interner;
+}
+
+void destroyStringInterner(StringInterner* interner) {
+    if (!interner) {
+        return;
+    }
+
+    // 初始化失败时，第一个table为NULL的分片及其之后的分片都没有初始化
+    for (size_t i = 0; i < STRING_INTERNER_SHARDS && interner->shards[i].table; i++) {
+        StringInternerShard* shard = &interner->shards[i];
+        destroyHashTable(shard->table);
+        destroyMemoryPool(shard->pool);
+        pthread_mutex_destroy(&shard->lock);
+    }
+    free(interner);
+}
+
+// ==================== 驻留 ====================
+
+InternedString stringInternerIntern(StringInterner* interner, const char* str, size_t length) {
+    if (!interner || !str) {
+        return NULL;
+    }
+
+    uint64_t hash = hashTableHashBytes(str, length);
+    StringInternerShard* shard = stringInternerShardFor(interner, hash);
+
+    pthread_mutex_lock(&shard->lock);
+    void* existing;
+    InternedString result = hashTableGetString(shard->table, str, length, hash, &existing)
+                                ? (InternedString)existing
+                                : stringInternerStoreLocked(shard, str, length, hash);
+    pthread_mutex_unlock(&shard->lock);
+
+    return result;
+}
+
+InternedString stringInternerFind(StringInterner* interner, const char* str, size_t length) {
+    if (!interner || !str) {
+        return NULL;
+    }
+
+    uint64_t hash = hashTableHashBytes(str, length);
+    StringInternerShard* shard = stringInternerShardFor(interner, hash);
+
+    pthread_mutex_lock(&shard->lock);
+    void* existing = NULL;
+    hashTableGetString(shard->table, str, length, hash, &existing);
+    pthread_mutex_unlock(&shard->lock);
+
+    return (InternedString)existing;
+}
+
+size_t stringInternerCount(StringInterner* interner) {
+    if (!interner) {
+        return 0;
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < STRING_INTERNER_SHARDS; i++) {
+        StringInternerShard* shard = &interner->shards[i];
+        pthread_mutex_lock(&shard->lock);
+        count += hashTableSize(shard->table);
+        pthread_mutex_unlock(&shard->lock);
+    }
+    return count;
+}
+
+size_t internedStringLength(InternedString str) {
+    if (!str) {
+        return 0;
+    }
+
+    size_t length;
+    memcpy(&length, str - sizeof(size_t), sizeof(size_t));
+    return length;
+}
+
+// ==================== 全局驻留器 ====================
+
+static _Atomic(StringInterner*) globalInterner = NULL;
+static pthread_mutex_t globalInternerLock = PTHREAD_MUTEX_INITIALIZER;
+
+StringInterner* globalStringInterner(void) {
+    StringInterner* interner = atomic_load_explicit(&globalInterner, memory_order_acquire);
+    if (interner) {
+        return interner;
+    }
+
+    pthread_mutex_lock(&globalInternerLock);
+    interner = atomic_load_explicit(&globalInterner, memory_order_relaxed);
+    if (!interner) {
+        interner = createStringInterner(0);
+        atomic_store_explicit(&globalInterner, interner, memory_order_release);
+    }
+    pthread_mutex_unlock(&globalInternerLock);
+
+    return interner;
+}
+
+void globalStringInternerReset(void) {
+    pthread_mutex_lock(&globalInternerLock);
+    StringInterner* interner = atomic_exchange_explicit(&globalInterner, NULL, memory_order_acq_rel);
+    pthread_mutex_unlock(&globalInternerLock);
+
+    destroyStringInterner(interner);
+}
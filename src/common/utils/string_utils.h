@@ -0,0 +1,91 @@
+#ifndef STRING_UTILS_H
+#define STRING_UTILS_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+
+// ==================== 字符串驻留 ====================
+
+/**
+ * @brief 驻留字符串
+ *
+ * 同一个驻留器中内容相同的字符串只保存一份，句柄就是指向这份副本的指针，
+ * 以'\0'结尾，可以直接当作C字符串使用，但不能修改或释放。
+ * 内容中可以含有'\0'（此时strlen比实际短），长度一律用internedStringLength获取。
+ * 比较两个驻留字符串只需比较指针，符号表可以用指针值作为键。
+ * 副本在驻留器销毁之前一直有效。
+ */
+typedef const char* InternedString;
+
+/**
+ * @brief 字符串驻留器
+ *
+ * 标识符、成员名、标签和typedef名在词法分析器、AST和符号表之间共享。
+ * 内部按哈希值分成若干个分片，每个分片有自己的锁、哈希表和内存池，
+ * 多个线程同时驻留时很少争用同一把锁。线程安全。
+ */
+typedef struct StringInterner StringInterner;
+
+/**
+ * @brief 创建字符串驻留器
+ * @param initialCapacity 预计的字符串数量（0表示不预先分配）
+ * @return 新创建的驻留器，失败返回NULL
+ */
+StringInterner* createStringInterner(size_t initialCapacity);
+
+/**
+ * @brief 销毁驻留器，它返回的所有句柄随之失效
+ * @param interner 要销毁的驻留器
+ */
+void destroyStringInterner(StringInterner* interner);
+
+/**
+ * @brief 驻留一段字符串
+ * @param interner 驻留器
+ * @param str 字符串起点（不要求以'\0'结尾，可以直接指向源码；中间的'\0'也算作内容）
+ * @param length 长度
+ * @return 驻留字符串，内存不足返回NULL
+ */
+InternedString stringInternerIntern(StringInterner* interner, const char* str, size_t length);
+
+/**
+ * @brief 驻留一个以'\0'结尾的字符串
+ */
+static inline InternedString stringInternerInternCString(StringInterner* interner, const char* str) {
+    return str ? stringInternerIntern(interner, str, strlen(str)) : NULL;
+}
+
+/**
+ * @brief 查找已驻留的字符串，不存在时不插入
+ * @return 驻留字符串，没有驻留过返回NULL
+ */
+InternedString stringInternerFind(StringInterner* interner, const char* str, size_t length);
+
+/**
+ * @brief 获取已驻留的不同字符串的数量
+ */
+size_t stringInternerCount(StringInterner* interner);
+
+/**
+ * @brief 驻留字符串的长度（不需要strlen）
+ */
+size_t internedStringLength(InternedString str);
+
+// ==================== 全局驻留器 ====================
+
+/**
+ * @brief 进程范围共享的驻留器，第一次调用时创建
+ * @return 全局驻留器，创建失败返回NULL
+ */
+StringInterner* globalStringInterner(void);
+
+/**
+ * @brief 销毁全局驻留器
+ *
+ * 之前得到的全局驻留字符串全部失效，调用者需保证不再有AST或token引用它们。
+ * 之后再调用globalStringInterner会重新创建。
+ */
+void globalStringInternerReset(void);
+
+#endif // STRING_UTILS_H
@@ -3,8 +3,11 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include "../../common/diagnostics/source_location.h"
 #include "../../common/containers/vector.h"
+#include "../../common/utils/string_utils.h"
+#include "../../common/utils/memory_pool.h"
 
 // 前向声明
 typedef struct Type Type;
@@ -83,6 +86,8 @@ typedef struct ASTNode {
     SourceLocation location;       // 源代码位置
     struct ASTNode* parent;        // 父节点指针
     ASTNodeType nodeType;          // 节点类型
+    bool arenaAllocated;           // 是否分配在节点内存池中（随内存池一起释放）
+    uint64_t structuralHash;       // 子树结构哈希的缓存（0表示尚未计算，见astNodeStructuralHash）
 
     // 虚函数表（函数指针）
     void (*accept)(struct ASTNode* self, ASTVisitor* visitor);
@@ -184,7 +189,7 @@ typedef enum {
  */
 typedef struct Declaration {
     ASTNode base;
-    char* name;                    // 声明的名称
+    InternedString name;           // 声明的名称（全局驻留字符串）
     DeclarationKind declKind;      // 声明子类型
     Symbol* symbol;                // 符号表条目（由语义分析器设置）
     StorageClassSpecifier storageClass;  // 存储类
@@ -258,6 +263,107 @@ TranslationUnit* createTranslationUnit(void);
  */
 void destroyTranslationUnit(TranslationUnit* unit);
 
+// ==================== 节点内存池 ====================
+
+/**
+ * @brief 设置当前线程创建AST节点所用的内存池
+ *
+ * 设置之后，各create*函数创建的节点以及节点内部的Vector都从该内存池分配，
+ * DESTROY_AST_NODE和destroyASTNode不再逐个释放它们；整棵树随
+ * memoryPoolReset/memoryPoolRelease一次释放，耗时与块数成正比而不是节点数。
+ * 通常传入memoryPhaseArena(MEMORY_PHASE_AST)。
+ *
+ * 同一棵树中的节点应全部来自内存池或全部来自堆：内存池中的父节点不会
+ * 销毁堆上的子节点。
+ *
+ * @param arena 内存池（NULL表示恢复为堆分配）
+ * @return 之前设置的内存池
+ */
+MemoryPool* astSetNodeArena(MemoryPool* arena);
+
+/**
+ * @brief 获取当前线程创建AST节点所用的内存池
+ * @return 内存池，堆分配时返回NULL
+ */
+MemoryPool* astGetNodeArena(void);
+
+/**
+ * @brief 为AST节点分配内存
+ *
+ * 从当前线程的节点内存池分配，没有设置时从堆分配；
+ * 返回的内存已设置好ASTNode::arenaAllocated，其余成员由调用者初始化。
+ *
+ * 优先使用当前线程的slab内存池，其次是节点内存池。
+ *
+ * @param type 节点类型（决定使用slab内存池中的哪个slab）
+ * @param size 字节数（不小于sizeof(ASTNode)）
+ * @return 分配的内存，失败返回NULL
+ */
+void* astAllocNode(ASTNodeType type, size_t size);
+
+/**
+ * @brief 释放astAllocNode分配的内存（内存池中的节点什么也不做）
+ * @param node 节点
+ */
+void astFreeNode(void* node);
+
+/**
+ * @brief 创建存放子节点的Vector，有节点内存池时分配在内存池中
+ * @param elementSize 每个元素的大小（字节）
+ * @param initialCapacity 初始容量
+ * @return 新创建的Vector，失败返回NULL
+ */
+Vector* astCreateNodeVector(size_t elementSize, size_t initialCapacity);
+
+// ==================== 节点slab内存池 ====================
+
+/**
+ * @brief AST节点slab内存池
+ *
+ * 每种节点类型一个slab（每种节点结构体的大小固定，即按大小分级），
+ * 同一种节点在内存中连续存放，语义分析和IR生成按种类处理节点时缓存命中率更高。
+ * 由ASTBuilder持有，销毁时按块释放整棵树，同时统计节点数。
+ */
+typedef struct ASTSlabArena ASTSlabArena;
+
+/**
+ * @brief 创建slab内存池
+ * @return 新创建的slab内存池，失败返回NULL
+ */
+ASTSlabArena* createASTSlabArena(void);
+
+/**
+ * @brief 销毁slab内存池及其中的全部节点
+ * @param arena 要销毁的slab内存池
+ */
+void destroyASTSlabArena(ASTSlabArena* arena);
+
+/**
+ * @brief 获取slab内存池中分配过的节点数
+ */
+size_t astSlabArenaNodeCount(const ASTSlabArena* arena);
+
+/**
+ * @brief 获取slab内存池已分配的字节数（包括子节点Vector）
+ */
+size_t astSlabArenaBytesAllocated(const ASTSlabArena* arena);
+
+/**
+ * @brief 设置当前线程创建AST节点所用的slab内存池
+ *
+ * 设置之后优先于astSetNodeArena设置的内存池。用完后应把返回值设置回去，
+ * 嵌套的设置按后进先出的顺序恢复。
+ *
+ * @param arena slab内存池（NULL表示不使用）
+ * @return 之前设置的slab内存池
+ */
+ASTSlabArena* astSetSlabArena(ASTSlabArena* arena);
+
+/**
+ * @brief 获取当前线程创建AST节点所用的slab内存池
+ */
+ASTSlabArena* astGetSlabArena(void);
+
 // ==================== 类型检查辅助函数 ====================
 
 /**
@@ -312,6 +418,16 @@ const char* astNodeTypeName(ASTNodeType type);
  */
 void astNodeSetParent(ASTNode* node, ASTNode* parent);
 
+/**
+ * @brief 清除节点及其所有祖先缓存的结构哈希
+ *
+ * 就地修改子树（替换子节点、向列表中添加元素等）之后调用，
+ * 下次需要时重新计算。
+ *
+ * @param node 被修改的节点
+ */
+void astNodeInvalidateStructuralHash(ASTNode* node);
+
 /**
  * @brief 获取节点的源位置
  * @param node AST节点
@@ -329,9 +445,15 @@ SourceLocation astNodeGetLocation(const ASTNode* node);
 #define AST_AS_TYPE_SPECIFIER(ptr) ((TypeSpecifier*)(ptr))
 #define AST_AS_TRANSLATION_UNIT(ptr) ((TranslationUnit*)(ptr))
 
-// 销毁宏 - 对所有 AST 节点类型都有效
+// 销毁宏 - 对所有 AST 节点类型都有效（内存池中的节点随内存池释放，这里跳过）
 #define DESTROY_AST_NODE(node) \
-    do { if ((node) != NULL) { ASTNode* _node = (ASTNode*)(node); _node->destroy(_node); (node) = NULL; } } while(0)
+    do { \
+        if ((node) != NULL) { \
+            ASTNode* _node = (ASTNode*)(node); \
+            if (!_node->arenaAllocated) { _node->destroy(_node); } \
+            (node) = NULL; \
+        } \
+    } while(0)
 
 // 类型检查宏
 #define AST_IS_LITERAL_EXPR(expr) \
@@ -44,13 +44,27 @@ static bool validateNodeName(const char* name) {
 /**
  * @brief 创建源位置
  */
-static SourceLocation createLocation(DiagnosticEngine* diagnostics, int line, int column) {
-    SourceLocation loc;
-    loc.filename = NULL;
-    loc.line = line;
-    loc.column = column;
-    loc.offset = 0;
-    return loc;
+static SourceLocation createLocation(DiagnosticEngine* diagnostics, uint32_t offset) {
+    return createSourceLocation(INVALID_FILE_ID, offset);
+}
+
+/**
+ * @brief 让接下来的create*调用从构建器的slab内存池分配节点
+ *
+ * 只在一次节点创建期间生效，必须与builderLeaveArena成对使用；
+ * 构建器不会在自己的函数之外改变线程的slab内存池。
+ *
+ * @return 之前设置的slab内存池
+ */
+static ASTSlabArena* builderEnterArena(ASTBuilder* builder) {
+    return astSetSlabArena(builder->arena);
+}
+
+/**
+ * @brief 恢复builderEnterArena之前的slab内存池
+ */
+static void builderLeaveArena(ASTSlabArena* previous) {
+    astSetSlabArena(previous);
 }
 
 // ==================== 构造函数和析构函数 ====================
@@ -72,15 +86,22 @@ ASTBuilder* createASTBuilder(DiagnosticEngine* diagnostics) {
     }
 
     builder->diagnostics = diagnostics;
+    builder->arena = createASTSlabArena();
+    if (!builder->arena) {
+        free(builder);
+        return NULL;
+    }
+
+    // 根节点也分配在构建器的slab内存池中
+    ASTSlabArena* previous = builderEnterArena(builder);
     builder->root = createTranslationUnit();
-    builder->nodePool = vectorCreate(sizeof(ASTNode*), 4);
+    builderLeaveArena(previous);
     builder->scopeStack = vectorCreate(sizeof(SymbolTable*), 4);
 
-    if (!builder->root || !builder->nodePool || !builder->scopeStack) {
+    if (!builder->root || !builder->scopeStack) {
         // 清理已分配的资源
-        if (builder->root) destroyTranslationUnit(builder->root);
-        if (builder->nodePool) vectorDestroy(builder->nodePool, NULL);
         if (builder->scopeStack) vectorDestroy(builder->scopeStack, NULL);
+        destroyASTSlabArena(builder->arena);
         free(builder);
         return NULL;
     }
@@ -93,15 +114,8 @@ void destroyASTBuilder(ASTBuilder* builder) {
         return;
     }
 
-    // 销毁根节点
-    if (builder->root) {
-        destroyTranslationUnit(builder->root);
-    }
-
-    // 销毁节点池（注意：节点已被根节点销毁，这里只需要销毁容器）
-    if (builder->nodePool) {
-        vectorDestroy(builder->nodePool, NULL);
-    }
+    // 按块释放全部节点（不逐个销毁）
+    destroyASTSlabArena(builder->arena);
 
     // 销毁作用域栈（注意：符号表不由我们管理，只销毁容器）
     if (builder->scopeStack) {
@@ -119,6 +133,10 @@ DiagnosticEngine* astBuilderGetDiagnostics(ASTBuilder* builder) {
     return builder ? builder->diagnostics : NULL;
 }
 
+ASTSlabArena* astBuilderGetArena(ASTBuilder* builder) {
+    return builder ? builder->arena : NULL;
+}
+
 // ==================== 声明构建函数 ====================
 
 Declaration* astBuilderAddVariableDecl(ASTBuilder* builder, const char* name,
@@ -140,7 +158,9 @@ Declaration* astBuilderAddVariableDecl(ASTBuilder* builder, const char* name,
     }
 
     // 创建变量声明
+    ASTSlabArena* previous = builderEnterArena(builder);
     Declaration* decl = createVariableDeclaration(name, type, initializer, location);
+    builderLeaveArena(previous);
     if (!decl) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -153,7 +173,8 @@ Declaration* astBuilderAddVariableDecl(ASTBuilder* builder, const char* name,
 
     // 添加到翻译单元
     if (builder->root && builder->root->declarations) {
-        vectorPushBack(builder->root->declarations, &decl);
+        VECTOR_PUSH_BACK(builder->root->declarations, Declaration*, decl);
+        astNodeInvalidateStructuralHash(&builder->root->base);
     }
 
     return decl;
@@ -178,7 +199,9 @@ Declaration* astBuilderAddFunctionDecl(ASTBuilder* builder, const char* name,
     }
 
     // 创建函数声明
+    ASTSlabArena* previous = builderEnterArena(builder);
     Declaration* decl = createFunctionDeclaration(name, returnType, parameters, body, location);
+    builderLeaveArena(previous);
     if (!decl) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -191,7 +214,8 @@ Declaration* astBuilderAddFunctionDecl(ASTBuilder* builder, const char* name,
 
     // 添加到翻译单元
     if (builder->root && builder->root->declarations) {
-        vectorPushBack(builder->root->declarations, &decl);
+        VECTOR_PUSH_BACK(builder->root->declarations, Declaration*, decl);
+        astNodeInvalidateStructuralHash(&builder->root->base);
     }
 
     return decl;
@@ -215,7 +239,9 @@ Declaration* astBuilderAddStructDecl(ASTBuilder* builder, const char* name,
     }
 
     // 创建结构体声明
+    ASTSlabArena* previous = builderEnterArena(builder);
     Declaration* decl = createStructDeclaration(name, members, location);
+    builderLeaveArena(previous);
     if (!decl) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -228,7 +254,8 @@ Declaration* astBuilderAddStructDecl(ASTBuilder* builder, const char* name,
 
     // 添加到翻译单元
     if (builder->root && builder->root->declarations) {
-        vectorPushBack(builder->root->declarations, &decl);
+        VECTOR_PUSH_BACK(builder->root->declarations, Declaration*, decl);
+        astNodeInvalidateStructuralHash(&builder->root->base);
     }
 
     return decl;
@@ -252,7 +279,9 @@ Declaration* astBuilderAddUnionDecl(ASTBuilder* builder, const char* name,
     }
 
     // 创建联合体声明
+    ASTSlabArena* previous = builderEnterArena(builder);
     Declaration* decl = createUnionDeclaration(name, members, location);
+    builderLeaveArena(previous);
     if (!decl) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -265,7 +294,8 @@ Declaration* astBuilderAddUnionDecl(ASTBuilder* builder, const char* name,
 
     // 添加到翻译单元
     if (builder->root && builder->root->declarations) {
-        vectorPushBack(builder->root->declarations, &decl);
+        VECTOR_PUSH_BACK(builder->root->declarations, Declaration*, decl);
+        astNodeInvalidateStructuralHash(&builder->root->base);
     }
 
     return decl;
@@ -289,7 +319,9 @@ Declaration* astBuilderAddEnumDecl(ASTBuilder* builder, const char* name,
     }
 
     // 创建枚举声明
+    ASTSlabArena* previous = builderEnterArena(builder);
     Declaration* decl = createEnumDeclaration(name, constants, location);
+    builderLeaveArena(previous);
     if (!decl) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -302,7 +334,8 @@ Declaration* astBuilderAddEnumDecl(ASTBuilder* builder, const char* name,
 
     // 添加到翻译单元
     if (builder->root && builder->root->declarations) {
-        vectorPushBack(builder->root->declarations, &decl);
+        VECTOR_PUSH_BACK(builder->root->declarations, Declaration*, decl);
+        astNodeInvalidateStructuralHash(&builder->root->base);
     }
 
     return decl;
@@ -326,7 +359,9 @@ Declaration* astBuilderAddTypedefDecl(ASTBuilder* builder, const char* name,
     }
 
     // 创建typedef声明
+    ASTSlabArena* previous = builderEnterArena(builder);
     Declaration* decl = createTypedefDeclaration(name, aliasedType, location);
+    builderLeaveArena(previous);
     if (!decl) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -339,7 +374,8 @@ Declaration* astBuilderAddTypedefDecl(ASTBuilder* builder, const char* name,
 
     // 添加到翻译单元
     if (builder->root && builder->root->declarations) {
-        vectorPushBack(builder->root->declarations, &decl);
+        VECTOR_PUSH_BACK(builder->root->declarations, Declaration*, decl);
+        astNodeInvalidateStructuralHash(&builder->root->base);
     }
 
     return decl;
@@ -353,7 +389,9 @@ Statement* astBuilderCreateExprStmt(ASTBuilder* builder, Expression* expression,
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Statement* stmt = createExpressionStatement(expression, location);
+    builderLeaveArena(previous);
     if (!stmt) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -372,7 +410,9 @@ Statement* astBuilderCreateCompoundStmt(ASTBuilder* builder, SourceLocation loca
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Statement* stmt = createCompoundStatement(location);
+    builderLeaveArena(previous);
     if (!stmt) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -393,7 +433,9 @@ Statement* astBuilderCreateIfStmt(ASTBuilder* builder, Expression* condition,
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Statement* stmt = createIfStatement(condition, thenStmt, elseStmt, location);
+    builderLeaveArena(previous);
     if (!stmt) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -413,7 +455,9 @@ Statement* astBuilderCreateWhileStmt(ASTBuilder* builder, Expression* condition,
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Statement* stmt = createWhileStatement(condition, body, location);
+    builderLeaveArena(previous);
     if (!stmt) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -433,7 +477,9 @@ Statement* astBuilderCreateDoWhileStmt(ASTBuilder* builder, Statement* body,
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Statement* stmt = createDoWhileStatement(body, condition, location);
+    builderLeaveArena(previous);
     if (!stmt) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -454,7 +500,9 @@ Statement* astBuilderCreateForStmt(ASTBuilder* builder, Expression* init,
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Statement* stmt = createForStatement(init, condition, increment, body, location);
+    builderLeaveArena(previous);
     if (!stmt) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -474,7 +522,9 @@ Statement* astBuilderCreateReturnStmt(ASTBuilder* builder, Expression* returnVal
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Statement* stmt = createReturnStatement(returnValue, location);
+    builderLeaveArena(previous);
     if (!stmt) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -493,7 +543,9 @@ Statement* astBuilderCreateBreakStmt(ASTBuilder* builder, SourceLocation locatio
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Statement* stmt = createBreakStatement(location);
+    builderLeaveArena(previous);
     if (!stmt) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -512,7 +564,9 @@ Statement* astBuilderCreateContinueStmt(ASTBuilder* builder, SourceLocation loca
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Statement* stmt = createContinueStatement(location);
+    builderLeaveArena(previous);
     if (!stmt) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -532,7 +586,9 @@ Statement* astBuilderCreateSwitchStmt(ASTBuilder* builder, Expression* condition
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Statement* stmt = createSwitchStatement(condition, cases, location);
+    builderLeaveArena(previous);
     if (!stmt) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -563,7 +619,9 @@ Statement* astBuilderCreateCaseStmt(ASTBuilder* builder, CaseKind kind,
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Statement* stmt = createCaseStatement(kind, value, statement, location);
+    builderLeaveArena(previous);
     if (!stmt) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -585,7 +643,9 @@ Expression* astBuilderCreateLiteralExpr(ASTBuilder* builder, Token* literal,
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Expression* expr = createLiteralExpr(literal, location);
+    builderLeaveArena(previous);
     if (!expr) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -605,7 +665,9 @@ Expression* astBuilderCreateIdentifierExpr(ASTBuilder* builder, const char* name
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Expression* expr = createIdentifierExpr(name, location);
+    builderLeaveArena(previous);
     if (!expr) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -626,7 +688,9 @@ Expression* astBuilderCreateBinaryOpExpr(ASTBuilder* builder, BinaryOperator op,
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Expression* expr = createBinaryOperatorExpr(op, left, right, location);
+    builderLeaveArena(previous);
     if (!expr) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -647,7 +711,9 @@ Expression* astBuilderCreateUnaryOpExpr(ASTBuilder* builder, UnaryOperator op,
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Expression* expr = createUnaryOperatorExpr(op, operand, isPrefix, location);
+    builderLeaveArena(previous);
     if (!expr) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -668,7 +734,9 @@ Expression* astBuilderCreateAssignmentExpr(ASTBuilder* builder, AssignmentKind k
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Expression* expr = createAssignmentExpr(kind, left, right, location);
+    builderLeaveArena(previous);
     if (!expr) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -689,7 +757,9 @@ Expression* astBuilderCreateTernaryExpr(ASTBuilder* builder, Expression* conditi
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Expression* expr = createTernaryExpr(condition, thenExpr, elseExpr, location);
+    builderLeaveArena(previous);
     if (!expr) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -709,7 +779,9 @@ Expression* astBuilderCreateFunctionCallExpr(ASTBuilder* builder, Expression* ca
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Expression* expr = createFunctionCallExpr(callee, arguments, location);
+    builderLeaveArena(previous);
     if (!expr) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -729,7 +801,9 @@ Expression* astBuilderCreateArraySubscriptExpr(ASTBuilder* builder, Expression*
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Expression* expr = createArraySubscriptExpr(array, index, location);
+    builderLeaveArena(previous);
     if (!expr) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -750,7 +824,9 @@ Expression* astBuilderCreateMemberAccessExpr(ASTBuilder* builder, Expression* ba
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Expression* expr = createMemberAccessExpr(baseExpr, memberName, isArrow, location);
+    builderLeaveArena(previous);
     if (!expr) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -770,7 +846,9 @@ Expression* astBuilderCreateCastExpr(ASTBuilder* builder, TypeSpecifier* targetT
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     Expression* expr = createCastExpr(targetType, operand, location);
+    builderLeaveArena(previous);
     if (!expr) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -792,7 +870,9 @@ TypeSpecifier* astBuilderCreateBasicType(ASTBuilder* builder, BasicTypeKind kind
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     TypeSpecifier* type = createBasicTypeSpecifier(kind, location);
+    builderLeaveArena(previous);
     if (!type) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -812,7 +892,9 @@ TypeSpecifier* astBuilderCreatePointerType(ASTBuilder* builder, TypeSpecifier* b
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     TypeSpecifier* type = createPointerTypeSpecifier(baseType, location);
+    builderLeaveArena(previous);
     if (!type) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -832,7 +914,9 @@ TypeSpecifier* astBuilderCreateArrayType(ASTBuilder* builder, TypeSpecifier* ele
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     TypeSpecifier* type = createArrayTypeSpecifier(elementType, size, location);
+    builderLeaveArena(previous);
     if (!type) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -853,7 +937,9 @@ TypeSpecifier* astBuilderCreateFunctionType(ASTBuilder* builder, TypeSpecifier*
         return NULL;
     }
 
+    ASTSlabArena* previous = builderEnterArena(builder);
     TypeSpecifier* type = createFunctionTypeSpecifier(returnType, parameterTypes, isVariadic, location);
+    builderLeaveArena(previous);
     if (!type) {
         diagnosticEngineEmitDiagnostic(builder->diagnostics,
             DIAGNOSTIC_ERROR,
@@ -883,8 +969,11 @@ bool astBuilderAddStmtToCompound(Statement* compound, Statement* stmt) {
         return false;
     }
 
-    vectorPushBack(comp->statements, &stmt);
+    if (!VECTOR_PUSH_BACK(comp->statements, Statement*, stmt)) {
+        return false;
+    }
     stmt->base.parent = (ASTNode*)compound;
+    astNodeInvalidateStructuralHash((ASTNode*)compound);
 
     return true;
 }
@@ -903,8 +992,11 @@ bool astBuilderAddDeclToCompound(Statement* compound, Declaration* decl) {
         return false;
     }
 
-    vectorPushBack(comp->declarations, &decl);
+    if (!VECTOR_PUSH_BACK(comp->declarations, Declaration*, decl)) {
+        return false;
+    }
     decl->base.parent = (ASTNode*)compound;
+    astNodeInvalidateStructuralHash((ASTNode*)compound);
 
     return true;
 }
@@ -942,12 +1034,5 @@ bool astBuilderValidateStmt(ASTBuilder* builder, Statement* stmt) {
 // ==================== 统计信息 ====================
 
 size_t astBuilderGetNodeCount(ASTBuilder* builder) {
-    if (!builder || !builder->root) {
-        return 0;
-    }
-
-    // TODO: 实现节点计数功能
-    // 可以使用访问者模式遍历AST并计数
-
-    return 0;
+    return builder ? astSlabArenaNodeCount(builder->arena) : 0;
 }
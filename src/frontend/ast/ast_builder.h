@@ -20,23 +20,29 @@ typedef struct SymbolTable SymbolTable;
  * - 提供类型安全的节点创建函数
  * - 自动处理父子关系
  * - 集成错误诊断
- * - 管理节点内存池（可选）
+ * - 持有节点slab内存池，整棵树随构建器一次释放
  * - 维护作用域栈
  *
+ * astBuilder*函数创建的节点都分配在构建器的slab内存池中，同一种节点在内存中
+ * 连续存放。构建器只在这些函数执行期间设置线程的slab内存池，返回前恢复，
+ * 因此多个构建器可以按任意顺序创建和销毁；构建器之外直接调用create*创建的
+ * 节点仍按线程当前的设置分配，不归构建器所有（见astBuilderGetArena）。
+ *
  * 使用示例：
  * @code
  * // 创建构建器
  * ASTBuilder* builder = createASTBuilder(diagnostics);
  *
  * // 创建main函数
- * TypeSpecifier* intType = createBasicTypeSpecifier(BASIC_TYPE_INT, location);
- * CompoundStatement* body = createCompoundStatement(location);
+ * TypeSpecifier* intType = astBuilderCreateBasicType(builder, BASIC_TYPE_INT, location);
+ * Statement* body = astBuilderCreateCompoundStmt(builder, location);
  *
  * Declaration* mainFunc = astBuilderAddFunctionDecl(builder, "main",
- *     intType, NULL, body, location);
+ *     intType, NULL, (CompoundStatement*)body, location);
  *
  * // 添加return语句
- * Expression* zero = createLiteralExpr(createIntegerToken("0", location), location);
+ * Expression* zero = astBuilderCreateLiteralExpr(builder,
+ *     createIntegerToken("0", location), location);
  * Statement* returnStmt = astBuilderCreateReturnStmt(builder, zero, location);
  * astBuilderAddStmtToCompound(body, returnStmt);
  *
@@ -50,7 +56,7 @@ typedef struct SymbolTable SymbolTable;
 typedef struct {
     TranslationUnit* root;          // AST根节点（翻译单元）
     DiagnosticEngine* diagnostics;  // 诊断引擎（用于错误报告）
-    Vector* nodePool;               // 节点内存池（用于内存管理）
+    ASTSlabArena* arena;            // 节点slab内存池（持有全部节点）
     Vector* scopeStack;             // 作用域栈（用于符号表管理）
 } ASTBuilder;
 
@@ -70,7 +76,8 @@ ASTBuilder* createASTBuilder(DiagnosticEngine* diagnostics);
  * @param builder 要销毁的构建器
  *
  * 销毁构建器及其管理的所有AST节点。
- * 注意：这会递归销毁整个AST树。
+ * 节点随slab内存池按块释放，耗时与块数成正比，与节点数无关；
+ * 之后不能再使用从构建器得到的任何节点。
  */
 void destroyASTBuilder(ASTBuilder* builder);
 
@@ -90,6 +97,16 @@ TranslationUnit* astBuilderGetRoot(ASTBuilder* builder);
  */
 DiagnosticEngine* astBuilderGetDiagnostics(ASTBuilder* builder);
 
+/**
+ * @brief 获取构建器的节点slab内存池
+ * @param builder 构建器
+ * @return slab内存池
+ *
+ * 需要直接调用create*函数时，用astSetSlabArena临时设置该内存池，
+ * 创建完成后恢复原来的设置，节点即归构建器所有。
+ */
+ASTSlabArena* astBuilderGetArena(ASTBuilder* builder);
+
 // ==================== 声明构建函数 ====================
 
 /**
@@ -504,8 +521,11 @@ bool astBuilderValidateStmt(ASTBuilder* builder, Statement* stmt);
 
 /**
  * @brief 获取AST节点总数
+ *
+ * 分配节点时计数，不需要遍历AST。
+ *
  * @param builder 构建器
- * @return 节点总数
+ * @return 构建器存在期间创建的节点总数（包括根节点）
  */
 size_t astBuilderGetNodeCount(ASTBuilder* builder);
 
@@ -58,15 +58,19 @@ static void printNodePrefix(ASTDumper* dumper, const char* nodeName, ASTNode* no
 
     // 输出源位置
     if (dumper->showLocation && node) {
-        if (node->location.filename) {
+        const char* filename = sourceLocationGetFilename(&node->location);
+        int line = 0;
+        int column = 0;
+        sourceLocationResolve(&node->location, &line, &column);
+        if (filename) {
             fprintf(dumper->output, " @ \033[0;33m%s:%d:%d\033[0m",
-                    node->location.filename,
-                    node->location.line,
-                    node->location.column);
+                    filename,
+                    line,
+                    column);
         } else {
             fprintf(dumper->output, " @ \033[0;33m%d:%d\033[0m",
-                    node->location.line,
-                    node->location.column);
+                    line,
+                    column);
         }
     }
 
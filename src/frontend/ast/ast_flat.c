@@ -0,0 +1,895 @@
+/**
+ * @file ast_flat.c
+ * @brief 扁平AST实现
+ *
+ * 节点编码见ast_flat.h中FlatAST的说明。
+ */
+
+#include "ast_flat.h"
+#include <stdlib.h>
+#include <string.h>
+
+// 节点数组的初始容量
+#define FLAT_AST_INITIAL_CAPACITY 256
+
+// ==================== 内部辅助函数 ====================
+
+/**
+ * @brief 把四个节点数组扩大到至少能容纳capacity个节点
+ */
+static bool flatAstGrowNodes(FlatAST* ast, uint32_t capacity) {
+    if (capacity <= ast->nodeCapacity) {
+        return true;
+    }
+
+    uint32_t newCapacity = ast->nodeCapacity ? ast->nodeCapacity : FLAT_AST_INITIAL_CAPACITY;
+    while (newCapacity < capacity) {
+        if (newCapacity > UINT32_MAX / 2) {
+            newCapacity = UINT32_MAX;
+            break;
+        }
+        newCapacity *= 2;
+    }
+
+    // 逐个realloc，某一步失败时已扩大的数组仍然可用，容量按最小的算
+    uint8_t* kinds = (uint8_t*)realloc(ast->kinds, newCapacity * sizeof(uint8_t));
+    if (!kinds) {
+        return false;
+    }
+    ast->kinds = kinds;
+
+    uint8_t* flags = (uint8_t*)realloc(ast->flags, newCapacity * sizeof(uint8_t));
+    if (!flags) {
+        return false;
+    }
+    ast->flags = flags;
+
+    uint32_t* offsets = (uint32_t*)realloc(ast->offsets, (size_t)newCapacity * sizeof(uint32_t));
+    if (!offsets) {
+        return false;
+    }
+    ast->offsets = offsets;
+
+    FlatNodeData* data = (FlatNodeData*)realloc(ast->data, (size_t)newCapacity * sizeof(FlatNodeData));
+    if (!data) {
+        return false;
+    }
+    ast->data = data;
+
+    ast->nodeCapacity = newCapacity;
+    return true;
+}
+
+/**
+ * @brief 追加一个节点
+ * @return 节点索引，失败返回FLAT_AST_INVALID
+ */
+static FlatNodeIndex flatAstAddNode(FlatAST* ast, ASTNodeType kind, uint8_t flags,
+                                    uint32_t lhs, uint32_t rhs, SourceLocation location) {
+    if (ast->nodeCount >= FLAT_AST_INVALID || !flatAstGrowNodes(ast, ast->nodeCount + 1)) {
+        return FLAT_AST_INVALID;
+    }
+
+    FlatNodeIndex node = ast->nodeCount++;
+    ast->kinds[node] = (uint8_t)kind;
+    ast->flags[node] = flags;
+    ast->offsets[node] = location.offset;
+    ast->data[node].lhs = lhs;
+    ast->data[node].rhs = rhs;
+    return node;
+}
+
+/**
+ * @brief 在extra中追加count个值
+ * @return 第一个值的下标，失败返回UINT32_MAX
+ */
+static uint32_t flatAstAddExtra(FlatAST* ast, const uint32_t* values, uint32_t count) {
+    size_t start = vectorSize(ast->extra);
+    if (start + count >= UINT32_MAX || !vectorResize(ast->extra, start + count, NULL)) {
+        return UINT32_MAX;
+    }
+    if (count > 0) {
+        memcpy(&VECTOR_AT(ast->extra, uint32_t, start), values, count * sizeof(uint32_t));
+    }
+    return (uint32_t)start;
+}
+
+/**
+ * @brief 在extra中追加一个节点列表[count, items...]
+ * @return 列表的下标，失败返回UINT32_MAX
+ */
+static uint32_t flatAstAddList(FlatAST* ast, const FlatNodeIndex* items, uint32_t count) {
+    if (count > 0 && !items) {
+        return UINT32_MAX;
+    }
+
+    uint32_t start = flatAstAddExtra(ast, &count, 1);
+    if (start == UINT32_MAX || flatAstAddExtra(ast, items, count) == UINT32_MAX) {
+        return UINT32_MAX;
+    }
+    return start;
+}
+
+/**
+ * @brief 把名称驻留后加入names
+ * @return names下标（name为NULL时返回0），失败返回UINT32_MAX
+ */
+static uint32_t flatAstAddName(FlatAST* ast, const char* name) {
+    if (!name) {
+        return 0;
+    }
+
+    InternedString interned = stringInternerInternCString(globalStringInterner(), name);
+    if (!interned || vectorSize(ast->names) >= UINT32_MAX ||
+        !VECTOR_PUSH_BACK(ast->names, InternedString, interned)) {
+        return UINT32_MAX;
+    }
+    return (uint32_t)(vectorSize(ast->names) - 1);
+}
+
+/**
+ * @brief 记录构建失败
+ *
+ * 失败是粘滞的：之后flatAstBuilderFinish返回NULL，即使调用者没有检查某次的返回值。
+ *
+ * @return FLAT_AST_INVALID
+ */
+static FlatNodeIndex flatAstBuilderFail(FlatASTBuilder* builder) {
+    if (builder) {
+        builder->failed = true;
+    }
+    return FLAT_AST_INVALID;
+}
+
+/**
+ * @brief 检查必需的子节点：已创建的节点，且不是FLAT_AST_NONE
+ */
+static inline bool flatAstIsChild(const FlatASTBuilder* builder, FlatNodeIndex child) {
+    return builder && builder->ast && child != FLAT_AST_NONE && child < builder->ast->nodeCount;
+}
+
+/**
+ * @brief 检查可选的子节点：FLAT_AST_NONE或已创建的节点（FLAT_AST_INVALID不行）
+ */
+static inline bool flatAstIsOptionalChild(const FlatASTBuilder* builder, FlatNodeIndex child) {
+    return child == FLAT_AST_NONE || flatAstIsChild(builder, child);
+}
+
+/**
+ * @brief 检查节点列表中的每一项都是已创建的节点
+ */
+static bool flatAstIsChildList(const FlatASTBuilder* builder, const FlatNodeIndex* items,
+                               uint32_t count) {
+    if (count > 0 && !items) {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (!flatAstIsChild(builder, items[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 创建只用到data字段的节点
+ */
+static inline FlatNodeIndex flatAstBuilderAdd(FlatASTBuilder* builder, ASTNodeType kind, uint8_t flags,
+                                              uint32_t lhs, uint32_t rhs, SourceLocation location) {
+    if (!builder || !builder->ast) {
+        return flatAstBuilderFail(builder);
+    }
+    FlatNodeIndex node = flatAstAddNode(builder->ast, kind, flags, lhs, rhs, location);
+    return node == FLAT_AST_INVALID ? flatAstBuilderFail(builder) : node;
+}
+
+/**
+ * @brief 创建名称放在lhs中的节点
+ */
+static FlatNodeIndex flatAstBuilderAddNamed(FlatASTBuilder* builder, ASTNodeType kind, const char* name,
+                                            uint32_t rhs, SourceLocation location) {
+    if (!builder || !builder->ast) {
+        return flatAstBuilderFail(builder);
+    }
+
+    uint32_t nameIndex = flatAstAddName(builder->ast, name);
+    if (nameIndex == UINT32_MAX) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, kind, 0, nameIndex, rhs, location);
+}
+
+/**
+ * @brief 把声明加到翻译单元
+ */
+static FlatNodeIndex flatAstBuilderAddTopLevel(FlatASTBuilder* builder, FlatNodeIndex decl) {
+    if (!flatAstIsChild(builder, decl) || !VECTOR_PUSH_BACK(builder->topLevel, FlatNodeIndex, decl)) {
+        return flatAstBuilderFail(builder);
+    }
+    return decl;
+}
+
+// ==================== 扁平AST ====================
+
+void destroyFlatAST(FlatAST* ast) {
+    if (!ast) {
+        return;
+    }
+
+    free(ast->kinds);
+    free(ast->flags);
+    free(ast->offsets);
+    free(ast->data);
+    vectorDestroy(ast->extra, NULL);
+    vectorDestroy(ast->names, NULL);
+    vectorDestroy(ast->literals, NULL);
+    free(ast);
+}
+
+InternedString flatAstNodeName(const FlatAST* ast, FlatNodeIndex node) {
+    if (!ast || node >= ast->nodeCount) {
+        return NULL;
+    }
+
+    FlatNodeData data = ast->data[node];
+    switch (flatAstKind(ast, node)) {
+        case AST_NODE_IDENTIFIER_EXPR:
+        case AST_NODE_LABELED_STATEMENT:
+        case AST_NODE_GOTO_STATEMENT:
+        case AST_NODE_VARIABLE_DECLARATION:
+        case AST_NODE_FUNCTION_DECLARATION:
+        case AST_NODE_STRUCT_DECLARATION:
+        case AST_NODE_UNION_DECLARATION:
+        case AST_NODE_ENUM_DECLARATION:
+        case AST_NODE_TYPEDEF_DECLARATION:
+        case AST_NODE_STRUCT_TYPE_SPECIFIER:
+        case AST_NODE_UNION_TYPE_SPECIFIER:
+        case AST_NODE_ENUM_TYPE_SPECIFIER:
+        case AST_NODE_TYPEDEF_NAME_SPECIFIER:
+            return flatAstName(ast, data.lhs);
+        case AST_NODE_MEMBER_ACCESS_EXPR:
+            return flatAstName(ast, data.rhs);
+        default:
+            return NULL;
+    }
+}
+
+Token* flatAstLiteral(const FlatAST* ast, FlatNodeIndex node) {
+    if (!ast || node >= ast->nodeCount || flatAstKind(ast, node) != AST_NODE_LITERAL_EXPR) {
+        return NULL;
+    }
+    return VECTOR_AT(ast->literals, Token*, ast->data[node].lhs);
+}
+
+/**
+ * @brief 收集子节点（跳过FLAT_AST_NONE）
+ */
+static inline void flatAstCollect(FlatNodeIndex child, FlatNodeIndex* children,
+                                  size_t maxChildren, size_t* count) {
+    if (child == FLAT_AST_NONE) {
+        return;
+    }
+    if (children && *count < maxChildren) {
+        children[*count] = child;
+    }
+    (*count)++;
+}
+
+static void flatAstCollectList(const FlatAST* ast, uint32_t index, FlatNodeIndex* children,
+                               size_t maxChildren, size_t* count) {
+    FlatNodeList list = flatAstList(ast, index);
+    for (uint32_t i = 0; i < list.count; i++) {
+        flatAstCollect(list.items[i], children, maxChildren, count);
+    }
+}
+
+size_t flatAstGetChildren(const FlatAST* ast, FlatNodeIndex node,
+                          FlatNodeIndex* children, size_t maxChildren) {
+    if (!ast || node >= ast->nodeCount) {
+        return 0;
+    }
+
+    FlatNodeData data = ast->data[node];
+    const uint32_t* extra;
+    size_t count = 0;
+
+    switch (flatAstKind(ast, node)) {
+        // 两个子节点依次放在lhs和rhs中
+        case AST_NODE_BINARY_OPERATOR_EXPR:
+        case AST_NODE_ASSIGNMENT_EXPR:
+        case AST_NODE_ARRAY_SUBSCRIPT_EXPR:
+        case AST_NODE_CAST_EXPR:
+        case AST_NODE_WHILE_STATEMENT:
+        case AST_NODE_DO_WHILE_STATEMENT:
+        case AST_NODE_CASE_STATEMENT:
+        case AST_NODE_ARRAY_TYPE_SPECIFIER:
+            flatAstCollect(data.lhs, children, maxChildren, &count);
+            flatAstCollect(data.rhs, children, maxChildren, &count);
+            break;
+
+        // 只有lhs一个子节点
+        case AST_NODE_UNARY_OPERATOR_EXPR:
+        case AST_NODE_MEMBER_ACCESS_EXPR:
+        case AST_NODE_EXPRESSION_STATEMENT:
+        case AST_NODE_RETURN_STATEMENT:
+        case AST_NODE_POINTER_TYPE_SPECIFIER:
+            flatAstCollect(data.lhs, children, maxChildren, &count);
+            break;
+
+        // lhs是名称，rhs是子节点
+        case AST_NODE_LABELED_STATEMENT:
+        case AST_NODE_TYPEDEF_DECLARATION:
+            flatAstCollect(data.rhs, children, maxChildren, &count);
+            break;
+
+        case AST_NODE_TERNARY_EXPR:
+        case AST_NODE_IF_STATEMENT:
+            extra = flatAstExtra(ast, data.rhs);
+            flatAstCollect(data.lhs, children, maxChildren, &count);
+            flatAstCollect(extra[0], children, maxChildren, &count);
+            flatAstCollect(extra[1], children, maxChildren, &count);
+            break;
+
+        case AST_NODE_FUNCTION_CALL_EXPR:
+        case AST_NODE_SWITCH_STATEMENT:
+        case AST_NODE_FUNCTION_TYPE_SPECIFIER:
+            flatAstCollect(data.lhs, children, maxChildren, &count);
+            flatAstCollectList(ast, data.rhs, children, maxChildren, &count);
+            break;
+
+        case AST_NODE_TRANSLATION_UNIT:
+            flatAstCollectList(ast, data.lhs, children, maxChildren, &count);
+            break;
+
+        case AST_NODE_COMPOUND_STATEMENT:
+            flatAstCollectList(ast, data.lhs, children, maxChildren, &count);
+            flatAstCollectList(ast, data.rhs, children, maxChildren, &count);
+            break;
+
+        case AST_NODE_FOR_STATEMENT:
+            extra = flatAstExtra(ast, data.lhs);
+            flatAstCollect(extra[0], children, maxChildren, &count);
+            flatAstCollect(extra[1], children, maxChildren, &count);
+            flatAstCollect(extra[2], children, maxChildren, &count);
+            flatAstCollect(data.rhs, children, maxChildren, &count);
+            break;
+
+        case AST_NODE_VARIABLE_DECLARATION:
+            extra = flatAstExtra(ast, data.rhs);
+            flatAstCollect(extra[0], children, maxChildren, &count);
+            flatAstCollect(extra[1], children, maxChildren, &count);
+            break;
+
+        case AST_NODE_FUNCTION_DECLARATION:
+            extra = flatAstExtra(ast, data.rhs);
+            flatAstCollect(extra[0], children, maxChildren, &count);
+            flatAstCollectList(ast, extra[1], children, maxChildren, &count);
+            flatAstCollect(extra[2], children, maxChildren, &count);
+            break;
+
+        case AST_NODE_STRUCT_DECLARATION:
+        case AST_NODE_UNION_DECLARATION:
+            flatAstCollectList(ast, data.rhs, children, maxChildren, &count);
+            break;
+
+        case AST_NODE_ENUM_DECLARATION:
+            extra = flatAstExtra(ast, data.rhs);
+            for (uint32_t i = 0; i < extra[0]; i++) {
+                flatAstCollect(extra[2 + 2 * i], children, maxChildren, &count);
+            }
+            break;
+
+        // 结构体/联合体/枚举类型说明符的declaration是引用，不是子节点；
+        // 其余节点没有子节点
+        default:
+            break;
+    }
+
+    return count;
+}
+
+size_t flatAstBytesUsed(const FlatAST* ast) {
+    if (!ast) {
+        return 0;
+    }
+
+    size_t perNode = 2 * sizeof(uint8_t) + sizeof(uint32_t) + sizeof(FlatNodeData);
+    return (size_t)ast->nodeCapacity * perNode +
+           vectorCapacity(ast->extra) * sizeof(uint32_t) +
+           vectorCapacity(ast->names) * sizeof(InternedString) +
+           vectorCapacity(ast->literals) * sizeof(Token*);
+}
+
+// ==================== 构建器 ====================
+
+FlatASTBuilder* createFlatASTBuilder(FileId fileId) {
+    FlatASTBuilder* builder = (FlatASTBuilder*)calloc(1, sizeof(FlatASTBuilder));
+    FlatAST* ast = (FlatAST*)calloc(1, sizeof(FlatAST));
+    if (!builder || !ast) {
+        free(builder);
+        free(ast);
+        return NULL;
+    }
+
+    builder->ast = ast;
+    ast->fileId = fileId;
+    ast->extra = vectorCreate(sizeof(uint32_t), 256);
+    ast->names = vectorCreate(sizeof(InternedString), 64);
+    ast->literals = vectorCreate(sizeof(Token*), 64);
+    builder->topLevel = vectorCreate(sizeof(FlatNodeIndex), 16);
+
+    // names[0]表示匿名；0号节点是翻译单元，声明列表在Finish时写入
+    InternedString anonymous = NULL;
+    if (!ast->extra || !ast->names || !ast->literals || !builder->topLevel ||
+        !VECTOR_PUSH_BACK(ast->names, InternedString, anonymous) ||
+        flatAstAddNode(ast, AST_NODE_TRANSLATION_UNIT, 0, 0, 0,
+                       createSourceLocation(fileId, 0)) != 0) {
+        destroyFlatASTBuilder(builder);
+        return NULL;
+    }
+
+    return builder;
+}
+
+void destroyFlatASTBuilder(FlatASTBuilder* builder) {
+    if (!builder) {
+        return;
+    }
+
+    destroyFlatAST(builder->ast);
+    vectorDestroy(builder->topLevel, NULL);
+    free(builder);
+}
+
+FlatAST* flatAstBuilderFinish(FlatASTBuilder* builder) {
+    if (!builder || !builder->ast || builder->failed) {
+        return NULL;
+    }
+
+    FlatAST* ast = builder->ast;
+    uint32_t list = flatAstAddList(ast, (const FlatNodeIndex*)vectorData(builder->topLevel),
+                                   (uint32_t)vectorSize(builder->topLevel));
+    if (list == UINT32_MAX) {
+        return NULL;
+    }
+    ast->data[0].lhs = list;
+
+    builder->ast = NULL;
+    return ast;
+}
+
+bool flatAstBuilderReserve(FlatASTBuilder* builder, uint32_t nodeCount) {
+    return builder && builder->ast && flatAstGrowNodes(builder->ast, nodeCount);
+}
+
+// ==================== 声明 ====================
+
+FlatNodeIndex flatAstBuilderCreateVariableDecl(FlatASTBuilder* builder, const char* name,
+                                               FlatNodeIndex type, FlatNodeIndex initializer,
+                                               SourceLocation location) {
+    if (!name || !flatAstIsChild(builder, type) || !flatAstIsOptionalChild(builder, initializer)) {
+        return flatAstBuilderFail(builder);
+    }
+
+    uint32_t fields[2] = { type, initializer };
+    uint32_t extra = flatAstAddExtra(builder->ast, fields, 2);
+    if (extra == UINT32_MAX) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAddNamed(builder, AST_NODE_VARIABLE_DECLARATION, name, extra, location);
+}
+
+FlatNodeIndex flatAstBuilderAddVariableDecl(FlatASTBuilder* builder, const char* name,
+                                            FlatNodeIndex type, FlatNodeIndex initializer,
+                                            SourceLocation location) {
+    return flatAstBuilderAddTopLevel(builder,
+        flatAstBuilderCreateVariableDecl(builder, name, type, initializer, location));
+}
+
+FlatNodeIndex flatAstBuilderAddFunctionDecl(FlatASTBuilder* builder, const char* name,
+                                            FlatNodeIndex returnType,
+                                            const FlatNodeIndex* parameters, uint32_t parameterCount,
+                                            FlatNodeIndex body, SourceLocation location) {
+    if (!name || !flatAstIsChild(builder, returnType) ||
+        !flatAstIsChildList(builder, parameters, parameterCount) ||
+        !flatAstIsOptionalChild(builder, body)) {
+        return flatAstBuilderFail(builder);
+    }
+
+    uint32_t params = flatAstAddList(builder->ast, parameters, parameterCount);
+    if (params == UINT32_MAX) {
+        return flatAstBuilderFail(builder);
+    }
+    uint32_t fields[3] = { returnType, params, body };
+    uint32_t extra = flatAstAddExtra(builder->ast, fields, 3);
+    if (extra == UINT32_MAX) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAddTopLevel(builder,
+        flatAstBuilderAddNamed(builder, AST_NODE_FUNCTION_DECLARATION, name, extra, location));
+}
+
+/**
+ * @brief 创建结构体或联合体声明
+ */
+static FlatNodeIndex flatAstBuilderAddRecordDecl(FlatASTBuilder* builder, ASTNodeType kind,
+                                                 const char* name, const FlatNodeIndex* members,
+                                                 uint32_t memberCount, SourceLocation location) {
+    if (!builder || !builder->ast || !flatAstIsChildList(builder, members, memberCount)) {
+        return flatAstBuilderFail(builder);
+    }
+
+    uint32_t list = flatAstAddList(builder->ast, members, memberCount);
+    if (list == UINT32_MAX) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAddTopLevel(builder,
+        flatAstBuilderAddNamed(builder, kind, name, list, location));
+}
+
+FlatNodeIndex flatAstBuilderAddStructDecl(FlatASTBuilder* builder, const char* name,
+                                          const FlatNodeIndex* members, uint32_t memberCount,
+                                          SourceLocation location) {
+    return flatAstBuilderAddRecordDecl(builder, AST_NODE_STRUCT_DECLARATION, name,
+                                       members, memberCount, location);
+}
+
+FlatNodeIndex flatAstBuilderAddUnionDecl(FlatASTBuilder* builder, const char* name,
+                                         const FlatNodeIndex* members, uint32_t memberCount,
+                                         SourceLocation location) {
+    return flatAstBuilderAddRecordDecl(builder, AST_NODE_UNION_DECLARATION, name,
+                                       members, memberCount, location);
+}
+
+FlatNodeIndex flatAstBuilderAddEnumDecl(FlatASTBuilder* builder, const char* name,
+                                        const char* const* constantNames,
+                                        const FlatNodeIndex* constantValues,
+                                        uint32_t constantCount, SourceLocation location) {
+    if (!builder || !builder->ast || (constantCount > 0 && !constantNames)) {
+        return flatAstBuilderFail(builder);
+    }
+
+    FlatAST* ast = builder->ast;
+    uint32_t extra = flatAstAddExtra(ast, &constantCount, 1);
+    if (extra == UINT32_MAX) {
+        return flatAstBuilderFail(builder);
+    }
+    for (uint32_t i = 0; i < constantCount; i++) {
+        if (constantValues && !flatAstIsOptionalChild(builder, constantValues[i])) {
+            return flatAstBuilderFail(builder);
+        }
+        uint32_t pair[2] = {
+            flatAstAddName(ast, constantNames[i]),
+            constantValues ? constantValues[i] : FLAT_AST_NONE
+        };
+        if (pair[0] == UINT32_MAX || flatAstAddExtra(ast, pair, 2) == UINT32_MAX) {
+            return flatAstBuilderFail(builder);
+        }
+    }
+    return flatAstBuilderAddTopLevel(builder,
+        flatAstBuilderAddNamed(builder, AST_NODE_ENUM_DECLARATION, name, extra, location));
+}
+
+FlatNodeIndex flatAstBuilderAddTypedefDecl(FlatASTBuilder* builder, const char* name,
+                                           FlatNodeIndex aliasedType, SourceLocation location) {
+    if (!name || !flatAstIsChild(builder, aliasedType)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAddTopLevel(builder,
+        flatAstBuilderAddNamed(builder, AST_NODE_TYPEDEF_DECLARATION, name, aliasedType, location));
+}
+
+// ==================== 语句 ====================
+
+FlatNodeIndex flatAstBuilderCreateExprStmt(FlatASTBuilder* builder, FlatNodeIndex expression,
+                                           SourceLocation location) {
+    if (!flatAstIsChild(builder, expression)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_EXPRESSION_STATEMENT, 0, expression, 0, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateCompoundStmt(FlatASTBuilder* builder,
+                                               const FlatNodeIndex* declarations, uint32_t declarationCount,
+                                               const FlatNodeIndex* statements, uint32_t statementCount,
+                                               SourceLocation location) {
+    if (!builder || !builder->ast ||
+        !flatAstIsChildList(builder, declarations, declarationCount) ||
+        !flatAstIsChildList(builder, statements, statementCount)) {
+        return flatAstBuilderFail(builder);
+    }
+
+    uint32_t decls = flatAstAddList(builder->ast, declarations, declarationCount);
+    uint32_t stmts = decls == UINT32_MAX ? UINT32_MAX
+                                         : flatAstAddList(builder->ast, statements, statementCount);
+    if (stmts == UINT32_MAX) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_COMPOUND_STATEMENT, 0, decls, stmts, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateIfStmt(FlatASTBuilder* builder, FlatNodeIndex condition,
+                                         FlatNodeIndex thenStmt, FlatNodeIndex elseStmt,
+                                         SourceLocation location) {
+    if (!flatAstIsChild(builder, condition) || !flatAstIsChild(builder, thenStmt) ||
+        !flatAstIsOptionalChild(builder, elseStmt)) {
+        return flatAstBuilderFail(builder);
+    }
+
+    uint32_t branches[2] = { thenStmt, elseStmt };
+    uint32_t extra = flatAstAddExtra(builder->ast, branches, 2);
+    if (extra == UINT32_MAX) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_IF_STATEMENT, 0, condition, extra, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateWhileStmt(FlatASTBuilder* builder, FlatNodeIndex condition,
+                                            FlatNodeIndex body, SourceLocation location) {
+    if (!flatAstIsChild(builder, condition) || !flatAstIsChild(builder, body)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_WHILE_STATEMENT, 0, condition, body, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateDoWhileStmt(FlatASTBuilder* builder, FlatNodeIndex body,
+                                              FlatNodeIndex condition, SourceLocation location) {
+    if (!flatAstIsChild(builder, condition) || !flatAstIsChild(builder, body)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_DO_WHILE_STATEMENT, 0, body, condition, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateForStmt(FlatASTBuilder* builder, FlatNodeIndex init,
+                                          FlatNodeIndex condition, FlatNodeIndex increment,
+                                          FlatNodeIndex body, SourceLocation location) {
+    if (!flatAstIsChild(builder, body) || !flatAstIsOptionalChild(builder, init) ||
+        !flatAstIsOptionalChild(builder, condition) || !flatAstIsOptionalChild(builder, increment)) {
+        return flatAstBuilderFail(builder);
+    }
+
+    uint32_t header[3] = { init, condition, increment };
+    uint32_t extra = flatAstAddExtra(builder->ast, header, 3);
+    if (extra == UINT32_MAX) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_FOR_STATEMENT, 0, extra, body, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateReturnStmt(FlatASTBuilder* builder, FlatNodeIndex returnValue,
+                                             SourceLocation location) {
+    if (!flatAstIsOptionalChild(builder, returnValue)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_RETURN_STATEMENT, 0, returnValue, 0, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateBreakStmt(FlatASTBuilder* builder, SourceLocation location) {
+    return flatAstBuilderAdd(builder, AST_NODE_BREAK_STATEMENT, 0, 0, 0, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateContinueStmt(FlatASTBuilder* builder, SourceLocation location) {
+    return flatAstBuilderAdd(builder, AST_NODE_CONTINUE_STATEMENT, 0, 0, 0, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateSwitchStmt(FlatASTBuilder* builder, FlatNodeIndex condition,
+                                             const FlatNodeIndex* cases, uint32_t caseCount,
+                                             SourceLocation location) {
+    if (!flatAstIsChild(builder, condition) || !flatAstIsChildList(builder, cases, caseCount)) {
+        return flatAstBuilderFail(builder);
+    }
+
+    uint32_t list = flatAstAddList(builder->ast, cases, caseCount);
+    if (list == UINT32_MAX) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_SWITCH_STATEMENT, 0, condition, list, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateCaseStmt(FlatASTBuilder* builder, CaseKind kind,
+                                           FlatNodeIndex value, FlatNodeIndex statement,
+                                           SourceLocation location) {
+    if (!flatAstIsChild(builder, statement) || !flatAstIsOptionalChild(builder, value) ||
+        (kind == CASE_LABEL && value == FLAT_AST_NONE)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_CASE_STATEMENT, (uint8_t)kind, value, statement, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateLabeledStmt(FlatASTBuilder* builder, const char* labelName,
+                                              FlatNodeIndex statement, SourceLocation location) {
+    if (!labelName || !flatAstIsChild(builder, statement)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAddNamed(builder, AST_NODE_LABELED_STATEMENT, labelName, statement, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateGotoStmt(FlatASTBuilder* builder, const char* labelName,
+                                           SourceLocation location) {
+    if (!labelName) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAddNamed(builder, AST_NODE_GOTO_STATEMENT, labelName, 0, location);
+}
+
+// ==================== 表达式 ====================
+
+FlatNodeIndex flatAstBuilderCreateLiteralExpr(FlatASTBuilder* builder, Token* literal,
+                                              SourceLocation location) {
+    if (!builder || !builder->ast || !literal) {
+        return flatAstBuilderFail(builder);
+    }
+
+    FlatAST* ast = builder->ast;
+    if (vectorSize(ast->literals) >= UINT32_MAX || !VECTOR_PUSH_BACK(ast->literals, Token*, literal)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_LITERAL_EXPR, 0,
+                          (uint32_t)(vectorSize(ast->literals) - 1), 0, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateIdentifierExpr(FlatASTBuilder* builder, const char* name,
+                                                 SourceLocation location) {
+    if (!name) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAddNamed(builder, AST_NODE_IDENTIFIER_EXPR, name, 0, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateBinaryOpExpr(FlatASTBuilder* builder, BinaryOperator op,
+                                               FlatNodeIndex left, FlatNodeIndex right,
+                                               SourceLocation location) {
+    if (!flatAstIsChild(builder, left) || !flatAstIsChild(builder, right)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_BINARY_OPERATOR_EXPR, (uint8_t)op, left, right, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateUnaryOpExpr(FlatASTBuilder* builder, UnaryOperator op,
+                                              FlatNodeIndex operand, bool isPrefix,
+                                              SourceLocation location) {
+    if (!flatAstIsChild(builder, operand)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_UNARY_OPERATOR_EXPR, (uint8_t)op, operand, isPrefix, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateAssignmentExpr(FlatASTBuilder* builder, AssignmentKind kind,
+                                                 FlatNodeIndex left, FlatNodeIndex right,
+                                                 SourceLocation location) {
+    if (!flatAstIsChild(builder, left) || !flatAstIsChild(builder, right)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_ASSIGNMENT_EXPR, (uint8_t)kind, left, right, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateTernaryExpr(FlatASTBuilder* builder, FlatNodeIndex condition,
+                                              FlatNodeIndex thenExpr, FlatNodeIndex elseExpr,
+                                              SourceLocation location) {
+    if (!flatAstIsChild(builder, condition) ||
+        !flatAstIsChild(builder, thenExpr) || !flatAstIsChild(builder, elseExpr)) {
+        return flatAstBuilderFail(builder);
+    }
+
+    uint32_t branches[2] = { thenExpr, elseExpr };
+    uint32_t extra = flatAstAddExtra(builder->ast, branches, 2);
+    if (extra == UINT32_MAX) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_TERNARY_EXPR, 0, condition, extra, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateFunctionCallExpr(FlatASTBuilder* builder, FlatNodeIndex callee,
+                                                   const FlatNodeIndex* arguments, uint32_t argumentCount,
+                                                   SourceLocation location) {
+    if (!flatAstIsChild(builder, callee) || !flatAstIsChildList(builder, arguments, argumentCount)) {
+        return flatAstBuilderFail(builder);
+    }
+
+    uint32_t list = flatAstAddList(builder->ast, arguments, argumentCount);
+    if (list == UINT32_MAX) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_FUNCTION_CALL_EXPR, 0, callee, list, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateArraySubscriptExpr(FlatASTBuilder* builder, FlatNodeIndex array,
+                                                     FlatNodeIndex index, SourceLocation location) {
+    if (!flatAstIsChild(builder, array) || !flatAstIsChild(builder, index)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_ARRAY_SUBSCRIPT_EXPR, 0, array, index, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateMemberAccessExpr(FlatASTBuilder* builder, FlatNodeIndex baseExpr,
+                                                   const char* memberName, bool isArrow,
+                                                   SourceLocation location) {
+    if (!flatAstIsChild(builder, baseExpr) || !memberName) {
+        return flatAstBuilderFail(builder);
+    }
+
+    uint32_t nameIndex = flatAstAddName(builder->ast, memberName);
+    if (nameIndex == UINT32_MAX) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_MEMBER_ACCESS_EXPR, isArrow, baseExpr, nameIndex, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateCastExpr(FlatASTBuilder* builder, FlatNodeIndex targetType,
+                                           FlatNodeIndex operand, SourceLocation location) {
+    if (!flatAstIsChild(builder, targetType) || !flatAstIsChild(builder, operand)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_CAST_EXPR, 0, targetType, operand, location);
+}
+
+// ==================== 类型说明符 ====================
+
+FlatNodeIndex flatAstBuilderCreateBasicType(FlatASTBuilder* builder, BasicTypeKind kind,
+                                            SourceLocation location) {
+    return flatAstBuilderAdd(builder, AST_NODE_BASIC_TYPE_SPECIFIER, (uint8_t)kind, 0, 0, location);
+}
+
+FlatNodeIndex flatAstBuilderCreatePointerType(FlatASTBuilder* builder, FlatNodeIndex baseType,
+                                              SourceLocation location) {
+    if (!flatAstIsChild(builder, baseType)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_POINTER_TYPE_SPECIFIER, 0, baseType, 0, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateArrayType(FlatASTBuilder* builder, FlatNodeIndex elementType,
+                                            FlatNodeIndex size, SourceLocation location) {
+    if (!flatAstIsChild(builder, elementType) || !flatAstIsOptionalChild(builder, size)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_ARRAY_TYPE_SPECIFIER, 0, elementType, size, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateFunctionType(FlatASTBuilder* builder, FlatNodeIndex returnType,
+                                               const FlatNodeIndex* parameterTypes, uint32_t parameterCount,
+                                               bool isVariadic, SourceLocation location) {
+    if (!flatAstIsChild(builder, returnType) ||
+        !flatAstIsChildList(builder, parameterTypes, parameterCount)) {
+        return flatAstBuilderFail(builder);
+    }
+
+    uint32_t list = flatAstAddList(builder->ast, parameterTypes, parameterCount);
+    if (list == UINT32_MAX) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAdd(builder, AST_NODE_FUNCTION_TYPE_SPECIFIER, isVariadic,
+                          returnType, list, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateStructType(FlatASTBuilder* builder, const char* name,
+                                             FlatNodeIndex declaration, SourceLocation location) {
+    if (!flatAstIsOptionalChild(builder, declaration)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAddNamed(builder, AST_NODE_STRUCT_TYPE_SPECIFIER, name, declaration, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateUnionType(FlatASTBuilder* builder, const char* name,
+                                            FlatNodeIndex declaration, SourceLocation location) {
+    if (!flatAstIsOptionalChild(builder, declaration)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAddNamed(builder, AST_NODE_UNION_TYPE_SPECIFIER, name, declaration, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateEnumType(FlatASTBuilder* builder, const char* name,
+                                           FlatNodeIndex declaration, SourceLocation location) {
+    if (!flatAstIsOptionalChild(builder, declaration)) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAddNamed(builder, AST_NODE_ENUM_TYPE_SPECIFIER, name, declaration, location);
+}
+
+FlatNodeIndex flatAstBuilderCreateTypedefName(FlatASTBuilder* builder, const char* typedefName,
+                                              SourceLocation location) {
+    if (!typedefName) {
+        return flatAstBuilderFail(builder);
+    }
+    return flatAstBuilderAddNamed(builder, AST_NODE_TYPEDEF_NAME_SPECIFIER, typedefName, 0, location);
+}
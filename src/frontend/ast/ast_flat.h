@@ -0,0 +1,370 @@
+#ifndef AST_FLAT_H
+#define AST_FLAT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ast.h"
+#include "ast_nodes.h"
+#include "../../common/diagnostics/source_manager.h"
+
+// ==================== 扁平AST ====================
+
+/**
+ * @brief 扁平AST中的节点索引
+ *
+ * 0号节点固定是翻译单元，它不会是任何节点的子节点，
+ * 所以子节点索引为FLAT_AST_NONE表示没有这个子节点（相当于NULL）。
+ * 构建失败用另一个值FLAT_AST_INVALID表示，不会与"没有子节点"混淆。
+ */
+typedef uint32_t FlatNodeIndex;
+
+#define FLAT_AST_NONE ((FlatNodeIndex)0)
+#define FLAT_AST_INVALID ((FlatNodeIndex)UINT32_MAX)
+
+/**
+ * @brief 节点的两个32位数据字段，含义由节点类型决定
+ */
+typedef struct {
+    uint32_t lhs;
+    uint32_t rhs;
+} FlatNodeData;
+
+/**
+ * @brief 节点列表（指向extra数组内部，添加节点后可能失效）
+ */
+typedef struct {
+    const FlatNodeIndex* items;
+    uint32_t count;
+} FlatNodeList;
+
+/**
+ * @brief 扁平AST（结构体数组）
+ *
+ * 与ast.h中的指针图是同一棵树的另一种编码：每个节点只占
+ * kind(1) + flags(1) + offset(4) + data(8) = 14字节，四个数组按节点索引对齐，
+ * 子节点用32位索引表示；放不进data的信息存放在旁路数组中：
+ * - extra：额外的子节点索引和节点列表（列表为[count, item0, item1, ...]）
+ * - names：驻留字符串（0号为NULL，表示匿名）
+ * - literals：字面量token
+ *
+ * 不保存父节点、虚函数表和完整的SourceLocation（整棵树共用一个fileId）。
+ * 节点按创建顺序存放，子节点总在父节点之前，按索引顺序扫描即是后序遍历。
+ *
+ * 各类型节点的编码（"extra→[a, b]"表示字段是extra中的下标，从那里起依次存放a、b；
+ * "list"表示字段是extra中一个节点列表的下标）：
+ *
+ * | 节点类型                  | flags          | lhs                    | rhs                           |
+ * |---------------------------|----------------|------------------------|-------------------------------|
+ * | TRANSLATION_UNIT          |                | list(声明)             |                               |
+ * | LITERAL_EXPR              |                | literals下标           |                               |
+ * | IDENTIFIER_EXPR           |                | names下标              |                               |
+ * | BINARY_OPERATOR_EXPR      | BinaryOperator | left                   | right                         |
+ * | UNARY_OPERATOR_EXPR       | UnaryOperator  | operand                | isPrefix                      |
+ * | ASSIGNMENT_EXPR           | AssignmentKind | left                   | right                         |
+ * | TERNARY_EXPR              |                | condition              | extra→[then, else]            |
+ * | FUNCTION_CALL_EXPR        |                | callee                 | list(实参)                    |
+ * | ARRAY_SUBSCRIPT_EXPR      |                | array                  | index                         |
+ * | MEMBER_ACCESS_EXPR        | isArrow        | baseExpr               | names下标                     |
+ * | CAST_EXPR                 |                | targetType             | operand                       |
+ * | EXPRESSION_STATEMENT      |                | expression             |                               |
+ * | COMPOUND_STATEMENT        |                | list(声明)             | list(语句)                    |
+ * | IF_STATEMENT              |                | condition              | extra→[then, else]            |
+ * | WHILE_STATEMENT           |                | condition              | body                          |
+ * | DO_WHILE_STATEMENT        |                | body                   | condition                     |
+ * | FOR_STATEMENT             |                | extra→[init, cond, inc]| body                          |
+ * | RETURN_STATEMENT          |                | returnValue            |                               |
+ * | SWITCH_STATEMENT          |                | condition              | list(case)                    |
+ * | CASE_STATEMENT            | CaseKind       | value                  | statement                     |
+ * | LABELED_STATEMENT         |                | names下标              | statement                     |
+ * | GOTO_STATEMENT            |                | names下标              |                               |
+ * | VARIABLE_DECLARATION      |                | names下标              | extra→[type, initializer]     |
+ * | FUNCTION_DECLARATION      |                | names下标              | extra→[returnType, list(参数), body] |
+ * | STRUCT/UNION_DECLARATION  |                | names下标              | list(成员)                    |
+ * | ENUM_DECLARATION          |                | names下标              | extra→[count, name0, value0, ...] |
+ * | TYPEDEF_DECLARATION       |                | names下标              | aliasedType                   |
+ * | BASIC_TYPE_SPECIFIER      | BasicTypeKind  |                        |                               |
+ * | POINTER_TYPE_SPECIFIER    |                | baseType               |                               |
+ * | ARRAY_TYPE_SPECIFIER      |                | elementType            | size                          |
+ * | FUNCTION_TYPE_SPECIFIER   | isVariadic     | returnType             | list(参数类型)                |
+ * | STRUCT/UNION/ENUM_TYPE_SPECIFIER |         | names下标              | declaration                   |
+ * | TYPEDEF_NAME_SPECIFIER    |                | names下标              |                               |
+ *
+ * 只读访问是线程安全的。
+ */
+typedef struct {
+    uint8_t* kinds;             // 节点类型（ASTNodeType）
+    uint8_t* flags;             // 运算符、子类型或布尔标志
+    uint32_t* offsets;          // 源文件中的字节偏移
+    FlatNodeData* data;         // 两个数据字段
+    uint32_t nodeCount;         // 节点数
+    uint32_t nodeCapacity;      // 四个节点数组的容量
+    Vector* extra;              // uint32_t
+    Vector* names;              // InternedString
+    Vector* literals;           // Token*
+    FileId fileId;              // 所有节点所在的源文件
+} FlatAST;
+
+/**
+ * @brief 销毁扁平AST（不销毁字面量token）
+ * @param ast 要销毁的扁平AST
+ */
+void destroyFlatAST(FlatAST* ast);
+
+// ==================== 访问 ====================
+
+/**
+ * @brief 获取节点数（包括0号翻译单元）
+ */
+static inline uint32_t flatAstNodeCount(const FlatAST* ast) {
+    return ast ? ast->nodeCount : 0;
+}
+
+/**
+ * @brief 获取节点类型
+ */
+static inline ASTNodeType flatAstKind(const FlatAST* ast, FlatNodeIndex node) {
+    return (ASTNodeType)ast->kinds[node];
+}
+
+/**
+ * @brief 获取节点的flags字段
+ */
+static inline uint8_t flatAstFlags(const FlatAST* ast, FlatNodeIndex node) {
+    return ast->flags[node];
+}
+
+/**
+ * @brief 获取节点的数据字段
+ */
+static inline FlatNodeData flatAstData(const FlatAST* ast, FlatNodeIndex node) {
+    return ast->data[node];
+}
+
+/**
+ * @brief 获取节点的源位置
+ */
+static inline SourceLocation flatAstLocation(const FlatAST* ast, FlatNodeIndex node) {
+    return createSourceLocation(ast->fileId, ast->offsets[node]);
+}
+
+/**
+ * @brief 获取extra数组中从index开始的数据
+ */
+static inline const uint32_t* flatAstExtra(const FlatAST* ast, uint32_t index) {
+    return &VECTOR_AT(ast->extra, uint32_t, index);
+}
+
+/**
+ * @brief 获取extra数组中index处的节点列表
+ */
+static inline FlatNodeList flatAstList(const FlatAST* ast, uint32_t index) {
+    const uint32_t* list = flatAstExtra(ast, index);
+    FlatNodeList result = { list + 1, list[0] };
+    return result;
+}
+
+/**
+ * @brief 获取names中的驻留字符串（0号为NULL）
+ */
+static inline InternedString flatAstName(const FlatAST* ast, uint32_t index) {
+    return VECTOR_AT(ast->names, InternedString, index);
+}
+
+/**
+ * @brief 获取节点的名称（标识符、成员名、标签、声明名、类型名）
+ * @return 驻留字符串，节点没有名称或匿名时返回NULL
+ */
+InternedString flatAstNodeName(const FlatAST* ast, FlatNodeIndex node);
+
+/**
+ * @brief 获取字面量节点的token
+ * @return token，不是字面量节点时返回NULL
+ */
+Token* flatAstLiteral(const FlatAST* ast, FlatNodeIndex node);
+
+/**
+ * @brief 获取节点的直接子节点（按源码顺序，跳过不存在的子节点）
+ * @param ast 扁平AST
+ * @param node 节点
+ * @param children 接收子节点的数组（可为NULL）
+ * @param maxChildren children的容量
+ * @return 子节点总数（可能大于maxChildren，此时只写入前maxChildren个）
+ */
+size_t flatAstGetChildren(const FlatAST* ast, FlatNodeIndex node,
+                          FlatNodeIndex* children, size_t maxChildren);
+
+/**
+ * @brief 获取扁平AST占用的字节数（节点数组和旁路数组）
+ */
+size_t flatAstBytesUsed(const FlatAST* ast);
+
+// ==================== 扁平AST构建器 ====================
+
+/**
+ * @brief 扁平AST构建器
+ *
+ * 与ASTBuilder对应：Add*Decl创建声明并加到翻译单元，Create*只创建节点。
+ * 子节点必须先创建，列表类的子节点以数组传入（解析器可以先把它们收集在
+ * 栈上的临时数组里）。所有函数失败时返回FLAT_AST_INVALID；把FLAT_AST_INVALID
+ * 作为子节点（包括可选的子节点和列表项）传入同样会失败，失败由此一直传到
+ * 调用者。失败是粘滞的，之后flatAstBuilderFinish返回NULL，不会交出缺了
+ * 子树的扁平AST。
+ *
+ * 使用示例：
+ * @code
+ * FlatASTBuilder* builder = createFlatASTBuilder(fileId);
+ * FlatNodeIndex intType = flatAstBuilderCreateBasicType(builder, BASIC_TYPE_INT, location);
+ * FlatNodeIndex zero = flatAstBuilderCreateLiteralExpr(builder, token, location);
+ * FlatNodeIndex ret = flatAstBuilderCreateReturnStmt(builder, zero, location);
+ * FlatNodeIndex body = flatAstBuilderCreateCompoundStmt(builder, NULL, 0, &ret, 1, location);
+ * flatAstBuilderAddFunctionDecl(builder, "main", intType, NULL, 0, body, location);
+ * FlatAST* ast = flatAstBuilderFinish(builder);
+ * destroyFlatASTBuilder(builder);
+ * @endcode
+ */
+typedef struct {
+    FlatAST* ast;               // 正在构建的扁平AST
+    Vector* topLevel;           // 翻译单元的声明（FlatNodeIndex）
+    bool failed;                // 是否有节点构建失败
+} FlatASTBuilder;
+
+/**
+ * @brief 创建扁平AST构建器
+ * @param fileId 节点所在的源文件
+ * @return 新创建的构建器，失败返回NULL
+ */
+FlatASTBuilder* createFlatASTBuilder(FileId fileId);
+
+/**
+ * @brief 销毁构建器（flatAstBuilderFinish之前销毁时一并销毁扁平AST）
+ * @param builder 要销毁的构建器
+ */
+void destroyFlatASTBuilder(FlatASTBuilder* builder);
+
+/**
+ * @brief 写入翻译单元的声明列表，交出扁平AST
+ *
+ * 之后扁平AST由调用者持有，构建器不能再添加节点。
+ *
+ * @param builder 构建器
+ * @return 扁平AST；此前有任何节点构建失败或内存不足时返回NULL
+ */
+FlatAST* flatAstBuilderFinish(FlatASTBuilder* builder);
+
+/**
+ * @brief 预留节点空间
+ * @param builder 构建器
+ * @param nodeCount 预计的节点总数
+ * @return 成功返回true，内存不足返回false
+ */
+bool flatAstBuilderReserve(FlatASTBuilder* builder, uint32_t nodeCount);
+
+// 声明（Add*加到翻译单元）
+FlatNodeIndex flatAstBuilderAddVariableDecl(FlatASTBuilder* builder, const char* name,
+                                            FlatNodeIndex type, FlatNodeIndex initializer,
+                                            SourceLocation location);
+FlatNodeIndex flatAstBuilderAddFunctionDecl(FlatASTBuilder* builder, const char* name,
+                                            FlatNodeIndex returnType,
+                                            const FlatNodeIndex* parameters, uint32_t parameterCount,
+                                            FlatNodeIndex body, SourceLocation location);
+FlatNodeIndex flatAstBuilderAddStructDecl(FlatASTBuilder* builder, const char* name,
+                                          const FlatNodeIndex* members, uint32_t memberCount,
+                                          SourceLocation location);
+FlatNodeIndex flatAstBuilderAddUnionDecl(FlatASTBuilder* builder, const char* name,
+                                         const FlatNodeIndex* members, uint32_t memberCount,
+                                         SourceLocation location);
+FlatNodeIndex flatAstBuilderAddEnumDecl(FlatASTBuilder* builder, const char* name,
+                                        const char* const* constantNames,
+                                        const FlatNodeIndex* constantValues,
+                                        uint32_t constantCount, SourceLocation location);
+FlatNodeIndex flatAstBuilderAddTypedefDecl(FlatASTBuilder* builder, const char* name,
+                                           FlatNodeIndex aliasedType, SourceLocation location);
+
+/**
+ * @brief 创建不加到翻译单元的变量声明（局部变量、参数、结构体成员）
+ */
+FlatNodeIndex flatAstBuilderCreateVariableDecl(FlatASTBuilder* builder, const char* name,
+                                               FlatNodeIndex type, FlatNodeIndex initializer,
+                                               SourceLocation location);
+
+// 语句
+FlatNodeIndex flatAstBuilderCreateExprStmt(FlatASTBuilder* builder, FlatNodeIndex expression,
+                                           SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateCompoundStmt(FlatASTBuilder* builder,
+                                               const FlatNodeIndex* declarations, uint32_t declarationCount,
+                                               const FlatNodeIndex* statements, uint32_t statementCount,
+                                               SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateIfStmt(FlatASTBuilder* builder, FlatNodeIndex condition,
+                                         FlatNodeIndex thenStmt, FlatNodeIndex elseStmt,
+                                         SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateWhileStmt(FlatASTBuilder* builder, FlatNodeIndex condition,
+                                            FlatNodeIndex body, SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateDoWhileStmt(FlatASTBuilder* builder, FlatNodeIndex body,
+                                              FlatNodeIndex condition, SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateForStmt(FlatASTBuilder* builder, FlatNodeIndex init,
+                                          FlatNodeIndex condition, FlatNodeIndex increment,
+                                          FlatNodeIndex body, SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateReturnStmt(FlatASTBuilder* builder, FlatNodeIndex returnValue,
+                                             SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateBreakStmt(FlatASTBuilder* builder, SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateContinueStmt(FlatASTBuilder* builder, SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateSwitchStmt(FlatASTBuilder* builder, FlatNodeIndex condition,
+                                             const FlatNodeIndex* cases, uint32_t caseCount,
+                                             SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateCaseStmt(FlatASTBuilder* builder, CaseKind kind,
+                                           FlatNodeIndex value, FlatNodeIndex statement,
+                                           SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateLabeledStmt(FlatASTBuilder* builder, const char* labelName,
+                                              FlatNodeIndex statement, SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateGotoStmt(FlatASTBuilder* builder, const char* labelName,
+                                           SourceLocation location);
+
+// 表达式
+FlatNodeIndex flatAstBuilderCreateLiteralExpr(FlatASTBuilder* builder, Token* literal,
+                                              SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateIdentifierExpr(FlatASTBuilder* builder, const char* name,
+                                                 SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateBinaryOpExpr(FlatASTBuilder* builder, BinaryOperator op,
+                                               FlatNodeIndex left, FlatNodeIndex right,
+                                               SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateUnaryOpExpr(FlatASTBuilder* builder, UnaryOperator op,
+                                              FlatNodeIndex operand, bool isPrefix,
+                                              SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateAssignmentExpr(FlatASTBuilder* builder, AssignmentKind kind,
+                                                 FlatNodeIndex left, FlatNodeIndex right,
+                                                 SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateTernaryExpr(FlatASTBuilder* builder, FlatNodeIndex condition,
+                                              FlatNodeIndex thenExpr, FlatNodeIndex elseExpr,
+                                              SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateFunctionCallExpr(FlatASTBuilder* builder, FlatNodeIndex callee,
+                                                   const FlatNodeIndex* arguments, uint32_t argumentCount,
+                                                   SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateArraySubscriptExpr(FlatASTBuilder* builder, FlatNodeIndex array,
+                                                     FlatNodeIndex index, SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateMemberAccessExpr(FlatASTBuilder* builder, FlatNodeIndex baseExpr,
+                                                   const char* memberName, bool isArrow,
+                                                   SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateCastExpr(FlatASTBuilder* builder, FlatNodeIndex targetType,
+                                           FlatNodeIndex operand, SourceLocation location);
+
+// 类型说明符
+FlatNodeIndex flatAstBuilderCreateBasicType(FlatASTBuilder* builder, BasicTypeKind kind,
+                                            SourceLocation location);
+FlatNodeIndex flatAstBuilderCreatePointerType(FlatASTBuilder* builder, FlatNodeIndex baseType,
+                                              SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateArrayType(FlatASTBuilder* builder, FlatNodeIndex elementType,
+                                            FlatNodeIndex size, SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateFunctionType(FlatASTBuilder* builder, FlatNodeIndex returnType,
+                                               const FlatNodeIndex* parameterTypes, uint32_t parameterCount,
+                                               bool isVariadic, SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateStructType(FlatASTBuilder* builder, const char* name,
+                                             FlatNodeIndex declaration, SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateUnionType(FlatASTBuilder* builder, const char* name,
+                                            FlatNodeIndex declaration, SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateEnumType(FlatASTBuilder* builder, const char* name,
+                                           FlatNodeIndex declaration, SourceLocation location);
+FlatNodeIndex flatAstBuilderCreateTypedefName(FlatASTBuilder* builder, const char* typedefName,
+                                              SourceLocation location);
+
+#endif // AST_FLAT_H
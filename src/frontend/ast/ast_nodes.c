@@ -1,9 +1,17 @@
 #include "ast_nodes.h"
+#include "ast_walk.h"
 #include "../../common/diagnostics/diagnostic_engine.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+/**
+ * @brief 把名称驻留到全局驻留器（同名的节点共用一份字符串）
+ */
+static InternedString astInternName(const char* name) {
+    return stringInternerInternCString(globalStringInterner(), name);
+}
+
 // ==================== 内部辅助函数 ====================
 
 /**
@@ -63,6 +71,147 @@ static const char* astNodeTypeNames[] = {
     "TypedefNameSpecifier"
 };
 
+// ==================== 节点内存池 ====================
+
+// slab数：每种节点类型一个
+#define AST_SLAB_COUNT (AST_NODE_TYPEDEF_NAME_SPECIFIER + 1)
+
+// 每个slab的块容量
+#define AST_SLAB_CHUNK_SIZE (64 * 1024)
+
+/**
+ * @brief AST节点slab内存池
+ *
+ * slabs[t]只存放类型为t的节点。每种节点类型的结构体大小固定，
+ * 因此每个slab就是一个大小分级，节点按创建顺序以固定步长紧挨着存放。
+ * 子节点Vector放在misc中，不打断节点的连续性。
+ */
+struct ASTSlabArena {
+    MemoryPool* slabs[AST_SLAB_COUNT];
+    MemoryPool* misc;
+    size_t nodeCount;
+};
+
+// 当前线程创建节点所用的slab内存池和内存池（都为NULL表示堆分配）
+static _Thread_local ASTSlabArena* astSlabArena = NULL;
+static _Thread_local MemoryPool* astNodeArena = NULL;
+
+ASTSlabArena* createASTSlabArena(void) {
+    ASTSlabArena* arena = (ASTSlabArena*)calloc(1, sizeof(ASTSlabArena));
+    if (!arena) {
+        return NULL;
+    }
+
+    arena->misc = createMemoryPool(AST_SLAB_CHUNK_SIZE);
+    if (!arena->misc) {
+        free(arena);
+        return NULL;
+    }
+    return arena;
+}
+
+void destroyASTSlabArena(ASTSlabArena* arena) {
+    if (!arena) {
+        return;
+    }
+
+    for (size_t i = 0; i < AST_SLAB_COUNT; i++) {
+        destroyMemoryPool(arena->slabs[i]);
+    }
+    destroyMemoryPool(arena->misc);
+    free(arena);
+}
+
+size_t astSlabArenaNodeCount(const ASTSlabArena* arena) {
+    return arena ? arena->nodeCount : 0;
+}
+
+size_t astSlabArenaBytesAllocated(const ASTSlabArena* arena) {
+    if (!arena) {
+        return 0;
+    }
+
+    size_t bytes = memoryPoolBytesAllocated(arena->misc);
+    for (size_t i = 0; i < AST_SLAB_COUNT; i++) {
+        bytes += memoryPoolBytesAllocated(arena->slabs[i]);
+    }
+    return bytes;
+}
+
+ASTSlabArena* astSetSlabArena(ASTSlabArena* arena) {
+    ASTSlabArena* previous = astSlabArena;
+    astSlabArena = arena;
+    return previous;
+}
+
+ASTSlabArena* astGetSlabArena(void) {
+    return astSlabArena;
+}
+
+/**
+ * @brief 从slab内存池中分配节点
+ */
+static void* astSlabArenaAlloc(ASTSlabArena* arena, ASTNodeType type, size_t size) {
+    MemoryPool* pool = arena->misc;
+    if ((unsigned)type < AST_SLAB_COUNT) {
+        // 各slab在第一次分配该类型的节点时才创建
+        if (!arena->slabs[type]) {
+            arena->slabs[type] = createMemoryPool(AST_SLAB_CHUNK_SIZE);
+            if (!arena->slabs[type]) {
+                return NULL;
+            }
+        }
+        pool = arena->slabs[type];
+    }
+
+    void* node = memoryPoolAlloc(pool, size);
+    if (node) {
+        arena->nodeCount++;
+    }
+    return node;
+}
+
+MemoryPool* astSetNodeArena(MemoryPool* arena) {
+    MemoryPool* previous = astNodeArena;
+    astNodeArena = arena;
+    return previous;
+}
+
+MemoryPool* astGetNodeArena(void) {
+    return astNodeArena;
+}
+
+void* astAllocNode(ASTNodeType type, size_t size) {
+    ASTNode* node;
+    if (astSlabArena) {
+        node = (ASTNode*)astSlabArenaAlloc(astSlabArena, type, size);
+    } else if (astNodeArena) {
+        node = (ASTNode*)memoryPoolAlloc(astNodeArena, size);
+    } else {
+        node = (ASTNode*)malloc(size);
+    }
+
+    if (node) {
+        node->arenaAllocated = astSlabArena != NULL || astNodeArena != NULL;
+        node->structuralHash = 0;
+    }
+    return node;
+}
+
+void astFreeNode(void* node) {
+    if (node && !((ASTNode*)node)->arenaAllocated) {
+        free(node);
+    }
+}
+
+Vector* astCreateNodeVector(size_t elementSize, size_t initialCapacity) {
+    if (astSlabArena) {
+        return vectorCreateInPool(astSlabArena->misc, elementSize, initialCapacity);
+    }
+    return astNodeArena ? vectorCreateInPool(astNodeArena, elementSize, initialCapacity)
+                        : vectorCreate(elementSize, initialCapacity);
+}
+
 // ==================== 基础AST节点函数 ====================
 
 /**
@@ -78,7 +227,7 @@ static void astNodeAccept(ASTNode* self, ASTVisitor* visitor) {
  * @brief 创建AST节点
  */
 ASTNode* createASTNode(ASTNodeType type, SourceLocation location) {
-    ASTNode* node = (ASTNode*)malloc(sizeof(ASTNode));
+    ASTNode* node = (ASTNode*)astAllocNode(type, sizeof(ASTNode));
     if (!node) {
         return NULL;
     }
@@ -96,7 +245,7 @@ ASTNode* createASTNode(ASTNodeType type, SourceLocation location) {
  * @brief 销毁AST节点
  */
 void destroyASTNode(ASTNode* node) {
-    if (node && node->destroy) {
+    if (node && !node->arenaAllocated && node->destroy) {
         node->destroy(node);
     }
 }
@@ -105,18 +254,18 @@ void destroyASTNode(ASTNode* node) {
  * @brief 创建翻译单元
  */
 TranslationUnit* createTranslationUnit(void) {
-    TranslationUnit* unit = (TranslationUnit*)malloc(sizeof(TranslationUnit));
+    TranslationUnit* unit = (TranslationUnit*)astAllocNode(AST_NODE_TRANSLATION_UNIT, sizeof(TranslationUnit));
     if (!unit) {
         return NULL;
     }
 
-    unit->base.location = createSourceLocation(NULL, 0, 0, 0);
+    unit->base.location = createSourceLocation(INVALID_FILE_ID, 0);
     unit->base.parent = NULL;
     unit->base.nodeType = AST_NODE_TRANSLATION_UNIT;
     unit->base.accept = astNodeAccept;
     unit->base.destroy = (void*)destroyTranslationUnit;
 
-    unit->declarations = vectorCreate(sizeof(Declaration*), 16);
+    unit->declarations = astCreateNodeVector(sizeof(Declaration*), 16);
 
     return unit;
 }
@@ -140,7 +289,7 @@ void destroyTranslationUnit(TranslationUnit* unit) {
         vectorDestroy(unit->declarations, NULL);
     }
 
-    free(unit);
+    astFreeNode(unit);
 }
 
 /**
@@ -162,6 +311,15 @@ void astNodeSetParent(ASTNode* node, ASTNode* parent) {
     }
 }
 
+/**
+ * @brief 清除节点及其祖先缓存的结构哈希
+ */
+void astNodeInvalidateStructuralHash(ASTNode* node) {
+    for (; node; node = node->parent) {
+        node->structuralHash = 0;
+    }
+}
+
 /**
  * @brief 获取节点的源位置
  */
@@ -169,7 +327,7 @@ SourceLocation astNodeGetLocation(const ASTNode* node) {
     if (node) {
         return node->location;
     }
-    return createSourceLocation(NULL, 0, 0, 0);
+    return createSourceLocation(INVALID_FILE_ID, 0);
 }
 
 // ==================== 表达式节点实现 ====================
@@ -185,14 +343,54 @@ static void destroyExpression(ASTNode* node) {
     Expression* expr = (Expression*)node;
 
     // 注意：type指针由语义分析器管理，不在这里释放
-    free(expr);
+    astFreeNode(expr);
+}
+
+/**
+ * @brief 前序：只进入堆上的表达式节点
+ *
+ * 类型转换的目标类型由类型系统管理，内存池中的节点随内存池释放，都不在这里释放。
+ */
+static ASTWalkAction destroyExpressionPreorder(ASTNode* node, size_t depth, void* userData) {
+    (void)depth;
+    (void)userData;
+    return node->arenaAllocated || !astNodeIsExpression(node) ? AST_WALK_SKIP_CHILDREN : AST_WALK_CONTINUE;
+}
+
+/**
+ * @brief 后序：子节点都已释放，释放节点自身
+ */
+static ASTWalkAction destroyExpressionPostorder(ASTNode* node, size_t depth, void* userData) {
+    (void)depth;
+    (void)userData;
+    if (node->arenaAllocated || !astNodeIsExpression(node)) {
+        return AST_WALK_CONTINUE;
+    }
+
+    if (node->nodeType == AST_NODE_FUNCTION_CALL_EXPR) {
+        vectorDestroy(((FunctionCallExpr*)node)->arguments, NULL);
+    }
+    astFreeNode(node);
+    return AST_WALK_CONTINUE;
+}
+
+/**
+ * @brief 销毁表达式及其全部子表达式
+ *
+ * 用astWalk后序释放，不递归，很深的a+b+c+...链也不会耗尽调用栈。
+ */
+static void destroyExpressionTree(ASTNode* node) {
+    if (!node) {
+        return;
+    }
+    astWalk(node, destroyExpressionPreorder, destroyExpressionPostorder, NULL);
 }
 
 /**
  * @brief 创建字面量表达式
  */
 Expression* createLiteralExpr(Token* literal, SourceLocation location) {
-    LiteralExpr* expr = (LiteralExpr*)malloc(sizeof(LiteralExpr));
+    LiteralExpr* expr = (LiteralExpr*)astAllocNode(AST_NODE_LITERAL_EXPR, sizeof(LiteralExpr));
     if (!expr) {
         return NULL;
     }
@@ -222,7 +420,7 @@ Expression* createIdentifierExpr(const char* name, SourceLocation location) {
         return NULL;
     }
 
-    IdentifierExpr* expr = (IdentifierExpr*)malloc(sizeof(IdentifierExpr));
+    IdentifierExpr* expr = (IdentifierExpr*)astAllocNode(AST_NODE_IDENTIFIER_EXPR, sizeof(IdentifierExpr));
     if (!expr) {
         return NULL;
     }
@@ -238,32 +436,17 @@ Expression* createIdentifierExpr(const char* name, SourceLocation location) {
     expr->base.isLvalue = true;   // 标识符通常是左值
     expr->base.isConstant = false;
 
-    expr->name = strdup(name);
+    expr->name = astInternName(name);
     expr->symbol = NULL;
 
     return (Expression*)expr;
 }
 
-/**
- * @brief 销毁标识符表达式
- */
-static void destroyIdentifierExpr(ASTNode* node) {
-    if (!node) {
-        return;
-    }
-
-    IdentifierExpr* expr = (IdentifierExpr*)node;
-    if (expr->name) {
-        free(expr->name);
-    }
-    free(expr);
-}
-
 /**
  * @brief 创建二元运算符表达式
  */
 Expression* createBinaryOperatorExpr(BinaryOperator op, Expression* left, Expression* right, SourceLocation location) {
-    BinaryOperatorExpr* expr = (BinaryOperatorExpr*)malloc(sizeof(BinaryOperatorExpr));
+    BinaryOperatorExpr* expr = (BinaryOperatorExpr*)astAllocNode(AST_NODE_BINARY_OPERATOR_EXPR, sizeof(BinaryOperatorExpr));
     if (!expr) {
         return NULL;
     }
@@ -272,7 +455,7 @@ Expression* createBinaryOperatorExpr(BinaryOperator op, Expression* left, Expres
     expr->base.base.parent = NULL;
     expr->base.base.nodeType = AST_NODE_BINARY_OPERATOR_EXPR;
     expr->base.base.accept = astNodeAccept;
-    expr->base.base.destroy = destroyExpression;
+    expr->base.base.destroy = destroyExpressionTree;
 
     expr->base.type = NULL;
     expr->base.exprKind = EXPR_BINARY_OPERATOR;
@@ -294,29 +477,11 @@ Expression* createBinaryOperatorExpr(BinaryOperator op, Expression* left, Expres
     return (Expression*)expr;
 }
 
-/**
- * @brief 销毁二元运算符表达式
- */
-static void destroyBinaryOperatorExpr(ASTNode* node) {
-    if (!node) {
-        return;
-    }
-
-    BinaryOperatorExpr* expr = (BinaryOperatorExpr*)node;
-    if (expr->left) {
-        DESTROY_AST_NODE(expr->left);
-    }
-    if (expr->right) {
-        DESTROY_AST_NODE(expr->right);
-    }
-    free(expr);
-}
-
 /**
  * @brief 创建一元运算符表达式
  */
 Expression* createUnaryOperatorExpr(UnaryOperator op, Expression* operand, bool isPrefix, SourceLocation location) {
-    UnaryOperatorExpr* expr = (UnaryOperatorExpr*)malloc(sizeof(UnaryOperatorExpr));
+    UnaryOperatorExpr* expr = (UnaryOperatorExpr*)astAllocNode(AST_NODE_UNARY_OPERATOR_EXPR, sizeof(UnaryOperatorExpr));
     if (!expr) {
         return NULL;
     }
@@ -325,7 +490,7 @@ Expression* createUnaryOperatorExpr(UnaryOperator op, Expression* operand, bool
     expr->base.base.parent = NULL;
     expr->base.base.nodeType = AST_NODE_UNARY_OPERATOR_EXPR;
     expr->base.base.accept = astNodeAccept;
-    expr->base.base.destroy = destroyExpression;
+    expr->base.base.destroy = destroyExpressionTree;
 
     expr->base.type = NULL;
     expr->base.exprKind = EXPR_UNARY_OPERATOR;
@@ -343,26 +508,11 @@ Expression* createUnaryOperatorExpr(UnaryOperator op, Expression* operand, bool
     return (Expression*)expr;
 }
 
-/**
- * @brief 销毁一元运算符表达式
- */
-static void destroyUnaryOperatorExpr(ASTNode* node) {
-    if (!node) {
-        return;
-    }
-
-    UnaryOperatorExpr* expr = (UnaryOperatorExpr*)node;
-    if (expr->operand) {
-        DESTROY_AST_NODE(expr->operand);
-    }
-    free(expr);
-}
-
 /**
  * @brief 创建赋值表达式
  */
 Expression* createAssignmentExpr(AssignmentKind kind, Expression* left, Expression* right, SourceLocation location) {
-    AssignmentExpr* expr = (AssignmentExpr*)malloc(sizeof(AssignmentExpr));
+    AssignmentExpr* expr = (AssignmentExpr*)astAllocNode(AST_NODE_ASSIGNMENT_EXPR, sizeof(AssignmentExpr));
     if (!expr) {
         return NULL;
     }
@@ -371,7 +521,7 @@ Expression* createAssignmentExpr(AssignmentKind kind, Expression* left, Expressi
     expr->base.base.parent = NULL;
     expr->base.base.nodeType = AST_NODE_ASSIGNMENT_EXPR;
     expr->base.base.accept = astNodeAccept;
-    expr->base.base.destroy = destroyExpression;
+    expr->base.base.destroy = destroyExpressionTree;
 
     expr->base.type = NULL;
     expr->base.exprKind = EXPR_ASSIGNMENT;
@@ -392,29 +542,11 @@ Expression* createAssignmentExpr(AssignmentKind kind, Expression* left, Expressi
     return (Expression*)expr;
 }
 
-/**
- * @brief 销毁赋值表达式
- */
-static void destroyAssignmentExpr(ASTNode* node) {
-    if (!node) {
-        return;
-    }
-
-    AssignmentExpr* expr = (AssignmentExpr*)node;
-    if (expr->left) {
-        DESTROY_AST_NODE(expr->left);
-    }
-    if (expr->right) {
-        DESTROY_AST_NODE(expr->right);
-    }
-    free(expr);
-}
-
 /**
  * @brief 创建三元表达式
  */
 Expression* createTernaryExpr(Expression* condition, Expression* thenExpr, Expression* elseExpr, SourceLocation location) {
-    TernaryExpr* expr = (TernaryExpr*)malloc(sizeof(TernaryExpr));
+    TernaryExpr* expr = (TernaryExpr*)astAllocNode(AST_NODE_TERNARY_EXPR, sizeof(TernaryExpr));
     if (!expr) {
         return NULL;
     }
@@ -423,7 +555,7 @@ Expression* createTernaryExpr(Expression* condition, Expression* thenExpr, Expre
     expr->base.base.parent = NULL;
     expr->base.base.nodeType = AST_NODE_TERNARY_EXPR;
     expr->base.base.accept = astNodeAccept;
-    expr->base.base.destroy = destroyExpression;
+    expr->base.base.destroy = destroyExpressionTree;
 
     expr->base.type = NULL;
     expr->base.exprKind = EXPR_TERNARY;
@@ -447,32 +579,11 @@ Expression* createTernaryExpr(Expression* condition, Expression* thenExpr, Expre
     return (Expression*)expr;
 }
 
-/**
- * @brief 销毁三元表达式
- */
-static void destroyTernaryExpr(ASTNode* node) {
-    if (!node) {
-        return;
-    }
-
-    TernaryExpr* expr = (TernaryExpr*)node;
-    if (expr->condition) {
-        DESTROY_AST_NODE(expr->condition);
-    }
-    if (expr->thenExpr) {
-        DESTROY_AST_NODE(expr->thenExpr);
-    }
-    if (expr->elseExpr) {
-        DESTROY_AST_NODE(expr->elseExpr);
-    }
-    free(expr);
-}
-
 /**
  * @brief 创建函数调用表达式
  */
 Expression* createFunctionCallExpr(Expression* callee, Vector* arguments, SourceLocation location) {
-    FunctionCallExpr* expr = (FunctionCallExpr*)malloc(sizeof(FunctionCallExpr));
+    FunctionCallExpr* expr = (FunctionCallExpr*)astAllocNode(AST_NODE_FUNCTION_CALL_EXPR, sizeof(FunctionCallExpr));
     if (!expr) {
         return NULL;
     }
@@ -481,7 +592,7 @@ Expression* createFunctionCallExpr(Expression* callee, Vector* arguments, Source
     expr->base.base.parent = NULL;
     expr->base.base.nodeType = AST_NODE_FUNCTION_CALL_EXPR;
     expr->base.base.accept = astNodeAccept;
-    expr->base.base.destroy = destroyExpression;
+    expr->base.base.destroy = destroyExpressionTree;
 
     expr->base.type = NULL;
     expr->base.exprKind = EXPR_FUNCTION_CALL;
@@ -498,35 +609,11 @@ Expression* createFunctionCallExpr(Expression* callee, Vector* arguments, Source
     return (Expression*)expr;
 }
 
-/**
- * @brief 销毁函数调用表达式
- */
-static void destroyFunctionCallExpr(ASTNode* node) {
-    if (!node) {
-        return;
-    }
-
-    FunctionCallExpr* expr = (FunctionCallExpr*)node;
-    if (expr->callee) {
-        DESTROY_AST_NODE(expr->callee);
-    }
-    if (expr->arguments) {
-        for (size_t i = 0; i < vectorSize(expr->arguments); i++) {
-            Expression** argPtr = vectorGet(expr->arguments, i);
-            if (argPtr && *argPtr) {
-                DESTROY_AST_NODE(*argPtr);
-            }
-        }
-        vectorDestroy(expr->arguments, NULL);
-    }
-    free(expr);
-}
-
 /**
  * @brief 创建数组下标表达式
  */
 Expression* createArraySubscriptExpr(Expression* array, Expression* index, SourceLocation location) {
-    ArraySubscriptExpr* expr = (ArraySubscriptExpr*)malloc(sizeof(ArraySubscriptExpr));
+    ArraySubscriptExpr* expr = (ArraySubscriptExpr*)astAllocNode(AST_NODE_ARRAY_SUBSCRIPT_EXPR, sizeof(ArraySubscriptExpr));
     if (!expr) {
         return NULL;
     }
@@ -535,7 +622,7 @@ Expression* createArraySubscriptExpr(Expression* array, Expression* index, Sourc
     expr->base.base.parent = NULL;
     expr->base.base.nodeType = AST_NODE_ARRAY_SUBSCRIPT_EXPR;
     expr->base.base.accept = astNodeAccept;
-    expr->base.base.destroy = destroyExpression;
+    expr->base.base.destroy = destroyExpressionTree;
 
     expr->base.type = NULL;
     expr->base.exprKind = EXPR_ARRAY_SUBSCRIPT;
@@ -555,24 +642,6 @@ Expression* createArraySubscriptExpr(Expression* array, Expression* index, Sourc
     return (Expression*)expr;
 }
 
-/**
- * @brief 销毁数组下标表达式
- */
-static void destroyArraySubscriptExpr(ASTNode* node) {
-    if (!node) {
-        return;
-    }
-
-    ArraySubscriptExpr* expr = (ArraySubscriptExpr*)node;
-    if (expr->array) {
-        DESTROY_AST_NODE(expr->array);
-    }
-    if (expr->index) {
-        DESTROY_AST_NODE(expr->index);
-    }
-    free(expr);
-}
-
 /**
  * @brief 创建成员访问表达式
  */
@@ -581,7 +650,7 @@ Expression* createMemberAccessExpr(Expression* baseExpr, const char* memberName,
         return NULL;
     }
 
-    MemberAccessExpr* expr = (MemberAccessExpr*)malloc(sizeof(MemberAccessExpr));
+    MemberAccessExpr* expr = (MemberAccessExpr*)astAllocNode(AST_NODE_MEMBER_ACCESS_EXPR, sizeof(MemberAccessExpr));
     if (!expr) {
         return NULL;
     }
@@ -590,7 +659,7 @@ Expression* createMemberAccessExpr(Expression* baseExpr, const char* memberName,
     expr->base.base.parent = NULL;
     expr->base.base.nodeType = AST_NODE_MEMBER_ACCESS_EXPR;
     expr->base.base.accept = astNodeAccept;
-    expr->base.base.destroy = destroyExpression;
+    expr->base.base.destroy = destroyExpressionTree;
 
     expr->base.type = NULL;
     expr->base.exprKind = EXPR_MEMBER_ACCESS;
@@ -598,7 +667,7 @@ Expression* createMemberAccessExpr(Expression* baseExpr, const char* memberName,
     expr->base.isConstant = false;
 
     expr->baseExpr = baseExpr;
-    expr->memberName = strdup(memberName);
+    expr->memberName = astInternName(memberName);
     expr->isArrow = isArrow;
 
     if (baseExpr) {
@@ -608,29 +677,11 @@ Expression* createMemberAccessExpr(Expression* baseExpr, const char* memberName,
     return (Expression*)expr;
 }
 
-/**
- * @brief 销毁成员访问表达式
- */
-static void destroyMemberAccessExpr(ASTNode* node) {
-    if (!node) {
-        return;
-    }
-
-    MemberAccessExpr* expr = (MemberAccessExpr*)node;
-    if (expr->baseExpr) {
-        DESTROY_AST_NODE(expr->baseExpr);
-    }
-    if (expr->memberName) {
-        free(expr->memberName);
-    }
-    free(expr);
-}
-
 /**
  * @brief 创建类型转换表达式
  */
 Expression* createCastExpr(TypeSpecifier* targetType, Expression* operand, SourceLocation location) {
-    CastExpr* expr = (CastExpr*)malloc(sizeof(CastExpr));
+    CastExpr* expr = (CastExpr*)astAllocNode(AST_NODE_CAST_EXPR, sizeof(CastExpr));
     if (!expr) {
         return NULL;
     }
@@ -639,7 +690,7 @@ Expression* createCastExpr(TypeSpecifier* targetType, Expression* operand, Sourc
     expr->base.base.parent = NULL;
     expr->base.base.nodeType = AST_NODE_CAST_EXPR;
     expr->base.base.accept = astNodeAccept;
-    expr->base.base.destroy = destroyExpression;
+    expr->base.base.destroy = destroyExpressionTree;
 
     expr->base.type = NULL;
     expr->base.exprKind = EXPR_CAST;
@@ -656,22 +707,6 @@ Expression* createCastExpr(TypeSpecifier* targetType, Expression* operand, Sourc
     return (Expression*)expr;
 }
 
-/**
- * @brief 销毁类型转换表达式
- */
-static void destroyCastExpr(ASTNode* node) {
-    if (!node) {
-        return;
-    }
-
-    CastExpr* expr = (CastExpr*)node;
-    // 注意：targetType 由类型系统管理，不在这里释放
-    if (expr->operand) {
-        DESTROY_AST_NODE(expr->operand);
-    }
-    free(expr);
-}
-
 // ==================== 运算符字符串转换 ====================
 
 const char* binaryOperatorToString(BinaryOperator op) {
@@ -742,14 +777,14 @@ static void destroyStatement(ASTNode* node) {
     if (!node) {
         return;
     }
-    free(node);
+    astFreeNode(node);
 }
 
 /**
  * @brief 创建表达式语句
  */
 Statement* createExpressionStatement(Expression* expression, SourceLocation location) {
-    ExpressionStatement* stmt = (ExpressionStatement*)malloc(sizeof(ExpressionStatement));
+    ExpressionStatement* stmt = (ExpressionStatement*)astAllocNode(AST_NODE_EXPRESSION_STATEMENT, sizeof(ExpressionStatement));
     if (!stmt) {
         return NULL;
     }
@@ -782,14 +817,14 @@ static void destroyExpressionStatement(ASTNode* node) {
     if (stmt->expression) {
         DESTROY_AST_NODE(stmt->expression);
     }
-    free(stmt);
+    astFreeNode(stmt);
 }
 
 /**
  * @brief 创建复合语句
  */
 Statement* createCompoundStatement(SourceLocation location) {
-    CompoundStatement* stmt = (CompoundStatement*)malloc(sizeof(CompoundStatement));
+    CompoundStatement* stmt = (CompoundStatement*)astAllocNode(AST_NODE_COMPOUND_STATEMENT, sizeof(CompoundStatement));
     if (!stmt) {
         return NULL;
     }
@@ -802,8 +837,8 @@ Statement* createCompoundStatement(SourceLocation location) {
 
     stmt->base.stmtKind = STMT_COMPOUND;
 
-    stmt->declarations = vectorCreate(sizeof(Declaration*), 8);
-    stmt->statements = vectorCreate(sizeof(Statement*), 8);
+    stmt->declarations = astCreateNodeVector(sizeof(Declaration*), 8);
+    stmt->statements = astCreateNodeVector(sizeof(Statement*), 8);
 
     return (Statement*)stmt;
 }
@@ -838,14 +873,14 @@ static void destroyCompoundStatement(ASTNode* node) {
         vectorDestroy(stmt->statements, NULL);
     }
 
-    free(stmt);
+    astFreeNode(stmt);
 }
 
 /**
  * @brief 创建if语句
  */
 Statement* createIfStatement(Expression* condition, Statement* thenStmt, Statement* elseStmt, SourceLocation location) {
-    IfStatement* stmt = (IfStatement*)malloc(sizeof(IfStatement));
+    IfStatement* stmt = (IfStatement*)astAllocNode(AST_NODE_IF_STATEMENT, sizeof(IfStatement));
     if (!stmt) {
         return NULL;
     }
@@ -893,14 +928,14 @@ static void destroyIfStatement(ASTNode* node) {
     if (stmt->elseStmt) {
         DESTROY_AST_NODE(stmt->elseStmt);
     }
-    free(stmt);
+    astFreeNode(stmt);
 }
 
 /**
  * @brief 创建while语句
  */
 Statement* createWhileStatement(Expression* condition, Statement* body, SourceLocation location) {
-    WhileStatement* stmt = (WhileStatement*)malloc(sizeof(WhileStatement));
+    WhileStatement* stmt = (WhileStatement*)astAllocNode(AST_NODE_WHILE_STATEMENT, sizeof(WhileStatement));
     if (!stmt) {
         return NULL;
     }
@@ -941,14 +976,14 @@ static void destroyWhileStatement(ASTNode* node) {
     if (stmt->body) {
         DESTROY_AST_NODE(stmt->body);
     }
-    free(stmt);
+    astFreeNode(stmt);
 }
 
 /**
  * @brief 创建do-while语句
  */
 Statement* createDoWhileStatement(Statement* body, Expression* condition, SourceLocation location) {
-    DoWhileStatement* stmt = (DoWhileStatement*)malloc(sizeof(DoWhileStatement));
+    DoWhileStatement* stmt = (DoWhileStatement*)astAllocNode(AST_NODE_DO_WHILE_STATEMENT, sizeof(DoWhileStatement));
     if (!stmt) {
         return NULL;
     }
@@ -989,14 +1024,14 @@ static void destroyDoWhileStatement(ASTNode* node) {
     if (stmt->condition) {
         DESTROY_AST_NODE(stmt->condition);
     }
-    free(stmt);
+    astFreeNode(stmt);
 }
 
 /**
  * @brief 创建for语句
  */
 Statement* createForStatement(Expression* init, Expression* condition, Expression* increment, Statement* body, SourceLocation location) {
-    ForStatement* stmt = (ForStatement*)malloc(sizeof(ForStatement));
+    ForStatement* stmt = (ForStatement*)astAllocNode(AST_NODE_FOR_STATEMENT, sizeof(ForStatement));
     if (!stmt) {
         return NULL;
     }
@@ -1051,14 +1086,14 @@ static void destroyForStatement(ASTNode* node) {
     if (stmt->body) {
         DESTROY_AST_NODE(stmt->body);
     }
-    free(stmt);
+    astFreeNode(stmt);
 }
 
 /**
  * @brief 创建return语句
  */
 Statement* createReturnStatement(Expression* returnValue, SourceLocation location) {
-    ReturnStatement* stmt = (ReturnStatement*)malloc(sizeof(ReturnStatement));
+    ReturnStatement* stmt = (ReturnStatement*)astAllocNode(AST_NODE_RETURN_STATEMENT, sizeof(ReturnStatement));
     if (!stmt) {
         return NULL;
     }
@@ -1091,14 +1126,14 @@ static void destroyReturnStatement(ASTNode* node) {
     if (stmt->returnValue) {
         DESTROY_AST_NODE(stmt->returnValue);
     }
-    free(stmt);
+    astFreeNode(stmt);
 }
 
 /**
  * @brief 创建break语句
  */
 Statement* createBreakStatement(SourceLocation location) {
-    BreakStatement* stmt = (BreakStatement*)malloc(sizeof(BreakStatement));
+    BreakStatement* stmt = (BreakStatement*)astAllocNode(AST_NODE_BREAK_STATEMENT, sizeof(BreakStatement));
     if (!stmt) {
         return NULL;
     }
@@ -1118,7 +1153,7 @@ Statement* createBreakStatement(SourceLocation location) {
  * @brief 创建continue语句
  */
 Statement* createContinueStatement(SourceLocation location) {
-    ContinueStatement* stmt = (ContinueStatement*)malloc(sizeof(ContinueStatement));
+    ContinueStatement* stmt = (ContinueStatement*)astAllocNode(AST_NODE_CONTINUE_STATEMENT, sizeof(ContinueStatement));
     if (!stmt) {
         return NULL;
     }
@@ -1138,7 +1173,7 @@ Statement* createContinueStatement(SourceLocation location) {
  * @brief 创建switch语句
  */
 Statement* createSwitchStatement(Expression* condition, Vector* cases, SourceLocation location) {
-    SwitchStatement* stmt = (SwitchStatement*)malloc(sizeof(SwitchStatement));
+    SwitchStatement* stmt = (SwitchStatement*)astAllocNode(AST_NODE_SWITCH_STATEMENT, sizeof(SwitchStatement));
     if (!stmt) {
         return NULL;
     }
@@ -1182,14 +1217,14 @@ static void destroySwitchStatement(ASTNode* node) {
         }
         vectorDestroy(stmt->cases, NULL);
     }
-    free(stmt);
+    astFreeNode(stmt);
 }
 
 /**
  * @brief 创建case/default语句
  */
 Statement* createCaseStatement(CaseKind kind, Expression* value, Statement* statement, SourceLocation location) {
-    CaseStatement* stmt = (CaseStatement*)malloc(sizeof(CaseStatement));
+    CaseStatement* stmt = (CaseStatement*)astAllocNode(AST_NODE_CASE_STATEMENT, sizeof(CaseStatement));
     if (!stmt) {
         return NULL;
     }
@@ -1231,7 +1266,7 @@ static void destroyCaseStatement(ASTNode* node) {
     if (stmt->statement) {
         DESTROY_AST_NODE(stmt->statement);
     }
-    free(stmt);
+    astFreeNode(stmt);
 }
 
 /**
@@ -1242,7 +1277,7 @@ Statement* createLabeledStatement(const char* labelName, Statement* statement, S
         return NULL;
     }
 
-    LabeledStatement* stmt = (LabeledStatement*)malloc(sizeof(LabeledStatement));
+    LabeledStatement* stmt = (LabeledStatement*)astAllocNode(AST_NODE_LABELED_STATEMENT, sizeof(LabeledStatement));
     if (!stmt) {
         return NULL;
     }
@@ -1255,7 +1290,7 @@ Statement* createLabeledStatement(const char* labelName, Statement* statement, S
 
     stmt->base.stmtKind = STMT_LABELED;
 
-    stmt->labelName = strdup(labelName);
+    stmt->labelName = astInternName(labelName);
     stmt->statement = statement;
 
     if (statement) {
@@ -1274,13 +1309,10 @@ static void destroyLabeledStatement(ASTNode* node) {
     }
 
     LabeledStatement* stmt = (LabeledStatement*)node;
-    if (stmt->labelName) {
-        free(stmt->labelName);
-    }
     if (stmt->statement) {
         DESTROY_AST_NODE(stmt->statement);
     }
-    free(stmt);
+    astFreeNode(stmt);
 }
 
 /**
@@ -1291,7 +1323,7 @@ Statement* createGotoStatement(const char* labelName, SourceLocation location) {
         return NULL;
     }
 
-    GotoStatement* stmt = (GotoStatement*)malloc(sizeof(GotoStatement));
+    GotoStatement* stmt = (GotoStatement*)astAllocNode(AST_NODE_GOTO_STATEMENT, sizeof(GotoStatement));
     if (!stmt) {
         return NULL;
     }
@@ -1304,7 +1336,7 @@ Statement* createGotoStatement(const char* labelName, SourceLocation location) {
 
     stmt->base.stmtKind = STMT_GOTO;
 
-    stmt->labelName = strdup(labelName);
+    stmt->labelName = astInternName(labelName);
 
     return (Statement*)stmt;
 }
@@ -1318,10 +1350,7 @@ static void destroyGotoStatement(ASTNode* node) {
     }
 
     GotoStatement* stmt = (GotoStatement*)node;
-    if (stmt->labelName) {
-        free(stmt->labelName);
-    }
-    free(stmt);
+    astFreeNode(stmt);
 }
 
 // ==================== 声明节点实现 ====================
@@ -1335,11 +1364,8 @@ static void destroyDeclaration(ASTNode* node) {
     }
 
     Declaration* decl = (Declaration*)node;
-    if (decl->name) {
-        free(decl->name);
-    }
     // symbol 由符号表管理，不在这里释放
-    free(decl);
+    astFreeNode(decl);
 }
 
 /**
@@ -1350,7 +1376,7 @@ Declaration* createVariableDeclaration(const char* name, TypeSpecifier* type, Ex
         return NULL;
     }
 
-    VariableDeclaration* decl = (VariableDeclaration*)malloc(sizeof(VariableDeclaration));
+    VariableDeclaration* decl = (VariableDeclaration*)astAllocNode(AST_NODE_VARIABLE_DECLARATION, sizeof(VariableDeclaration));
     if (!decl) {
         return NULL;
     }
@@ -1361,7 +1387,7 @@ Declaration* createVariableDeclaration(const char* name, TypeSpecifier* type, Ex
     decl->base.base.accept = astNodeAccept;
     decl->base.base.destroy = destroyDeclaration;
 
-    decl->base.name = strdup(name);
+    decl->base.name = astInternName(name);
     decl->base.declKind = DECL_VARIABLE;
     decl->base.symbol = NULL;
     decl->base.storageClass = STORAGE_CLASS_NONE;
@@ -1391,10 +1417,7 @@ static void destroyVariableDeclaration(ASTNode* node) {
     if (decl->initializer) {
         DESTROY_AST_NODE(decl->initializer);
     }
-    if (decl->base.name) {
-        free(decl->base.name);
-    }
-    free(decl);
+    astFreeNode(decl);
 }
 
 /**
@@ -1405,7 +1428,7 @@ Declaration* createFunctionDeclaration(const char* name, TypeSpecifier* returnTy
         return NULL;
     }
 
-    FunctionDeclaration* decl = (FunctionDeclaration*)malloc(sizeof(FunctionDeclaration));
+    FunctionDeclaration* decl = (FunctionDeclaration*)astAllocNode(AST_NODE_FUNCTION_DECLARATION, sizeof(FunctionDeclaration));
     if (!decl) {
         return NULL;
     }
@@ -1416,7 +1439,7 @@ Declaration* createFunctionDeclaration(const char* name, TypeSpecifier* returnTy
     decl->base.base.accept = astNodeAccept;
     decl->base.base.destroy = destroyDeclaration;
 
-    decl->base.name = strdup(name);
+    decl->base.name = astInternName(name);
     decl->base.declKind = DECL_FUNCTION;
     decl->base.symbol = NULL;
     decl->base.storageClass = STORAGE_CLASS_NONE;
@@ -1443,9 +1466,6 @@ static void destroyFunctionDeclaration(ASTNode* node) {
     }
 
     FunctionDeclaration* decl = (FunctionDeclaration*)node;
-    if (decl->base.name) {
-        free(decl->base.name);
-    }
     // returnType 由类型系统管理
     if (decl->parameters) {
         for (size_t i = 0; i < vectorSize(decl->parameters); i++) {
@@ -1459,14 +1479,14 @@ static void destroyFunctionDeclaration(ASTNode* node) {
     if (decl->body) {
         DESTROY_AST_NODE(decl->body);
     }
-    free(decl);
+    astFreeNode(decl);
 }
 
 /**
  * @brief 创建结构体声明
  */
 Declaration* createStructDeclaration(const char* name, Vector* members, SourceLocation location) {
-    StructDeclaration* decl = (StructDeclaration*)malloc(sizeof(StructDeclaration));
+    StructDeclaration* decl = (StructDeclaration*)astAllocNode(AST_NODE_STRUCT_DECLARATION, sizeof(StructDeclaration));
     if (!decl) {
         return NULL;
     }
@@ -1477,7 +1497,7 @@ Declaration* createStructDeclaration(const char* name, Vector* members, SourceLo
     decl->base.base.accept = astNodeAccept;
     decl->base.base.destroy = destroyDeclaration;
 
-    decl->base.name = name ? strdup(name) : NULL;
+    decl->base.name = astInternName(name);
     decl->base.declKind = DECL_STRUCT;
     decl->base.symbol = NULL;
     decl->base.storageClass = STORAGE_CLASS_NONE;
@@ -1497,9 +1517,6 @@ static void destroyStructDeclaration(ASTNode* node) {
     }
 
     StructDeclaration* decl = (StructDeclaration*)node;
-    if (decl->base.name) {
-        free(decl->base.name);
-    }
     if (decl->members) {
         for (size_t i = 0; i < vectorSize(decl->members); i++) {
             Declaration** memberPtr = vectorGet(decl->members, i);
@@ -1509,14 +1526,14 @@ static void destroyStructDeclaration(ASTNode* node) {
         }
         vectorDestroy(decl->members, NULL);
     }
-    free(decl);
+    astFreeNode(decl);
 }
 
 /**
  * @brief 创建联合体声明
  */
 Declaration* createUnionDeclaration(const char* name, Vector* members, SourceLocation location) {
-    UnionDeclaration* decl = (UnionDeclaration*)malloc(sizeof(UnionDeclaration));
+    UnionDeclaration* decl = (UnionDeclaration*)astAllocNode(AST_NODE_UNION_DECLARATION, sizeof(UnionDeclaration));
     if (!decl) {
         return NULL;
     }
@@ -1527,7 +1544,7 @@ Declaration* createUnionDeclaration(const char* name, Vector* members, SourceLoc
     decl->base.base.accept = astNodeAccept;
     decl->base.base.destroy = destroyDeclaration;
 
-    decl->base.name = name ? strdup(name) : NULL;
+    decl->base.name = astInternName(name);
     decl->base.declKind = DECL_UNION;
     decl->base.symbol = NULL;
     decl->base.storageClass = STORAGE_CLASS_NONE;
@@ -1546,9 +1563,6 @@ static void destroyUnionDeclaration(ASTNode* node) {
     }
 
     UnionDeclaration* decl = (UnionDeclaration*)node;
-    if (decl->base.name) {
-        free(decl->base.name);
-    }
     if (decl->members) {
         for (size_t i = 0; i < vectorSize(decl->members); i++) {
             Declaration** memberPtr = vectorGet(decl->members, i);
@@ -1558,14 +1572,14 @@ static void destroyUnionDeclaration(ASTNode* node) {
         }
         vectorDestroy(decl->members, NULL);
     }
-    free(decl);
+    astFreeNode(decl);
 }
 
 /**
  * @brief 创建枚举声明
  */
 Declaration* createEnumDeclaration(const char* name, Vector* constants, SourceLocation location) {
-    EnumDeclaration* decl = (EnumDeclaration*)malloc(sizeof(EnumDeclaration));
+    EnumDeclaration* decl = (EnumDeclaration*)astAllocNode(AST_NODE_ENUM_DECLARATION, sizeof(EnumDeclaration));
     if (!decl) {
         return NULL;
     }
@@ -1576,7 +1590,7 @@ Declaration* createEnumDeclaration(const char* name, Vector* constants, SourceLo
     decl->base.base.accept = astNodeAccept;
     decl->base.base.destroy = destroyDeclaration;
 
-    decl->base.name = name ? strdup(name) : NULL;
+    decl->base.name = astInternName(name);
     decl->base.declKind = DECL_ENUM;
     decl->base.symbol = NULL;
     decl->base.storageClass = STORAGE_CLASS_NONE;
@@ -1596,16 +1610,10 @@ static void destroyEnumDeclaration(ASTNode* node) {
     }
 
     EnumDeclaration* decl = (EnumDeclaration*)node;
-    if (decl->base.name) {
-        free(decl->base.name);
-    }
     if (decl->constants) {
         for (size_t i = 0; i < vectorSize(decl->constants); i++) {
             EnumConstant* constant = (EnumConstant*)vectorGet(decl->constants, i);
             if (constant) {
-                if (constant->name) {
-                    free(constant->name);
-                }
                 if (constant->value) {
                     DESTROY_AST_NODE(constant->value);
                 }
@@ -1613,7 +1621,7 @@ static void destroyEnumDeclaration(ASTNode* node) {
         }
         vectorDestroy(decl->constants, free);
     }
-    free(decl);
+    astFreeNode(decl);
 }
 
 /**
@@ -1624,7 +1632,7 @@ Declaration* createTypedefDeclaration(const char* name, TypeSpecifier* aliasedTy
         return NULL;
     }
 
-    TypedefDeclaration* decl = (TypedefDeclaration*)malloc(sizeof(TypedefDeclaration));
+    TypedefDeclaration* decl = (TypedefDeclaration*)astAllocNode(AST_NODE_TYPEDEF_DECLARATION, sizeof(TypedefDeclaration));
     if (!decl) {
         return NULL;
     }
@@ -1635,7 +1643,7 @@ Declaration* createTypedefDeclaration(const char* name, TypeSpecifier* aliasedTy
     decl->base.base.accept = astNodeAccept;
     decl->base.base.destroy = destroyDeclaration;
 
-    decl->base.name = strdup(name);
+    decl->base.name = astInternName(name);
     decl->base.declKind = DECL_TYPEDEF;
     decl->base.symbol = NULL;
     decl->base.storageClass = STORAGE_CLASS_NONE;
@@ -1654,11 +1662,8 @@ static void destroyTypedefDeclaration(ASTNode* node) {
     }
 
     TypedefDeclaration* decl = (TypedefDeclaration*)node;
-    if (decl->base.name) {
-        free(decl->base.name);
-    }
     // aliasedType 由类型系统管理
-    free(decl);
+    astFreeNode(decl);
 }
 
 // ==================== 类型说明符节点实现 ====================
@@ -1670,14 +1675,14 @@ static void destroyTypeSpecifier(ASTNode* node) {
     if (!node) {
         return;
     }
-    free(node);
+    astFreeNode(node);
 }
 
 /**
  * @brief 创建基础类型说明符
  */
 TypeSpecifier* createBasicTypeSpecifier(BasicTypeKind kind, SourceLocation location) {
-    BasicTypeSpecifier* typeSpec = (BasicTypeSpecifier*)malloc(sizeof(BasicTypeSpecifier));
+    BasicTypeSpecifier* typeSpec = (BasicTypeSpecifier*)astAllocNode(AST_NODE_BASIC_TYPE_SPECIFIER, sizeof(BasicTypeSpecifier));
     if (!typeSpec) {
         return NULL;
     }
@@ -1705,7 +1710,7 @@ TypeSpecifier* createBasicTypeSpecifier(BasicTypeKind kind, SourceLocation locat
  * @brief 创建指针类型说明符
  */
 TypeSpecifier* createPointerTypeSpecifier(TypeSpecifier* baseType, SourceLocation location) {
-    PointerTypeSpecifier* typeSpec = (PointerTypeSpecifier*)malloc(sizeof(PointerTypeSpecifier));
+    PointerTypeSpecifier* typeSpec = (PointerTypeSpecifier*)astAllocNode(AST_NODE_POINTER_TYPE_SPECIFIER, sizeof(PointerTypeSpecifier));
     if (!typeSpec) {
         return NULL;
     }
@@ -1735,14 +1740,14 @@ static void destroyPointerTypeSpecifier(ASTNode* node) {
 
     PointerTypeSpecifier* typeSpec = (PointerTypeSpecifier*)node;
     // baseType 由类型系统管理，不在这里释放
-    free(typeSpec);
+    astFreeNode(typeSpec);
 }
 
 /**
  * @brief 创建数组类型说明符
  */
 TypeSpecifier* createArrayTypeSpecifier(TypeSpecifier* elementType, Expression* size, SourceLocation location) {
-    ArrayTypeSpecifier* typeSpec = (ArrayTypeSpecifier*)malloc(sizeof(ArrayTypeSpecifier));
+    ArrayTypeSpecifier* typeSpec = (ArrayTypeSpecifier*)astAllocNode(AST_NODE_ARRAY_TYPE_SPECIFIER, sizeof(ArrayTypeSpecifier));
     if (!typeSpec) {
         return NULL;
     }
@@ -1781,14 +1786,14 @@ static void destroyArrayTypeSpecifier(ASTNode* node) {
     if (typeSpec->size) {
         DESTROY_AST_NODE(typeSpec->size);
     }
-    free(typeSpec);
+    astFreeNode(typeSpec);
 }
 
 /**
  * @brief 创建函数类型说明符
  */
 TypeSpecifier* createFunctionTypeSpecifier(TypeSpecifier* returnType, Vector* parameterTypes, bool isVariadic, SourceLocation location) {
-    FunctionTypeSpecifier* typeSpec = (FunctionTypeSpecifier*)malloc(sizeof(FunctionTypeSpecifier));
+    FunctionTypeSpecifier* typeSpec = (FunctionTypeSpecifier*)astAllocNode(AST_NODE_FUNCTION_TYPE_SPECIFIER, sizeof(FunctionTypeSpecifier));
     if (!typeSpec) {
         return NULL;
     }
@@ -1820,14 +1825,14 @@ static void destroyFunctionTypeSpecifier(ASTNode* node) {
 
     FunctionTypeSpecifier* typeSpec = (FunctionTypeSpecifier*)node;
     // returnType 和 parameterTypes 由类型系统管理
-    free(typeSpec);
+    astFreeNode(typeSpec);
 }
 
 /**
  * @brief 创建结构体类型说明符
  */
 TypeSpecifier* createStructTypeSpecifier(const char* name, StructDeclaration* declaration, SourceLocation location) {
-    StructTypeSpecifier* typeSpec = (StructTypeSpecifier*)malloc(sizeof(StructTypeSpecifier));
+    StructTypeSpecifier* typeSpec = (StructTypeSpecifier*)astAllocNode(AST_NODE_STRUCT_TYPE_SPECIFIER, sizeof(StructTypeSpecifier));
     if (!typeSpec) {
         return NULL;
     }
@@ -1842,7 +1847,7 @@ TypeSpecifier* createStructTypeSpecifier(const char* name, StructDeclaration* de
     typeSpec->base.isConst = false;
     typeSpec->base.isVolatile = false;
 
-    typeSpec->name = name ? strdup(name) : NULL;
+    typeSpec->name = astInternName(name);
     typeSpec->declaration = declaration;
 
     return (TypeSpecifier*)typeSpec;
@@ -1857,18 +1862,15 @@ static void destroyStructTypeSpecifier(ASTNode* node) {
     }
 
     StructTypeSpecifier* typeSpec = (StructTypeSpecifier*)node;
-    if (typeSpec->name) {
-        free(typeSpec->name);
-    }
     // declaration 由符号表管理
-    free(typeSpec);
+    astFreeNode(typeSpec);
 }
 
 /**
  * @brief 创建联合体类型说明符
  */
 TypeSpecifier* createUnionTypeSpecifier(const char* name, UnionDeclaration* declaration, SourceLocation location) {
-    UnionTypeSpecifier* typeSpec = (UnionTypeSpecifier*)malloc(sizeof(UnionTypeSpecifier));
+    UnionTypeSpecifier* typeSpec = (UnionTypeSpecifier*)astAllocNode(AST_NODE_UNION_TYPE_SPECIFIER, sizeof(UnionTypeSpecifier));
     if (!typeSpec) {
         return NULL;
     }
@@ -1883,7 +1885,7 @@ TypeSpecifier* createUnionTypeSpecifier(const char* name, UnionDeclaration* decl
     typeSpec->base.isConst = false;
     typeSpec->base.isVolatile = false;
 
-    typeSpec->name = name ? strdup(name) : NULL;
+    typeSpec->name = astInternName(name);
     typeSpec->declaration = declaration;
 
     return (TypeSpecifier*)typeSpec;
@@ -1898,17 +1900,14 @@ static void destroyUnionTypeSpecifier(ASTNode* node) {
     }
 
     UnionTypeSpecifier* typeSpec = (UnionTypeSpecifier*)node;
-    if (typeSpec->name) {
-        free(typeSpec->name);
-    }
-    free(typeSpec);
+    astFreeNode(typeSpec);
 }
 
 /**
  * @brief 创建枚举类型说明符
  */
 TypeSpecifier* createEnumTypeSpecifier(const char* name, EnumDeclaration* declaration, SourceLocation location) {
-    EnumTypeSpecifier* typeSpec = (EnumTypeSpecifier*)malloc(sizeof(EnumTypeSpecifier));
+    EnumTypeSpecifier* typeSpec = (EnumTypeSpecifier*)astAllocNode(AST_NODE_ENUM_TYPE_SPECIFIER, sizeof(EnumTypeSpecifier));
     if (!typeSpec) {
         return NULL;
     }
@@ -1923,7 +1922,7 @@ TypeSpecifier* createEnumTypeSpecifier(const char* name, EnumDeclaration* declar
     typeSpec->base.isConst = false;
     typeSpec->base.isVolatile = false;
 
-    typeSpec->name = name ? strdup(name) : NULL;
+    typeSpec->name = astInternName(name);
     typeSpec->declaration = declaration;
 
     return (TypeSpecifier*)typeSpec;
@@ -1938,10 +1937,7 @@ static void destroyEnumTypeSpecifier(ASTNode* node) {
     }
 
     EnumTypeSpecifier* typeSpec = (EnumTypeSpecifier*)node;
-    if (typeSpec->name) {
-        free(typeSpec->name);
-    }
-    free(typeSpec);
+    astFreeNode(typeSpec);
 }
 
 /**
@@ -1952,7 +1948,7 @@ TypeSpecifier* createTypedefNameSpecifier(const char* typedefName, SourceLocatio
         return NULL;
     }
 
-    TypedefNameSpecifier* typeSpec = (TypedefNameSpecifier*)malloc(sizeof(TypedefNameSpecifier));
+    TypedefNameSpecifier* typeSpec = (TypedefNameSpecifier*)astAllocNode(AST_NODE_TYPEDEF_NAME_SPECIFIER, sizeof(TypedefNameSpecifier));
     if (!typeSpec) {
         return NULL;
     }
@@ -1967,7 +1963,7 @@ TypeSpecifier* createTypedefNameSpecifier(const char* typedefName, SourceLocatio
     typeSpec->base.isConst = false;
     typeSpec->base.isVolatile = false;
 
-    typeSpec->typedefName = strdup(typedefName);
+    typeSpec->typedefName = astInternName(typedefName);
 
     return (TypeSpecifier*)typeSpec;
 }
@@ -1981,10 +1977,7 @@ static void destroyTypedefNameSpecifier(ASTNode* node) {
     }
 
     TypedefNameSpecifier* typeSpec = (TypedefNameSpecifier*)node;
-    if (typeSpec->typedefName) {
-        free(typeSpec->typedefName);
-    }
-    free(typeSpec);
+    astFreeNode(typeSpec);
 }
 
 // ==================== 辅助字符串转换函数 ====================
@@ -78,7 +78,7 @@ typedef struct {
  */
 typedef struct {
     Expression base;
-    char* name;                // 标识符名称
+    InternedString name;       // 标识符名称（全局驻留字符串）
     Symbol* symbol;            // 符号表条目（由语义分析器解析）
 } IdentifierExpr;
 
@@ -146,7 +146,7 @@ typedef struct {
 typedef struct {
     Expression base;
     Expression* baseExpr;
-    char* memberName;
+    InternedString memberName;
     bool isArrow;              // true for ->, false for .
 } MemberAccessExpr;
 
@@ -268,7 +268,7 @@ typedef struct {
  */
 typedef struct {
     Statement base;
-    char* labelName;
+    InternedString labelName;
     Statement* statement;
 } LabeledStatement;
 
@@ -277,7 +277,7 @@ typedef struct {
  */
 typedef struct {
     Statement base;
-    char* labelName;
+    InternedString labelName;
 } GotoStatement;
 
 // ==================== 声明节点类型 ====================
@@ -326,7 +326,7 @@ typedef struct {
  * @brief 枚举常量
  */
 typedef struct {
-    char* name;
+    InternedString name;
     Expression* value;         // 可以为 NULL
 } EnumConstant;
 
@@ -408,7 +408,7 @@ typedef struct {
  */
 typedef struct {
     TypeSpecifier base;
-    char* name;                // NULL 表示匿名结构体
+    InternedString name;       // NULL 表示匿名结构体
     StructDeclaration* declaration;  // 可以为 NULL（前向声明）
 } StructTypeSpecifier;
 
@@ -417,7 +417,7 @@ typedef struct {
  */
 typedef struct {
     TypeSpecifier base;
-    char* name;                // NULL 表示匿名联合体
+    InternedString name;       // NULL 表示匿名联合体
     UnionDeclaration* declaration;   // 可以为 NULL（前向声明）
 } UnionTypeSpecifier;
 
@@ -426,7 +426,7 @@ typedef struct {
  */
 typedef struct {
     TypeSpecifier base;
-    char* name;                // NULL 表示匿名枚举
+    InternedString name;       // NULL 表示匿名枚举
     EnumDeclaration* declaration;    // 可以为 NULL（前向声明）
 } EnumTypeSpecifier;
 
@@ -435,7 +435,7 @@ typedef struct {
  */
 typedef struct {
     TypeSpecifier base;
-    char* typedefName;
+    InternedString typedefName;
 } TypedefNameSpecifier;
 
 // ==================== 工厂函数声明 ====================
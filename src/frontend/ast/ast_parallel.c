@@ -0,0 +1,368 @@
+/**
+ * @file ast_parallel.c
+ * @brief 顶层声明的并行访问实现
+ */
+
+// sysconf(_SC_NPROCESSORS_ONLN)、strdup和pthread需要POSIX接口
+#define _DEFAULT_SOURCE
+#include "ast_parallel.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// ==================== 内部数据结构 ====================
+
+/**
+ * @brief 工作线程缓冲的一条诊断
+ */
+typedef struct {
+    size_t declaration;     // 报告时正在访问的声明下标
+    size_t sequence;        // 在本线程内的报告顺序
+    DiagnosticLevel level;
+    SourceLocation location;
+    char* message;
+} ParallelDiagnostic;
+
+/**
+ * @brief 工作线程持有的声明区间
+ *
+ * 高32位是下一个待领取的下标，低32位是区间终点（不含）。
+ * 补齐到64字节，相邻线程的区间不在同一缓存行里。
+ */
+typedef struct {
+    _Atomic uint64_t bounds;
+    char padding[64 - sizeof(uint64_t)];
+} ParallelRange;
+
+struct ParallelJob;
+
+/**
+ * @brief 工作线程状态
+ */
+typedef struct {
+    ParallelRange range;
+    struct ParallelJob* job;
+    ASTVisitor visitor;             // 访问者模板的副本，privateData为本线程的数据
+    void* data;                     // createWorkerData的返回值
+    DiagnosticEngine* diagnostics;  // 本线程的诊断缓冲
+    Vector* records;                // ParallelDiagnostic
+    size_t currentDeclaration;
+    bool ready;                     // 初始化成功，data需要合并
+} ParallelWorker;
+
+/**
+ * @brief 所有工作线程共享的任务
+ */
+typedef struct ParallelJob {
+    const ASTParallelVisitOptions* options;
+    Vector* declarations;
+    ParallelWorker* workers;
+    size_t workerCount;
+} ParallelJob;
+
+/**
+ * @brief 把诊断记到工作线程缓冲里的消费者
+ */
+typedef struct {
+    DiagnosticConsumer base;
+    ParallelWorker* worker;
+} ParallelDiagnosticConsumer;
+
+static inline uint64_t parallelPackRange(uint32_t begin, uint32_t end) {
+    return ((uint64_t)begin << 32) | end;
+}
+
+// ==================== 诊断缓冲 ====================
+
+static void parallelDiagnosticConsumerHandle(DiagnosticConsumer* consumer,
+                                             const Diagnostic* diagnostic) {
+    ParallelWorker* worker = ((ParallelDiagnosticConsumer*)consumer)->worker;
+    ParallelDiagnostic* record = (ParallelDiagnostic*)vectorEmplaceBack(worker->records);
+    if (!record) {
+        return;
+    }
+
+    record->declaration = worker->currentDeclaration;
+    record->sequence = vectorSize(worker->records) - 1;
+    record->level = diagnostic->level;
+    record->location = diagnostic->location;
+    record->message = strdup(diagnostic->message ? diagnostic->message : "");
+}
+
+static void parallelDiagnosticConsumerDestroy(DiagnosticConsumer* consumer) {
+    free(consumer);
+}
+
+/**
+ * @brief 按（声明下标，报告顺序）排序
+ */
+static int parallelCompareDiagnostics(const void* a, const void* b) {
+    const ParallelDiagnostic* left = *(const ParallelDiagnostic* const*)a;
+    const ParallelDiagnostic* right = *(const ParallelDiagnostic* const*)b;
+    if (left->declaration != right->declaration) {
+        return left->declaration < right->declaration ? -1 : 1;
+    }
+    if (left->sequence != right->sequence) {
+        return left->sequence < right->sequence ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief 把所有线程缓冲的诊断按源码顺序重放到目标引擎
+ */
+static void parallelReplayDiagnostics(ParallelJob* job) {
+    DiagnosticEngine* target = job->options->diagnostics;
+    size_t total = 0;
+    for (size_t i = 0; i < job->workerCount; i++) {
+        if (job->workers[i].records) {
+            total += vectorSize(job->workers[i].records);
+        }
+    }
+    if (!target || total == 0) {
+        return;
+    }
+
+    ParallelDiagnostic** sorted = (ParallelDiagnostic**)malloc(total * sizeof(ParallelDiagnostic*));
+    if (!sorted) {
+        return;
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < job->workerCount; i++) {
+        Vector* records = job->workers[i].records;
+        for (size_t j = 0; records && j < vectorSize(records); j++) {
+            sorted[count++] = &VECTOR_AT(records, ParallelDiagnostic, j);
+        }
+    }
+    qsort(sorted, count, sizeof(ParallelDiagnostic*), parallelCompareDiagnostics);
+
+    for (size_t i = 0; i < count; i++) {
+        diagnosticEngineReport(target, sorted[i]->level, sorted[i]->location, "%s",
+                               sorted[i]->message ? sorted[i]->message : "");
+    }
+    free(sorted);
+}
+
+static void parallelFreeRecord(void* element) {
+    free(((ParallelDiagnostic*)element)->message);
+}
+
+// ==================== 调度 ====================
+
+/**
+ * @brief 从自己区间的头部领取一个声明
+ */
+static bool parallelTakeOwn(ParallelWorker* worker, size_t* index) {
+    uint64_t bounds = atomic_load(&worker->range.bounds);
+    for (;;) {
+        uint32_t begin = (uint32_t)(bounds >> 32);
+        uint32_t end = (uint32_t)bounds;
+        if (begin >= end) {
+            return false;
+        }
+        // 失败时bounds被更新为当前值，重试
+        if (atomic_compare_exchange_weak(&worker->range.bounds, &bounds,
+                                         parallelPackRange(begin + 1, end))) {
+            *index = begin;
+            return true;
+        }
+    }
+}
+
+/**
+ * @brief 从其他线程区间的尾部偷走一半，放进自己（已空）的区间
+ */
+static bool parallelSteal(ParallelWorker* worker) {
+    ParallelJob* job = worker->job;
+    size_t self = (size_t)(worker - job->workers);
+
+    for (size_t step = 1; step < job->workerCount; step++) {
+        ParallelWorker* victim = &job->workers[(self + step) % job->workerCount];
+        uint64_t bounds = atomic_load(&victim->range.bounds);
+
+        for (;;) {
+            uint32_t begin = (uint32_t)(bounds >> 32);
+            uint32_t end = (uint32_t)bounds;
+            if (begin >= end) {
+                break;
+            }
+            uint32_t middle = end - (end - begin + 1) / 2;
+            if (atomic_compare_exchange_weak(&victim->range.bounds, &bounds,
+                                             parallelPackRange(begin, middle))) {
+                // 自己的区间为空时别的线程不会修改它，直接写入
+                atomic_store(&worker->range.bounds, parallelPackRange(middle, end));
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief 初始化工作线程：诊断缓冲、privateData和访问者副本
+ */
+static bool parallelWorkerInit(ParallelWorker* worker) {
+    const ASTParallelVisitOptions* options = worker->job->options;
+
+    worker->records = vectorCreate(sizeof(ParallelDiagnostic), 0);
+    ParallelDiagnosticConsumer* consumer =
+        (ParallelDiagnosticConsumer*)malloc(sizeof(ParallelDiagnosticConsumer));
+    if (!worker->records || !consumer) {
+        free(consumer);
+        return false;
+    }
+    consumer->base.handleDiagnostic = parallelDiagnosticConsumerHandle;
+    consumer->base.destroy = parallelDiagnosticConsumerDestroy;
+    consumer->base.privateData = NULL;
+    consumer->worker = worker;
+
+    worker->diagnostics = createDiagnosticEngine(&consumer->base);
+    if (!worker->diagnostics) {
+        free(consumer);
+        return false;
+    }
+
+    worker->visitor = *options->visitor;
+    if (options->createWorkerData) {
+        worker->data = options->createWorkerData(worker->diagnostics, options->userData);
+        if (!worker->data) {
+            return false;
+        }
+        worker->visitor.privateData = worker->data;
+    }
+
+    worker->ready = true;
+    return true;
+}
+
+/**
+ * @brief 工作线程：先做完自己的区间，再去偷别人的
+ */
+static void* parallelWorkerRun(void* arg) {
+    ParallelWorker* worker = (ParallelWorker*)arg;
+    ParallelJob* job = worker->job;
+
+    // 初始化失败时不领任务，自己的区间会被其他线程偷走
+    if (!parallelWorkerInit(worker)) {
+        return NULL;
+    }
+
+    // 调用线程可能装着ASTBuilder的内存池，内存池不是线程安全的；
+    // 访问期间所有线程新建的节点都在堆上分配，行为一致
+    ASTSlabArena* previousSlabArena = astSetSlabArena(NULL);
+    MemoryPool* previousNodeArena = astSetNodeArena(NULL);
+
+    size_t index;
+    for (;;) {
+        if (!parallelTakeOwn(worker, &index)) {
+            if (!parallelSteal(worker)) {
+                break;
+            }
+            continue;
+        }
+
+        ASTNode* declaration = VECTOR_AT(job->declarations, ASTNode*, index);
+        if (!declaration) {
+            continue;
+        }
+        worker->currentDeclaration = index;
+        if (job->options->walkSubtrees) {
+            astTraverseDFS(declaration, &worker->visitor, true);
+        } else {
+            astNodeAccept(declaration, &worker->visitor);
+        }
+    }
+
+    astSetNodeArena(previousNodeArena);
+    astSetSlabArena(previousSlabArena);
+    return NULL;
+}
+
+// ==================== 入口 ====================
+
+bool astVisitDeclarationsParallel(TranslationUnit* unit, const ASTParallelVisitOptions* options) {
+    if (!unit || !options || !options->visitor) {
+        return false;
+    }
+
+    size_t declarationCount = unit->declarations ? vectorSize(unit->declarations) : 0;
+    if (declarationCount > UINT32_MAX) {
+        return false;
+    }
+
+    size_t threadCount = options->threadCount;
+    if (threadCount == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threadCount = online > 0 ? (size_t)online : 1;
+    }
+    size_t maxThreads = declarationCount / AST_PARALLEL_MIN_DECLS_PER_THREAD;
+    if (threadCount > maxThreads) {
+        threadCount = maxThreads > 0 ? maxThreads : 1;
+    }
+
+    ParallelWorker* workers = (ParallelWorker*)calloc(threadCount, sizeof(ParallelWorker));
+    if (!workers) {
+        return false;
+    }
+
+    ParallelJob job;
+    job.options = options;
+    job.declarations = unit->declarations;
+    job.workers = workers;
+    job.workerCount = threadCount;
+
+    // 按下标均分成连续区间，相邻的声明留在同一线程里
+    for (size_t i = 0; i < threadCount; i++) {
+        uint32_t begin = (uint32_t)(declarationCount * i / threadCount);
+        uint32_t end = (uint32_t)(declarationCount * (i + 1) / threadCount);
+        atomic_init(&workers[i].range.bounds, parallelPackRange(begin, end));
+        workers[i].job = &job;
+    }
+
+    // 当前线程作为0号工作线程参与；线程创建失败时少开几个，它们的区间照样被偷走
+    pthread_t* threads = threadCount > 1 ? (pthread_t*)malloc((threadCount - 1) * sizeof(pthread_t)) : NULL;
+    size_t started = 0;
+    if (threads) {
+        while (started < threadCount - 1 &&
+               pthread_create(&threads[started], NULL, parallelWorkerRun, &workers[started + 1]) == 0) {
+            started++;
+        }
+    }
+    parallelWorkerRun(&workers[0]);
+    for (size_t i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+
+    // 没有线程完成初始化时区间无人领取
+    bool completed = true;
+    for (size_t i = 0; i < threadCount; i++) {
+        uint64_t bounds = atomic_load(&workers[i].range.bounds);
+        if ((uint32_t)(bounds >> 32) < (uint32_t)bounds) {
+            completed = false;
+        }
+    }
+
+    parallelReplayDiagnostics(&job);
+
+    for (size_t i = 0; i < threadCount; i++) {
+        ParallelWorker* worker = &workers[i];
+        if (worker->ready && options->mergeWorkerData) {
+            options->mergeWorkerData(worker->data, options->userData);
+        }
+        if (worker->diagnostics) {
+            destroyDiagnosticEngine(worker->diagnostics);
+        }
+        if (worker->records) {
+            vectorDestroy(worker->records, parallelFreeRecord);
+        }
+    }
+    free(workers);
+
+    return completed;
+}
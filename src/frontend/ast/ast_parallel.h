@@ -0,0 +1,62 @@
+#ifndef AST_PARALLEL_H
+#define AST_PARALLEL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "ast.h"
+#include "ast_visitor.h"
+#include "../../common/diagnostics/diagnostic_engine.h"
+
+// 每个工作线程平均至少分到的顶层声明数，声明太少时少开线程
+#define AST_PARALLEL_MIN_DECLS_PER_THREAD 8
+
+/**
+ * @brief 并行访问的配置
+ *
+ * 每个工作线程复制一份visitor，并用createWorkerData创建自己的privateData，
+ * 访问函数通过self->privateData取到本线程的上下文，不需要加锁。
+ */
+typedef struct {
+    const ASTVisitor* visitor;      // 访问者模板，每个工作线程复制一份
+    bool walkSubtrees;              // true：对每个声明做前序astTraverseDFS；false：只astNodeAccept声明本身
+    size_t threadCount;             // 工作线程数（0表示使用在线CPU数，含调用线程）
+
+    /**
+     * @brief 在工作线程上创建该线程的privateData（可为NULL，此时沿用visitor->privateData）
+     *
+     * diagnostics是本线程的诊断缓冲，访问函数应把诊断报告到这里；
+     * 结束后所有线程的诊断按声明的源码顺序合并到options.diagnostics。
+     * 返回NULL表示创建失败，该线程不领取任务。
+     */
+    void* (*createWorkerData)(DiagnosticEngine* diagnostics, void* userData);
+
+    /**
+     * @brief 在调用线程上合并并释放privateData（可为NULL）
+     *
+     * 所有线程结束后按工作线程编号依次调用，合并顺序与调度无关。
+     */
+    void (*mergeWorkerData)(void* workerData, void* userData);
+
+    void* userData;                 // 传给上面两个回调
+    DiagnosticEngine* diagnostics;  // 合并诊断的目标（可为NULL，此时丢弃诊断）
+} ASTParallelVisitOptions;
+
+/**
+ * @brief 并行访问翻译单元的顶层声明
+ *
+ * 顶层声明之间互不依赖（语义检查、降级等按函数进行的工作），按下标切成
+ * 连续区间分给各工作线程。每个线程从自己区间的头部依次领取，做完后
+ * 从其他线程区间的尾部偷走一半，函数大小悬殊时也能保持负载均衡。
+ * 区间用一个64位原子量表示，领取和窃取都是一次CAS，不加锁。
+ *
+ * 各线程的诊断先记在自己的缓冲里，结束后按（声明下标，报告顺序）排序
+ * 重放到options->diagnostics，输出与顺序访问完全相同。
+ * 线程数为1或声明太少时在调用线程上顺序执行，行为不变。
+ *
+ * @param unit 翻译单元
+ * @param options 并行访问配置
+ * @return 所有声明都访问完返回true；参数无效或没有线程能完成初始化时返回false
+ */
+bool astVisitDeclarationsParallel(TranslationUnit* unit, const ASTParallelVisitOptions* options);
+
+#endif // AST_PARALLEL_H
@@ -0,0 +1,125 @@
+#ifndef AST_STATIC_VISITOR_H
+#define AST_STATIC_VISITOR_H
+
+#include <stdbool.h>
+#include "ast_walk.h"
+
+/**
+ * @brief 编译期生成的静态访问者
+ *
+ * ASTVisitor每访问一个节点要经过遍历回调、astNodeAccept里的switch、
+ * beforeVisit/afterVisit钩子和访问函数指针，全是间接调用，编译器无法内联。
+ * 常量求值、引用计数这类遍历密集的遍可以改用静态访问者：遍在编译期列出
+ * 自己处理的节点类型和处理函数，宏展开成一个带switch的专用遍历函数，
+ * 处理函数是直接调用，可以被内联；子节点枚举和遍历栈与astWalk相同。
+ *
+ * 处理函数的形式为：
+ *   ASTWalkAction handler(NodeType* node, StateType* state);
+ * 前序处理函数可以返回AST_WALK_SKIP_CHILDREN跳过子节点，任何处理函数都可以
+ * 返回AST_WALK_STOP结束遍历。没有列出的节点类型直接跳过，不产生调用。
+ *
+ * 用法：
+ *   #define USE_COUNT_PREORDER(HANDLER) \
+ *       HANDLER(AST_NODE_IDENTIFIER_EXPR, IdentifierExpr, countIdentifier)
+ *
+ *   AST_DEFINE_STATIC_VISITOR(useCountWalk, UseCountState,
+ *                             USE_COUNT_PREORDER, AST_STATIC_NO_HANDLERS)
+ *
+ *   useCountWalk(root, &state);   // 完整遍历返回true，被停止或内存不足返回false
+ */
+
+/**
+ * @brief 处理函数列表中一项展开成的case
+ */
+#define AST_STATIC_VISITOR_CASE(kind, NodeType, handler) \
+    case kind: \
+        return handler((NodeType*)node, state);
+
+/**
+ * @brief 空的处理函数列表（只需要前序或只需要后序时使用）
+ */
+#define AST_STATIC_NO_HANDLERS(HANDLER)
+
+/**
+ * @brief 定义静态访问者
+ *
+ * 生成static bool name(ASTNode* root, StateType* state)，以及它使用的
+ * name##Preorder、name##Postorder两个分派函数。
+ *
+ * @param name 生成的遍历函数名
+ * @param StateType 遍的状态类型，处理函数的第二个参数
+ * @param PRE_HANDLERS 前序处理函数列表宏，形如LIST(HANDLER)
+ * @param POST_HANDLERS 后序处理函数列表宏
+ */
+#define AST_DEFINE_STATIC_VISITOR(name, StateType, PRE_HANDLERS, POST_HANDLERS) \
+    static inline ASTWalkAction name##Preorder(ASTNode* node, StateType* state) { \
+        (void)state; \
+        switch (node->nodeType) { \
+            PRE_HANDLERS(AST_STATIC_VISITOR_CASE) \
+            default: \
+                return AST_WALK_CONTINUE; \
+        } \
+    } \
+    \
+    static inline ASTWalkAction name##Postorder(ASTNode* node, StateType* state) { \
+        (void)state; \
+        switch (node->nodeType) { \
+            POST_HANDLERS(AST_STATIC_VISITOR_CASE) \
+            default: \
+                return AST_WALK_CONTINUE; \
+        } \
+    } \
+    \
+    static bool name(ASTNode* root, StateType* state) { \
+        if (!root) { \
+            return true; \
+        } \
+        ASTWalkAction action = name##Preorder(root, state); \
+        if (action == AST_WALK_STOP) { \
+            return false; \
+        } \
+        if (action == AST_WALK_SKIP_CHILDREN || astNodeIsLeafKind(root->nodeType)) { \
+            return name##Postorder(root, state) != AST_WALK_STOP; \
+        } \
+        \
+        ASTWalkStack stack; \
+        astWalkStackInit(&stack); \
+        astWalkStackPush(&stack, root); \
+        bool completed = true; \
+        \
+        while (stack.depth > 0) { \
+            ASTWalkFrame* frame = astWalkStackTop(&stack); \
+            ASTNode* child = astChildCursorNext(frame->node, &frame->cursor); \
+            if (!child) { \
+                ASTNode* finished = frame->node; \
+                astWalkStackPop(&stack); \
+                if (name##Postorder(finished, state) == AST_WALK_STOP) { \
+                    completed = false; \
+                    break; \
+                } \
+                continue; \
+            } \
+            \
+            action = name##Preorder(child, state); \
+            if (action == AST_WALK_STOP) { \
+                completed = false; \
+                break; \
+            } \
+            if (action == AST_WALK_SKIP_CHILDREN || astNodeIsLeafKind(child->nodeType)) { \
+                if (name##Postorder(child, state) == AST_WALK_STOP) { \
+                    completed = false; \
+                    break; \
+                } \
+                continue; \
+            } \
+            if (!astWalkStackPush(&stack, child)) { \
+                completed = false; \
+                break; \
+            } \
+        } \
+        \
+        astWalkStackRelease(&stack); \
+        return completed; \
+    }
+
+#endif // AST_STATIC_VISITOR_H
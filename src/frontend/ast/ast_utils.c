@@ -6,7 +6,9 @@
  */
 
 #include "ast_utils.h"
+#include "ast_walk.h"
 #include "../../common/diagnostics/diagnostic_engine.h"
+#include "../../common/utils/hash_table.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -14,311 +16,80 @@
 // ==================== 内部辅助函数 ====================
 
 /**
- * @brief 递归计数节点
+ * @brief 计数回调：每个节点加一
  */
-static size_t countNodesRecursive(const ASTNode* node) {
-    if (!node) {
-        return 0;
-    }
-
-    size_t count = 1;  // 计数当前节点
-
-    // 根据节点类型递归计数子节点
-    switch (node->nodeType) {
-        case AST_NODE_TRANSLATION_UNIT: {
-            const TranslationUnit* unit = (const TranslationUnit*)node;
-            if (unit->declarations) {
-                for (size_t i = 0; i < vectorSize(unit->declarations); i++) {
-                    ASTNode* child = (ASTNode*)vectorGet(unit->declarations, i);
-                    count += countNodesRecursive(child);
-                }
-            }
-            break;
-        }
-
-        case AST_NODE_COMPOUND_STATEMENT: {
-            const CompoundStatement* stmt = (const CompoundStatement*)node;
-            if (stmt->statements) {
-                for (size_t i = 0; i < vectorSize(stmt->statements); i++) {
-                    ASTNode* child = (ASTNode*)vectorGet(stmt->statements, i);
-                    count += countNodesRecursive(child);
-                }
-            }
-            if (stmt->declarations) {
-                for (size_t i = 0; i < vectorSize(stmt->declarations); i++) {
-                    ASTNode* child = (ASTNode*)vectorGet(stmt->declarations, i);
-                    count += countNodesRecursive(child);
-                }
-            }
-            break;
-        }
-
-        case AST_NODE_BINARY_OPERATOR_EXPR: {
-            const BinaryOperatorExpr* expr = (const BinaryOperatorExpr*)node;
-            if (expr->left) count += countNodesRecursive((ASTNode*)expr->left);
-            if (expr->right) count += countNodesRecursive((ASTNode*)expr->right);
-            break;
-        }
-
-        case AST_NODE_UNARY_OPERATOR_EXPR: {
-            const UnaryOperatorExpr* expr = (const UnaryOperatorExpr*)node;
-            if (expr->operand) count += countNodesRecursive((ASTNode*)expr->operand);
-            break;
-        }
-
-        case AST_NODE_ASSIGNMENT_EXPR: {
-            const AssignmentExpr* expr = (const AssignmentExpr*)node;
-            if (expr->left) count += countNodesRecursive((ASTNode*)expr->left);
-            if (expr->right) count += countNodesRecursive((ASTNode*)expr->right);
-            break;
-        }
-
-        case AST_NODE_TERNARY_EXPR: {
-            const TernaryExpr* expr = (const TernaryExpr*)node;
-            if (expr->condition) count += countNodesRecursive((ASTNode*)expr->condition);
-            if (expr->thenExpr) count += countNodesRecursive((ASTNode*)expr->thenExpr);
-            if (expr->elseExpr) count += countNodesRecursive((ASTNode*)expr->elseExpr);
-            break;
-        }
-
-        case AST_NODE_FUNCTION_CALL_EXPR: {
-            const FunctionCallExpr* expr = (const FunctionCallExpr*)node;
-            if (expr->callee) count += countNodesRecursive((ASTNode*)expr->callee);
-            if (expr->arguments) {
-                for (size_t i = 0; i < vectorSize(expr->arguments); i++) {
-                    Expression* arg = (Expression*)vectorGet(expr->arguments, i);
-                    count += countNodesRecursive((ASTNode*)arg);
-                }
-            }
-            break;
-        }
-
-        case AST_NODE_ARRAY_SUBSCRIPT_EXPR: {
-            const ArraySubscriptExpr* expr = (const ArraySubscriptExpr*)node;
-            if (expr->array) count += countNodesRecursive((ASTNode*)expr->array);
-            if (expr->index) count += countNodesRecursive((ASTNode*)expr->index);
-            break;
-        }
-
-        case AST_NODE_MEMBER_ACCESS_EXPR: {
-            const MemberAccessExpr* expr = (const MemberAccessExpr*)node;
-            if (expr->baseExpr) count += countNodesRecursive((ASTNode*)expr->baseExpr);
-            break;
-        }
-
-        case AST_NODE_CAST_EXPR: {
-            const CastExpr* expr = (const CastExpr*)node;
-            if (expr->targetType) count += countNodesRecursive((ASTNode*)expr->targetType);
-            if (expr->operand) count += countNodesRecursive((ASTNode*)expr->operand);
-            break;
-        }
-
-        case AST_NODE_EXPRESSION_STATEMENT: {
-            const ExpressionStatement* stmt = (const ExpressionStatement*)node;
-            if (stmt->expression) count += countNodesRecursive((ASTNode*)stmt->expression);
-            break;
-        }
-
-        case AST_NODE_IF_STATEMENT: {
-            const IfStatement* stmt = (const IfStatement*)node;
-            if (stmt->condition) count += countNodesRecursive((ASTNode*)stmt->condition);
-            if (stmt->thenStmt) count += countNodesRecursive((ASTNode*)stmt->thenStmt);
-            if (stmt->elseStmt) count += countNodesRecursive((ASTNode*)stmt->elseStmt);
-            break;
-        }
-
-        case AST_NODE_WHILE_STATEMENT: {
-            const WhileStatement* stmt = (const WhileStatement*)node;
-            if (stmt->condition) count += countNodesRecursive((ASTNode*)stmt->condition);
-            if (stmt->body) count += countNodesRecursive((ASTNode*)stmt->body);
-            break;
-        }
-
-        case AST_NODE_DO_WHILE_STATEMENT: {
-            const DoWhileStatement* stmt = (const DoWhileStatement*)node;
-            if (stmt->body) count += countNodesRecursive((ASTNode*)stmt->body);
-            if (stmt->condition) count += countNodesRecursive((ASTNode*)stmt->condition);
-            break;
-        }
-
-        case AST_NODE_FOR_STATEMENT: {
-            const ForStatement* stmt = (const ForStatement*)node;
-            if (stmt->init) count += countNodesRecursive((ASTNode*)stmt->init);
-            if (stmt->condition) count += countNodesRecursive((ASTNode*)stmt->condition);
-            if (stmt->increment) count += countNodesRecursive((ASTNode*)stmt->increment);
-            if (stmt->body) count += countNodesRecursive((ASTNode*)stmt->body);
-            break;
-        }
-
-        case AST_NODE_RETURN_STATEMENT: {
-            const ReturnStatement* stmt = (const ReturnStatement*)node;
-            if (stmt->returnValue) count += countNodesRecursive((ASTNode*)stmt->returnValue);
-            break;
-        }
-
-        case AST_NODE_SWITCH_STATEMENT: {
-            const SwitchStatement* stmt = (const SwitchStatement*)node;
-            if (stmt->condition) count += countNodesRecursive((ASTNode*)stmt->condition);
-            if (stmt->cases) {
-                for (size_t i = 0; i < vectorSize(stmt->cases); i++) {
-                    ASTNode* caseStmt = (ASTNode*)vectorGet(stmt->cases, i);
-                    count += countNodesRecursive(caseStmt);
-                }
-            }
-            break;
-        }
-
-        case AST_NODE_CASE_STATEMENT: {
-            const CaseStatement* stmt = (const CaseStatement*)node;
-            if (stmt->value) count += countNodesRecursive((ASTNode*)stmt->value);
-            if (stmt->statement) count += countNodesRecursive((ASTNode*)stmt->statement);
-            break;
-        }
-
-        case AST_NODE_LABELED_STATEMENT: {
-            const LabeledStatement* stmt = (const LabeledStatement*)node;
-            if (stmt->statement) count += countNodesRecursive((ASTNode*)stmt->statement);
-            break;
-        }
-
-        case AST_NODE_VARIABLE_DECLARATION: {
-            const VariableDeclaration* decl = (const VariableDeclaration*)node;
-            if (decl->type) count += countNodesRecursive((ASTNode*)decl->type);
-            if (decl->initializer) count += countNodesRecursive((ASTNode*)decl->initializer);
-            break;
-        }
-
-        case AST_NODE_FUNCTION_DECLARATION: {
-            const FunctionDeclaration* decl = (const FunctionDeclaration*)node;
-            if (decl->returnType) count += countNodesRecursive((ASTNode*)decl->returnType);
-            if (decl->parameters) {
-                for (size_t i = 0; i < vectorSize(decl->parameters); i++) {
-                    ASTNode* param = (ASTNode*)vectorGet(decl->parameters, i);
-                    count += countNodesRecursive(param);
-                }
-            }
-            if (decl->body) count += countNodesRecursive((ASTNode*)decl->body);
-            break;
-        }
-
-        case AST_NODE_STRUCT_DECLARATION: {
-            const StructDeclaration* decl = (const StructDeclaration*)node;
-            if (decl->members) {
-                for (size_t i = 0; i < vectorSize(decl->members); i++) {
-                    ASTNode* member = (ASTNode*)vectorGet(decl->members, i);
-                    count += countNodesRecursive(member);
-                }
-            }
-            break;
-        }
-
-        case AST_NODE_UNION_DECLARATION: {
-            const UnionDeclaration* decl = (const UnionDeclaration*)node;
-            if (decl->members) {
-                for (size_t i = 0; i < vectorSize(decl->members); i++) {
-                    ASTNode* member = (ASTNode*)vectorGet(decl->members, i);
-                    count += countNodesRecursive(member);
-                }
-            }
-            break;
-        }
-
-        case AST_NODE_TYPEDEF_DECLARATION: {
-            const TypedefDeclaration* decl = (const TypedefDeclaration*)node;
-            if (decl->aliasedType) count += countNodesRecursive((ASTNode*)decl->aliasedType);
-            break;
-        }
-
-        case AST_NODE_POINTER_TYPE_SPECIFIER: {
-            const PointerTypeSpecifier* type = (const PointerTypeSpecifier*)node;
-            if (type->baseType) count += countNodesRecursive((ASTNode*)type->baseType);
-            break;
-        }
-
-        case AST_NODE_ARRAY_TYPE_SPECIFIER: {
-            const ArrayTypeSpecifier* type = (const ArrayTypeSpecifier*)node;
-            if (type->elementType) count += countNodesRecursive((ASTNode*)type->elementType);
-            if (type->size) count += countNodesRecursive((ASTNode*)type->size);
-            break;
-        }
-
-        case AST_NODE_FUNCTION_TYPE_SPECIFIER: {
-            const FunctionTypeSpecifier* type = (const FunctionTypeSpecifier*)node;
-            if (type->returnType) count += countNodesRecursive((ASTNode*)type->returnType);
-            if (type->parameterTypes) {
-                for (size_t i = 0; i < vectorSize(type->parameterTypes); i++) {
-                    ASTNode* paramType = (ASTNode*)vectorGet(type->parameterTypes, i);
-                    count += countNodesRecursive(paramType);
-                }
-            }
-            break;
-        }
-
-        default:
-            // 其他节点类型没有子节点
-            break;
-    }
-
-    return count;
+static ASTWalkAction countNodesCallback(ASTNode* node, size_t depth, void* userData) {
+    (void)node;
+    (void)depth;
+    (*(size_t*)userData)++;
+    return AST_WALK_CONTINUE;
 }
 
 /**
- * @brief 递归计算树深度
+ * @brief 深度回调：记录遇到的最大深度
  */
-static size_t calculateDepthRecursive(const ASTNode* node, size_t currentDepth) {
-    if (!node) {
-        return currentDepth;
+static ASTWalkAction maxDepthCallback(ASTNode* node, size_t depth, void* userData) {
+    (void)node;
+    size_t* maxDepth = (size_t*)userData;
+    if (depth > *maxDepth) {
+        *maxDepth = depth;
     }
+    return AST_WALK_CONTINUE;
+}
 
-    size_t maxDepth = currentDepth;
-
-    // 根据节点类型递归计算深度
-    switch (node->nodeType) {
-        case AST_NODE_TRANSLATION_UNIT: {
-            const TranslationUnit* unit = (const TranslationUnit*)node;
-            if (unit->declarations) {
-                for (size_t i = 0; i < vectorSize(unit->declarations); i++) {
-                    ASTNode* child = (ASTNode*)vectorGet(unit->declarations, i);
-                    size_t childDepth = calculateDepthRecursive(child, currentDepth + 1);
-                    if (childDepth > maxDepth) {
-                        maxDepth = childDepth;
-                    }
-                }
-            }
-            break;
-        }
+/**
+ * @brief 按类型查找时的遍历状态
+ */
+typedef struct {
+    ASTNodeType type;
+    Vector* results;
+} FindByTypeContext;
 
-        case AST_NODE_COMPOUND_STATEMENT: {
-            const CompoundStatement* stmt = (const CompoundStatement*)node;
-            if (stmt->statements) {
-                for (size_t i = 0; i < vectorSize(stmt->statements); i++) {
-                    ASTNode* child = (ASTNode*)vectorGet(stmt->statements, i);
-                    size_t childDepth = calculateDepthRecursive(child, currentDepth + 1);
-                    if (childDepth > maxDepth) {
-                        maxDepth = childDepth;
-                    }
-                }
-            }
-            break;
-        }
+/**
+ * @brief 查找回调：收集指定类型的节点
+ */
+static ASTWalkAction findByTypeCallback(ASTNode* node, size_t depth, void* userData) {
+    (void)depth;
+    FindByTypeContext* context = (FindByTypeContext*)userData;
+    if (node->nodeType == context->type &&
+        !VECTOR_PUSH_BACK(context->results, ASTNode*, node)) {
+        return AST_WALK_STOP;
+    }
+    return AST_WALK_CONTINUE;
+}
 
-        // 可以添加更多节点类型的处理...
+/**
+ * @brief 树验证时的遍历状态
+ */
+typedef struct {
+    DiagnosticEngine* diagnostics;
+    bool valid;
+} ValidateContext;
 
-        default:
-            break;
+/**
+ * @brief 验证回调：逐个验证节点，出错后继续以便报告全部错误
+ */
+static ASTWalkAction validateCallback(ASTNode* node, size_t depth, void* userData) {
+    (void)depth;
+    ValidateContext* context = (ValidateContext*)userData;
+    if (!astNodeValidate(node, context->diagnostics)) {
+        context->valid = false;
     }
-
-    return maxDepth;
+    return AST_WALK_CONTINUE;
 }
 
 // ==================== 节点信息函数 ====================
 
 size_t astNodeCountDescendants(const ASTNode* node) {
-    return countNodesRecursive(node);
+    size_t count = 0;
+    astWalk((ASTNode*)node, countNodesCallback, NULL, &count);
+    return count;
 }
 
 size_t astTreeGetDepth(const ASTNode* root) {
-    return calculateDepthRecursive(root, 0);
+    size_t maxDepth = 0;
+    astWalk((ASTNode*)root, maxDepthCallback, NULL, &maxDepth);
+    return maxDepth;
 }
 
 bool astNodeHasParent(const ASTNode* node) {
@@ -330,47 +101,7 @@ bool astNodeIsRoot(const ASTNode* node) {
 }
 
 size_t astNodeGetChildCount(const ASTNode* node) {
-    if (!node) {
-        return 0;
-    }
-
-    switch (node->nodeType) {
-        case AST_NODE_TRANSLATION_UNIT: {
-            const TranslationUnit* unit = (const TranslationUnit*)node;
-            return unit->declarations ? vectorSize(unit->declarations) : 0;
-        }
-
-        case AST_NODE_COMPOUND_STATEMENT: {
-            const CompoundStatement* stmt = (const CompoundStatement*)node;
-            size_t count = 0;
-            if (stmt->declarations) count += vectorSize(stmt->declarations);
-            if (stmt->statements) count += vectorSize(stmt->statements);
-            return count;
-        }
-
-        case AST_NODE_BINARY_OPERATOR_EXPR:
-        case AST_NODE_ASSIGNMENT_EXPR:
-            return 2;  // left and right
-
-        case AST_NODE_TERNARY_EXPR:
-            return 3;  // condition, thenExpr, elseExpr
-
-        case AST_NODE_UNARY_OPERATOR_EXPR:
-        case AST_NODE_CAST_EXPR:
-        case AST_NODE_ARRAY_SUBSCRIPT_EXPR:
-        case AST_NODE_MEMBER_ACCESS_EXPR:
-            return 1;  // single operand
-
-        case AST_NODE_FUNCTION_CALL_EXPR: {
-            const FunctionCallExpr* expr = (const FunctionCallExpr*)node;
-            size_t count = 1;  // callee
-            if (expr->arguments) count += vectorSize(expr->arguments);
-            return count;
-        }
-
-        default:
-            return 0;
-    }
+    return astNodeGetChildren(node, NULL, 0);
 }
 
 // ==================== 节点遍历函数 ====================
@@ -395,43 +126,13 @@ Vector* astNodeFindChildrenByType(const ASTNode* node, ASTNodeType type) {
         return NULL;
     }
 
-    switch (node->nodeType) {
-        case AST_NODE_TRANSLATION_UNIT: {
-            const TranslationUnit* unit = (const TranslationUnit*)node;
-            if (unit->declarations) {
-                for (size_t i = 0; i < vectorSize(unit->declarations); i++) {
-                    ASTNode* child = (ASTNode*)vectorGet(unit->declarations, i);
-                    if (child->nodeType == type) {
-                        vectorPushBack(results, &child);
-                    }
-                }
-            }
-            break;
+    ASTChildCursor cursor = AST_CHILD_CURSOR_INIT;
+    ASTNode* child;
+    while ((child = astNodeNextChild(node, &cursor)) != NULL) {
+        if (child->nodeType == type && !VECTOR_PUSH_BACK(results, ASTNode*, child)) {
+            vectorDestroy(results, NULL);
+            return NULL;
         }
-
-        case AST_NODE_COMPOUND_STATEMENT: {
-            const CompoundStatement* stmt = (const CompoundStatement*)node;
-            if (stmt->statements) {
-                for (size_t i = 0; i < vectorSize(stmt->statements); i++) {
-                    ASTNode* child = (ASTNode*)vectorGet(stmt->statements, i);
-                    if (child->nodeType == type) {
-                        vectorPushBack(results, &child);
-                    }
-                }
-            }
-            if (stmt->declarations) {
-                for (size_t i = 0; i < vectorSize(stmt->declarations); i++) {
-                    ASTNode* child = (ASTNode*)vectorGet(stmt->declarations, i);
-                    if (child->nodeType == type) {
-                        vectorPushBack(results, &child);
-                    }
-                }
-            }
-            break;
-        }
-
-        default:
-            break;
     }
 
     return results;
@@ -463,61 +164,13 @@ Vector* astNodeFindAllByType(ASTNode* root, ASTNodeType type) {
         return NULL;
     }
 
-    // 使用栈进行深度优先搜索
-    Vector* stack = vectorCreate(sizeof(ASTNode*), 8);
-    if (!stack) {
+    // 前序遍历，结果按源码顺序排列
+    FindByTypeContext context = {type, results};
+    if (!astWalk(root, findByTypeCallback, NULL, &context)) {
         vectorDestroy(results, NULL);
         return NULL;
     }
 
-    vectorPushBack(stack, &root);
-
-    while (vectorSize(stack) > 0) {
-        ASTNode* current = *(ASTNode**)vectorGet(stack, vectorSize(stack) - 1);
-        vectorPopBack(stack, NULL);
-
-        if (current->nodeType == type) {
-            vectorPushBack(results, &current);
-        }
-
-        // 添加子节点到栈
-        switch (current->nodeType) {
-            case AST_NODE_TRANSLATION_UNIT: {
-                const TranslationUnit* unit = (const TranslationUnit*)current;
-                if (unit->declarations) {
-                    for (size_t i = 0; i < vectorSize(unit->declarations); i++) {
-                        ASTNode* child = (ASTNode*)vectorGet(unit->declarations, i);
-                        vectorPushBack(stack, &child);
-                    }
-                }
-                break;
-            }
-
-            case AST_NODE_COMPOUND_STATEMENT: {
-                const CompoundStatement* stmt = (const CompoundStatement*)current;
-                if (stmt->statements) {
-                    for (size_t i = 0; i < vectorSize(stmt->statements); i++) {
-                        ASTNode* child = (ASTNode*)vectorGet(stmt->statements, i);
-                        vectorPushBack(stack, &child);
-                    }
-                }
-                if (stmt->declarations) {
-                    for (size_t i = 0; i < vectorSize(stmt->declarations); i++) {
-                        ASTNode* child = (ASTNode*)vectorGet(stmt->declarations, i);
-                        vectorPushBack(stack, &child);
-                    }
-                }
-                break;
-            }
-
-            // 可以添加更多节点类型的处理...
-
-            default:
-                break;
-        }
-    }
-
-    vectorDestroy(stack, NULL);
     return results;
 }
 
@@ -732,84 +385,759 @@ bool astTreeValidate(const ASTNode* root, DiagnosticEngine* diagnostics) {
         return false;
     }
 
-    bool valid = true;
+    ValidateContext context = {diagnostics, true};
+    astWalk((ASTNode*)root, validateCallback, NULL, &context);
+    return context.valid;
+}
 
-    // 验证根节点
-    if (!astNodeValidate(root, diagnostics)) {
-        valid = false;
+// ==================== 结构哈希 ====================
+
+// 列表中为NULL的子节点和为NULL的可选子节点在哈希中的占位值
+#define AST_HASH_NULL_CHILD 0x6E756C6CULL
+
+// 一个节点最多的属性字数（基本类型说明符：限定符2个、种类和4个标志）
+#define AST_MAX_ATTRIBUTE_WORDS 8
+
+/**
+ * @brief 把一个值混入哈希（boost::hash_combine加64位终结函数）
+ */
+static inline uint64_t astHashCombine(uint64_t hash, uint64_t value) {
+    uint64_t x = hash ^ (value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2));
+    x ^= x >> 31;
+    x *= 0x7FB5D329728EA185ULL;
+    x ^= x >> 27;
+    x *= 0x81DADEF4BC2DD44DULL;
+    x ^= x >> 33;
+    return x;
+}
+
+/**
+ * @brief 字面量Token的值对应的属性字
+ *
+ * 与词法分析器存值的方式一致：字符串字面量是stringValue，浮点是floatValue，
+ * 普通字符常量是charValue，其余（整数、宽字符）是intValue。
+ * 字符串取内容的哈希，相等时还要逐字节比较。
+ */
+static uint64_t literalValueWord(const Token* token) {
+    switch (token->type) {
+        case TOKEN_STRING_LITERAL:
+            return token->value.stringValue ? hashTableHashString(token->value.stringValue) : 0;
+        case TOKEN_FLOAT_LITERAL: {
+            uint64_t bits;
+            memcpy(&bits, &token->value.floatValue, sizeof(bits));
+            return bits;
+        }
+        case TOKEN_CHAR_LITERAL:
+            if (token->literalType == LITERAL_TYPE_CHAR) {
+                return (uint64_t)(unsigned char)token->value.charValue;
+            }
+            return (uint64_t)token->value.intValue;
+        default:
+            return (uint64_t)token->value.intValue;
     }
+}
 
-    // 递归验证所有子节点
-    switch (root->nodeType) {
-        case AST_NODE_TRANSLATION_UNIT: {
-            const TranslationUnit* unit = (const TranslationUnit*)root;
-            if (unit->declarations) {
-                for (size_t i = 0; i < vectorSize(unit->declarations); i++) {
-                    ASTNode* child = (ASTNode*)vectorGet(unit->declarations, i);
-                    if (!astTreeValidate(child, diagnostics)) {
-                        valid = false;
-                    }
-                }
+/**
+ * @brief 取节点的语法属性（子节点以外参与比较的字段）
+ *
+ * 名称都是驻留字符串，按指针比较；结构体等类型说明符引用的声明也按指针比较。
+ * 源位置、父指针和语义分析设置的字段不参与比较。
+ *
+ * @return 写入words的字数
+ */
+static size_t astNodeAttributeWords(const ASTNode* node, uint64_t* words) {
+    size_t count = 0;
+
+    if (astNodeIsDeclaration(node)) {
+        const Declaration* decl = (const Declaration*)node;
+        words[count++] = (uint64_t)(uintptr_t)decl->name;
+        words[count++] = (uint64_t)decl->storageClass;
+    } else if (astNodeIsTypeSpecifier(node)) {
+        const TypeSpecifier* typeSpec = (const TypeSpecifier*)node;
+        words[count++] = (uint64_t)typeSpec->isConst;
+        words[count++] = (uint64_t)typeSpec->isVolatile;
+    }
+
+    switch (node->nodeType) {
+        case AST_NODE_LITERAL_EXPR: {
+            const Token* token = ((const LiteralExpr*)node)->literalToken;
+            if (token) {
+                words[count++] = (uint64_t)token->type;
+                words[count++] = (uint64_t)token->literalType;
+                words[count++] = literalValueWord(token);
             }
             break;
         }
+        case AST_NODE_IDENTIFIER_EXPR:
+            words[count++] = (uint64_t)(uintptr_t)((const IdentifierExpr*)node)->name;
+            break;
+        case AST_NODE_BINARY_OPERATOR_EXPR:
+            words[count++] = (uint64_t)((const BinaryOperatorExpr*)node)->op;
+            break;
+        case AST_NODE_UNARY_OPERATOR_EXPR:
+            words[count++] = (uint64_t)((const UnaryOperatorExpr*)node)->op;
+            words[count++] = (uint64_t)((const UnaryOperatorExpr*)node)->isPrefix;
+            break;
+        case AST_NODE_ASSIGNMENT_EXPR:
+            words[count++] = (uint64_t)((const AssignmentExpr*)node)->kind;
+            break;
+        case AST_NODE_MEMBER_ACCESS_EXPR:
+            words[count++] = (uint64_t)(uintptr_t)((const MemberAccessExpr*)node)->memberName;
+            words[count++] = (uint64_t)((const MemberAccessExpr*)node)->isArrow;
+            break;
+        case AST_NODE_CASE_STATEMENT:
+            words[count++] = (uint64_t)((const CaseStatement*)node)->kind;
+            break;
+        case AST_NODE_LABELED_STATEMENT:
+            words[count++] = (uint64_t)(uintptr_t)((const LabeledStatement*)node)->labelName;
+            break;
+        case AST_NODE_GOTO_STATEMENT:
+            words[count++] = (uint64_t)(uintptr_t)((const GotoStatement*)node)->labelName;
+            break;
+        case AST_NODE_VARIABLE_DECLARATION:
+            words[count++] = (uint64_t)((const VariableDeclaration*)node)->isConst;
+            words[count++] = (uint64_t)((const VariableDeclaration*)node)->isVolatile;
+            break;
+        case AST_NODE_FUNCTION_DECLARATION:
+            words[count++] = (uint64_t)((const FunctionDeclaration*)node)->isInline;
+            words[count++] = (uint64_t)((const FunctionDeclaration*)node)->isNoreturn;
+            break;
+        case AST_NODE_STRUCT_DECLARATION:
+            words[count++] = (uint64_t)((const StructDeclaration*)node)->isPacked;
+            break;
+        case AST_NODE_BASIC_TYPE_SPECIFIER: {
+            const BasicTypeSpecifier* basic = (const BasicTypeSpecifier*)node;
+            words[count++] = (uint64_t)basic->kind;
+            words[count++] = (uint64_t)basic->isLong;
+            words[count++] = (uint64_t)basic->isShort;
+            words[count++] = (uint64_t)basic->isSigned;
+            words[count++] = (uint64_t)basic->isUnsigned;
+            break;
+        }
+        case AST_NODE_ARRAY_TYPE_SPECIFIER:
+            words[count++] = (uint64_t)((const ArrayTypeSpecifier*)node)->isVariableLength;
+            break;
+        case AST_NODE_FUNCTION_TYPE_SPECIFIER:
+            words[count++] = (uint64_t)((const FunctionTypeSpecifier*)node)->isVariadic;
+            break;
+        case AST_NODE_STRUCT_TYPE_SPECIFIER:
+            words[count++] = (uint64_t)(uintptr_t)((const StructTypeSpecifier*)node)->name;
+            words[count++] = (uint64_t)(uintptr_t)((const StructTypeSpecifier*)node)->declaration;
+            break;
+        case AST_NODE_UNION_TYPE_SPECIFIER:
+            words[count++] = (uint64_t)(uintptr_t)((const UnionTypeSpecifier*)node)->name;
+            words[count++] = (uint64_t)(uintptr_t)((const UnionTypeSpecifier*)node)->declaration;
+            break;
+        case AST_NODE_ENUM_TYPE_SPECIFIER:
+            words[count++] = (uint64_t)(uintptr_t)((const EnumTypeSpecifier*)node)->name;
+            words[count++] = (uint64_t)(uintptr_t)((const EnumTypeSpecifier*)node)->declaration;
+            break;
+        case AST_NODE_TYPEDEF_NAME_SPECIFIER:
+            words[count++] = (uint64_t)(uintptr_t)((const TypedefNameSpecifier*)node)->typedefName;
+            break;
+        default:
+            break;
+    }
+
+    return count;
+}
+
+/**
+ * @brief 比较两个同类型节点的语法属性
+ */
+static bool astNodeAttributesEqual(const ASTNode* a, const ASTNode* b) {
+    uint64_t wordsA[AST_MAX_ATTRIBUTE_WORDS];
+    uint64_t wordsB[AST_MAX_ATTRIBUTE_WORDS];
+    size_t countA = astNodeAttributeWords(a, wordsA);
+    size_t countB = astNodeAttributeWords(b, wordsB);
+    if (countA != countB || memcmp(wordsA, wordsB, countA * sizeof(uint64_t)) != 0) {
+        return false;
+    }
+
+    // 字符串字面量的属性字只是内容的哈希
+    if (a->nodeType == AST_NODE_LITERAL_EXPR) {
+        const Token* tokenA = ((const LiteralExpr*)a)->literalToken;
+        const Token* tokenB = ((const LiteralExpr*)b)->literalToken;
+        if (tokenA && tokenB && tokenA->type == TOKEN_STRING_LITERAL) {
+            const char* valueA = tokenA->value.stringValue;
+            const char* valueB = tokenB->value.stringValue;
+            if (valueA != valueB && (!valueA || !valueB || strcmp(valueA, valueB) != 0)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
 
-        case AST_NODE_COMPOUND_STATEMENT: {
-            const CompoundStatement* stmt = (const CompoundStatement*)root;
-            if (stmt->statements) {
-                for (size_t i = 0; i < vectorSize(stmt->statements); i++) {
-                    ASTNode* child = (ASTNode*)vectorGet(stmt->statements, i);
-                    if (!astTreeValidate(child, diagnostics)) {
-                        valid = false;
-                    }
+/**
+ * @brief 由属性和子节点已缓存的哈希计算节点的结构哈希
+ */
+static uint64_t astNodeComputeHash(const ASTNode* node) {
+    uint64_t words[AST_MAX_ATTRIBUTE_WORDS];
+    size_t wordCount = astNodeAttributeWords(node, words);
+
+    uint64_t hash = astHashCombine(0, (uint64_t)node->nodeType);
+    for (size_t i = 0; i < wordCount; i++) {
+        hash = astHashCombine(hash, words[i]);
+    }
+
+    // 逐个槽位混入子节点，为NULL的子节点也占一位，不同槽位的子节点不会混淆
+    const ASTChildLayout* layout = astNodeChildLayout(node->nodeType);
+    const char* base = (const char*)node;
+    for (size_t i = 0; i < layout->slotCount; i++) {
+        const ASTChildSlot* slot = &layout->slots[i];
+        if (slot->kind == AST_CHILD_NODE) {
+            const ASTNode* child = *(ASTNode* const*)(base + slot->offset);
+            hash = astHashCombine(hash, child ? child->structuralHash : AST_HASH_NULL_CHILD);
+            continue;
+        }
+
+        const Vector* list = *(Vector* const*)(base + slot->offset);
+        size_t size = list ? list->size : 0;
+        hash = astHashCombine(hash, (uint64_t)size);
+        for (size_t j = 0; j < size; j++) {
+            const ASTNode* child;
+            if (slot->kind == AST_CHILD_LIST) {
+                child = VECTOR_AT(list, ASTNode*, j);
+            } else {
+                const EnumConstant* constant = VECTOR_AT(list, EnumConstant*, j);
+                hash = astHashCombine(hash, constant ? (uint64_t)(uintptr_t)constant->name : 0);
+                child = constant ? (const ASTNode*)constant->value : NULL;
+            }
+            hash = astHashCombine(hash, child ? child->structuralHash : AST_HASH_NULL_CHILD);
+        }
+    }
+
+    // 0表示尚未计算
+    return hash ? hash : 1;
+}
+
+/**
+ * @brief 结构哈希前序回调：已经缓存哈希的子树不再进入
+ */
+static ASTWalkAction structuralHashPreorder(ASTNode* node, size_t depth, void* userData) {
+    (void)depth;
+    (void)userData;
+    return node->structuralHash ? AST_WALK_SKIP_CHILDREN : AST_WALK_CONTINUE;
+}
+
+/**
+ * @brief 结构哈希后序回调：子节点的哈希都已算好，计算本节点的哈希
+ */
+static ASTWalkAction structuralHashPostorder(ASTNode* node, size_t depth, void* userData) {
+    (void)depth;
+    (void)userData;
+    if (!node->structuralHash) {
+        node->structuralHash = astNodeComputeHash(node);
+    }
+    return AST_WALK_CONTINUE;
+}
+
+uint64_t astNodeStructuralHash(const ASTNode* node) {
+    if (!node) {
+        return 0;
+    }
+
+    // 哈希是缓存，计算时写入const节点
+    if (!node->structuralHash) {
+        astWalk((ASTNode*)node, structuralHashPreorder, structuralHashPostorder, NULL);
+    }
+    return node->structuralHash;
+}
+
+// ==================== 节点克隆函数 ====================
+
+/**
+ * @brief 各节点类型结构体的大小，克隆时按此复制
+ *
+ * 基础类型的节点由createASTNode创建，只有ASTNode头部。
+ */
+static const size_t astNodeSizes[AST_CHILD_LAYOUT_COUNT] = {
+    [AST_NODE_EXPRESSION] = sizeof(ASTNode),
+    [AST_NODE_STATEMENT] = sizeof(ASTNode),
+    [AST_NODE_DECLARATION] = sizeof(ASTNode),
+    [AST_NODE_TYPE_SPECIFIER] = sizeof(ASTNode),
+    [AST_NODE_TRANSLATION_UNIT] = sizeof(TranslationUnit),
+
+    [AST_NODE_LITERAL_EXPR] = sizeof(LiteralExpr),
+    [AST_NODE_IDENTIFIER_EXPR] = sizeof(IdentifierExpr),
+    [AST_NODE_BINARY_OPERATOR_EXPR] = sizeof(BinaryOperatorExpr),
+    [AST_NODE_UNARY_OPERATOR_EXPR] = sizeof(UnaryOperatorExpr),
+    [AST_NODE_ASSIGNMENT_EXPR] = sizeof(AssignmentExpr),
+    [AST_NODE_TERNARY_EXPR] = sizeof(TernaryExpr),
+    [AST_NODE_FUNCTION_CALL_EXPR] = sizeof(FunctionCallExpr),
+    [AST_NODE_ARRAY_SUBSCRIPT_EXPR] = sizeof(ArraySubscriptExpr),
+    [AST_NODE_MEMBER_ACCESS_EXPR] = sizeof(MemberAccessExpr),
+    [AST_NODE_CAST_EXPR] = sizeof(CastExpr),
+
+    [AST_NODE_EXPRESSION_STATEMENT] = sizeof(ExpressionStatement),
+    [AST_NODE_COMPOUND_STATEMENT] = sizeof(CompoundStatement),
+    [AST_NODE_IF_STATEMENT] = sizeof(IfStatement),
+    [AST_NODE_WHILE_STATEMENT] = sizeof(WhileStatement),
+    [AST_NODE_DO_WHILE_STATEMENT] = sizeof(DoWhileStatement),
+    [AST_NODE_FOR_STATEMENT] = sizeof(ForStatement),
+    [AST_NODE_RETURN_STATEMENT] = sizeof(ReturnStatement),
+    [AST_NODE_BREAK_STATEMENT] = sizeof(BreakStatement),
+    [AST_NODE_CONTINUE_STATEMENT] = sizeof(ContinueStatement),
+    [AST_NODE_SWITCH_STATEMENT] = sizeof(SwitchStatement),
+    [AST_NODE_CASE_STATEMENT] = sizeof(CaseStatement),
+    [AST_NODE_LABELED_STATEMENT] = sizeof(LabeledStatement),
+    [AST_NODE_GOTO_STATEMENT] = sizeof(GotoStatement),
+
+    [AST_NODE_VARIABLE_DECLARATION] = sizeof(VariableDeclaration),
+    [AST_NODE_FUNCTION_DECLARATION] = sizeof(FunctionDeclaration),
+    [AST_NODE_STRUCT_DECLARATION] = sizeof(StructDeclaration),
+    [AST_NODE_UNION_DECLARATION] = sizeof(UnionDeclaration),
+    [AST_NODE_ENUM_DECLARATION] = sizeof(EnumDeclaration),
+    [AST_NODE_TYPEDEF_DECLARATION] = sizeof(TypedefDeclaration),
+
+    [AST_NODE_BASIC_TYPE_SPECIFIER] = sizeof(BasicTypeSpecifier),
+    [AST_NODE_POINTER_TYPE_SPECIFIER] = sizeof(PointerTypeSpecifier),
+    [AST_NODE_ARRAY_TYPE_SPECIFIER] = sizeof(ArrayTypeSpecifier),
+    [AST_NODE_FUNCTION_TYPE_SPECIFIER] = sizeof(FunctionTypeSpecifier),
+    [AST_NODE_STRUCT_TYPE_SPECIFIER] = sizeof(StructTypeSpecifier),
+    [AST_NODE_UNION_TYPE_SPECIFIER] = sizeof(UnionTypeSpecifier),
+    [AST_NODE_ENUM_TYPE_SPECIFIER] = sizeof(EnumTypeSpecifier),
+    [AST_NODE_TYPEDEF_NAME_SPECIFIER] = sizeof(TypedefNameSpecifier),
+};
+
+/**
+ * @brief 哈希合并表
+ */
+struct ASTHashConsTable {
+    HashTable* nodes;       // 规范节点 -> 规范节点
+    size_t sharedCount;     // 复用规范节点的次数
+};
+
+/**
+ * @brief 克隆过程的状态
+ */
+typedef struct {
+    Vector* results;            // ASTNode*，已克隆、尚未挂到父节点上的子树（按子节点顺序）
+    ASTHashConsTable* table;    // 非NULL时复用并登记规范节点
+    const ASTNode* reused;      // 前序时找到规范节点的节点，其后序直接跳过
+} CloneContext;
+
+/**
+ * @brief 节点是否参与哈希合并（只合并表达式和类型说明符）
+ */
+static bool hashConsShareable(const ASTNode* node) {
+    return astNodeIsExpression(node) || astNodeIsTypeSpecifier(node);
+}
+
+/**
+ * @brief 释放克隆节点时已经创建的子节点列表（用于失败路径）
+ */
+static void cloneReleaseLists(ASTNode* copy) {
+    const ASTChildLayout* layout = astNodeChildLayout(copy->nodeType);
+    char* base = (char*)copy;
+    for (size_t i = 0; i < layout->slotCount; i++) {
+        const ASTChildSlot* slot = &layout->slots[i];
+        if (slot->kind == AST_CHILD_NODE) {
+            continue;
+        }
+        Vector** list = (Vector**)(base + slot->offset);
+        if (*list && slot->kind == AST_CHILD_ENUM_CONSTANTS) {
+            for (size_t j = 0; j < (*list)->size; j++) {
+                free(VECTOR_AT(*list, EnumConstant*, j));
+            }
+        }
+        vectorDestroy(*list, NULL);
+        *list = NULL;
+    }
+}
+
+/**
+ * @brief 复制单个节点，子节点换成已经克隆好的子树
+ *
+ * @param node 原节点
+ * @param children 原节点各个非NULL子节点的克隆，按布局表顺序排列
+ * @return 新节点，内存不足返回NULL（children不受影响）
+ */
+static ASTNode* cloneNodeWithChildren(const ASTNode* node, ASTNode* const* children) {
+    size_t size = (unsigned)node->nodeType < AST_CHILD_LAYOUT_COUNT ? astNodeSizes[node->nodeType] : 0;
+    if (size == 0) {
+        return NULL;
+    }
+
+    ASTNode* copy = (ASTNode*)astAllocNode(node->nodeType, size);
+    if (!copy) {
+        return NULL;
+    }
+    bool arenaAllocated = copy->arenaAllocated;
+    memcpy(copy, node, size);
+    copy->arenaAllocated = arenaAllocated;
+    copy->parent = NULL;
+
+    // 先清空列表字段，失败时只释放本函数创建的列表
+    const ASTChildLayout* layout = astNodeChildLayout(node->nodeType);
+    char* base = (char*)copy;
+    for (size_t i = 0; i < layout->slotCount; i++) {
+        if (layout->slots[i].kind != AST_CHILD_NODE) {
+            *(Vector**)(base + layout->slots[i].offset) = NULL;
+        }
+    }
+
+    size_t next = 0;
+    for (size_t i = 0; i < layout->slotCount; i++) {
+        const ASTChildSlot* slot = &layout->slots[i];
+        const char* sourceField = (const char*)node + slot->offset;
+
+        if (slot->kind == AST_CHILD_NODE) {
+            ASTNode** field = (ASTNode**)(base + slot->offset);
+            if (*field) {
+                *field = children[next++];
+            }
+            continue;
+        }
+
+        const Vector* sourceList = *(Vector* const*)sourceField;
+        if (!sourceList) {
+            continue;
+        }
+
+        size_t elementSize = slot->kind == AST_CHILD_LIST ? sizeof(ASTNode*) : sizeof(EnumConstant*);
+        Vector* list = astCreateNodeVector(elementSize, sourceList->size);
+        if (!list) {
+            goto fail;
+        }
+        *(Vector**)(base + slot->offset) = list;
+
+        for (size_t j = 0; j < sourceList->size; j++) {
+            if (slot->kind == AST_CHILD_LIST) {
+                ASTNode* child = VECTOR_AT(sourceList, ASTNode*, j) ? children[next++] : NULL;
+                if (!VECTOR_PUSH_BACK(list, ASTNode*, child)) {
+                    goto fail;
                 }
+                continue;
             }
-            if (stmt->declarations) {
-                for (size_t i = 0; i < vectorSize(stmt->declarations); i++) {
-                    ASTNode* child = (ASTNode*)vectorGet(stmt->declarations, i);
-                    if (!astTreeValidate(child, diagnostics)) {
-                        valid = false;
-                    }
+
+            const EnumConstant* sourceConstant = VECTOR_AT(sourceList, EnumConstant*, j);
+            EnumConstant* constant = NULL;
+            if (sourceConstant) {
+                constant = (EnumConstant*)malloc(sizeof(EnumConstant));
+                if (!constant) {
+                    goto fail;
                 }
+                constant->name = sourceConstant->name;
+                constant->value = sourceConstant->value ? (Expression*)children[next++] : NULL;
+            }
+            if (!VECTOR_PUSH_BACK(list, EnumConstant*, constant)) {
+                free(constant);
+                goto fail;
             }
-            break;
         }
+    }
 
-        // 可以添加更多节点类型的处理...
+    // 新克隆的子树挂到本节点下；复用的规范节点保留第一次出现时的父节点
+    for (size_t i = 0; i < next; i++) {
+        if (!children[i]->parent) {
+            children[i]->parent = copy;
+        }
+    }
+    return copy;
 
-        default:
-            break;
+fail:
+    cloneReleaseLists(copy);
+    astFreeNode(copy);
+    return NULL;
+}
+
+/**
+ * @brief 克隆前序回调：找到结构相同的规范节点时直接引用，不进入子节点
+ */
+static ASTWalkAction clonePreorder(ASTNode* node, size_t depth, void* userData) {
+    (void)depth;
+    CloneContext* context = (CloneContext*)userData;
+    if (!context->table || !hashConsShareable(node)) {
+        return AST_WALK_CONTINUE;
     }
 
-    return valid;
+    void* canonical;
+    if (!hashTableFindHashed(context->table->nodes, node, node->structuralHash, &canonical)) {
+        return AST_WALK_CONTINUE;
+    }
+    if (!VECTOR_PUSH_BACK(context->results, ASTNode*, (ASTNode*)canonical)) {
+        return AST_WALK_STOP;
+    }
+    context->table->sharedCount++;
+    context->reused = node;
+    return AST_WALK_SKIP_CHILDREN;
 }
 
-// ==================== 节点克隆函数 ====================
+/**
+ * @brief 克隆后序回调：子节点的克隆都在结果栈顶，复制本节点并替换它们
+ */
+static ASTWalkAction clonePostorder(ASTNode* node, size_t depth, void* userData) {
+    (void)depth;
+    CloneContext* context = (CloneContext*)userData;
+    if (context->reused == node) {
+        context->reused = NULL;
+        return AST_WALK_CONTINUE;
+    }
+
+    size_t childCount = 0;
+    ASTChildCursor cursor = AST_CHILD_CURSOR_INIT;
+    while (astChildCursorNext(node, &cursor)) {
+        childCount++;
+    }
+
+    size_t first = vectorSize(context->results) - childCount;
+    ASTNode* copy = cloneNodeWithChildren(node, &VECTOR_AT(context->results, ASTNode*, first));
+    if (!copy) {
+        return AST_WALK_STOP;
+    }
+    vectorResize(context->results, first, NULL);
+    VECTOR_PUSH_BACK(context->results, ASTNode*, copy);  // 刚弹出过元素，容量足够
+
+    if (context->table && copy->arenaAllocated && hashConsShareable(copy)) {
+        hashTableInsertHashed(context->table->nodes, copy, copy->structuralHash, copy);
+    }
+    return AST_WALK_CONTINUE;
+}
+
+/**
+ * @brief 克隆子树（table非NULL时复用其中的规范节点）
+ */
+static ASTNode* cloneSubtree(const ASTNode* node, ASTHashConsTable* table) {
+    CloneContext context;
+    context.results = vectorCreate(sizeof(ASTNode*), 64);
+    context.table = table;
+    context.reused = NULL;
+    if (!context.results) {
+        return NULL;
+    }
+
+    ASTNode* clone = NULL;
+    if (astWalk((ASTNode*)node, clonePreorder, clonePostorder, &context) &&
+        vectorSize(context.results) == 1) {
+        clone = VECTOR_AT(context.results, ASTNode*, 0);
+    } else {
+        // 失败时销毁已经克隆好的子树（内存池中的节点随内存池释放）
+        for (size_t i = 0; i < vectorSize(context.results); i++) {
+            ASTNode* partial = VECTOR_AT(context.results, ASTNode*, i);
+            DESTROY_AST_NODE(partial);
+        }
+    }
+
+    vectorDestroy(context.results, NULL);
+    return clone;
+}
 
 ASTNode* astNodeClone(const ASTNode* node) {
     if (!node) {
         return NULL;
     }
+    return cloneSubtree(node, NULL);
+}
 
-    // TODO: 实现深度克隆
-    // 这需要根据节点类型复制所有字段和子节点
+// ==================== 节点比较函数 ====================
 
-    return NULL;
+// 比较栈放在调用者栈帧里的节点对数
+#define AST_EQUALS_INLINE_PAIRS 32
+
+/**
+ * @brief 待比较的一对节点
+ */
+typedef struct {
+    const ASTNode* a;
+    const ASTNode* b;
+} NodePair;
+
+/**
+ * @brief 比较栈，超出内联容量后转到堆上
+ */
+typedef struct {
+    NodePair* items;
+    size_t size;
+    size_t capacity;
+    NodePair inlineItems[AST_EQUALS_INLINE_PAIRS];
+} NodePairStack;
+
+static bool nodePairStackPush(NodePairStack* stack, const ASTNode* a, const ASTNode* b) {
+    if (stack->size == stack->capacity) {
+        size_t capacity = stack->capacity * 2;
+        NodePair* items = (NodePair*)malloc(capacity * sizeof(NodePair));
+        if (!items) {
+            return false;
+        }
+        memcpy(items, stack->items, stack->size * sizeof(NodePair));
+        if (stack->items != stack->inlineItems) {
+            free(stack->items);
+        }
+        stack->items = items;
+        stack->capacity = capacity;
+    }
+    stack->items[stack->size].a = a;
+    stack->items[stack->size].b = b;
+    stack->size++;
+    return true;
 }
 
-// ==================== 节点比较函数 ====================
+/**
+ * @brief 比较两个同类型节点的子节点槽位，把对应的子节点对压入比较栈
+ * @return 列表长度或枚举常量名不同时返回false
+ */
+static bool pushChildPairs(NodePairStack* stack, const ASTNode* a, const ASTNode* b) {
+    const ASTChildLayout* layout = astNodeChildLayout(a->nodeType);
+    for (size_t i = 0; i < layout->slotCount; i++) {
+        const ASTChildSlot* slot = &layout->slots[i];
+        const char* fieldA = (const char*)a + slot->offset;
+        const char* fieldB = (const char*)b + slot->offset;
+
+        if (slot->kind == AST_CHILD_NODE) {
+            if (!nodePairStackPush(stack, *(ASTNode* const*)fieldA, *(ASTNode* const*)fieldB)) {
+                return false;
+            }
+            continue;
+        }
+
+        const Vector* listA = *(Vector* const*)fieldA;
+        const Vector* listB = *(Vector* const*)fieldB;
+        size_t size = listA ? listA->size : 0;
+        if (size != (listB ? listB->size : 0)) {
+            return false;
+        }
+
+        for (size_t j = 0; j < size; j++) {
+            const ASTNode* childA;
+            const ASTNode* childB;
+            if (slot->kind == AST_CHILD_LIST) {
+                childA = VECTOR_AT(listA, ASTNode*, j);
+                childB = VECTOR_AT(listB, ASTNode*, j);
+            } else {
+                const EnumConstant* constantA = VECTOR_AT(listA, EnumConstant*, j);
+                const EnumConstant* constantB = VECTOR_AT(listB, EnumConstant*, j);
+                if (!constantA || !constantB) {
+                    if (constantA != constantB) {
+                        return false;
+                    }
+                    continue;
+                }
+                if (constantA->name != constantB->name) {
+                    return false;
+                }
+                childA = (const ASTNode*)constantA->value;
+                childB = (const ASTNode*)constantB->value;
+            }
+            if (!nodePairStackPush(stack, childA, childB)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
 
 bool astNodeEquals(const ASTNode* a, const ASTNode* b) {
-    if (!a || !b) {
-        return a == b;
+    if (a == b) {
+        return true;
+    }
+    if (!a || !b || a->nodeType != b->nodeType) {
+        return false;
     }
 
-    if (a->nodeType != b->nodeType) {
+    // 两棵子树的哈希都会被缓存，之后其中任何一对子树不同都能立即排除
+    if (astNodeStructuralHash(a) != astNodeStructuralHash(b)) {
         return false;
     }
 
-    // TODO: 实现深度比较
-    // 这需要根据节点类型比较所有字段和子节点
+    NodePairStack stack;
+    stack.items = stack.inlineItems;
+    stack.size = 0;
+    stack.capacity = AST_EQUALS_INLINE_PAIRS;
+    nodePairStackPush(&stack, a, b);
+
+    bool equal = true;
+    while (equal && stack.size > 0) {
+        NodePair pair = stack.items[--stack.size];
+        if (pair.a == pair.b) {
+            continue;
+        }
+        if (!pair.a || !pair.b || pair.a->nodeType != pair.b->nodeType ||
+            astNodeStructuralHash(pair.a) != astNodeStructuralHash(pair.b) ||
+            !astNodeAttributesEqual(pair.a, pair.b) ||
+            !pushChildPairs(&stack, pair.a, pair.b)) {
+            equal = false;
+        }
+    }
+
+    if (stack.items != stack.inlineItems) {
+        free(stack.items);
+    }
+    return equal;
+}
+
+// ==================== 子树哈希合并 ====================
+
+static uint64_t hashConsHashNode(const void* key) {
+    return astNodeStructuralHash((const ASTNode*)key);
+}
+
+static bool hashConsNodesEqual(const void* a, const void* b) {
+    return astNodeEquals((const ASTNode*)a, (const ASTNode*)b);
+}
+
+ASTHashConsTable* createASTHashConsTable(size_t initialCapacity) {
+    ASTHashConsTable* table = (ASTHashConsTable*)malloc(sizeof(ASTHashConsTable));
+    if (!table) {
+        return NULL;
+    }
+
+    table->nodes = createHashTable(hashConsHashNode, hashConsNodesEqual, initialCapacity);
+    if (!table->nodes) {
+        free(table);
+        return NULL;
+    }
+    table->sharedCount = 0;
+    return table;
+}
+
+void destroyASTHashConsTable(ASTHashConsTable* table) {
+    if (!table) {
+        return;
+    }
+    destroyHashTable(table->nodes);
+    free(table);
+}
+
+ASTNode* astHashConsIntern(ASTHashConsTable* table, ASTNode* node) {
+    if (!table || !node || !node->arenaAllocated || !hashConsShareable(node)) {
+        return node;
+    }
+
+    uint64_t hash = astNodeStructuralHash(node);
+    void* canonical;
+    if (hashTableFindHashed(table->nodes, node, hash, &canonical)) {
+        if (canonical != node) {
+            table->sharedCount++;
+        }
+        return (ASTNode*)canonical;
+    }
+
+    // 登记失败（内存不足）时只是不合并
+    hashTableInsertHashed(table->nodes, node, hash, node);
+    return node;
+}
+
+ASTNode* astHashConsClone(ASTHashConsTable* table, const ASTNode* node) {
+    if (!node) {
+        return NULL;
+    }
+
+    // 堆上的节点不能共享
+    if (!table || (!astGetSlabArena() && !astGetNodeArena())) {
+        return cloneSubtree(node, NULL);
+    }
+
+    // 先算好整棵子树的哈希，查找规范节点时都是O(1)
+    astNodeStructuralHash(node);
+    return cloneSubtree(node, table);
+}
+
+size_t astHashConsUniqueCount(const ASTHashConsTable* table) {
+    return table ? hashTableSize(table->nodes) : 0;
+}
 
-    return false;
+size_t astHashConsSharedCount(const ASTHashConsTable* table) {
+    return table ? table->sharedCount : 0;
 }
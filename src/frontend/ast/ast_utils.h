@@ -6,6 +6,7 @@
 #include "../../common/diagnostics/diagnostic_engine.h"
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 // ==================== 节点信息函数 ====================
 
@@ -14,7 +15,7 @@
  * @param node AST节点
  * @return 后代节点总数
  *
- * 递归计算以该节点为根的子树中的所有节点数量。
+ * 用astWalk迭代遍历以该节点为根的子树计数，很深的树也不会栈溢出。
  */
 size_t astNodeCountDescendants(const ASTNode* node);
 
@@ -23,7 +24,7 @@ size_t astNodeCountDescendants(const ASTNode* node);
  * @param root 根节点
  * @return 树的深度
  *
- * 从根节点到最远叶子节点的最长路径长度。
+ * 从根节点到最远叶子节点的最长路径长度（边数，只有根节点时为0）。
  */
 size_t astTreeGetDepth(const ASTNode* root);
 
@@ -44,7 +45,7 @@ bool astNodeIsRoot(const ASTNode* node);
 /**
  * @brief 获取节点的直接子节点数量
  * @param node AST节点
- * @return 直接子节点数量
+ * @return 直接子节点数量（不计为NULL的可选子节点）
  */
 size_t astNodeGetChildCount(const ASTNode* node);
 
@@ -165,7 +166,7 @@ ASTNode* astNodeFindParentByType(const ASTNode* node, ASTNodeType type);
  * @param type 要查找的节点类型
  * @return 匹配的节点向量（ASTNode*），调用者负责销毁
  *
- * 递归查找所有后代节点。
+ * 前序遍历整棵子树（包括root自身），结果按源码顺序排列。
  * 如果没有找到，返回空向量。
  * 失败返回NULL。
  */
@@ -194,7 +195,7 @@ bool astNodeValidate(const ASTNode* node, DiagnosticEngine* diagnostics);
  * @param diagnostics 诊断引擎（可以为NULL）
  * @return true如果树有效，false否则
  *
- * 递归验证树中的所有节点。
+ * 遍历验证树中的所有节点。
  * 如果提供diagnostics，会报告所有发现的错误。
  */
 bool astTreeValidate(const ASTNode* root, DiagnosticEngine* diagnostics);
@@ -206,21 +207,107 @@ bool astTreeValidate(const ASTNode* root, DiagnosticEngine* diagnostics);
  * @param node 要克隆的节点
  * @return 新克隆的节点，失败返回NULL
  *
- * 创建节点的深拷贝，包括所有子节点。
- * 调用者负责销毁返回的节点。
+ * 按子节点布局表复制节点及其整棵子树，用显式栈迭代，很深的树也不会栈溢出。
+ * 新节点与create*函数一样从当前线程的slab内存池或节点内存池分配，
+ * 都没有设置时从堆分配，调用者负责销毁（内存池中的节点随内存池释放）。
+ *
+ * 克隆的父指针指向克隆出的父节点，根节点的父指针为NULL。
+ * 字面量的Token、语义分析设置的type/symbol以及结构体等类型说明符引用的
+ * 声明都是引用，与原节点共享；缓存的结构哈希一并复制。
  */
 ASTNode* astNodeClone(const ASTNode* node);
 
 // ==================== 节点比较函数 ====================
 
+/**
+ * @brief 计算子树的结构哈希
+ * @param node 子树的根节点
+ * @return 结构哈希（node为NULL时返回0，否则非0）
+ *
+ * 哈希覆盖节点类型、运算符、名称、字面量值等语法属性和所有子节点，
+ * 不包括源位置、父指针和语义分析设置的type/symbol。
+ *
+ * 结果缓存在ASTNode::structuralHash中：第一次调用时自底向上计算整棵子树，
+ * 之后子树中任何节点的哈希都是O(1)。就地修改子树后需要调用
+ * astNodeInvalidateStructuralHash。计算会写缓存，多个线程不能同时对
+ * 同一棵尚未计算过的子树调用。
+ */
+uint64_t astNodeStructuralHash(const ASTNode* node);
+
 /**
  * @brief 比较两个AST节点是否相等
  * @param a 第一个节点
  * @param b 第二个节点
  * @return true如果节点相等，false否则
  *
- * 深度比较两个节点及其所有子节点。
+ * 深度比较两个节点及其所有子节点，比较的内容与astNodeStructuralHash相同。
+ * 先比较两棵子树的结构哈希，不相等的子树通常在O(1)内被排除，
+ * 哈希相同时再逐个节点比较。两个参数都为NULL时相等。
  */
 bool astNodeEquals(const ASTNode* a, const ASTNode* b);
 
+// ==================== 子树哈希合并 ====================
+
+/**
+ * @brief 哈希合并表
+ *
+ * 记录每种结构的一个规范节点，结构相同的表达式和类型说明符子树只保留一份，
+ * 被多个父节点共享，宏展开、内联等生成的代码里大量重复的子树不再重复分配。
+ *
+ * 共享后的节点有多个父节点，不能再逐个销毁，因此只合并分配在内存池中的节点；
+ * 堆上的节点原样返回，不会被共享。共享节点的父指针指向第一次出现的位置，
+ * type/symbol等语义信息也随之共享：只应对同一作用域内的代码做合并，
+ * 需要就地修改共享的子树时先用astNodeClone复制。
+ * 语句和声明有各自的身份（标签、作用域、符号），不参与合并。
+ *
+ * 表只引用节点，必须在节点所在的内存池释放之前销毁。非线程安全。
+ */
+typedef struct ASTHashConsTable ASTHashConsTable;
+
+/**
+ * @brief 创建哈希合并表
+ * @param initialCapacity 预计的规范节点数（0表示不预先分配）
+ * @return 新创建的表，失败返回NULL
+ */
+ASTHashConsTable* createASTHashConsTable(size_t initialCapacity);
+
+/**
+ * @brief 销毁哈希合并表（不销毁其中的节点）
+ * @param table 要销毁的表
+ */
+void destroyASTHashConsTable(ASTHashConsTable* table);
+
+/**
+ * @brief 取节点的规范节点
+ * @param table 哈希合并表
+ * @param node 新建的节点，其子节点应当已经是规范节点
+ * @return 表中与node结构相同的节点；没有时把node登记为规范节点并返回node；
+ *         node不参与合并（堆上的节点、语句、声明）时返回node
+ *
+ * 供自底向上生成代码时使用：每创建一个节点就换成它的规范节点。
+ */
+ASTNode* astHashConsIntern(ASTHashConsTable* table, ASTNode* node);
+
+/**
+ * @brief 克隆子树，复用表中已有的相同子树
+ * @param table 哈希合并表
+ * @param node 要克隆的子树
+ * @return 克隆结果，失败返回NULL
+ *
+ * 与astNodeClone相同，但遇到与表中规范节点结构相同的表达式或类型说明符子树时
+ * 直接引用规范节点，整棵子树都不分配；新复制的节点登记为规范节点。
+ * 当前线程没有设置内存池时退化为astNodeClone。
+ */
+ASTNode* astHashConsClone(ASTHashConsTable* table, const ASTNode* node);
+
+/**
+ * @brief 获取表中规范节点的数量
+ */
+size_t astHashConsUniqueCount(const ASTHashConsTable* table);
+
+/**
+ * @brief 获取复用规范节点的次数（每次省去一棵子树的分配）
+ */
+size_t astHashConsSharedCount(const ASTHashConsTable* table);
+
 #endif // AST_UTILS_H
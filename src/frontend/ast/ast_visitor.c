@@ -6,7 +6,9 @@
  */
 
 #include "ast_visitor.h"
+#include "ast_walk.h"
 #include "../../common/diagnostics/diagnostic_engine.h"
+#include "../../common/containers/deque.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -372,74 +374,12 @@ void astNodeAccept(ASTNode* node, ASTVisitor* visitor) {
 // ==================== 遍历辅助函数实现 ====================
 
 /**
- * @brief 内部递归深度优先遍历
+ * @brief 遍历回调：让访问者访问当前节点
  */
-static void traverseDFSRecursive(ASTNode* node, ASTVisitor* visitor,
-                                  ASTTraversalContext* context, bool preorder) {
-    if (!node || !visitor || !context) {
-        return;
-    }
-
-    // 检查深度限制
-    if (context->maxDepth > 0 && context->depth >= context->maxDepth) {
-        return;
-    }
-
-    // 检查是否停止遍历
-    if (context->stopTraversal) {
-        return;
-    }
-
-    context->depth++;
-
-    // 前序遍历：先访问当前节点
-    if (preorder) {
-        astNodeAccept(node, visitor);
-    }
-
-    // 访问子节点
-    if (context->visitChildren) {
-        switch (node->nodeType) {
-            case AST_NODE_TRANSLATION_UNIT: {
-                TranslationUnit* unit = (TranslationUnit*)node;
-                if (unit->declarations) {
-                    for (size_t i = 0; i < vectorSize(unit->declarations); i++) {
-                        ASTNode* child = (ASTNode*)vectorGet(unit->declarations, i);
-                        traverseDFSRecursive(child, visitor, context, preorder);
-                    }
-                }
-                break;
-            }
-
-            case AST_NODE_COMPOUND_STATEMENT: {
-                CompoundStatement* stmt = (CompoundStatement*)node;
-                if (stmt->statements) {
-                    for (size_t i = 0; i < vectorSize(stmt->statements); i++) {
-                        ASTNode* child = (ASTNode*)vectorGet(stmt->statements, i);
-                        traverseDFSRecursive(child, visitor, context, preorder);
-                    }
-                }
-                if (stmt->declarations) {
-                    for (size_t i = 0; i < vectorSize(stmt->declarations); i++) {
-                        ASTNode* child = (ASTNode*)vectorGet(stmt->declarations, i);
-                        traverseDFSRecursive(child, visitor, context, preorder);
-                    }
-                }
-                break;
-            }
-
-            // 其他复合节点的子节点访问...
-            default:
-                break;
-        }
-    }
-
-    // 后序遍历：后访问当前节点
-    if (!preorder) {
-        astNodeAccept(node, visitor);
-    }
-
-    context->depth--;
+static ASTWalkAction acceptWalkCallback(ASTNode* node, size_t depth, void* userData) {
+    (void)depth;
+    astNodeAccept(node, (ASTVisitor*)userData);
+    return AST_WALK_CONTINUE;
 }
 
 void astTraverseDFS(ASTNode* root, ASTVisitor* visitor, bool preorder) {
@@ -447,15 +387,9 @@ void astTraverseDFS(ASTNode* root, ASTVisitor* visitor, bool preorder) {
         return;
     }
 
-    ASTTraversalContext* context = createASTTraversalContext();
-    if (!context) {
-        return;
-    }
-
-    context->visitChildren = true;
-    traverseDFSRecursive(root, visitor, context, preorder);
-
-    destroyASTTraversalContext(context);
+    // 显式栈迭代遍历，深树不会耗尽调用栈
+    astWalk(root, preorder ? acceptWalkCallback : NULL,
+            preorder ? NULL : acceptWalkCallback, visitor);
 }
 
 void astTraverseBFS(ASTNode* root, ASTVisitor* visitor) {
@@ -463,51 +397,29 @@ void astTraverseBFS(ASTNode* root, ASTVisitor* visitor) {
         return;
     }
 
-    // 使用队列实现广度优先遍历
-    Vector* queue = vectorCreate(sizeof(ASTNode*), 4);
+    // 使用环形队列实现广度优先遍历，出队是O(1)
+    Deque* queue = dequeCreate(sizeof(ASTNode*), 0);
     if (!queue) {
         return;
     }
 
-    vectorPushBack(queue, &root);
+    DEQUE_PUSH_BACK(queue, ASTNode*, root);
 
-    while (vectorSize(queue) > 0) {
-        ASTNode* node = *(ASTNode**)vectorGet(queue, 0);
-        vectorEraseAt(queue, 0);
+    while (!dequeIsEmpty(queue)) {
+        ASTNode* node = DEQUE_POP_FRONT(queue, ASTNode*);
 
         // 访问当前节点
         astNodeAccept(node, visitor);
 
-        // 将子节点加入队列
-        switch (node->nodeType) {
-            case AST_NODE_TRANSLATION_UNIT: {
-                TranslationUnit* unit = (TranslationUnit*)node;
-                if (unit->declarations) {
-                    for (size_t i = 0; i < vectorSize(unit->declarations); i++) {
-                        ASTNode* child = (ASTNode*)vectorGet(unit->declarations, i);
-                        vectorPushBack(queue, &child);
-                    }
-                }
-                break;
-            }
-
-            case AST_NODE_COMPOUND_STATEMENT: {
-                CompoundStatement* stmt = (CompoundStatement*)node;
-                if (stmt->statements) {
-                    for (size_t i = 0; i < vectorSize(stmt->statements); i++) {
-                        ASTNode* child = (ASTNode*)vectorGet(stmt->statements, i);
-                        vectorPushBack(queue, &child);
-                    }
-                }
-                break;
-            }
-
-            default:
-                break;
+        // 将子节点按源码顺序加入队列
+        ASTChildCursor cursor = AST_CHILD_CURSOR_INIT;
+        ASTNode* child;
+        while ((child = astNodeNextChild(node, &cursor)) != NULL) {
+            DEQUE_PUSH_BACK(queue, ASTNode*, child);
         }
     }
 
-    vectorDestroy(queue, NULL);
+    dequeDestroy(queue, NULL);
 }
 
 void astTraverseChildren(Vector* children, ASTVisitor* visitor) {
@@ -516,8 +428,7 @@ void astTraverseChildren(Vector* children, ASTVisitor* visitor) {
     }
 
     for (size_t i = 0; i < vectorSize(children); i++) {
-        ASTNode* child = (ASTNode*)vectorGet(children, i);
-        astNodeAccept(child, visitor);
+        astNodeAccept(VECTOR_AT(children, ASTNode*, i), visitor);
     }
 }
 
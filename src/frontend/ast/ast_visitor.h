@@ -41,200 +41,200 @@ typedef struct ASTVisitor {
     /**
      * @brief 访问翻译单元（AST根节点）
      */
-    void (*visitTranslationUnit)(struct ASTVisitor* self, struct TranslationUnit* node);
+    void (*visitTranslationUnit)(struct ASTVisitor* self, TranslationUnit* node);
 
     // ==================== 表达式访问函数 ====================
 
     /**
      * @brief 访问字面量表达式
      */
-    void (*visitLiteralExpr)(struct ASTVisitor* self, struct LiteralExpr* node);
+    void (*visitLiteralExpr)(struct ASTVisitor* self, LiteralExpr* node);
 
     /**
      * @brief 访问标识符表达式
      */
-    void (*visitIdentifierExpr)(struct ASTVisitor* self, struct IdentifierExpr* node);
+    void (*visitIdentifierExpr)(struct ASTVisitor* self, IdentifierExpr* node);
 
     /**
      * @brief 访问二元运算符表达式
      */
-    void (*visitBinaryOperatorExpr)(struct ASTVisitor* self, struct BinaryOperatorExpr* node);
+    void (*visitBinaryOperatorExpr)(struct ASTVisitor* self, BinaryOperatorExpr* node);
 
     /**
      * @brief 访问一元运算符表达式
      */
-    void (*visitUnaryOperatorExpr)(struct ASTVisitor* self, struct UnaryOperatorExpr* node);
+    void (*visitUnaryOperatorExpr)(struct ASTVisitor* self, UnaryOperatorExpr* node);
 
     /**
      * @brief 访问赋值表达式
      */
-    void (*visitAssignmentExpr)(struct ASTVisitor* self, struct AssignmentExpr* node);
+    void (*visitAssignmentExpr)(struct ASTVisitor* self, AssignmentExpr* node);
 
     /**
      * @brief 访问三元条件运算符表达式
      */
-    void (*visitTernaryExpr)(struct ASTVisitor* self, struct TernaryExpr* node);
+    void (*visitTernaryExpr)(struct ASTVisitor* self, TernaryExpr* node);
 
     /**
      * @brief 访问函数调用表达式
      */
-    void (*visitFunctionCallExpr)(struct ASTVisitor* self, struct FunctionCallExpr* node);
+    void (*visitFunctionCallExpr)(struct ASTVisitor* self, FunctionCallExpr* node);
 
     /**
      * @brief 访问数组下标表达式
      */
-    void (*visitArraySubscriptExpr)(struct ASTVisitor* self, struct ArraySubscriptExpr* node);
+    void (*visitArraySubscriptExpr)(struct ASTVisitor* self, ArraySubscriptExpr* node);
 
     /**
      * @brief 访问成员访问表达式
      */
-    void (*visitMemberAccessExpr)(struct ASTVisitor* self, struct MemberAccessExpr* node);
+    void (*visitMemberAccessExpr)(struct ASTVisitor* self, MemberAccessExpr* node);
 
     /**
      * @brief 访问类型转换表达式
      */
-    void (*visitCastExpr)(struct ASTVisitor* self, struct CastExpr* node);
+    void (*visitCastExpr)(struct ASTVisitor* self, CastExpr* node);
 
     // ==================== 语句访问函数 ====================
 
     /**
      * @brief 访问表达式语句
      */
-    void (*visitExpressionStatement)(struct ASTVisitor* self, struct ExpressionStatement* node);
+    void (*visitExpressionStatement)(struct ASTVisitor* self, ExpressionStatement* node);
 
     /**
      * @brief 访问复合语句（块）
      */
-    void (*visitCompoundStatement)(struct ASTVisitor* self, struct CompoundStatement* node);
+    void (*visitCompoundStatement)(struct ASTVisitor* self, CompoundStatement* node);
 
     /**
      * @brief 访问if语句
      */
-    void (*visitIfStatement)(struct ASTVisitor* self, struct IfStatement* node);
+    void (*visitIfStatement)(struct ASTVisitor* self, IfStatement* node);
 
     /**
      * @brief 访问while循环语句
      */
-    void (*visitWhileStatement)(struct ASTVisitor* self, struct WhileStatement* node);
+    void (*visitWhileStatement)(struct ASTVisitor* self, WhileStatement* node);
 
     /**
      * @brief 访问do-while循环语句
      */
-    void (*visitDoWhileStatement)(struct ASTVisitor* self, struct DoWhileStatement* node);
+    void (*visitDoWhileStatement)(struct ASTVisitor* self, DoWhileStatement* node);
 
     /**
      * @brief 访问for循环语句
      */
-    void (*visitForStatement)(struct ASTVisitor* self, struct ForStatement* node);
+    void (*visitForStatement)(struct ASTVisitor* self, ForStatement* node);
 
     /**
      * @brief 访问return语句
      */
-    void (*visitReturnStatement)(struct ASTVisitor* self, struct ReturnStatement* node);
+    void (*visitReturnStatement)(struct ASTVisitor* self, ReturnStatement* node);
 
     /**
      * @brief 访问break语句
      */
-    void (*visitBreakStatement)(struct ASTVisitor* self, struct BreakStatement* node);
+    void (*visitBreakStatement)(struct ASTVisitor* self, BreakStatement* node);
 
     /**
      * @brief 访问continue语句
      */
-    void (*visitContinueStatement)(struct ASTVisitor* self, struct ContinueStatement* node);
+    void (*visitContinueStatement)(struct ASTVisitor* self, ContinueStatement* node);
 
     /**
      * @brief 访问switch语句
      */
-    void (*visitSwitchStatement)(struct ASTVisitor* self, struct SwitchStatement* node);
+    void (*visitSwitchStatement)(struct ASTVisitor* self, SwitchStatement* node);
 
     /**
      * @brief 访问case/default标签语句
      */
-    void (*visitCaseStatement)(struct ASTVisitor* self, struct CaseStatement* node);
+    void (*visitCaseStatement)(struct ASTVisitor* self, CaseStatement* node);
 
     /**
      * @brief 访问标签语句（用于goto）
      */
-    void (*visitLabeledStatement)(struct ASTVisitor* self, struct LabeledStatement* node);
+    void (*visitLabeledStatement)(struct ASTVisitor* self, LabeledStatement* node);
 
     /**
      * @brief 访问goto语句
      */
-    void (*visitGotoStatement)(struct ASTVisitor* self, struct GotoStatement* node);
+    void (*visitGotoStatement)(struct ASTVisitor* self, GotoStatement* node);
 
     // ==================== 声明访问函数 ====================
 
     /**
      * @brief 访问变量声明
      */
-    void (*visitVariableDeclaration)(struct ASTVisitor* self, struct VariableDeclaration* node);
+    void (*visitVariableDeclaration)(struct ASTVisitor* self, VariableDeclaration* node);
 
     /**
      * @brief 访问函数声明
      */
-    void (*visitFunctionDeclaration)(struct ASTVisitor* self, struct FunctionDeclaration* node);
+    void (*visitFunctionDeclaration)(struct ASTVisitor* self, FunctionDeclaration* node);
 
     /**
      * @brief 访问结构体声明
      */
-    void (*visitStructDeclaration)(struct ASTVisitor* self, struct StructDeclaration* node);
+    void (*visitStructDeclaration)(struct ASTVisitor* self, StructDeclaration* node);
 
     /**
      * @brief 访问联合体声明
      */
-    void (*visitUnionDeclaration)(struct ASTVisitor* self, struct UnionDeclaration* node);
+    void (*visitUnionDeclaration)(struct ASTVisitor* self, UnionDeclaration* node);
 
     /**
      * @brief 访问枚举声明
      */
-    void (*visitEnumDeclaration)(struct ASTVisitor* self, struct EnumDeclaration* node);
+    void (*visitEnumDeclaration)(struct ASTVisitor* self, EnumDeclaration* node);
 
     /**
      * @brief 访问typedef声明
      */
-    void (*visitTypedefDeclaration)(struct ASTVisitor* self, struct TypedefDeclaration* node);
+    void (*visitTypedefDeclaration)(struct ASTVisitor* self, TypedefDeclaration* node);
 
     // ==================== 类型说明符访问函数 ====================
 
     /**
      * @brief 访问基础类型说明符
      */
-    void (*visitBasicTypeSpecifier)(struct ASTVisitor* self, struct BasicTypeSpecifier* node);
+    void (*visitBasicTypeSpecifier)(struct ASTVisitor* self, BasicTypeSpecifier* node);
 
     /**
      * @brief 访问指针类型说明符
      */
-    void (*visitPointerTypeSpecifier)(struct ASTVisitor* self, struct PointerTypeSpecifier* node);
+    void (*visitPointerTypeSpecifier)(struct ASTVisitor* self, PointerTypeSpecifier* node);
 
     /**
      * @brief 访问数组类型说明符
      */
-    void (*visitArrayTypeSpecifier)(struct ASTVisitor* self, struct ArrayTypeSpecifier* node);
+    void (*visitArrayTypeSpecifier)(struct ASTVisitor* self, ArrayTypeSpecifier* node);
 
     /**
      * @brief 访问函数类型说明符
      */
-    void (*visitFunctionTypeSpecifier)(struct ASTVisitor* self, struct FunctionTypeSpecifier* node);
+    void (*visitFunctionTypeSpecifier)(struct ASTVisitor* self, FunctionTypeSpecifier* node);
 
     /**
      * @brief 访问结构体类型说明符
      */
-    void (*visitStructTypeSpecifier)(struct ASTVisitor* self, struct StructTypeSpecifier* node);
+    void (*visitStructTypeSpecifier)(struct ASTVisitor* self, StructTypeSpecifier* node);
 
     /**
      * @brief 访问联合体类型说明符
      */
-    void (*visitUnionTypeSpecifier)(struct ASTVisitor* self, struct UnionTypeSpecifier* node);
+    void (*visitUnionTypeSpecifier)(struct ASTVisitor* self, UnionTypeSpecifier* node);
 
     /**
      * @brief 访问枚举类型说明符
      */
-    void (*visitEnumTypeSpecifier)(struct ASTVisitor* self, struct EnumTypeSpecifier* node);
+    void (*visitEnumTypeSpecifier)(struct ASTVisitor* self, EnumTypeSpecifier* node);
 
     /**
      * @brief 访问typedef名称类型说明符
      */
-    void (*visitTypedefNameSpecifier)(struct ASTVisitor* self, struct TypedefNameSpecifier* node);
+    void (*visitTypedefNameSpecifier)(struct ASTVisitor* self, TypedefNameSpecifier* node);
 
     // ==================== 通用访问函数 ====================
 
@@ -313,6 +313,8 @@ void astNodeAccept(ASTNode* node, ASTVisitor* visitor);
  *
  * 前序遍历：先访问父节点，再访问子节点
  * 后序遍历：先访问子节点，再访问父节点
+ *
+ * 基于astWalk迭代实现，覆盖所有节点类型，子节点按源码顺序访问。
  */
 void astTraverseDFS(ASTNode* root, ASTVisitor* visitor, bool preorder);
 
@@ -0,0 +1,237 @@
+/**
+ * @file ast_walk.c
+ * @brief AST子节点枚举与迭代遍历实现
+ *
+ * 子节点的位置统一登记在布局表中，新增节点类型时只需添加一行表项，
+ * 计数、查找、验证、访问者遍历等工具都会自动覆盖它。
+ */
+
+#include "ast_walk.h"
+
+// ==================== 子节点布局表 ====================
+
+#define AST_NODE_SLOT(structType, field) \
+    { (uint16_t)offsetof(structType, field), AST_CHILD_NODE }
+#define AST_LIST_SLOT(structType, field) \
+    { (uint16_t)offsetof(structType, field), AST_CHILD_LIST }
+
+const ASTChildLayout astChildLayoutTable[AST_CHILD_LAYOUT_COUNT] = {
+    [AST_NODE_TRANSLATION_UNIT] = {1, {
+        AST_LIST_SLOT(TranslationUnit, declarations)}},
+
+    // 表达式
+    [AST_NODE_BINARY_OPERATOR_EXPR] = {2, {
+        AST_NODE_SLOT(BinaryOperatorExpr, left),
+        AST_NODE_SLOT(BinaryOperatorExpr, right)}},
+    [AST_NODE_UNARY_OPERATOR_EXPR] = {1, {
+        AST_NODE_SLOT(UnaryOperatorExpr, operand)}},
+    [AST_NODE_ASSIGNMENT_EXPR] = {2, {
+        AST_NODE_SLOT(AssignmentExpr, left),
+        AST_NODE_SLOT(AssignmentExpr, right)}},
+    [AST_NODE_TERNARY_EXPR] = {3, {
+        AST_NODE_SLOT(TernaryExpr, condition),
+        AST_NODE_SLOT(TernaryExpr, thenExpr),
+        AST_NODE_SLOT(TernaryExpr, elseExpr)}},
+    [AST_NODE_FUNCTION_CALL_EXPR] = {2, {
+        AST_NODE_SLOT(FunctionCallExpr, callee),
+        AST_LIST_SLOT(FunctionCallExpr, arguments)}},
+    [AST_NODE_ARRAY_SUBSCRIPT_EXPR] = {2, {
+        AST_NODE_SLOT(ArraySubscriptExpr, array),
+        AST_NODE_SLOT(ArraySubscriptExpr, index)}},
+    [AST_NODE_MEMBER_ACCESS_EXPR] = {1, {
+        AST_NODE_SLOT(MemberAccessExpr, baseExpr)}},
+    [AST_NODE_CAST_EXPR] = {2, {
+        AST_NODE_SLOT(CastExpr, targetType),
+        AST_NODE_SLOT(CastExpr, operand)}},
+
+    // 语句（复合语句的局部声明写在语句之前）
+    [AST_NODE_EXPRESSION_STATEMENT] = {1, {
+        AST_NODE_SLOT(ExpressionStatement, expression)}},
+    [AST_NODE_COMPOUND_STATEMENT] = {2, {
+        AST_LIST_SLOT(CompoundStatement, declarations),
+        AST_LIST_SLOT(CompoundStatement, statements)}},
+    [AST_NODE_IF_STATEMENT] = {3, {
+        AST_NODE_SLOT(IfStatement, condition),
+        AST_NODE_SLOT(IfStatement, thenStmt),
+        AST_NODE_SLOT(IfStatement, elseStmt)}},
+    [AST_NODE_WHILE_STATEMENT] = {2, {
+        AST_NODE_SLOT(WhileStatement, condition),
+        AST_NODE_SLOT(WhileStatement, body)}},
+    [AST_NODE_DO_WHILE_STATEMENT] = {2, {
+        AST_NODE_SLOT(DoWhileStatement, body),
+        AST_NODE_SLOT(DoWhileStatement, condition)}},
+    [AST_NODE_FOR_STATEMENT] = {4, {
+        AST_NODE_SLOT(ForStatement, init),
+        AST_NODE_SLOT(ForStatement, condition),
+        AST_NODE_SLOT(ForStatement, increment),
+        AST_NODE_SLOT(ForStatement, body)}},
+    [AST_NODE_RETURN_STATEMENT] = {1, {
+        AST_NODE_SLOT(ReturnStatement, returnValue)}},
+    [AST_NODE_SWITCH_STATEMENT] = {2, {
+        AST_NODE_SLOT(SwitchStatement, condition),
+        AST_LIST_SLOT(SwitchStatement, cases)}},
+    [AST_NODE_CASE_STATEMENT] = {2, {
+        AST_NODE_SLOT(CaseStatement, value),
+        AST_NODE_SLOT(CaseStatement, statement)}},
+    [AST_NODE_LABELED_STATEMENT] = {1, {
+        AST_NODE_SLOT(LabeledStatement, statement)}},
+
+    // 声明
+    [AST_NODE_VARIABLE_DECLARATION] = {2, {
+        AST_NODE_SLOT(VariableDeclaration, type),
+        AST_NODE_SLOT(VariableDeclaration, initializer)}},
+    [AST_NODE_FUNCTION_DECLARATION] = {3, {
+        AST_NODE_SLOT(FunctionDeclaration, returnType),
+        AST_LIST_SLOT(FunctionDeclaration, parameters),
+        AST_NODE_SLOT(FunctionDeclaration, body)}},
+    [AST_NODE_STRUCT_DECLARATION] = {1, {
+        AST_LIST_SLOT(StructDeclaration, members)}},
+    [AST_NODE_UNION_DECLARATION] = {1, {
+        AST_LIST_SLOT(UnionDeclaration, members)}},
+    [AST_NODE_ENUM_DECLARATION] = {1, {
+        { (uint16_t)offsetof(EnumDeclaration, constants), AST_CHILD_ENUM_CONSTANTS }}},
+    [AST_NODE_TYPEDEF_DECLARATION] = {1, {
+        AST_NODE_SLOT(TypedefDeclaration, aliasedType)}},
+
+    // 类型说明符
+    [AST_NODE_POINTER_TYPE_SPECIFIER] = {1, {
+        AST_NODE_SLOT(PointerTypeSpecifier, baseType)}},
+    [AST_NODE_ARRAY_TYPE_SPECIFIER] = {2, {
+        AST_NODE_SLOT(ArrayTypeSpecifier, elementType),
+        AST_NODE_SLOT(ArrayTypeSpecifier, size)}},
+    [AST_NODE_FUNCTION_TYPE_SPECIFIER] = {2, {
+        AST_NODE_SLOT(FunctionTypeSpecifier, returnType),
+        AST_LIST_SLOT(FunctionTypeSpecifier, parameterTypes)}},
+
+    // 其余类型（字面量、标识符、break/continue/goto、基本类型等）没有子节点
+};
+
+#undef AST_NODE_SLOT
+#undef AST_LIST_SLOT
+
+const ASTChildLayout* astNodeChildLayout(ASTNodeType type) {
+    static const ASTChildLayout emptyLayout = {0, {{0, 0}}};
+
+    if ((unsigned)type >= AST_CHILD_LAYOUT_COUNT) {
+        return &emptyLayout;
+    }
+    return &astChildLayoutTable[type];
+}
+
+// ==================== 子节点枚举 ====================
+
+ASTNode* astNodeNextChild(const ASTNode* node, ASTChildCursor* cursor) {
+    if (!node || !cursor) {
+        return NULL;
+    }
+    return astChildCursorNext(node, cursor);
+}
+
+size_t astNodeGetChildren(const ASTNode* node, ASTNode** children, size_t maxChildren) {
+    ASTChildCursor cursor = AST_CHILD_CURSOR_INIT;
+    size_t count = 0;
+    ASTNode* child;
+
+    if (!node) {
+        return 0;
+    }
+
+    while ((child = astChildCursorNext(node, &cursor)) != NULL) {
+        if (children && count < maxChildren) {
+            children[count] = child;
+        }
+        count++;
+    }
+
+    return count;
+}
+
+// ==================== 遍历栈 ====================
+
+bool astWalkStackGrow(ASTWalkStack* stack) {
+    ASTWalkSegment* next = stack->top->next;
+
+    if (!next) {
+        if (!stack->pool) {
+            stack->pool = createMemoryPool(0);
+            if (!stack->pool) {
+                return false;
+            }
+        }
+
+        // 段头和层数组放在同一块内存里；段头大小是指针大小的整数倍，层数组自然对齐
+        next = (ASTWalkSegment*)memoryPoolAlloc(stack->pool,
+            sizeof(ASTWalkSegment) + AST_WALK_SEGMENT_FRAMES * sizeof(ASTWalkFrame));
+        if (!next) {
+            return false;
+        }
+        next->prev = stack->top;
+        next->next = NULL;
+        next->frames = (ASTWalkFrame*)(next + 1);
+        next->capacity = AST_WALK_SEGMENT_FRAMES;
+        stack->top->next = next;
+    }
+
+    stack->top = next;
+    stack->used = 0;
+    return true;
+}
+
+// ==================== 迭代遍历 ====================
+
+bool astWalk(ASTNode* root, ASTWalkCallback preorder, ASTWalkCallback postorder, void* userData) {
+    if (!root) {
+        return true;
+    }
+
+    ASTWalkAction action = preorder ? preorder(root, 0, userData) : AST_WALK_CONTINUE;
+    if (action == AST_WALK_STOP) {
+        return false;
+    }
+    if (action == AST_WALK_SKIP_CHILDREN || astNodeIsLeafKind(root->nodeType)) {
+        return !postorder || postorder(root, 0, userData) != AST_WALK_STOP;
+    }
+
+    ASTWalkStack stack;
+    astWalkStackInit(&stack);
+    astWalkStackPush(&stack, root);
+    bool completed = true;
+
+    while (stack.depth > 0) {
+        ASTWalkFrame* frame = astWalkStackTop(&stack);
+        ASTNode* child = astChildCursorNext(frame->node, &frame->cursor);
+
+        if (!child) {
+            // 子节点都已遍历完，后序访问当前节点并出栈
+            ASTNode* node = frame->node;
+            astWalkStackPop(&stack);
+            if (postorder && postorder(node, stack.depth, userData) == AST_WALK_STOP) {
+                completed = false;
+                break;
+            }
+            continue;
+        }
+
+        size_t depth = stack.depth;
+        action = preorder ? preorder(child, depth, userData) : AST_WALK_CONTINUE;
+        if (action == AST_WALK_STOP) {
+            completed = false;
+            break;
+        }
+        // 叶子节点不入栈
+        if (action == AST_WALK_SKIP_CHILDREN || astNodeIsLeafKind(child->nodeType)) {
+            if (postorder && postorder(child, depth, userData) == AST_WALK_STOP) {
+                completed = false;
+                break;
+            }
+            continue;
+        }
+        if (!astWalkStackPush(&stack, child)) {
+            completed = false;
+            break;
+        }
+    }
+
+    astWalkStackRelease(&stack);
+    return completed;
+}
@@ -0,0 +1,294 @@
+#ifndef AST_WALK_H
+#define AST_WALK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ast.h"
+#include "ast_nodes.h"
+#include "../../common/utils/memory_pool.h"
+
+// ==================== 子节点布局表 ====================
+
+/**
+ * @brief 子节点槽位的种类
+ */
+typedef enum {
+    AST_CHILD_NODE,            // 单个子节点字段（ASTNode*，可以为NULL）
+    AST_CHILD_LIST,            // 子节点列表字段（Vector*，元素为ASTNode*）
+    AST_CHILD_ENUM_CONSTANTS   // 枚举常量列表（Vector*，元素为EnumConstant*，子节点是其value）
+} ASTChildSlotKind;
+
+/**
+ * @brief 子节点槽位：字段在节点结构体中的偏移和种类
+ */
+typedef struct {
+    uint16_t offset;
+    uint8_t kind;              // ASTChildSlotKind
+} ASTChildSlot;
+
+// 单个节点类型最多的子节点槽位数（for语句：init/condition/increment/body）
+#define AST_MAX_CHILD_SLOTS 4
+
+/**
+ * @brief 一种节点类型的子节点布局
+ *
+ * 槽位按源码顺序排列，所有遍历都按这个顺序访问子节点。
+ * 类型说明符也算子节点；结构体/联合体/枚举类型说明符的declaration
+ * 是对声明的引用，不算子节点（与扁平AST一致）。
+ */
+typedef struct {
+    uint8_t slotCount;
+    ASTChildSlot slots[AST_MAX_CHILD_SLOTS];
+} ASTChildLayout;
+
+// 布局表的项数（每种节点类型一项）
+#define AST_CHILD_LAYOUT_COUNT (AST_NODE_TYPEDEF_NAME_SPECIFIER + 1)
+
+/**
+ * @brief 子节点布局表，按节点类型索引
+ */
+extern const ASTChildLayout astChildLayoutTable[AST_CHILD_LAYOUT_COUNT];
+
+/**
+ * @brief 该类型的节点是否一定没有子节点（字面量、标识符等）
+ *
+ * 遍历时叶子节点不必入栈，直接做前序和后序访问。
+ */
+static inline bool astNodeIsLeafKind(ASTNodeType type) {
+    return (unsigned)type >= AST_CHILD_LAYOUT_COUNT || astChildLayoutTable[type].slotCount == 0;
+}
+
+/**
+ * @brief 获取节点类型的子节点布局
+ * @param type 节点类型
+ * @return 布局表项，类型无效时返回没有槽位的空布局
+ */
+const ASTChildLayout* astNodeChildLayout(ASTNodeType type);
+
+// ==================== 子节点枚举 ====================
+
+/**
+ * @brief 子节点游标，记录枚举到的槽位和列表下标
+ */
+typedef struct {
+    uint32_t slot;
+    uint32_t item;
+} ASTChildCursor;
+
+#define AST_CHILD_CURSOR_INIT {0, 0}
+
+/**
+ * @brief 取下一个子节点（内联版本，供遍历的热循环使用）
+ *
+ * 与astNodeNextChild相同，但node不能为NULL。
+ */
+static inline ASTNode* astChildCursorNext(const ASTNode* node, ASTChildCursor* cursor) {
+    if ((unsigned)node->nodeType >= AST_CHILD_LAYOUT_COUNT) {
+        return NULL;
+    }
+
+    const ASTChildLayout* layout = &astChildLayoutTable[node->nodeType];
+    const char* base = (const char*)node;
+
+    while (cursor->slot < layout->slotCount) {
+        const ASTChildSlot* slot = &layout->slots[cursor->slot];
+
+        if (slot->kind == AST_CHILD_NODE) {
+            ASTNode* child = *(ASTNode* const*)(base + slot->offset);
+            cursor->slot++;
+            if (child) {
+                return child;
+            }
+            continue;
+        }
+
+        const Vector* list = *(Vector* const*)(base + slot->offset);
+        while (list && cursor->item < list->size) {
+            ASTNode* child;
+            if (slot->kind == AST_CHILD_LIST) {
+                child = VECTOR_AT(list, ASTNode*, cursor->item);
+            } else {
+                const EnumConstant* constant = VECTOR_AT(list, EnumConstant*, cursor->item);
+                child = constant ? (ASTNode*)constant->value : NULL;
+            }
+            cursor->item++;
+            if (child) {
+                return child;
+            }
+        }
+
+        cursor->slot++;
+        cursor->item = 0;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief 取下一个子节点
+ *
+ * 按布局表顺序前进，跳过为NULL的字段和列表元素。
+ *
+ * @param node 父节点
+ * @param cursor 游标（首次调用前用AST_CHILD_CURSOR_INIT初始化）
+ * @return 下一个子节点，没有更多子节点时返回NULL
+ */
+ASTNode* astNodeNextChild(const ASTNode* node, ASTChildCursor* cursor);
+
+/**
+ * @brief 获取节点的直接子节点
+ * @param node 父节点
+ * @param children 接收子节点的数组（可为NULL）
+ * @param maxChildren children的容量
+ * @return 子节点总数（可能大于maxChildren，此时只写入前maxChildren个）
+ */
+size_t astNodeGetChildren(const ASTNode* node, ASTNode** children, size_t maxChildren);
+
+// ==================== 遍历栈 ====================
+
+// 遍历栈放在调用者栈帧里的层数，一般的AST不会超过
+#define AST_WALK_INLINE_FRAMES 64
+
+// 更深时从内存池分配的每段层数
+#define AST_WALK_SEGMENT_FRAMES 1024
+
+/**
+ * @brief 遍历栈的一层：节点和它的子节点游标
+ */
+typedef struct {
+    ASTNode* node;
+    ASTChildCursor cursor;
+} ASTWalkFrame;
+
+/**
+ * @brief 遍历栈的一段
+ *
+ * 段连成双向链表。回退到上一段后不释放当前段，再次加深时直接复用。
+ */
+typedef struct ASTWalkSegment {
+    struct ASTWalkSegment* prev;
+    struct ASTWalkSegment* next;
+    ASTWalkFrame* frames;
+    size_t capacity;
+} ASTWalkSegment;
+
+/**
+ * @brief 分段遍历栈
+ *
+ * 第一段内联在结构体里（通常在调用者的栈上），更深的段从内存池分配，
+ * 内存池在第一次溢出时创建，astWalkStackRelease时整体释放。
+ */
+typedef struct {
+    ASTWalkSegment* top;       // 栈顶所在的段
+    size_t used;               // 栈顶段已用的层数
+    size_t depth;              // 栈中的总层数
+    MemoryPool* pool;          // 额外段所在的内存池
+    ASTWalkSegment first;
+    ASTWalkFrame inlineFrames[AST_WALK_INLINE_FRAMES];
+} ASTWalkStack;
+
+/**
+ * @brief 切换到下一段（没有时分配），供astWalkStackPush在当前段满时调用
+ * @return 成功返回true，内存不足返回false
+ */
+bool astWalkStackGrow(ASTWalkStack* stack);
+
+/**
+ * @brief 初始化空的遍历栈
+ */
+static inline void astWalkStackInit(ASTWalkStack* stack) {
+    stack->first.prev = NULL;
+    stack->first.next = NULL;
+    stack->first.frames = stack->inlineFrames;
+    stack->first.capacity = AST_WALK_INLINE_FRAMES;
+    stack->top = &stack->first;
+    stack->used = 0;
+    stack->depth = 0;
+    stack->pool = NULL;
+}
+
+/**
+ * @brief 压入一层，返回新栈顶，内存不足返回NULL
+ */
+static inline ASTWalkFrame* astWalkStackPush(ASTWalkStack* stack, ASTNode* node) {
+    if (stack->used == stack->top->capacity && !astWalkStackGrow(stack)) {
+        return NULL;
+    }
+
+    ASTWalkFrame* frame = &stack->top->frames[stack->used++];
+    frame->node = node;
+    frame->cursor.slot = 0;
+    frame->cursor.item = 0;
+    stack->depth++;
+    return frame;
+}
+
+/**
+ * @brief 栈顶一层（栈不能为空）
+ */
+static inline ASTWalkFrame* astWalkStackTop(ASTWalkStack* stack) {
+    return &stack->top->frames[stack->used - 1];
+}
+
+/**
+ * @brief 弹出栈顶一层（栈不能为空）
+ */
+static inline void astWalkStackPop(ASTWalkStack* stack) {
+    stack->used--;
+    stack->depth--;
+    if (stack->used == 0 && stack->top->prev) {
+        stack->top = stack->top->prev;
+        stack->used = stack->top->capacity;
+    }
+}
+
+/**
+ * @brief 释放遍历栈从内存池分配的段
+ */
+static inline void astWalkStackRelease(ASTWalkStack* stack) {
+    if (stack->pool) {
+        destroyMemoryPool(stack->pool);
+        stack->pool = NULL;
+    }
+}
+
+// ==================== 迭代遍历 ====================
+
+/**
+ * @brief 遍历回调的返回值
+ */
+typedef enum {
+    AST_WALK_CONTINUE,         // 继续遍历
+    AST_WALK_SKIP_CHILDREN,    // 不进入当前节点的子节点（只对前序回调有效）
+    AST_WALK_STOP              // 立即结束整个遍历
+} ASTWalkAction;
+
+/**
+ * @brief 遍历回调
+ * @param node 当前节点
+ * @param depth 节点深度（根节点为0）
+ * @param userData 用户数据
+ * @return 遍历动作
+ */
+typedef ASTWalkAction (*ASTWalkCallback)(ASTNode* node, size_t depth, void* userData);
+
+/**
+ * @brief 深度优先遍历子树（同时支持前序和后序）
+ *
+ * 用显式栈迭代实现，不递归，时间O(n)，再深的树（如十万层的
+ * a+b+c+...链）也不会耗尽调用栈。栈见ASTWalkStack：前几十层放在本函数的
+ * 栈帧里，更深时从遍历专用的内存池按段分配，遍历结束后整体释放。
+ *
+ * 每个节点先调用preorder，再遍历其子节点，最后调用postorder。
+ * preorder返回AST_WALK_SKIP_CHILDREN时跳过子节点，但仍调用postorder。
+ *
+ * @param root 根节点
+ * @param preorder 前序回调（可为NULL）
+ * @param postorder 后序回调（可为NULL）
+ * @param userData 传给回调的用户数据
+ * @return 完整遍历返回true，被回调停止或内存不足返回false
+ */
+bool astWalk(ASTNode* root, ASTWalkCallback preorder, ASTWalkCallback postorder, void* userData);
+
+#endif // AST_WALK_H
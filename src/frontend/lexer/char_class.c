@@ -0,0 +1,261 @@
+#include "char_class.h"
+
+// 每个字节值一项，按字节值顺序排列
+const CharClass charClassTable[256] = {
+    /* 0x00   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x01   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x02   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x03   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x04   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x05   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x06   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x07   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x08   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x09   */ { CHAR_KIND_WHITESPACE, CHAR_FLAG_SPACE },
+    /* 0x0A   */ { CHAR_KIND_WHITESPACE, CHAR_FLAG_SPACE },
+    /* 0x0B   */ { CHAR_KIND_WHITESPACE, CHAR_FLAG_SPACE },
+    /* 0x0C   */ { CHAR_KIND_WHITESPACE, CHAR_FLAG_SPACE },
+    /* 0x0D   */ { CHAR_KIND_WHITESPACE, CHAR_FLAG_SPACE },
+    /* 0x0E   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x0F   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x10   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x11   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x12   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x13   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x14   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x15   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x16   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x17   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x18   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x19   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x1A   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x1B   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x1C   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x1D   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x1E   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x1F   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x20   */ { CHAR_KIND_WHITESPACE, CHAR_FLAG_SPACE },
+    /* '!'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '"'    */ { CHAR_KIND_STRING_QUOTE, 0 },
+    /* '#'    */ { CHAR_KIND_HASH, 0 },
+    /* '$'    */ { CHAR_KIND_UNKNOWN, 0 },
+    /* '%'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '&'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '\''   */ { CHAR_KIND_CHAR_QUOTE, 0 },
+    /* '('    */ { CHAR_KIND_OPERATOR, 0 },
+    /* ')'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '*'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '+'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* ','    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '-'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '.'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '/'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '0'    */ { CHAR_KIND_DIGIT, CHAR_FLAG_IDENT | CHAR_FLAG_DIGIT | CHAR_FLAG_HEX | CHAR_FLAG_OCTAL },
+    /* '1'    */ { CHAR_KIND_DIGIT, CHAR_FLAG_IDENT | CHAR_FLAG_DIGIT | CHAR_FLAG_HEX | CHAR_FLAG_OCTAL },
+    /* '2'    */ { CHAR_KIND_DIGIT, CHAR_FLAG_IDENT | CHAR_FLAG_DIGIT | CHAR_FLAG_HEX | CHAR_FLAG_OCTAL },
+    /* '3'    */ { CHAR_KIND_DIGIT, CHAR_FLAG_IDENT | CHAR_FLAG_DIGIT | CHAR_FLAG_HEX | CHAR_FLAG_OCTAL },
+    /* '4'    */ { CHAR_KIND_DIGIT, CHAR_FLAG_IDENT | CHAR_FLAG_DIGIT | CHAR_FLAG_HEX | CHAR_FLAG_OCTAL },
+    /* '5'    */ { CHAR_KIND_DIGIT, CHAR_FLAG_IDENT | CHAR_FLAG_DIGIT | CHAR_FLAG_HEX | CHAR_FLAG_OCTAL },
+    /* '6'    */ { CHAR_KIND_DIGIT, CHAR_FLAG_IDENT | CHAR_FLAG_DIGIT | CHAR_FLAG_HEX | CHAR_FLAG_OCTAL },
+    /* '7'    */ { CHAR_KIND_DIGIT, CHAR_FLAG_IDENT | CHAR_FLAG_DIGIT | CHAR_FLAG_HEX | CHAR_FLAG_OCTAL },
+    /* '8'    */ { CHAR_KIND_DIGIT, CHAR_FLAG_IDENT | CHAR_FLAG_DIGIT | CHAR_FLAG_HEX },
+    /* '9'    */ { CHAR_KIND_DIGIT, CHAR_FLAG_IDENT | CHAR_FLAG_DIGIT | CHAR_FLAG_HEX },
+    /* ':'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* ';'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '<'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '='    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '>'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '?'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '@'    */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 'A'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT | CHAR_FLAG_HEX },
+    /* 'B'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT | CHAR_FLAG_HEX },
+    /* 'C'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT | CHAR_FLAG_HEX },
+    /* 'D'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT | CHAR_FLAG_HEX },
+    /* 'E'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT | CHAR_FLAG_HEX },
+    /* 'F'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT | CHAR_FLAG_HEX },
+    /* 'G'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'H'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'I'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'J'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'K'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'L'    */ { CHAR_KIND_WIDE_PREFIX, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'M'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'N'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'O'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'P'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'Q'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'R'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'S'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'T'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'U'    */ { CHAR_KIND_WIDE_PREFIX, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'V'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'W'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'X'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'Y'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'Z'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* '['    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '\\'   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* ']'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '^'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '_'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* '`'    */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 'a'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT | CHAR_FLAG_HEX },
+    /* 'b'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT | CHAR_FLAG_HEX },
+    /* 'c'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT | CHAR_FLAG_HEX },
+    /* 'd'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT | CHAR_FLAG_HEX },
+    /* 'e'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT | CHAR_FLAG_HEX },
+    /* 'f'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT | CHAR_FLAG_HEX },
+    /* 'g'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'h'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'i'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'j'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'k'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'l'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'm'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'n'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'o'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'p'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'q'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'r'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 's'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 't'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'u'    */ { CHAR_KIND_WIDE_PREFIX, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'v'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'w'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'x'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'y'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* 'z'    */ { CHAR_KIND_IDENTIFIER, CHAR_FLAG_IDENT_START | CHAR_FLAG_IDENT },
+    /* '{'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '|'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '}'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* '~'    */ { CHAR_KIND_OPERATOR, 0 },
+    /* 0x7F   */ { CHAR_KIND_UNKNOWN, 0 },
+    /* 0x80   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x81   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x82   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x83   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x84   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x85   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x86   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x87   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x88   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x89   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x8A   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x8B   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x8C   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x8D   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x8E   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x8F   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x90   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x91   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x92   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x93   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x94   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x95   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x96   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x97   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x98   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x99   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x9A   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x9B   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x9C   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x9D   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x9E   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0x9F   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xA0   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xA1   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xA2   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xA3   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xA4   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xA5   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xA6   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xA7   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xA8   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xA9   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xAA   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xAB   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xAC   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xAD   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xAE   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xAF   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xB0   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xB1   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xB2   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xB3   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xB4   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xB5   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xB6   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xB7   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xB8   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xB9   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xBA   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xBB   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xBC   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xBD   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xBE   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xBF   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xC0   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xC1   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xC2   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xC3   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xC4   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xC5   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xC6   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xC7   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xC8   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xC9   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xCA   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xCB   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xCC   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xCD   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xCE   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xCF   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xD0   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xD1   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xD2   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xD3   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xD4   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xD5   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xD6   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xD7   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xD8   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xD9   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xDA   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xDB   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xDC   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xDD   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xDE   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xDF   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xE0   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xE1   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xE2   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xE3   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xE4   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xE5   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xE6   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xE7   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xE8   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xE9   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xEA   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xEB   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xEC   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xED   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xEE   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xEF   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xF0   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xF1   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xF2   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xF3   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xF4   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xF5   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xF6   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xF7   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xF8   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xF9   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xFA   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xFB   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xFC   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xFD   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xFE   */ { CHAR_KIND_UNICODE_START, 0 },
+    /* 0xFF   */ { CHAR_KIND_UNICODE_START, 0 },
+};
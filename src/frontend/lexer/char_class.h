@@ -0,0 +1,94 @@
+#ifndef CHAR_CLASS_H
+#define CHAR_CLASS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief 字符类别（决定词法分析器从该字符开始扫描哪种token）
+ */
+typedef enum {
+    CHAR_KIND_UNKNOWN,          // 非法字符
+    CHAR_KIND_WHITESPACE,       // 空白字符
+    CHAR_KIND_IDENTIFIER,       // 标识符首字符
+    CHAR_KIND_WIDE_PREFIX,      // 'L'、'u'、'U'，可能是字符/字符串的编码前缀
+    CHAR_KIND_DIGIT,            // 数字
+    CHAR_KIND_CHAR_QUOTE,       // '\''
+    CHAR_KIND_STRING_QUOTE,     // '"'
+    CHAR_KIND_HASH,             // '#'
+    CHAR_KIND_OPERATOR,         // 运算符或分隔符首字符
+    CHAR_KIND_UNICODE_START     // 0x80及以上的字节或'\\'，可能是UTF-8字符或通用字符名开始的标识符
+} CharKind;
+
+// 字符属性标志位
+#define CHAR_FLAG_SPACE         (1 << 0)    // 空白字符
+#define CHAR_FLAG_IDENT_START   (1 << 1)    // 可以作为标识符首字符
+#define CHAR_FLAG_IDENT         (1 << 2)    // 可以出现在标识符中
+#define CHAR_FLAG_DIGIT         (1 << 3)    // 十进制数字
+#define CHAR_FLAG_HEX           (1 << 4)    // 十六进制数字
+#define CHAR_FLAG_OCTAL         (1 << 5)    // 八进制数字
+
+/**
+ * @brief 字符分类表项
+ */
+typedef struct {
+    uint8_t kind;       // CharKind
+    uint8_t flags;      // CHAR_FLAG_*
+} CharClass;
+
+/**
+ * @brief 按字节值索引的字符分类表
+ *
+ * 编译期常量，与locale无关，取代<ctype.h>中的isalpha/isdigit等函数。
+ * 0x80及以上的字节都归为CHAR_KIND_UNICODE_START，标志位为0，
+ * Unicode标识符字符由词法分析器解码后查unicode.h中的表。
+ */
+extern const CharClass charClassTable[256];
+
+static inline CharKind charKind(char ch) {
+    return (CharKind)charClassTable[(unsigned char)ch].kind;
+}
+
+static inline bool charHasFlag(char ch, unsigned flag) {
+    return (charClassTable[(unsigned char)ch].flags & flag) != 0;
+}
+
+static inline bool charIsSpace(char ch) {
+    return charHasFlag(ch, CHAR_FLAG_SPACE);
+}
+
+static inline bool charIsIdentifierStart(char ch) {
+    return charHasFlag(ch, CHAR_FLAG_IDENT_START);
+}
+
+static inline bool charIsIdentifier(char ch) {
+    return charHasFlag(ch, CHAR_FLAG_IDENT);
+}
+
+static inline bool charIsDigit(char ch) {
+    return charHasFlag(ch, CHAR_FLAG_DIGIT);
+}
+
+static inline bool charIsHexDigit(char ch) {
+    return charHasFlag(ch, CHAR_FLAG_HEX);
+}
+
+static inline bool charIsOctalDigit(char ch) {
+    return charHasFlag(ch, CHAR_FLAG_OCTAL);
+}
+
+/**
+ * @brief 转换为小写（只处理ASCII字母）
+ */
+static inline char charToLower(char ch) {
+    return (ch >= 'A' && ch <= 'Z') ? (char)(ch | 0x20) : ch;
+}
+
+/**
+ * @brief 十六进制数字的值（ch必须是十六进制数字）
+ */
+static inline int charHexValue(char ch) {
+    return charIsDigit(ch) ? ch - '0' : charToLower(ch) - 'a' + 10;
+}
+
+#endif
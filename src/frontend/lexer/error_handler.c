@@ -1,3 +1,5 @@
+// strdup/asprintf是GNU扩展，C11模式下需要显式开启
+#define _GNU_SOURCE
 #include "error_handler.h"
 #include "../../common/containers/vector.h"
 #include <stdio.h>
@@ -20,10 +22,6 @@ static void destroyErrorInfo(void* error) {
     if (errorInfo->suggestion) {
         free(errorInfo->suggestion);
     }
-
-    if (errorInfo->location.filename) {
-        free(errorInfo->location.filename);
-    }
 }
 
 // ==================== 构造函数和析构函数 ====================
@@ -78,14 +76,9 @@ bool reportError(ErrorHandler* handler, ErrorLevel level, ErrorType type,
     error.suggestion = suggestion ? strdup(suggestion) : NULL;
     error.errorCode = 0;
 
-    if (location.filename) {
-        error.location.filename = strdup(location.filename);
-    }
-
     if (!vectorPushBack(handler->errors, &error)) {
         if (error.message) free(error.message);
         if (error.suggestion) free(error.suggestion);
-        if (error.location.filename) free(error.location.filename);
         return false;
     }
 
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""生成Unicode标识符属性表（unicode_tables.c）
+
+用法：gen_unicode_tables.py 输出文件
+
+XID_Start/XID_Continue取自Python自带的Unicode数据库（str.isidentifier
+按这两个属性判断）。码点按256个一块切分，内容相同的块只保留一份：
+一级表按码点高位给出块号，二级表每个码点占2位（bit0为XID_Continue，
+bit1为XID_Start）。ASCII部分由char_class表处理，这里照常生成但不会被查询。
+"""
+
+import sys
+import unicodedata
+
+BLOCK_SHIFT = 8
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+CODE_POINT_LIMIT = 0x110000
+
+
+def xid_property(cp):
+    ch = chr(cp)
+    value = 0
+    if ('a' + ch).isidentifier():
+        value |= 1
+    # '_'不属于XID_Start，Python额外允许它作为标识符首字符
+    if ch.isidentifier() and ch != '_':
+        value |= 2
+    return value
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.stderr.write('usage: gen_unicode_tables.py OUTPUT\n')
+        return 1
+
+    blocks = {}
+    block_list = []
+    stage1 = []
+    for base in range(0, CODE_POINT_LIMIT, BLOCK_SIZE):
+        block = tuple(xid_property(cp) for cp in range(base, base + BLOCK_SIZE))
+        if block not in blocks:
+            blocks[block] = len(block_list)
+            block_list.append(block)
+        stage1.append(blocks[block])
+    assert len(block_list) <= 256, 'block index no longer fits in uint8_t'
+
+    out = []
+    out.append('#include "unicode_tables.h"')
+    out.append('')
+    out.append('// 由gen_unicode_tables.py根据Unicode %s生成，不要手工修改' % unicodedata.unidata_version)
+    out.append('')
+    out.append('const uint8_t unicodeIdentifierStage1[UNICODE_IDENTIFIER_STAGE1_SIZE] = {')
+    for i in range(0, len(stage1), 16):
+        out.append('    ' + ' '.join('%d,' % v for v in stage1[i:i + 16]))
+    out.append('};')
+    out.append('')
+    out.append('const uint8_t unicodeIdentifierStage2[][UNICODE_IDENTIFIER_BLOCK_BYTES] = {')
+    for block in block_list:
+        packed = []
+        for i in range(0, BLOCK_SIZE, 4):
+            packed.append(block[i] | block[i + 1] << 2 | block[i + 2] << 4 | block[i + 3] << 6)
+        out.append('    {')
+        for i in range(0, len(packed), 16):
+            out.append('        ' + ' '.join('0x%02x,' % v for v in packed[i:i + 16]))
+        out.append('    },')
+    out.append('};')
+    out.append('')
+
+    with open(sys.argv[1], 'w', encoding='utf-8', newline='\n') as f:
+        f.write('\n'.join(out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,587 @@
+#include "incremental_lexer.h"
+#include <stdlib.h>
+#include <string.h>
+
+// 首次分配token槽位时假设的平均字节数，与token_array.c保持一致
+#define BYTES_PER_TOKEN_ESTIMATE 5
+
+// 词法分析器在token末尾之后最多查看的字节数（标识符之后的通用字符名
+// \Uhhhhhhhh最长10字节），离编辑点这么近的token也要重新扫描
+#define LEXER_MAX_LOOKAHEAD 10
+
+// 字符串池的浪费超过这个字节数且超过存活内容时压缩
+#define STRING_POOL_COMPACT_THRESHOLD 4096
+
+// ==================== 间隙缓冲区 ====================
+
+/**
+ * @brief token数量
+ */
+static inline size_t incrementalTokenCount(const IncrementalLexer* lexer) {
+    return lexer->gapStart + (lexer->capacity - lexer->gapEnd);
+}
+
+/**
+ * @brief 逻辑下标对应的槽位
+ */
+static inline size_t incrementalSlot(const IncrementalLexer* lexer, size_t index) {
+    return index < lexer->gapStart ? index : index + (lexer->gapEnd - lexer->gapStart);
+}
+
+/**
+ * @brief 槽位中token的绝对起始偏移
+ */
+static inline size_t incrementalSlotOffset(const IncrementalLexer* lexer, size_t slot) {
+    uint32_t stored = lexer->tokens[slot].offset;
+    return slot < lexer->gapStart ? stored : lexer->textLength - stored;
+}
+
+/**
+ * @brief 槽位中token的绝对结束偏移
+ */
+static inline size_t incrementalSlotEnd(const IncrementalLexer* lexer, size_t slot) {
+    return incrementalSlotOffset(lexer, slot) + lexer->tokens[slot].length;
+}
+
+/**
+ * @brief 把间隙移动到逻辑下标index处
+ *
+ * 跨过间隙的token在绝对偏移和到末尾的距离之间转换，代价与移动距离成正比。
+ */
+static void incrementalMoveGap(IncrementalLexer* lexer, size_t index) {
+    while (lexer->gapStart > index) {
+        // 间隙左移：前面的token搬到间隙之后
+        lexer->gapStart--;
+        lexer->gapEnd--;
+        lexer->tokens[lexer->gapEnd] = lexer->tokens[lexer->gapStart];
+        lexer->values[lexer->gapEnd] = lexer->values[lexer->gapStart];
+        lexer->tokens[lexer->gapEnd].offset =
+            (uint32_t)(lexer->textLength - lexer->tokens[lexer->gapEnd].offset);
+    }
+    while (lexer->gapStart < index) {
+        // 间隙右移：后面的token搬到间隙之前
+        lexer->tokens[lexer->gapStart] = lexer->tokens[lexer->gapEnd];
+        lexer->values[lexer->gapStart] = lexer->values[lexer->gapEnd];
+        lexer->tokens[lexer->gapStart].offset =
+            (uint32_t)(lexer->textLength - lexer->tokens[lexer->gapStart].offset);
+        lexer->gapStart++;
+        lexer->gapEnd++;
+    }
+}
+
+/**
+ * @brief 保证间隙中至少还有一个空槽位
+ */
+static bool incrementalReserveGap(IncrementalLexer* lexer) {
+    if (lexer->gapStart < lexer->gapEnd) {
+        return true;
+    }
+
+    size_t newCapacity = lexer->capacity < 16 ? 16 : lexer->capacity * 2;
+    PackedToken* tokens = (PackedToken*)realloc(lexer->tokens, newCapacity * sizeof(PackedToken));
+    if (!tokens) {
+        return false;
+    }
+    lexer->tokens = tokens;
+    TokenValue* values = (TokenValue*)realloc(lexer->values, newCapacity * sizeof(TokenValue));
+    if (!values) {
+        return false;
+    }
+    lexer->values = values;
+
+    // 间隙之后的部分挪到新数组的末尾
+    size_t tailCount = lexer->capacity - lexer->gapEnd;
+    size_t newGapEnd = newCapacity - tailCount;
+    memmove(lexer->tokens + newGapEnd, lexer->tokens + lexer->gapEnd, tailCount * sizeof(PackedToken));
+    memmove(lexer->values + newGapEnd, lexer->values + lexer->gapEnd, tailCount * sizeof(TokenValue));
+    lexer->gapEnd = newGapEnd;
+    lexer->capacity = newCapacity;
+    return true;
+}
+
+// ==================== 字符串池 ====================
+
+/**
+ * @brief 追加解码后的字符串，填写value中的位置
+ */
+static bool incrementalAddString(IncrementalLexer* lexer, const char* str, size_t length, TokenValue* value) {
+    size_t required = lexer->stringPoolSize + length + 1;
+    if (required > lexer->stringPoolCapacity) {
+        size_t newCapacity = lexer->stringPoolCapacity ? lexer->stringPoolCapacity : 256;
+        while (newCapacity < required) {
+            newCapacity *= 2;
+        }
+        char* pool = (char*)realloc(lexer->stringPool, newCapacity);
+        if (!pool) {
+            return false;
+        }
+        lexer->stringPool = pool;
+        lexer->stringPoolCapacity = newCapacity;
+    }
+
+    value->as.string.offset = (uint32_t)lexer->stringPoolSize;
+    value->as.string.length = (uint32_t)length;
+    if (length > 0) {
+        memcpy(lexer->stringPool + lexer->stringPoolSize, str, length);
+    }
+    lexer->stringPool[lexer->stringPoolSize + length] = '\0';
+    lexer->stringPoolSize += length + 1;
+    lexer->stringPoolLive += length + 1;
+    return true;
+}
+
+/**
+ * @brief 槽位被丢弃时归还它引用的字符串字节
+ */
+static void incrementalReleaseSlot(IncrementalLexer* lexer, size_t slot) {
+    if (lexer->tokens[slot].type == TOKEN_STRING_LITERAL &&
+        lexer->tokens[slot].valueIndex != TOKEN_NO_VALUE) {
+        lexer->stringPoolLive -= lexer->values[slot].as.string.length + 1;
+    }
+}
+
+/**
+ * @brief 反复编辑字符串字面量后池中会积累死字节，浪费过多时整体重建
+ */
+static void incrementalCompactStrings(IncrementalLexer* lexer) {
+    size_t waste = lexer->stringPoolSize - lexer->stringPoolLive;
+    if (waste < STRING_POOL_COMPACT_THRESHOLD || waste < lexer->stringPoolLive) {
+        return;
+    }
+
+    char* pool = (char*)malloc(lexer->stringPoolLive ? lexer->stringPoolLive : 1);
+    if (!pool) {
+        return;  // 压缩只是优化，失败时保持原样
+    }
+
+    size_t size = 0;
+    for (size_t slot = 0; slot < lexer->capacity; slot++) {
+        if (slot == lexer->gapStart) {
+            slot = lexer->gapEnd;
+            if (slot >= lexer->capacity) {
+                break;
+            }
+        }
+        if (lexer->tokens[slot].type != TOKEN_STRING_LITERAL ||
+            lexer->tokens[slot].valueIndex == TOKEN_NO_VALUE) {
+            continue;
+        }
+        TokenValue* value = &lexer->values[slot];
+        size_t bytes = value->as.string.length + 1;
+        memcpy(pool + size, lexer->stringPool + value->as.string.offset, bytes);
+        value->as.string.offset = (uint32_t)size;
+        size += bytes;
+    }
+
+    free(lexer->stringPool);
+    lexer->stringPool = pool;
+    lexer->stringPoolSize = size;
+    lexer->stringPoolCapacity = lexer->stringPoolLive ? lexer->stringPoolLive : 1;
+}
+
+// ==================== 重新扫描 ====================
+
+/**
+ * @brief 把扫描结果写入间隙起点
+ */
+static bool incrementalInsertToken(IncrementalLexer* lexer, const LexedToken* lexed) {
+    if (!incrementalReserveGap(lexer)) {
+        return false;
+    }
+
+    TokenValue value;
+    memset(&value, 0, sizeof(TokenValue));
+    uint32_t valueIndex = TOKEN_NO_VALUE;
+
+    if (lexed->hasValue) {
+        value.literalType = (uint8_t)lexed->literalType;
+        value.isWide = lexed->isWide;
+        switch (lexed->type) {
+            case TOKEN_STRING_LITERAL:
+                if (!incrementalAddString(lexer, lexed->stringValue, lexed->stringLength, &value)) {
+                    return false;
+                }
+                break;
+            case TOKEN_FLOAT_LITERAL:
+                value.as.floatValue = lexed->value.floatValue;
+                break;
+            case TOKEN_CHAR_LITERAL:
+                if (lexed->literalType == LITERAL_TYPE_CHAR) {
+                    value.as.charValue = lexed->value.charValue;
+                } else {
+                    value.as.intValue = lexed->value.intValue;
+                }
+                break;
+            default:
+                value.as.intValue = lexed->value.intValue;
+                break;
+        }
+        valueIndex = 0;  // 值与token同槽位存放，这里只标记“有值”
+    }
+
+    PackedToken* token = &lexer->tokens[lexer->gapStart];
+    token->offset = (uint32_t)lexed->offset;
+    token->length = (uint32_t)lexed->length;
+    token->type = (uint16_t)lexed->type;
+    token->flags = (uint16_t)lexed->flags;
+    token->valueIndex = valueIndex;
+    lexer->values[lexer->gapStart] = value;
+    lexer->gapStart++;
+    return true;
+}
+
+/**
+ * @brief 从restart开始重新扫描，直到与间隙之后的旧token重新同步
+ *
+ * 起点在编辑区末尾（editEnd，新坐标）之后的旧token，其后的源码没有变化，
+ * 新扫描一旦停在同一个起点，之后的token必然一致。
+ */
+static bool incrementalRelex(IncrementalLexer* lexer, size_t restart, size_t editEnd) {
+    lexer->lastRelexedCount = 0;
+    lexer->lastDiscardedCount = 0;
+    lexer->lexer->position = restart;
+
+    LexedToken lexed;
+    for (;;) {
+        lexerScanToken(lexer->lexer, &lexed);
+
+        // 丢弃被编辑覆盖或已经被新token越过的旧token。间隙之后的token记录
+        // 到末尾的距离，起点落在被删除区域中的token按新长度换算会下溢，
+        // 所以先用距离判断它是否在编辑区之后
+        while (lexer->gapEnd < lexer->capacity) {
+            size_t distance = lexer->tokens[lexer->gapEnd].offset;
+            if (distance <= lexer->textLength - editEnd &&
+                lexer->textLength - distance >= lexed.offset) {
+                break;
+            }
+            incrementalReleaseSlot(lexer, lexer->gapEnd);
+            lexer->gapEnd++;
+            lexer->lastDiscardedCount++;
+        }
+
+        if (lexer->gapEnd < lexer->capacity &&
+            incrementalSlotOffset(lexer, lexer->gapEnd) == lexed.offset) {
+            return true;  // 重新同步，后面的旧token全部沿用
+        }
+
+        if (!incrementalInsertToken(lexer, &lexed)) {
+            return false;
+        }
+        lexer->lastRelexedCount++;
+
+        if (lexed.type == TOKEN_EOF) {
+            return true;
+        }
+    }
+}
+
+/**
+ * @brief 找到第一个可能受offset处编辑影响的token
+ *
+ * 即第一个结束位置加上前看距离不早于offset的token。偏移单调递增，二分查找；
+ * EOF的结束位置是源码末尾，所以一定能找到。
+ */
+static size_t incrementalFindFirstAffected(const IncrementalLexer* lexer, size_t offset) {
+    size_t low = 0;
+    size_t high = incrementalTokenCount(lexer);
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (incrementalSlotEnd(lexer, incrementalSlot(lexer, mid)) + LEXER_MAX_LOOKAHEAD < offset) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// ==================== 构造函数和析构函数 ====================
+
+IncrementalLexer* createIncrementalLexer(const char* source, size_t length,
+                                         const char* filename, DiagnosticEngine* diagnostics) {
+    if ((!source && length > 0) || length > UINT32_MAX) {
+        return NULL;
+    }
+
+    IncrementalLexer* lexer = (IncrementalLexer*)calloc(1, sizeof(IncrementalLexer));
+    if (!lexer) {
+        return NULL;
+    }
+
+    lexer->textCapacity = length + 1;
+    lexer->text = (char*)malloc(lexer->textCapacity);
+    if (!lexer->text) {
+        free(lexer);
+        return NULL;
+    }
+    if (length > 0) {
+        memcpy(lexer->text, source, length);
+    }
+    lexer->text[length] = '\0';
+    lexer->textLength = length;
+
+    // 源码由增量词法分析器持有，内部词法分析器只借用
+    lexer->lexer = createLexer("", filename, diagnostics);
+    if (!lexer->lexer || !lexerSetSource(lexer->lexer, lexer->text, length)) {
+        destroyIncrementalLexer(lexer);
+        return NULL;
+    }
+
+    lexer->capacity = length / BYTES_PER_TOKEN_ESTIMATE + 16;
+    lexer->tokens = (PackedToken*)malloc(lexer->capacity * sizeof(PackedToken));
+    lexer->values = (TokenValue*)malloc(lexer->capacity * sizeof(TokenValue));
+    if (!lexer->tokens || !lexer->values) {
+        destroyIncrementalLexer(lexer);
+        return NULL;
+    }
+    lexer->gapStart = 0;
+    lexer->gapEnd = lexer->capacity;
+
+    if (!incrementalRelex(lexer, 0, 0)) {
+        destroyIncrementalLexer(lexer);
+        return NULL;
+    }
+    return lexer;
+}
+
+void destroyIncrementalLexer(IncrementalLexer* lexer) {
+    if (!lexer) {
+        return;
+    }
+    // 同时释放内部词法分析器在源管理器中的表项
+    destroyLexer(lexer->lexer);
+    free(lexer->text);
+    free(lexer->tokens);
+    free(lexer->values);
+    free(lexer->stringPool);
+    free(lexer);
+}
+
+// ==================== 编辑 ====================
+
+bool incrementalLexerApplyEdit(IncrementalLexer* lexer, const TextEdit* edit) {
+    if (!lexer || !edit || (!edit->insertedText && edit->insertedLength > 0)) {
+        return false;
+    }
+    if (edit->offset > lexer->textLength ||
+        edit->removedLength > lexer->textLength - edit->offset) {
+        return false;
+    }
+    size_t newLength = lexer->textLength - edit->removedLength + edit->insertedLength;
+    if (newLength > UINT32_MAX) {
+        return false;
+    }
+
+    // 先在旧坐标下定位：受影响的第一个token之前那个token的末尾就是安全重启点
+    size_t first = incrementalFindFirstAffected(lexer, edit->offset);
+    incrementalMoveGap(lexer, first);
+    size_t restart = first > 0 ? incrementalSlotEnd(lexer, first - 1) : 0;
+
+    // 修改源码；间隙之后的token记录的是到末尾的距离，随新长度自动平移
+    if (newLength + 1 > lexer->textCapacity) {
+        size_t newCapacity = lexer->textCapacity * 2;
+        if (newCapacity < newLength + 1) {
+            newCapacity = newLength + 1;
+        }
+        char* text = (char*)realloc(lexer->text, newCapacity);
+        if (!text) {
+            return false;
+        }
+        lexer->text = text;
+        lexer->textCapacity = newCapacity;
+    }
+
+    size_t tailStart = edit->offset + edit->removedLength;
+    memmove(lexer->text + edit->offset + edit->insertedLength, lexer->text + tailStart,
+            lexer->textLength - tailStart);
+    if (edit->insertedLength > 0) {
+        memcpy(lexer->text + edit->offset, edit->insertedText, edit->insertedLength);
+    }
+    lexer->textLength = newLength;
+    lexer->text[newLength] = '\0';
+
+    if (!lexerSetEditedSource(lexer->lexer, lexer->text, newLength,
+                              edit->offset, edit->removedLength, edit->insertedLength)) {
+        return false;
+    }
+
+    if (!incrementalRelex(lexer, restart, edit->offset + edit->insertedLength)) {
+        return false;
+    }
+    incrementalCompactStrings(lexer);
+    return true;
+}
+
+/**
+ * @brief 找到token数组中第一个可能受offset处编辑影响的token
+ *
+ * 与incrementalFindFirstAffected相同，数组中没有EOF时可能返回count。
+ */
+static size_t tokenArrayFindFirstAffected(const TokenArray* array, size_t offset) {
+    size_t low = 0;
+    size_t high = array->count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        const PackedToken* token = &array->tokens[mid];
+        if ((size_t)token->offset + token->length + LEXER_MAX_LOOKAHEAD < offset) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+TokenArray* incrementalRelexTokenArray(Lexer* lexer, const TokenArray* previous, const TextEdit* edit) {
+    if (!lexer || !previous || !edit) {
+        return NULL;
+    }
+    if (edit->offset > previous->sourceLength ||
+        edit->removedLength > previous->sourceLength - edit->offset ||
+        lexer->sourceLength != previous->sourceLength - edit->removedLength + edit->insertedLength) {
+        return NULL;
+    }
+
+    TokenArray* tokens = createTokenArray(lexer->source, lexer->sourceLength, previous->fileId,
+                                          previous->count + 16);
+    if (!tokens) {
+        return NULL;
+    }
+
+    // 编辑点之前的token不受影响，偏移也不变
+    size_t first = tokenArrayFindFirstAffected(previous, edit->offset);
+    if (!tokenArrayAppendRange(tokens, previous, 0, first)) {
+        destroyTokenArray(tokens);
+        return NULL;
+    }
+    lexer->position = first > 0
+        ? (size_t)previous->tokens[first - 1].offset + previous->tokens[first - 1].length
+        : 0;
+
+    // 起点在编辑区之后的旧token，在新源码中的起点是旧起点减去removed加上inserted
+    size_t oldEditEnd = edit->offset + edit->removedLength;
+    size_t cursor = first;
+
+    LexedToken lexed;
+    for (;;) {
+        lexerScanToken(lexer, &lexed);
+
+        while (cursor < previous->count &&
+               (previous->tokens[cursor].offset < oldEditEnd ||
+                previous->tokens[cursor].offset - edit->removedLength + edit->insertedLength <
+                    lexed.offset)) {
+            cursor++;
+        }
+        if (cursor < previous->count &&
+            previous->tokens[cursor].offset - edit->removedLength + edit->insertedLength ==
+                lexed.offset) {
+            break;  // 重新同步，后面的旧token全部沿用
+        }
+
+        if (!lexerAppendPackedToken(tokens, &lexed)) {
+            destroyTokenArray(tokens);
+            return NULL;
+        }
+        if (lexed.type == TOKEN_EOF) {
+            return tokens;
+        }
+    }
+
+    size_t reused = tokens->count;
+    if (!tokenArrayAppendRange(tokens, previous, cursor, previous->count - cursor)) {
+        destroyTokenArray(tokens);
+        return NULL;
+    }
+    for (size_t i = reused; i < tokens->count; i++) {
+        tokens->tokens[i].offset =
+            (uint32_t)(tokens->tokens[i].offset - edit->removedLength + edit->insertedLength);
+    }
+    return tokens;
+}
+
+// ==================== 访问 ====================
+
+const char* incrementalLexerGetSource(const IncrementalLexer* lexer, size_t* length) {
+    if (!lexer) {
+        return NULL;
+    }
+    if (length) {
+        *length = lexer->textLength;
+    }
+    return lexer->text;
+}
+
+size_t incrementalLexerTokenCount(const IncrementalLexer* lexer) {
+    return lexer ? incrementalTokenCount(lexer) : 0;
+}
+
+bool incrementalLexerGetToken(const IncrementalLexer* lexer, size_t index, PackedToken* out) {
+    if (!lexer || !out || index >= incrementalTokenCount(lexer)) {
+        return false;
+    }
+    size_t slot = incrementalSlot(lexer, index);
+    *out = lexer->tokens[slot];
+    out->offset = (uint32_t)incrementalSlotOffset(lexer, slot);
+    if (out->valueIndex != TOKEN_NO_VALUE) {
+        out->valueIndex = (uint32_t)index;
+    }
+    return true;
+}
+
+const TokenValue* incrementalLexerGetValue(const IncrementalLexer* lexer, size_t index) {
+    if (!lexer || index >= incrementalTokenCount(lexer)) {
+        return NULL;
+    }
+    size_t slot = incrementalSlot(lexer, index);
+    return lexer->tokens[slot].valueIndex != TOKEN_NO_VALUE ? &lexer->values[slot] : NULL;
+}
+
+const char* incrementalLexerGetString(const IncrementalLexer* lexer, size_t index, size_t* length) {
+    const TokenValue* value = incrementalLexerGetValue(lexer, index);
+    if (!value || lexer->tokens[incrementalSlot(lexer, index)].type != TOKEN_STRING_LITERAL) {
+        return NULL;
+    }
+    if (length) {
+        *length = value->as.string.length;
+    }
+    return lexer->stringPool + value->as.string.offset;
+}
+
+TokenArray* incrementalLexerSnapshot(const IncrementalLexer* lexer) {
+    if (!lexer) {
+        return NULL;
+    }
+
+    size_t count = incrementalTokenCount(lexer);
+    TokenArray* array = createTokenArray(lexer->text, lexer->textLength, lexer->lexer->fileId, count);
+    if (!array) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        PackedToken token;
+        if (!incrementalLexerGetToken(lexer, i, &token)) {
+            destroyTokenArray(array);
+            return NULL;
+        }
+
+        const TokenValue* value = incrementalLexerGetValue(lexer, i);
+        TokenValue copy;
+        if (value) {
+            copy = *value;
+            if (token.type == TOKEN_STRING_LITERAL &&
+                !tokenArrayAddString(array, lexer->stringPool + value->as.string.offset,
+                                     value->as.string.length, &copy)) {
+                destroyTokenArray(array);
+                return NULL;
+            }
+        }
+
+        if (!tokenArrayPush(array, (TokenType)token.type, token.offset, token.length,
+                            token.flags, value ? &copy : NULL)) {
+            destroyTokenArray(array);
+            return NULL;
+        }
+    }
+    return array;
+}
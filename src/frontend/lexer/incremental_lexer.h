@@ -0,0 +1,153 @@
+#ifndef INCREMENTAL_LEXER_H
+#define INCREMENTAL_LEXER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "lexer.h"
+#include "token_array.h"
+
+/**
+ * @brief 一次文本编辑
+ *
+ * 把[offset, offset + removedLength)替换为insertedText，偏移按编辑前的源码计算。
+ */
+typedef struct {
+    size_t offset;              // 编辑起始偏移
+    size_t removedLength;       // 删除的字节数
+    const char* insertedText;   // 插入的文本（纯删除时可为NULL）
+    size_t insertedLength;      // 插入的字节数
+} TextEdit;
+
+/**
+ * @brief 增量词法分析器
+ *
+ * 持有源码和对应的token序列，每次编辑只从编辑点之前最近的安全重启点
+ * （上一个未受影响token的末尾，必然在注释和字符串之外）开始重新扫描，
+ * 一旦新扫描出的token起点与编辑区之后的某个旧token重合，后面的token
+ * 必然完全相同，直接沿用。
+ *
+ * token存放在间隙缓冲区中：间隙之前的token记录绝对偏移，间隙之后的
+ * token记录到文件末尾的距离。编辑发生在间隙处时，其后的token不需要
+ * 逐个修改偏移；间隙只随编辑位置移动，连续在附近编辑时摊还O(1)。
+ */
+typedef struct {
+    Lexer* lexer;               // 扫描用的词法分析器（源码指向text）
+
+    char* text;                 // 当前源码（以'\0'结尾）
+    size_t textLength;
+    size_t textCapacity;
+
+    PackedToken* tokens;        // token间隙缓冲区（valueIndex只用来标记是否有值）
+    TokenValue* values;         // 与tokens一一对应的字面量值
+    size_t capacity;            // 槽位总数
+    size_t gapStart;            // 间隙起点（也是间隙之前的token数）
+    size_t gapEnd;              // 间隙终点
+
+    char* stringPool;           // 字符串字面量解码后的内容（只追加，定期压缩）
+    size_t stringPoolSize;
+    size_t stringPoolCapacity;
+    size_t stringPoolLive;      // 仍被token引用的字节数
+
+    size_t lastRelexedCount;    // 最近一次编辑重新扫描出的token数
+    size_t lastDiscardedCount;  // 最近一次编辑丢弃的旧token数
+} IncrementalLexer;
+
+// ==================== 构造函数和析构函数 ====================
+
+/**
+ * @brief 创建增量词法分析器并对初始源码做一次完整扫描
+ * @param source 初始源码（会被复制）
+ * @param length 源码长度
+ * @param filename 文件名（用于错误报告）
+ * @param diagnostics 诊断引擎（可为NULL）
+ * @return 新创建的增量词法分析器，失败返回NULL
+ */
+IncrementalLexer* createIncrementalLexer(const char* source, size_t length,
+                                         const char* filename, DiagnosticEngine* diagnostics);
+
+/**
+ * @brief 销毁增量词法分析器
+ * @param lexer 要销毁的增量词法分析器
+ */
+void destroyIncrementalLexer(IncrementalLexer* lexer);
+
+// ==================== 编辑 ====================
+
+/**
+ * @brief 应用一次编辑并增量更新token序列
+ * @param lexer 增量词法分析器
+ * @param edit 编辑内容
+ * @return 成功返回true；编辑越界时返回false且不做任何修改；
+ *         内存不足时返回false，此时token序列可能不完整，应销毁后重新创建
+ */
+bool incrementalLexerApplyEdit(IncrementalLexer* lexer, const TextEdit* edit);
+
+/**
+ * @brief 按一次编辑由旧token数组得到新token数组
+ *
+ * 不需要IncrementalLexer，源码和token数组都由调用者持有：调用者先应用编辑，
+ * 用lexerSetEditedSource（或lexerSetSource）让lexer指向编辑后的源码，
+ * 再传入编辑前的token数组。
+ * 编辑点之前的token原样复制，从安全重启点开始重新扫描，与编辑区之后的旧token
+ * 重新同步后，其余旧token平移偏移后复制。只有编辑附近会重新扫描，
+ * 但复制token仍与文件大小成正比；连续编辑同一个文件时用IncrementalLexer。
+ *
+ * @param lexer 已指向编辑后源码的词法分析器（诊断只报告重新扫描的部分）
+ * @param previous 编辑前源码的token数组（不修改）
+ * @param edit 这次编辑，偏移按编辑前的源码计算
+ * @return 新的token数组，词素引用lexer的源码，由调用者用destroyTokenArray释放；
+ *         编辑与两份源码的长度不符或内存不足时返回NULL
+ */
+TokenArray* incrementalRelexTokenArray(Lexer* lexer, const TokenArray* previous, const TextEdit* edit);
+
+// ==================== 访问 ====================
+
+/**
+ * @brief 当前源码
+ * @param lexer 增量词法分析器
+ * @param length 输出源码长度（可为NULL）
+ * @return 以'\0'结尾的源码，下一次编辑后失效
+ */
+const char* incrementalLexerGetSource(const IncrementalLexer* lexer, size_t* length);
+
+/**
+ * @brief token数量（含末尾的EOF）
+ */
+size_t incrementalLexerTokenCount(const IncrementalLexer* lexer);
+
+/**
+ * @brief 获取第index个token
+ * @param lexer 增量词法分析器
+ * @param index token下标
+ * @param out 输出token，offset为绝对偏移；有字面量值时valueIndex等于index
+ * @return 越界返回false
+ */
+bool incrementalLexerGetToken(const IncrementalLexer* lexer, size_t index, PackedToken* out);
+
+/**
+ * @brief 获取第index个token的字面量值
+ * @return 没有值或越界返回NULL
+ */
+const TokenValue* incrementalLexerGetValue(const IncrementalLexer* lexer, size_t index);
+
+/**
+ * @brief 获取第index个token解码后的字符串内容
+ * @param lexer 增量词法分析器
+ * @param index token下标
+ * @param length 输出长度（可为NULL）
+ * @return 以'\0'结尾的字符串，不是字符串字面量时返回NULL
+ */
+const char* incrementalLexerGetString(const IncrementalLexer* lexer, size_t index, size_t* length);
+
+/**
+ * @brief 导出当前token序列
+ *
+ * 复制成普通的紧凑token数组交给语法分析器等下游使用，词素引用增量
+ * 词法分析器的源码，因此在下一次编辑之前有效。
+ *
+ * @param lexer 增量词法分析器
+ * @return token数组，由调用者用destroyTokenArray释放；失败返回NULL
+ */
+TokenArray* incrementalLexerSnapshot(const IncrementalLexer* lexer);
+
+#endif
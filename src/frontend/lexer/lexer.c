@@ -1,10 +1,14 @@
 #include "lexer.h"
-#include "../../common/containers/vector.h"
 #include "../../common/diagnostics/diagnostic_engine.h"
+#include "../../common/io/file_reader.h"
+#include "lexer_simd.h"
+#include "char_class.h"
+#include "number_parser.h"
+#include "unicode.h"
 #include <stdio.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
-#include <ctype.h>
 #include <errno.h>
 #include <stdarg.h>
 
@@ -15,6 +19,7 @@
  */
 typedef struct {
     const char* keyword;
+    size_t length;
     TokenType tokenType;
 } KeywordEntry;
 
@@ -23,86 +28,107 @@ typedef struct {
  */
 typedef struct {
     const char* directive;
+    size_t length;
     TokenType tokenType;
 } PreprocessorDirectiveEntry;
 
 /**
- * @brief 关键字映射表
- * 注意：必须与token.h中的TokenType枚举顺序一致
+ * @brief 关键字完美哈希
+ *
+ * 以长度、首字符、第二个字符和末字符计算槽位。所有关键字都至少有两个字符，
+ * 且在128个槽内互不冲突。槽位由下面的宏在编译期算出并通过指定初始化器放入
+ * 表中；新增关键字若与已有槽位冲突，编译器会给出-Woverride-init警告，
+ * 此时需要重新选取乘数。
  */
-static const KeywordEntry keywordTable[] = {
+#define KEYWORD_HASH_SIZE 128
+#define KEYWORD_MAX_LENGTH 14
+#define KEYWORD_HASH(c0, c1, cl, len) \
+    (((unsigned)(c0) * 12u + (unsigned)(c1) * 7u + (unsigned)(cl) * 27u + (unsigned)(len)) \
+     & (KEYWORD_HASH_SIZE - 1))
+#define KEYWORD_ENTRY(str, c0, c1, cl, type) \
+    [KEYWORD_HASH(c0, c1, cl, sizeof(str) - 1)] = { str, sizeof(str) - 1, type }
+
+/**
+ * @brief 关键字哈希表（空槽的length为0）
+ */
+static const KeywordEntry keywordTable[KEYWORD_HASH_SIZE] = {
     // C基础关键字
-    {"int", TOKEN_INT},
-    {"float", TOKEN_FLOAT},
-    {"char", TOKEN_CHAR},
-    {"double", TOKEN_DOUBLE},
-    {"void", TOKEN_VOID},
-    {"if", TOKEN_IF},
-    {"else", TOKEN_ELSE},
-    {"while", TOKEN_WHILE},
-    {"for", TOKEN_FOR},
-    {"do", TOKEN_DO},
-    {"return", TOKEN_RETURN},
-    {"break", TOKEN_BREAK},
-    {"continue", TOKEN_CONTINUE},
-    {"switch", TOKEN_SWITCH},
-    {"case", TOKEN_CASE},
-    {"default", TOKEN_DEFAULT},
-    {"struct", TOKEN_STRUCT},
-    {"union", TOKEN_UNION},
-    {"enum", TOKEN_ENUM},
-    {"typedef", TOKEN_TYPEDEF},
-    {"static", TOKEN_STATIC},
-    {"extern", TOKEN_EXTERN},
-    {"const", TOKEN_CONST},
-    {"unsigned", TOKEN_UNSIGNED},
-    {"signed", TOKEN_SIGNED},
-    {"sizeof", TOKEN_SIZEOF},
-    {"auto", TOKEN_AUTO},
-    {"register", TOKEN_REGISTER},
-    {"volatile", TOKEN_VOLATILE},
-    {"goto", TOKEN_GOTO},
+    KEYWORD_ENTRY("int", 'i', 'n', 't', TOKEN_INT),
+    KEYWORD_ENTRY("float", 'f', 'l', 't', TOKEN_FLOAT),
+    KEYWORD_ENTRY("char", 'c', 'h', 'r', TOKEN_CHAR),
+    KEYWORD_ENTRY("double", 'd', 'o', 'e', TOKEN_DOUBLE),
+    KEYWORD_ENTRY("void", 'v', 'o', 'd', TOKEN_VOID),
+    KEYWORD_ENTRY("if", 'i', 'f', 'f', TOKEN_IF),
+    KEYWORD_ENTRY("else", 'e', 'l', 'e', TOKEN_ELSE),
+    KEYWORD_ENTRY("while", 'w', 'h', 'e', TOKEN_WHILE),
+    KEYWORD_ENTRY("for", 'f', 'o', 'r', TOKEN_FOR),
+    KEYWORD_ENTRY("do", 'd', 'o', 'o', TOKEN_DO),
+    KEYWORD_ENTRY("return", 'r', 'e', 'n', TOKEN_RETURN),
+    KEYWORD_ENTRY("break", 'b', 'r', 'k', TOKEN_BREAK),
+    KEYWORD_ENTRY("continue", 'c', 'o', 'e', TOKEN_CONTINUE),
+    KEYWORD_ENTRY("switch", 's', 'w', 'h', TOKEN_SWITCH),
+    KEYWORD_ENTRY("case", 'c', 'a', 'e', TOKEN_CASE),
+    KEYWORD_ENTRY("default", 'd', 'e', 't', TOKEN_DEFAULT),
+    KEYWORD_ENTRY("struct", 's', 't', 't', TOKEN_STRUCT),
+    KEYWORD_ENTRY("union", 'u', 'n', 'n', TOKEN_UNION),
+    KEYWORD_ENTRY("enum", 'e', 'n', 'm', TOKEN_ENUM),
+    KEYWORD_ENTRY("typedef", 't', 'y', 'f', TOKEN_TYPEDEF),
+    KEYWORD_ENTRY("static", 's', 't', 'c', TOKEN_STATIC),
+    KEYWORD_ENTRY("extern", 'e', 'x', 'n', TOKEN_EXTERN),
+    KEYWORD_ENTRY("const", 'c', 'o', 't', TOKEN_CONST),
+    KEYWORD_ENTRY("unsigned", 'u', 'n', 'd', TOKEN_UNSIGNED),
+    KEYWORD_ENTRY("signed", 's', 'i', 'd', TOKEN_SIGNED),
+    KEYWORD_ENTRY("sizeof", 's', 'i', 'f', TOKEN_SIZEOF),
+    KEYWORD_ENTRY("auto", 'a', 'u', 'o', TOKEN_AUTO),
+    KEYWORD_ENTRY("register", 'r', 'e', 'r', TOKEN_REGISTER),
+    KEYWORD_ENTRY("volatile", 'v', 'o', 'e', TOKEN_VOLATILE),
+    KEYWORD_ENTRY("goto", 'g', 'o', 'o', TOKEN_GOTO),
     // C11/C17 新增关键字
-    {"alignas", TOKEN_ALIGNAS},
-    {"_Alignas", TOKEN_ALIGNAS},
-    {"alignof", TOKEN_ALIGNOF},
-    {"_Alignof", TOKEN_ALIGNOF},
-    {"atomic", TOKEN_ATOMIC},
-    {"_Atomic", TOKEN_ATOMIC},
-    {"generic", TOKEN_GENERIC},
-    {"_Generic", TOKEN_GENERIC},
-    {"static_assert", TOKEN_STATIC_ASSERT},
-    {"_Static_assert", TOKEN_STATIC_ASSERT},
-    {"thread_local", TOKEN_THREAD_LOCAL},
-    {"_Thread_local", TOKEN_THREAD_LOCAL},
-    {"noreturn", TOKEN_NORETURN},
-    {"_Noreturn", TOKEN_NORETURN},
-    {NULL, TOKEN_IDENTIFIER}  // 哨兵值
+    KEYWORD_ENTRY("alignas", 'a', 'l', 's', TOKEN_ALIGNAS),
+    KEYWORD_ENTRY("_Alignas", '_', 'A', 's', TOKEN_ALIGNAS),
+    KEYWORD_ENTRY("alignof", 'a', 'l', 'f', TOKEN_ALIGNOF),
+    KEYWORD_ENTRY("_Alignof", '_', 'A', 'f', TOKEN_ALIGNOF),
+    KEYWORD_ENTRY("atomic", 'a', 't', 'c', TOKEN_ATOMIC),
+    KEYWORD_ENTRY("_Atomic", '_', 'A', 'c', TOKEN_ATOMIC),
+    KEYWORD_ENTRY("generic", 'g', 'e', 'c', TOKEN_GENERIC),
+    KEYWORD_ENTRY("_Generic", '_', 'G', 'c', TOKEN_GENERIC),
+    KEYWORD_ENTRY("static_assert", 's', 't', 't', TOKEN_STATIC_ASSERT),
+    KEYWORD_ENTRY("_Static_assert", '_', 'S', 't', TOKEN_STATIC_ASSERT),
+    KEYWORD_ENTRY("thread_local", 't', 'h', 'l', TOKEN_THREAD_LOCAL),
+    KEYWORD_ENTRY("_Thread_local", '_', 'T', 'l', TOKEN_THREAD_LOCAL),
+    KEYWORD_ENTRY("noreturn", 'n', 'o', 'n', TOKEN_NORETURN),
+    KEYWORD_ENTRY("_Noreturn", '_', 'N', 'n', TOKEN_NORETURN),
 };
 
-#define KEYWORD_COUNT (sizeof(keywordTable) / sizeof(KeywordEntry) - 1)
-
-/**
- * @brief 预处理指令映射表
- */
-static const PreprocessorDirectiveEntry preprocessorDirectiveTable[] = {
-    {"define", TOKEN_PREPROCESSOR_DEFINE},
-    {"undef", TOKEN_PREPROCESSOR_UNDEF},
-    {"include", TOKEN_PREPROCESSOR_INCLUDE},
-    {"if", TOKEN_PREPROCESSOR_IF},
-    {"ifdef", TOKEN_PREPROCESSOR_IFDEF},
-    {"ifndef", TOKEN_PREPROCESSOR_IFNDEF},
-    {"elif", TOKEN_PREPROCESSOR_ELIF},
-    {"else", TOKEN_PREPROCESSOR_ELSE},
-    {"endif", TOKEN_PREPROCESSOR_ENDIF},
-    {"line", TOKEN_PREPROCESSOR_LINE},
-    {"error", TOKEN_PREPROCESSOR_ERROR},
-    {"pragma", TOKEN_PREPROCESSOR_PRAGMA},
-    {"warning", TOKEN_PREPROCESSOR_WARNING},
-    {NULL, TOKEN_HASH}  // 哨兵值
-};
+/**
+ * @brief 预处理指令完美哈希，构造方式同关键字
+ */
+#define DIRECTIVE_HASH_SIZE 32
+#define DIRECTIVE_MAX_LENGTH 7
+#define DIRECTIVE_HASH(c0, c1, cl, len) \
+    (((unsigned)(c0) + (unsigned)(c1) * 2u + (unsigned)(cl) * 3u + (unsigned)(len)) \
+     & (DIRECTIVE_HASH_SIZE - 1))
+#define DIRECTIVE_ENTRY(str, c0, c1, cl, type) \
+    [DIRECTIVE_HASH(c0, c1, cl, sizeof(str) - 1)] = { str, sizeof(str) - 1, type }
 
-#define PREPROCESSOR_DIRECTIVE_COUNT (sizeof(preprocessorDirectiveTable) / sizeof(PreprocessorDirectiveEntry) - 1)
+/**
+ * @brief 预处理指令哈希表
+ */
+static const PreprocessorDirectiveEntry preprocessorDirectiveTable[DIRECTIVE_HASH_SIZE] = {
+    DIRECTIVE_ENTRY("define", 'd', 'e', 'e', TOKEN_PREPROCESSOR_DEFINE),
+    DIRECTIVE_ENTRY("undef", 'u', 'n', 'f', TOKEN_PREPROCESSOR_UNDEF),
+    DIRECTIVE_ENTRY("include", 'i', 'n', 'e', TOKEN_PREPROCESSOR_INCLUDE),
+    DIRECTIVE_ENTRY("if", 'i', 'f', 'f', TOKEN_PREPROCESSOR_IF),
+    DIRECTIVE_ENTRY("ifdef", 'i', 'f', 'f', TOKEN_PREPROCESSOR_IFDEF),
+    DIRECTIVE_ENTRY("ifndef", 'i', 'f', 'f', TOKEN_PREPROCESSOR_IFNDEF),
+    DIRECTIVE_ENTRY("elif", 'e', 'l', 'f', TOKEN_PREPROCESSOR_ELIF),
+    DIRECTIVE_ENTRY("else", 'e', 'l', 'e', TOKEN_PREPROCESSOR_ELSE),
+    DIRECTIVE_ENTRY("endif", 'e', 'n', 'f', TOKEN_PREPROCESSOR_ENDIF),
+    DIRECTIVE_ENTRY("line", 'l', 'i', 'e', TOKEN_PREPROCESSOR_LINE),
+    DIRECTIVE_ENTRY("error", 'e', 'r', 'r', TOKEN_PREPROCESSOR_ERROR),
+    DIRECTIVE_ENTRY("pragma", 'p', 'r', 'a', TOKEN_PREPROCESSOR_PRAGMA),
+    DIRECTIVE_ENTRY("warning", 'w', 'a', 'g', TOKEN_PREPROCESSOR_WARNING),
+};
 
 // ==================== 内部辅助函数 ====================
 
@@ -111,7 +137,11 @@ static const PreprocessorDirectiveEntry preprocessorDirectiveTable[] = {
  */
 static void lexerReportError(Lexer* lexer, LexerErrorType errorType,
                              SourceLocation location, const char* format, ...) {
-    if (!lexer || !lexer->diagnostics) {
+    if (!lexer) {
+        return;
+    }
+    lexer->errorCount++;
+    if (!lexer->diagnostics) {
         return;
     }
 
@@ -164,7 +194,11 @@ static void lexerReportError(Lexer* lexer, LexerErrorType errorType,
  */
 static void lexerReportWarning(Lexer* lexer, SourceLocation location,
                               const char* format, ...) {
-    if (!lexer || !lexer->diagnostics) {
+    if (!lexer) {
+        return;
+    }
+    lexer->warningCount++;
+    if (!lexer->diagnostics) {
         return;
     }
 
@@ -198,9 +232,7 @@ static void lexerReportWarning(Lexer* lexer, SourceLocation location,
  * @brief 获取当前字符
  */
 static inline char lexerCurrentChar(const Lexer* lexer) {
-    if (lexer->position >= lexer->sourceLength) {
-        return '\0';
-    }
+    // position不会越过sourceLength，缓冲区结尾的'\0'哨兵保证读取安全
     return lexer->source[lexer->position];
 }
 
@@ -229,17 +261,15 @@ static inline char lexerAdvance(Lexer* lexer) {
     if (lexer->position >= lexer->sourceLength) {
         return '\0';
     }
-    char ch = lexer->source[lexer->position++];
-    lexer->column++;
-
-    // 处理换行符
-    if (ch == '\n') {
-        lexer->line++;
-        lexer->column = 1;
-        lexer->lineStartOffset = lexer->position;
-    }
+    // 只前进偏移，行列号在输出诊断时由源管理器的行索引计算
+    return lexer->source[lexer->position++];
+}
 
-    return ch;
+/**
+ * @brief 一次前进到批量扫描停下的位置
+ */
+static inline void lexerAdvanceTo(Lexer* lexer, const char* target) {
+    lexer->position = (size_t)(target - lexer->source);
 }
 
 /**
@@ -274,63 +304,101 @@ static inline void lexerSkipChar(Lexer* lexer) {
  * @brief 创建当前源位置的Token位置信息
  */
 static inline SourceLocation lexerCreateCurrentLocation(const Lexer* lexer) {
-    return createSourceLocation(
-        lexer->filename,
-        (int)lexer->line,
-        (int)lexer->column,
-        (int)lexer->position
-    );
+    return createSourceLocation(lexer->fileId, (uint32_t)lexer->position);
 }
 
 // ==================== 构造函数和析构函数 ====================
 
 /**
- * @brief 从源代码字符串创建词法分析器
+ * @brief 在给定的源码缓冲区上初始化词法分析器
  */
-Lexer* createLexer(const char* source, const char* filename, DiagnosticEngine* diagnostics) {
-    if (!source) {
-        return NULL;
-    }
-
+static Lexer* lexerCreateWithBuffer(SourceBuffer* buffer, bool ownsBuffer,
+                                    const char* filename, DiagnosticEngine* diagnostics) {
     Lexer* lexer = (Lexer*)malloc(sizeof(Lexer));
     if (!lexer) {
         return NULL;
     }
 
-    // 复制源代码
-    lexer->source = strdup(source);
-    if (!lexer->source) {
-        free(lexer);
-        return NULL;
-    }
-    lexer->sourceLength = strlen(source);
+    // 直接引用缓冲区内容，不复制源码
+    lexer->sourceBuffer = buffer;
+    lexer->ownsSourceBuffer = ownsBuffer;
+    lexer->source = sourceBufferData(buffer);
+    lexer->sourceLength = sourceBufferLength(buffer);
 
     // 初始化位置信息
     lexer->position = 0;
-    lexer->line = 1;
-    lexer->column = 1;
-    lexer->lineStartOffset = 0;
 
-    // 设置文件名
-    lexer->filename = filename ? strdup(filename) : NULL;
+    // 每个缓冲区单独注册（同名或匿名的缓冲区不共用行索引），
+    // 位置信息只保存文件ID和偏移，行列号按需由源管理器计算
+    lexer->fileId = sourceManagerAddBuffer(filename);
+    sourceManagerSetFileContent(lexer->fileId, lexer->source, lexer->sourceLength);
 
     // 设置诊断引擎
     lexer->diagnostics = diagnostics;
 
     // 初始化关键字表（目前使用静态表，不需要动态创建）
     lexer->keywords = NULL;
+    lexer->interner = NULL;
+
+    // 字符串解码缓冲区在第一次遇到字符串字面量时分配
+    lexer->scratchBuffer = NULL;
+    lexer->scratchCapacity = 0;
+
+    // token内存池，持有lexerNextToken返回的全部token
+    lexer->tokenArena = createMemoryPool(0);
+    if (!lexer->tokenArena) {
+        free(lexer);
+        return NULL;
+    }
+    lexer->peekedToken = NULL;
+    lexer->peekedStart = 0;
+    lexer->peekedEnd = 0;
 
     // 初始化状态标志
     lexer->inPreprocessor = false;
     lexer->inComment = false;
-    lexer->supportUnicode = false;
+    lexer->supportUnicode = true;
     lexer->preserveComments = false;
 
+    lexer->errorCount = 0;
+    lexer->warningCount = 0;
+    lexer->sharesSource = false;
     lexer->privateData = NULL;
 
     return lexer;
 }
 
+/**
+ * @brief 从源代码字符串创建词法分析器
+ */
+Lexer* createLexer(const char* source, const char* filename, DiagnosticEngine* diagnostics) {
+    if (!source) {
+        return NULL;
+    }
+
+    // 调用者的字符串生命周期未知，复制一份
+    SourceBuffer* buffer = createSourceBufferCopy(source, strlen(source));
+    if (!buffer) {
+        return NULL;
+    }
+
+    Lexer* lexer = lexerCreateWithBuffer(buffer, true, filename, diagnostics);
+    if (!lexer) {
+        destroySourceBuffer(buffer);
+    }
+    return lexer;
+}
+
+/**
+ * @brief 借用已有源码缓冲区创建词法分析器
+ */
+Lexer* createLexerFromBuffer(SourceBuffer* buffer, const char* filename, DiagnosticEngine* diagnostics) {
+    if (!buffer || !sourceBufferData(buffer)) {
+        return NULL;
+    }
+    return lexerCreateWithBuffer(buffer, false, filename, diagnostics);
+}
+
 /**
  * @brief 从文件创建词法分析器
  */
@@ -339,39 +407,45 @@ Lexer* createLexerFromFile(const char* filename, DiagnosticEngine* diagnostics)
         return NULL;
     }
 
-    // 读取文件内容
-    FILE* file = fopen(filename, "r");
-    if (!file) {
+    // 优先内存映射，管道等不可映射的输入回退到读入
+    SourceBuffer* buffer = fileReaderOpen(filename, FILE_READ_AUTO);
+    if (!buffer) {
         return NULL;
     }
 
-    // 获取文件大小
-    fseek(file, 0, SEEK_END);
-    long fileSize = ftell(file);
-    fseek(file, 0, SEEK_SET);
+    Lexer* lexer = lexerCreateWithBuffer(buffer, true, filename, diagnostics);
+    if (!lexer) {
+        destroySourceBuffer(buffer);
+    }
+    return lexer;
+}
 
-    if (fileSize <= 0) {
-        fclose(file);
+/**
+ * @brief 创建共享同一份源码的词法分析器
+ */
+Lexer* createLexerView(const Lexer* lexer) {
+    if (!lexer) {
         return NULL;
     }
 
-    // 分配缓冲区读取文件
-    char* source = (char*)malloc(fileSize + 1);
-    if (!source) {
-        fclose(file);
+    Lexer* view = (Lexer*)calloc(1, sizeof(Lexer));
+    if (!view) {
+        return NULL;
+    }
+    view->tokenArena = createMemoryPool(0);
+    if (!view->tokenArena) {
+        free(view);
         return NULL;
     }
 
-    size_t readSize = fread(source, 1, fileSize, file);
-    source[readSize] = '\0';
-    fclose(file);
-
-    // 创建词法分析器
-    Lexer* lexer = createLexer(source, filename, diagnostics);
-    // lexer已经复制了source，释放临时缓冲区
-    free(source);
-
-    return lexer;
+    // 源码、文件ID都借用原词法分析器的，诊断只计数不输出
+    view->source = lexer->source;
+    view->sourceLength = lexer->sourceLength;
+    view->fileId = lexer->fileId;
+    view->sharesSource = true;
+    view->supportUnicode = lexer->supportUnicode;
+    view->preserveComments = lexer->preserveComments;
+    return view;
 }
 
 /**
@@ -379,12 +453,17 @@ Lexer* createLexerFromFile(const char* filename, DiagnosticEngine* diagnostics)
  */
 void destroyLexer(Lexer* lexer) {
     if (lexer) {
-        if (lexer->source) {
-            free(lexer->source);
+        // 源码即将失效，放弃源管理器中的表项（共享源码的由原词法分析器负责）；
+        // 没有其他持有者时表项随之释放，不会为此构建行索引
+        if (!lexer->sharesSource) {
+            sourceManagerReleaseFileContent(lexer->fileId, lexer->source);
+            sourceManagerReleaseBuffer(lexer->fileId);
         }
-        if (lexer->filename) {
-            free(lexer->filename);
+        if (lexer->ownsSourceBuffer) {
+            destroySourceBuffer(lexer->sourceBuffer);
         }
+        free(lexer->scratchBuffer);
+        destroyMemoryPool(lexer->tokenArena);
         // 关键字表是静态的，不需要释放
         if (lexer->privateData) {
             free(lexer->privateData);
@@ -399,17 +478,19 @@ void destroyLexer(Lexer* lexer) {
  * @brief 跳过空白字符
  */
 void lexerSkipWhitespace(Lexer* lexer) {
-    while (!lexerIsAtEnd(lexer)) {
-        char ch = lexerCurrentChar(lexer);
+    const char* end = lexer->source + lexer->sourceLength;
 
-        // 处理空白字符
-        if (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n' || ch == '\v' || ch == '\f') {
-            lexerAdvance(lexer);
+    while (!lexerIsAtEnd(lexer)) {
+        // 批量跳过连续的空白字符
+        const char* cursor = lexer->source + lexer->position;
+        const char* stop = simdSkipWhitespace(cursor, end);
+        if (stop != cursor) {
+            lexerAdvanceTo(lexer, stop);
             continue;
         }
 
         // 处理反斜杠换行（续行）
-        if (ch == '\\' && lexerPeekNext(lexer) == '\n') {
+        if (lexerCurrentChar(lexer) == '\\' && lexerPeekNext(lexer) == '\n') {
             lexerAdvance(lexer);  // 跳过反斜杠
             lexerAdvance(lexer);  // 跳过换行
             continue;
@@ -419,6 +500,14 @@ void lexerSkipWhitespace(Lexer* lexer) {
     }
 }
 
+/**
+ * @brief 前进到行尾的换行符（不跳过换行）
+ */
+static void lexerSkipToLineEnd(Lexer* lexer) {
+    lexerAdvanceTo(lexer, simdFindLineEnd(lexer->source + lexer->position,
+                                          lexer->source + lexer->sourceLength));
+}
+
 /**
  * @brief 跳过单行注释
  */
@@ -427,10 +516,7 @@ static void lexerSkipLineComment(Lexer* lexer) {
     lexerAdvance(lexer);
     lexerAdvance(lexer);
 
-    // 跳过直到行尾
-    while (!lexerIsAtEnd(lexer) && lexerCurrentChar(lexer) != '\n') {
-        lexerAdvance(lexer);
-    }
+    lexerSkipToLineEnd(lexer);
 }
 
 /**
@@ -440,31 +526,20 @@ static void lexerSkipLineComment(Lexer* lexer) {
 static bool lexerSkipBlockComment(Lexer* lexer) {
     // 跳过 /*
     size_t startOffset = lexer->position;
-    size_t startLine = lexer->line;
-    size_t startColumn = lexer->column;
     lexerAdvance(lexer);
     lexerAdvance(lexer);
 
-    while (!lexerIsAtEnd(lexer)) {
-        char ch = lexerCurrentChar(lexer);
-
-        // 检查注释结束
-        if (ch == '*' && lexerPeekNext(lexer) == '/') {
-            lexerAdvance(lexer);  // 跳过 *
-            lexerAdvance(lexer);  // 跳过 /
-            return true;
-        }
-
-        lexerAdvance(lexer);
+    // 批量查找注释结束标记
+    const char* end = lexer->source + lexer->sourceLength;
+    const char* terminator = simdFindBlockCommentEnd(lexer->source + lexer->position, end);
+    if (terminator != end) {
+        lexerAdvanceTo(lexer, terminator + 2);
+        return true;
     }
+    lexerAdvanceTo(lexer, end);
 
     // 注释未闭合 - 报告错误
-    SourceLocation location = createSourceLocation(
-        lexer->filename,
-        (int)startLine,
-        (int)startColumn,
-        (int)startOffset
-    );
+    SourceLocation location = createSourceLocation(lexer->fileId, (uint32_t)startOffset);
     lexerReportError(lexer, LEX_ERROR_UNTERMINATED_COMMENT, location,
                     "unterminated block comment");
 
@@ -476,7 +551,7 @@ static bool lexerSkipBlockComment(Lexer* lexer) {
  */
 bool lexerSkipComment(Lexer* lexer) {
     if (lexerIsAtEnd(lexer)) {
-        return true;
+        return false;
     }
 
     char ch = lexerCurrentChar(lexer);
@@ -499,388 +574,316 @@ bool lexerSkipComment(Lexer* lexer) {
 // ==================== 标识符和关键字识别 ====================
 
 /**
- * @brief 检查字符串是否为关键字
+ * @brief 在源码切片上查找关键字（不要求以'\0'结尾，不分配内存）
  */
-TokenType lexerIsKeyword(const Lexer* lexer, const char* str) {
-    if (!str) {
+TokenType lexerLookupKeyword(const char* str, size_t length) {
+    if (!str || length < 2 || length > KEYWORD_MAX_LENGTH) {
         return TOKEN_IDENTIFIER;
     }
 
-    // 线性搜索关键字表
-    for (size_t i = 0; i < KEYWORD_COUNT; i++) {
-        if (strcmp(keywordTable[i].keyword, str) == 0) {
-            return keywordTable[i].tokenType;
-        }
+    const unsigned char* bytes = (const unsigned char*)str;
+    const KeywordEntry* entry = &keywordTable[KEYWORD_HASH(bytes[0], bytes[1], bytes[length - 1], length)];
+    if (entry->length == length && memcmp(entry->keyword, str, length) == 0) {
+        return entry->tokenType;
     }
 
     return TOKEN_IDENTIFIER;
 }
 
 /**
- * @brief 读取标识符
+ * @brief 检查字符串是否为关键字
  */
-static Token lexerReadIdentifier(Lexer* lexer) {
-    size_t start = lexer->position;
-    size_t startColumn = lexer->column;
-    size_t startLine = lexer->line;
-    size_t startOffset = lexer->position;
-
-    // 标识符以字母或下划线开头
-    char ch = lexerCurrentChar(lexer);
-    if (isalpha(ch) || ch == '_') {
-        lexerAdvance(lexer);
-    }
-
-    // 后续字符可以是字母、数字或下划线
-    while (!lexerIsAtEnd(lexer)) {
-        ch = lexerCurrentChar(lexer);
-        if (isalnum(ch) || ch == '_') {
-            lexerAdvance(lexer);
-        } else {
-            break;
-        }
-    }
-
-    // 提取标识符字符串
-    size_t length = lexer->position - start;
-    char* lexeme = (char*)malloc(length + 1);
-    if (!lexeme) {
-        return *createEOFToken(lexerCreateCurrentLocation(lexer));
-    }
-    memcpy(lexeme, lexer->source + start, length);
-    lexeme[length] = '\0';
-
-    // 检查是否为关键字
-    TokenType type = lexerIsKeyword(lexer, lexeme);
-
-    // 创建源位置
-    SourceLocation location = createSourceLocation(
-        lexer->filename,
-        (int)startLine,
-        (int)startColumn,
-        (int)startOffset
-    );
-
-    Token* token = createToken(type, lexeme, location);
-    free(lexeme);
-
-    if (token) {
-        return *token;
+TokenType lexerIsKeyword(const Lexer* lexer, const char* str) {
+    (void)lexer;
+    if (!str) {
+        return TOKEN_IDENTIFIER;
     }
-    return *createEOFToken(location);
+    return lexerLookupKeyword(str, strlen(str));
 }
 
-// ==================== 预处理指令识别 ====================
-
 /**
- * @brief 检查字符串是否为预处理指令
+ * @brief 通用字符名表示的码点是否合法（C11 6.4.3）
+ *
+ * 不能是代理区码点，也不能小于U+00A0（'$'、'@'、'`'除外）。
  */
-static TokenType lexerIsPreprocessorDirective(const char* str) {
-    if (!str) {
-        return TOKEN_IDENTIFIER;
-    }
-
-    // 线性搜索预处理指令表
-    for (size_t i = 0; i < PREPROCESSOR_DIRECTIVE_COUNT; i++) {
-        if (strcmp(preprocessorDirectiveTable[i].directive, str) == 0) {
-            return preprocessorDirectiveTable[i].tokenType;
-        }
+static bool lexerIsValidUniversalCharacter(uint32_t codePoint) {
+    if (codePoint < 0xA0) {
+        return codePoint == 0x24 || codePoint == 0x40 || codePoint == 0x60;
     }
-
-    return TOKEN_IDENTIFIER;
+    return codePoint <= UNICODE_MAX_CODE_POINT && (codePoint < 0xD800 || codePoint > 0xDFFF);
 }
 
 /**
- * @brief 读取预处理指令
+ * @brief 读取通用字符名\uhhhh或\Uhhhhhhhh
+ * @param p 反斜杠的位置
+ * @param end 输入结束位置
+ * @param codePoint 输出码点（未检查是否合法）
+ * @return 消耗的字节数，不是完整的通用字符名时返回0
  */
-static Token lexerReadPreprocessorDirective(Lexer* lexer) {
-    size_t startColumn = lexer->column;
-    size_t startLine = lexer->line;
-    size_t startOffset = lexer->position;
-
-    // 跳过 #
-    lexerAdvance(lexer);
-
-    // 跳过 # 后的空白
-    lexerSkipWhitespace(lexer);
-
-    // 读取指令名称
-    size_t directiveStart = lexer->position;
-    while (!lexerIsAtEnd(lexer) && isalpha(lexerCurrentChar(lexer))) {
-        lexerAdvance(lexer);
-    }
-
-    // 提取指令名称
-    size_t directiveLength = lexer->position - directiveStart;
-    char* directive = (char*)malloc(directiveLength + 1);
-    if (!directive) {
-        return *createEOFToken(lexerCreateCurrentLocation(lexer));
+static size_t lexerReadUniversalCharacterName(const char* p, const char* end, uint32_t* codePoint) {
+    if (end - p < 2 || p[0] != '\\' || (p[1] != 'u' && p[1] != 'U')) {
+        return 0;
     }
-    memcpy(directive, lexer->source + directiveStart, directiveLength);
-    directive[directiveLength] = '\0';
 
-    // 检查是否为已知预处理指令
-    TokenType type = lexerIsPreprocessorDirective(directive);
-
-    // 创建源位置
-    SourceLocation location = createSourceLocation(
-        lexer->filename,
-        (int)startLine,
-        (int)startColumn,
-        (int)startOffset
-    );
-
-    // 读取整行作为词素
-    while (!lexerIsAtEnd(lexer) && lexerCurrentChar(lexer) != '\n') {
-        lexerAdvance(lexer);
-    }
-
-    size_t lexemeLength = lexer->position - startOffset;
-    char* lexeme = (char*)malloc(lexemeLength + 1);
-    if (lexeme) {
-        memcpy(lexeme, lexer->source + startOffset, lexemeLength);
-        lexeme[lexemeLength] = '\0';
+    size_t digits = p[1] == 'u' ? 4 : 8;
+    if ((size_t)(end - p) < 2 + digits) {
+        return 0;
     }
 
-    Token* token = createToken(type, lexeme ? lexeme : directive, location);
-    free(directive);
-    if (lexeme) free(lexeme);
-
-    if (token) {
-        return *token;
+    uint32_t value = 0;
+    for (size_t i = 0; i < digits; i++) {
+        char ch = p[2 + i];
+        if (!charIsHexDigit(ch)) {
+            return 0;
+        }
+        value = value * 16 + (uint32_t)charHexValue(ch);
     }
-    return *createEOFToken(location);
+    *codePoint = value;
+    return 2 + digits;
 }
 
-// ==================== 数字字面量识别 ====================
-
 /**
- * @brief 读取数字前缀（0x, 0b, 0等）
+ * @brief 匹配一个非ASCII的标识符字符（UTF-8字符或通用字符名）
+ * @param p 字符的位置（0x80及以上的字节或反斜杠）
+ * @param end 输入结束位置
+ * @param isStart true时要求XID_Start，否则要求XID_Continue
+ * @return 消耗的字节数，不能出现在标识符的这个位置时返回0
  */
-static int lexerDetectNumberBase(Lexer* lexer) {
-    char ch = lexerCurrentChar(lexer);
-    char next = lexerPeekNext(lexer);
-
-    // 检查十六进制前缀 0x 或 0X
-    if (ch == '0' && (next == 'x' || next == 'X')) {
-        lexerAdvance(lexer);  // 跳过 0
-        lexerAdvance(lexer);  // 跳过 x/X
-        return 16;
-    }
-
-    // 检查二进制前缀 0b 或 0B (C23)
-    if (ch == '0' && (next == 'b' || next == 'B')) {
-        lexerAdvance(lexer);  // 跳过 0
-        lexerAdvance(lexer);  // 跳过 b/B
-        return 2;
-    }
-
-    // 检查八进制前缀 0
-    if (ch == '0' && isdigit(next)) {
-        lexerAdvance(lexer);  // 跳过 0
-        return 8;
+static size_t lexerMatchUnicodeIdentifierChar(const char* p, const char* end, bool isStart) {
+    uint32_t codePoint;
+    size_t length;
+    if (*p == '\\') {
+        length = lexerReadUniversalCharacterName(p, end, &codePoint);
+        if (length == 0 || !lexerIsValidUniversalCharacter(codePoint)) {
+            return 0;
+        }
+    } else {
+        length = unicodeDecodeUtf8(p, end, &codePoint);
+        if (length == 0) {
+            return 0;
+        }
     }
 
-    return 10;  // 默认十进制
+    bool allowed = isStart ? unicodeIsIdentifierStart(codePoint)
+                           : unicodeIsIdentifierContinue(codePoint);
+    return allowed ? length : 0;
 }
 
 /**
- * @brief 读取整数字面量
+ * @brief 扫描标识符首字符之后的部分并确定token类型
  */
-static Token lexerReadInteger(Lexer* lexer, int base) {
-    size_t start = lexer->position;
-    size_t startColumn = lexer->column;
-    size_t startLine = lexer->line;
-    size_t startOffset = lexer->position;
-
-    // 读取数字
-    while (!lexerIsAtEnd(lexer)) {
-        char ch = lexerCurrentChar(lexer);
-
-        // 根据进制判断有效字符
-        bool valid = false;
-        if (base == 16) {
-            valid = isxdigit(ch);
-        } else if (base == 10) {
-            valid = isdigit(ch);
-        } else if (base == 8) {
-            valid = (ch >= '0' && ch <= '7');
-        } else if (base == 2) {
-            valid = (ch == '0' || ch == '1');
-        }
-
-        if (!valid) {
+static void lexerFinishIdentifier(Lexer* lexer, size_t start, LexedToken* out) {
+    const char* end = lexer->source + lexer->sourceLength;
+
+    for (;;) {
+        // 字母、数字和下划线批量跳过，纯ASCII的标识符在这里一次扫描完
+        const char* p = simdSkipIdentifierChars(lexer->source + lexer->position, end);
+        lexerAdvanceTo(lexer, p);
+        if (p == end || !lexer->supportUnicode || charKind(*p) != CHAR_KIND_UNICODE_START) {
             break;
         }
-        lexerAdvance(lexer);
-    }
 
-    // 检查类型后缀 (u, l, ll, ul, ull 等)
-    while (!lexerIsAtEnd(lexer)) {
-        char ch = tolower(lexerCurrentChar(lexer));
-        if (ch == 'u' || ch == 'l') {
-            lexerAdvance(lexer);
-        } else {
+        size_t length = lexerMatchUnicodeIdentifierChar(p, end, false);
+        if (length == 0) {
             break;
         }
+        lexerAdvanceTo(lexer, p + length);
+        out->flags |= TOKEN_FLAG_UNICODE;
     }
 
-    // 提取数字字符串
-    size_t length = lexer->position - start;
-    char* lexeme = (char*)malloc(length + 1);
-    if (!lexeme) {
-        return *createEOFToken(lexerCreateCurrentLocation(lexer));
+    // 关键字都是ASCII，含Unicode字符的一定是普通标识符
+    if (out->flags & TOKEN_FLAG_UNICODE) {
+        out->type = TOKEN_IDENTIFIER;
+    } else {
+        // 直接在源码切片上检查是否为关键字
+        out->type = lexerLookupKeyword(lexer->source + start, lexer->position - start);
     }
-    memcpy(lexeme, lexer->source + start, length);
-    lexeme[length] = '\0';
-
-    // 创建源位置
-    SourceLocation location = createSourceLocation(
-        lexer->filename,
-        (int)startLine,
-        (int)startColumn,
-        (int)startOffset
-    );
+}
 
-    Token* token = createIntegerToken(lexeme, location, base);
-    free(lexeme);
+/**
+ * @brief 扫描标识符或关键字
+ */
+static void lexerScanIdentifier(Lexer* lexer, LexedToken* out) {
+    size_t start = lexer->position;
 
-    if (token) {
-        return *token;
-    }
-    return *createEOFToken(location);
+    // 标识符以字母或下划线开头
+    lexerAdvance(lexer);
+    lexerFinishIdentifier(lexer, start, out);
 }
 
 /**
- * @brief 读取浮点数字面量
+ * @brief 扫描以0x80及以上的字节或反斜杠开头的token
+ *
+ * 能作为标识符首字符（XID_Start）的UTF-8字符或通用字符名开始一个标识符；
+ * 其余合法字符整个作为一个未知token，非法的UTF-8字节报错后按单字节跳过。
+ * 关闭Unicode支持时逐字节作为未知token。
  */
-static Token lexerReadFloat(Lexer* lexer) {
-    size_t start = lexer->position;
-    size_t startColumn = lexer->column;
-    size_t startLine = lexer->line;
-    size_t startOffset = lexer->position;
+static void lexerScanUnicodeStart(Lexer* lexer, LexedToken* out) {
+    const char* p = lexer->source + lexer->position;
+    const char* end = lexer->source + lexer->sourceLength;
+    out->type = TOKEN_UNKNOWN;
 
-    // 读取整数部分
-    while (!lexerIsAtEnd(lexer) && isdigit(lexerCurrentChar(lexer))) {
+    if (!lexer->supportUnicode) {
         lexerAdvance(lexer);
+        return;
     }
 
-    // 读取小数点
-    if (lexerCurrentChar(lexer) == '.') {
-        lexerAdvance(lexer);
-
-        // 读取小数部分
-        while (!lexerIsAtEnd(lexer) && isdigit(lexerCurrentChar(lexer))) {
-            lexerAdvance(lexer);
-        }
+    size_t length = lexerMatchUnicodeIdentifierChar(p, end, true);
+    if (length > 0) {
+        lexerAdvanceTo(lexer, p + length);
+        out->flags |= TOKEN_FLAG_UNICODE;
+        lexerFinishIdentifier(lexer, (size_t)(p - lexer->source), out);
+        return;
     }
 
-    // 读取指数部分
-    char ch = lexerCurrentChar(lexer);
-    if (ch == 'e' || ch == 'E') {
-        lexerAdvance(lexer);
-
-        // 检查可选的正负号
-        if (lexerCurrentChar(lexer) == '+' || lexerCurrentChar(lexer) == '-') {
-            lexerAdvance(lexer);
+    uint32_t codePoint;
+    SourceLocation location = lexerCreateCurrentLocation(lexer);
+    if (*p == '\\') {
+        length = lexerReadUniversalCharacterName(p, end, &codePoint);
+        if (length > 0 && !lexerIsValidUniversalCharacter(codePoint)) {
+            lexerReportError(lexer, LEX_ERROR_INVALID_UNICODE, location,
+                             "universal character name \\U%08X is not valid", codePoint);
         }
-
-        // 读取指数数字
-        while (!lexerIsAtEnd(lexer) && isdigit(lexerCurrentChar(lexer))) {
-            lexerAdvance(lexer);
+    } else {
+        length = unicodeDecodeUtf8(p, end, &codePoint);
+        if (length == 0) {
+            lexerReportError(lexer, LEX_ERROR_INVALID_UNICODE, location,
+                             "invalid UTF-8 byte 0x%02X", (unsigned)(unsigned char)*p);
         }
     }
+    lexerAdvanceTo(lexer, p + (length > 0 ? length : 1));
+}
 
-    // 检查类型后缀 (f, l, F, L)
-    ch = tolower(lexerCurrentChar(lexer));
-    if (ch == 'f' || ch == 'l') {
-        lexerAdvance(lexer);
-    }
+// ==================== 预处理指令识别 ====================
 
-    // 提取数字字符串
-    size_t length = lexer->position - start;
-    char* lexeme = (char*)malloc(length + 1);
-    if (!lexeme) {
-        return *createEOFToken(lexerCreateCurrentLocation(lexer));
+/**
+ * @brief 在源码切片上查找预处理指令
+ */
+static TokenType lexerIsPreprocessorDirective(const char* str, size_t length) {
+    if (!str || length < 2 || length > DIRECTIVE_MAX_LENGTH) {
+        return TOKEN_IDENTIFIER;
     }
-    memcpy(lexeme, lexer->source + start, length);
-    lexeme[length] = '\0';
-
-    // 创建源位置
-    SourceLocation location = createSourceLocation(
-        lexer->filename,
-        (int)startLine,
-        (int)startColumn,
-        (int)startOffset
-    );
-
-    Token* token = createFloatToken(lexeme, location);
-    free(lexeme);
 
-    if (token) {
-        return *token;
+    const unsigned char* bytes = (const unsigned char*)str;
+    const PreprocessorDirectiveEntry* entry =
+        &preprocessorDirectiveTable[DIRECTIVE_HASH(bytes[0], bytes[1], bytes[length - 1], length)];
+    if (entry->length == length && memcmp(entry->directive, str, length) == 0) {
+        return entry->tokenType;
     }
-    return *createEOFToken(location);
+
+    return TOKEN_IDENTIFIER;
 }
 
 /**
- * @brief 读取数字字面量
+ * @brief 扫描预处理指令（整行作为一个token）
  */
-static Token lexerReadNumber(Lexer* lexer) {
-    // 检测进制
-    int base = lexerDetectNumberBase(lexer);
-
-    // 回退一位，重新检查
-    if (base != 10) {
-        size_t oldPos = lexer->position;
-        size_t oldCol = lexer->column;
-        size_t oldLine = lexer->line;
-
-        // 尝试读取为整数
-        Token token = lexerReadInteger(lexer, base);
+static void lexerScanPreprocessorDirective(Lexer* lexer, LexedToken* out) {
+    // 跳过 #
+    lexerAdvance(lexer);
 
-        // 检查是否有小数点（可能是浮点数）
-        if (lexerCurrentChar(lexer) == '.') {
-            // 回退，重新解析为浮点数
-            lexer->position = oldPos - 2;
-            lexer->column = oldCol;
-            lexer->line = oldLine;
-            return lexerReadFloat(lexer);
-        }
+    // 跳过 # 后的空白
+    lexerSkipWhitespace(lexer);
 
-        return token;
+    // 读取指令名称
+    size_t directiveStart = lexer->position;
+    while (!lexerIsAtEnd(lexer) && charIsIdentifierStart(lexerCurrentChar(lexer))) {
+        lexerAdvance(lexer);
     }
 
-    // 十进制数可能是整数或浮点数
-    // 向前查看判断是否有小数点或科学计数法
-    size_t lookahead = lexer->position;
-    bool isFloat = false;
+    // 检查是否为已知预处理指令
+    size_t directiveLength = lexer->position - directiveStart;
+    out->type = lexerIsPreprocessorDirective(lexer->source + directiveStart, directiveLength);
+    out->flags |= TOKEN_FLAG_PREPROCESSOR;
 
-    while (lookahead < lexer->sourceLength && isdigit(lexer->source[lookahead])) {
-        lookahead++;
-    }
+    // 读取整行作为词素
+    lexerSkipToLineEnd(lexer);
+}
+
+// ==================== 数字字面量识别 ====================
 
-    if (lookahead < lexer->sourceLength) {
-        char ch = lexer->source[lookahead];
-        if (ch == '.' || ch == 'e' || ch == 'E') {
-            isFloat = true;
+/**
+ * @brief 扫描数字字面量
+ *
+ * 由numberParseLiteral一趟完成扫描和求值，不复制词素，也不再调用strtoll/strtod。
+ */
+static void lexerScanNumber(Lexer* lexer, LexedToken* out) {
+    NumberLiteral literal;
+    size_t length = numberParseLiteral(lexer->source + lexer->position,
+                                       lexer->source + lexer->sourceLength, &literal);
+    // 数字字面量不会跨行，直接跳到末尾
+    lexer->position += length;
+
+    out->hasValue = true;
+    if (literal.isFloat) {
+        out->type = TOKEN_FLOAT_LITERAL;
+        out->value.floatValue = literal.floatValue;
+        out->literalType = literal.isFloatSuffix ? LITERAL_TYPE_FLOAT : LITERAL_TYPE_DOUBLE;
+        if (literal.isLongDouble) {
+            out->flags |= TOKEN_FLAG_LONG;
+        }
+    } else {
+        out->type = TOKEN_INTEGER_LITERAL;
+        // 超出long long范围的无符号值按位保存，由语义分析按后缀解释
+        out->value.intValue = (long long)literal.intValue;
+        switch (literal.base) {
+            case 16: out->literalType = LITERAL_TYPE_HEXADECIMAL; break;
+            case 8:  out->literalType = LITERAL_TYPE_OCTAL; break;
+            case 2:  out->literalType = LITERAL_TYPE_BINARY; break;
+            default: out->literalType = LITERAL_TYPE_DECIMAL; break;
+        }
+        if (literal.isUnsigned) {
+            out->flags |= TOKEN_FLAG_UNSIGNED;
+        }
+        if (literal.longCount == 1) {
+            out->flags |= TOKEN_FLAG_LONG;
+        } else if (literal.longCount == 2) {
+            out->flags |= TOKEN_FLAG_LONG_LONG;
         }
     }
 
-    if (isFloat) {
-        return lexerReadFloat(lexer);
+    if (literal.status == NUMBER_PARSE_OK) {
+        return;
     }
 
-    return lexerReadInteger(lexer, 10);
+    SourceLocation location = createSourceLocation(lexer->fileId, (uint32_t)out->offset);
+    int lexemeLength = (int)length;
+    const char* lexeme = lexer->source + out->offset;
+    switch (literal.status) {
+        case NUMBER_PARSE_OVERFLOW:
+            lexerReportWarning(lexer, location, "integer literal '%.*s' is too large",
+                               lexemeLength, lexeme);
+            break;
+        case NUMBER_PARSE_NO_DIGITS:
+            lexerReportError(lexer, LEX_ERROR_INVALID_NUMBER_FORMAT, location,
+                             "missing digits in numeric literal '%.*s'", lexemeLength, lexeme);
+            break;
+        case NUMBER_PARSE_INVALID_DIGIT:
+            lexerReportError(lexer, LEX_ERROR_INVALID_NUMBER_FORMAT, location,
+                             "invalid digit in numeric literal '%.*s'", lexemeLength, lexeme);
+            break;
+        case NUMBER_PARSE_INVALID_SUFFIX:
+            lexerReportError(lexer, LEX_ERROR_INVALID_NUMBER_FORMAT, location,
+                             "invalid suffix on numeric literal '%.*s'", lexemeLength, lexeme);
+            break;
+        default:
+            break;
+    }
 }
 
 // ==================== 字符和字符串字面量识别 ====================
 
 /**
  * @brief 处理转义序列
+ *
+ * @param lexer 词法分析器，当前字符为反斜杠
+ * @param success 输出转义序列是否合法
+ * @param isUniversal 输出是否为通用字符名（此时返回值是码点，否则是一个字节的值）
+ * @return 转义得到的值
  */
-static char lexerProcessEscapeSequence(Lexer* lexer, bool* success) {
+static uint32_t lexerProcessEscapeSequence(Lexer* lexer, bool* success, bool* isUniversal) {
     *success = true;
+    *isUniversal = false;
+    size_t escapeStart = lexer->position;
     lexerAdvance(lexer);  // 跳过反斜杠
 
     if (lexerIsAtEnd(lexer)) {
@@ -918,7 +921,7 @@ static char lexerProcessEscapeSequence(Lexer* lexer, bool* success) {
                     break;
                 }
             }
-            return (char)value;
+            return (uint32_t)value;
         }
 
         // 十六进制转义 \xhh
@@ -929,75 +932,117 @@ static char lexerProcessEscapeSequence(Lexer* lexer, bool* success) {
             int count = 0;
             while (count < 2 && !lexerIsAtEnd(lexer)) {
                 ch = lexerCurrentChar(lexer);
-                if (isxdigit(ch)) {
-                    value = value * 16 + (isdigit(ch) ? (ch - '0') : (tolower(ch) - 'a' + 10));
+                if (charIsHexDigit(ch)) {
+                    value = value * 16 + charHexValue(ch);
                     lexerAdvance(lexer);
                     count++;
                 } else {
                     break;
                 }
             }
-            return (char)value;
+            return (uint32_t)value;
         }
 
-        // Unicode转义 \uhhhh 或 \Uhhhhhhhh
+        // 通用字符名 \uhhhh 或 \Uhhhhhhhh
         case 'u':
         case 'U': {
-            // 简化处理，跳过Unicode转义
-            lexerAdvance(lexer);
-            int maxDigits = (ch == 'u') ? 4 : 8;
-            for (int i = 0; i < maxDigits && !lexerIsAtEnd(lexer); i++) {
-                if (isxdigit(lexerCurrentChar(lexer))) {
+            SourceLocation location = createSourceLocation(lexer->fileId, (uint32_t)escapeStart);
+            uint32_t codePoint = 0;
+            size_t length = lexerReadUniversalCharacterName(lexer->source + escapeStart,
+                                                           lexer->source + lexer->sourceLength,
+                                                           &codePoint);
+            if (length == 0) {
+                // 十六进制数字不够，跳过已有的数字
+                lexerAdvance(lexer);
+                while (!lexerIsAtEnd(lexer) && charIsHexDigit(lexerCurrentChar(lexer)) &&
+                       lexer->position - escapeStart < ((ch == 'u') ? 6u : 10u)) {
                     lexerAdvance(lexer);
                 }
+                lexerReportError(lexer, LEX_ERROR_INVALID_UNICODE, location,
+                                 "incomplete universal character name");
+                *success = false;
+                return '?';
+            }
+
+            lexer->position = escapeStart + length;
+            if (!lexerIsValidUniversalCharacter(codePoint)) {
+                lexerReportError(lexer, LEX_ERROR_INVALID_UNICODE, location,
+                                 "universal character name \\U%08X is not valid", codePoint);
+                *success = false;
+                return '?';
             }
-            return '?';  // 占位符
+            *isUniversal = true;
+            return codePoint;
         }
 
         default:
             *success = false;
             lexerAdvance(lexer);
-            return ch;
+            return (unsigned char)ch;
     }
 }
 
 /**
- * @brief 读取字符字面量
+ * @brief 读取字面量中的一个非ASCII字符
+ *
+ * 合法的UTF-8字符整个读入；非法字节报错后按单字节读入。
+ * 关闭Unicode支持时总是按单字节读入。
+ *
+ * @param lexer 词法分析器，当前字节>=0x80
+ * @param codePoint 输出码点（单字节读入时为该字节的值）
+ * @return 读入的字节数
  */
-static Token lexerReadChar(Lexer* lexer) {
-    size_t startColumn = lexer->column;
-    size_t startLine = lexer->line;
-    size_t startOffset = lexer->position;
-    bool isWide = false;
-
-    // 检查宽字符前缀 L
-    if (lexerCurrentChar(lexer) == 'L') {
-        isWide = true;
-        lexerAdvance(lexer);
+static size_t lexerReadLiteralUtf8(Lexer* lexer, uint32_t* codePoint) {
+    const char* p = lexer->source + lexer->position;
+    size_t length = 0;
+    if (lexer->supportUnicode) {
+        length = unicodeDecodeUtf8(p, lexer->source + lexer->sourceLength, codePoint);
+        if (length == 0) {
+            lexerReportError(lexer, LEX_ERROR_INVALID_UNICODE, lexerCreateCurrentLocation(lexer),
+                             "invalid UTF-8 byte 0x%02X", (unsigned)(unsigned char)*p);
+        }
     }
+    if (length == 0) {
+        *codePoint = (unsigned char)*p;
+        length = 1;
+    }
+    lexer->position += length;
+    return length;
+}
 
-    // 跳过开引号
-    lexerAdvance(lexer);
+/**
+ * @brief 扫描字符字面量
+ *
+ * 普通字符常量的值是一个字节，保存在charValue中；L、u、U前缀的字符常量
+ * 的值是码点，保存在intValue中。
+ *
+ * @param lexer 词法分析器
+ * @param out 输出token
+ * @param literalType 由编码前缀决定的字面量类型
+ * @param prefixLength 编码前缀的长度
+ */
+static void lexerScanChar(Lexer* lexer, LexedToken* out, LiteralType literalType, size_t prefixLength) {
+    SourceLocation location = lexerCreateCurrentLocation(lexer);
 
-    if (lexerIsAtEnd(lexer)) {
-        SourceLocation loc = createSourceLocation(
-            lexer->filename,
-            (int)startLine,
-            (int)startColumn,
-            (int)startOffset
-        );
-        return *createEOFToken(loc);
-    }
+    // 跳过编码前缀和开引号
+    lexer->position += prefixLength;
+    lexerAdvance(lexer);
 
     // 读取字符内容
-    char value = '\0';
-    bool success = true;
-
-    if (lexerCurrentChar(lexer) == '\\') {
-        value = lexerProcessEscapeSequence(lexer, &success);
-    } else {
-        value = lexerCurrentChar(lexer);
-        lexerAdvance(lexer);
+    uint32_t value = 0;
+    bool multiByte = false;
+    if (!lexerIsAtEnd(lexer)) {
+        bool success = true;
+        char ch = lexerCurrentChar(lexer);
+        if (ch == '\\') {
+            value = lexerProcessEscapeSequence(lexer, &success, &multiByte);
+            out->flags |= TOKEN_FLAG_ESCAPE_SEQUENCE;
+        } else if ((unsigned char)ch >= 0x80) {
+            multiByte = lexerReadLiteralUtf8(lexer, &value) > 1;
+        } else {
+            value = (unsigned char)ch;
+            lexerAdvance(lexer);
+        }
     }
 
     // 跳过闭引号
@@ -1005,62 +1050,92 @@ static Token lexerReadChar(Lexer* lexer) {
         lexerAdvance(lexer);
     }
 
-    // 创建源位置
-    SourceLocation location = createSourceLocation(
-        lexer->filename,
-        (int)startLine,
-        (int)startColumn,
-        (int)startOffset
-    );
-
-    // 构造词素
-    char lexeme[4] = { '\0', '\0', '\0', '\0' };
-    lexeme[0] = '\'';
-    if (isWide) {
-        lexeme[0] = 'L';
-        lexeme[1] = '\'';
-        lexeme[2] = value;
-        lexeme[3] = '\'';
+    out->type = TOKEN_CHAR_LITERAL;
+    out->hasValue = true;
+    out->isWide = literalType == LITERAL_TYPE_WCHAR;
+    out->literalType = literalType;
+
+    if (literalType == LITERAL_TYPE_CHAR) {
+        // 普通字符常量按UTF-8编码后不止一个字节，只保留码点的低8位
+        if (multiByte && value > 0x7F) {
+            lexerReportWarning(lexer, location, "multi-character character constant");
+        }
+        out->value.charValue = (char)value;
     } else {
-        lexeme[1] = value;
-        lexeme[2] = '\'';
+        if (literalType == LITERAL_TYPE_UTF16_CHAR && value > 0xFFFF) {
+            lexerReportWarning(lexer, location,
+                               "character U+%04X is not representable in a single UTF-16 code unit",
+                               (unsigned)value);
+        }
+        out->value.intValue = value;
     }
+}
 
-    Token* token = createTokenWithCharValue(TOKEN_CHAR_LITERAL, lexeme, location, value, isWide);
-    if (token) {
-        return *token;
+/**
+ * @brief 向暂存缓冲区追加一段字节（总留出一个字节给结尾的'\0'）
+ */
+static bool lexerScratchAppend(Lexer* lexer, size_t length, const char* data, size_t count) {
+    if (length + count >= lexer->scratchCapacity) {
+        size_t newCapacity = lexer->scratchCapacity == 0 ? 64 : lexer->scratchCapacity * 2;
+        while (length + count >= newCapacity) {
+            newCapacity *= 2;
+        }
+        char* newBuffer = (char*)realloc(lexer->scratchBuffer, newCapacity);
+        if (!newBuffer) {
+            return false;
+        }
+        lexer->scratchBuffer = newBuffer;
+        lexer->scratchCapacity = newCapacity;
     }
-    return *createEOFToken(location);
+    memcpy(lexer->scratchBuffer + length, data, count);
+    return true;
 }
 
 /**
- * @brief 读取字符串字面量
+ * @brief 向暂存缓冲区追加一个字节
  */
-static Token lexerReadString(Lexer* lexer) {
-    size_t start = lexer->position;
-    size_t startColumn = lexer->column;
-    size_t startLine = lexer->line;
-    size_t startOffset = lexer->position;
-    bool isWide = false;
+static bool lexerScratchPush(Lexer* lexer, size_t length, char ch) {
+    return lexerScratchAppend(lexer, length, &ch, 1);
+}
 
-    // 检查宽字符串前缀 L
-    if (lexerCurrentChar(lexer) == 'L') {
-        isWide = true;
-        lexerAdvance(lexer);
-    }
+/**
+ * @brief 扫描字符串字面量
+ *
+ * 解码后的内容写入词法分析器的暂存缓冲区，缓冲区在token之间复用。
+ * 不论编码前缀是什么，内容都按UTF-8保存（通用字符名编码为UTF-8，
+ * 八进制和十六进制转义按原字节写入），由literalType表示目标编码。
+ *
+ * @param lexer 词法分析器
+ * @param out 输出token
+ * @param literalType 由编码前缀决定的字面量类型
+ * @param prefixLength 编码前缀的长度
+ */
+static void lexerScanString(Lexer* lexer, LexedToken* out, LiteralType literalType, size_t prefixLength) {
+    const char* end = lexer->source + lexer->sourceLength;
 
-    // 跳过开引号
+    // 跳过编码前缀和开引号
+    lexer->position += prefixLength;
     lexerAdvance(lexer);
 
-    // 构建字符串内容
-    size_t bufferSize = 64;
     size_t length = 0;
-    char* buffer = (char*)malloc(bufferSize);
-    if (!buffer) {
-        return *createEOFToken(lexerCreateCurrentLocation(lexer));
-    }
-
+    bool bufferOk = true;
     while (!lexerIsAtEnd(lexer)) {
+        // 不含引号、反斜杠、换行的ASCII内容整段复制
+        const char* p = lexer->source + lexer->position;
+        const char* stop = simdSkipStringChars(p, end);
+        if (stop > p) {
+            size_t count = (size_t)(stop - p);
+            if (bufferOk && lexerScratchAppend(lexer, length, p, count)) {
+                length += count;
+            } else {
+                bufferOk = false;
+            }
+            lexerAdvanceTo(lexer, stop);
+            if (lexerIsAtEnd(lexer)) {
+                break;
+            }
+        }
+
         char ch = lexerCurrentChar(lexer);
 
         if (ch == '"') {
@@ -1073,386 +1148,598 @@ static Token lexerReadString(Lexer* lexer) {
             break;
         }
 
+        char bytes[UNICODE_UTF8_MAX_LENGTH];
+        size_t count = 1;
         if (ch == '\\') {
             bool success;
-            ch = lexerProcessEscapeSequence(lexer, &success);
+            bool isUniversal;
+            uint32_t value = lexerProcessEscapeSequence(lexer, &success, &isUniversal);
+            out->flags |= TOKEN_FLAG_ESCAPE_SEQUENCE;
+            if (isUniversal) {
+                count = unicodeEncodeUtf8(value, bytes);
+            } else {
+                bytes[0] = (char)value;
+            }
         } else {
-            lexerAdvance(lexer);
+            // UTF-8字符原样复制
+            const char* start = lexer->source + lexer->position;
+            uint32_t codePoint;
+            count = lexerReadLiteralUtf8(lexer, &codePoint);
+            memcpy(bytes, start, count);
         }
 
-        // 扩展缓冲区
-        if (length >= bufferSize - 1) {
-            bufferSize *= 2;
-            char* newBuffer = (char*)realloc(buffer, bufferSize);
-            if (!newBuffer) {
-                free(buffer);
-                return *createEOFToken(lexerCreateCurrentLocation(lexer));
-            }
-            buffer = newBuffer;
+        if (bufferOk && lexerScratchAppend(lexer, length, bytes, count)) {
+            length += count;
+        } else {
+            bufferOk = false;
         }
-
-        buffer[length++] = ch;
     }
 
-    buffer[length] = '\0';
-
-    // 提取词素
-    size_t lexemeLength = lexer->position - start;
-    char* lexeme = (char*)malloc(lexemeLength + 1);
-    if (lexeme) {
-        memcpy(lexeme, lexer->source + start, lexemeLength);
-        lexeme[lexemeLength] = '\0';
+    if (bufferOk && lexerScratchPush(lexer, length, '\0')) {
+        out->stringValue = lexer->scratchBuffer;
+        out->stringLength = length;
+    } else {
+        out->stringValue = "";
+        out->stringLength = 0;
     }
 
-    // 创建源位置
-    SourceLocation location = createSourceLocation(
-        lexer->filename,
-        (int)startLine,
-        (int)startColumn,
-        (int)startOffset
-    );
-
-    Token* token = createTokenWithStringValue(TOKEN_STRING_LITERAL, lexeme ? lexeme : "", location, buffer, isWide);
-    free(buffer);
-    if (lexeme) free(lexeme);
+    out->type = TOKEN_STRING_LITERAL;
+    out->hasValue = true;
+    out->isWide = literalType == LITERAL_TYPE_WSTRING;
+    out->literalType = literalType;
+    if (literalType != LITERAL_TYPE_STRING && literalType != LITERAL_TYPE_WSTRING) {
+        out->flags |= TOKEN_FLAG_UNICODE;
+    }
+}
 
-    if (token) {
-        return *token;
+/**
+ * @brief 扫描以L、u、U开头的token
+ *
+ * 后面紧跟引号时是带编码前缀的字符或字符串字面量（L、u、U、u8），
+ * 否则是标识符。C11没有u8字符常量，u8'x'按标识符u8加字符常量处理。
+ */
+static void lexerScanPrefixedLiteral(Lexer* lexer, LexedToken* out) {
+    char prefix = lexerCurrentChar(lexer);
+    size_t prefixLength = (prefix == 'u' && lexerPeekNext(lexer) == '8') ? 2 : 1;
+    char quote = lexerPeekChar(lexer, prefixLength);
+
+    if (quote == '"') {
+        LiteralType type = prefixLength == 2 ? LITERAL_TYPE_UTF8_STRING
+                         : prefix == 'L' ? LITERAL_TYPE_WSTRING
+                         : prefix == 'u' ? LITERAL_TYPE_UTF16_STRING
+                         : LITERAL_TYPE_UTF32_STRING;
+        lexerScanString(lexer, out, type, prefixLength);
+    } else if (quote == '\'' && prefixLength == 1) {
+        LiteralType type = prefix == 'L' ? LITERAL_TYPE_WCHAR
+                         : prefix == 'u' ? LITERAL_TYPE_UTF16_CHAR
+                         : LITERAL_TYPE_UTF32_CHAR;
+        lexerScanChar(lexer, out, type, prefixLength);
+    } else {
+        lexerScanIdentifier(lexer, out);
     }
-    return *createEOFToken(location);
 }
 
 // ==================== 运算符和分隔符识别 ====================
 
 /**
- * @brief 读取运算符或分隔符
+ * @brief 运算符前缀树节点编号
+ *
+ * 每个节点对应一个运算符前缀。OPERATOR_NODE_NONE表示不是运算符的首字符。
  */
-static Token lexerReadOperatorOrPunctuation(Lexer* lexer) {
-    char ch = lexerCurrentChar(lexer);
-    size_t startColumn = lexer->column;
-    size_t startLine = lexer->line;
-    size_t startOffset = lexer->position;
+enum {
+    OPERATOR_NODE_NONE,
+    OPERATOR_NODE_PLUS, OPERATOR_NODE_PLUS_PLUS, OPERATOR_NODE_PLUS_ASSIGN,
+    OPERATOR_NODE_MINUS, OPERATOR_NODE_MINUS_MINUS, OPERATOR_NODE_MINUS_ASSIGN, OPERATOR_NODE_ARROW,
+    OPERATOR_NODE_STAR, OPERATOR_NODE_STAR_ASSIGN,
+    OPERATOR_NODE_SLASH, OPERATOR_NODE_SLASH_ASSIGN,
+    OPERATOR_NODE_PERCENT, OPERATOR_NODE_PERCENT_ASSIGN,
+    OPERATOR_NODE_ASSIGN, OPERATOR_NODE_EQUAL,
+    OPERATOR_NODE_NOT, OPERATOR_NODE_NOT_EQUAL,
+    OPERATOR_NODE_LESS, OPERATOR_NODE_LESS_EQUAL, OPERATOR_NODE_SHL, OPERATOR_NODE_SHL_ASSIGN,
+    OPERATOR_NODE_GREATER, OPERATOR_NODE_GREATER_EQUAL, OPERATOR_NODE_SHR, OPERATOR_NODE_SHR_ASSIGN,
+    OPERATOR_NODE_AMP, OPERATOR_NODE_AMP_AMP, OPERATOR_NODE_AMP_ASSIGN,
+    OPERATOR_NODE_PIPE, OPERATOR_NODE_PIPE_PIPE, OPERATOR_NODE_PIPE_ASSIGN,
+    OPERATOR_NODE_CARET, OPERATOR_NODE_CARET_ASSIGN,
+    OPERATOR_NODE_TILDE,
+    OPERATOR_NODE_DOT, OPERATOR_NODE_DOT_DOT, OPERATOR_NODE_ELLIPSIS,
+    OPERATOR_NODE_LPAREN, OPERATOR_NODE_RPAREN,
+    OPERATOR_NODE_LBRACKET, OPERATOR_NODE_RBRACKET,
+    OPERATOR_NODE_LBRACE, OPERATOR_NODE_RBRACE,
+    OPERATOR_NODE_SEMICOLON, OPERATOR_NODE_COMMA,
+    OPERATOR_NODE_COLON, OPERATOR_NODE_QUESTION,
+    OPERATOR_NODE_COUNT
+};
 
-    SourceLocation location = createSourceLocation(
-        lexer->filename,
-        (int)startLine,
-        (int)startColumn,
-        (int)startOffset
-    );
+// 单个节点的最大子节点数（'-'后可以接'-'、'='、'>'）
+#define OPERATOR_TRIE_MAX_CHILDREN 3
 
-    // 处理多字符运算符
-    char next = lexerPeekNext(lexer);
-
-    switch (ch) {
-        // 赋值运算符
-        case '=':
-            lexerAdvance(lexer);
-            if (next == '=') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_EQUAL, location);
-            }
-            return *createOperatorToken(TOKEN_ASSIGN, location);
+/**
+ * @brief 运算符前缀树节点
+ */
+typedef struct {
+    TokenType token;                                // 在此结束时的token，TOKEN_UNKNOWN表示不能在此结束
+    uint8_t childCount;                             // 子节点数量
+    char childChars[OPERATOR_TRIE_MAX_CHILDREN];    // 通往子节点的字符
+    uint8_t children[OPERATOR_TRIE_MAX_CHILDREN];   // 子节点编号
+} OperatorTrieNode;
 
-        case '!':
-            lexerAdvance(lexer);
-            if (next == '=') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_NOT_EQUAL, location);
-            }
-            return *createOperatorToken(TOKEN_LOGICAL_NOT, location);
+#define OPERATOR_LEAF(tok) { tok, 0, {0}, {0} }
+#define OPERATOR_NODE1(tok, c1, n1) { tok, 1, {c1}, {n1} }
+#define OPERATOR_NODE2(tok, c1, n1, c2, n2) { tok, 2, {c1, c2}, {n1, n2} }
+#define OPERATOR_NODE3(tok, c1, n1, c2, n2, c3, n3) { tok, 3, {c1, c2, c3}, {n1, n2, n3} }
 
-        case '<':
-            lexerAdvance(lexer);
-            if (next == '=') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_LESS_EQUAL, location);
-            }
-            if (next == '<') {
-                lexerAdvance(lexer);
-                if (lexerPeekNext(lexer) == '=') {
-                    lexerAdvance(lexer);
-                    return *createOperatorToken(TOKEN_LEFT_SHIFT, location);  // <<= 需要后续处理
-                }
-                return *createOperatorToken(TOKEN_LEFT_SHIFT, location);
-            }
-            return *createOperatorToken(TOKEN_LESS, location);
+/**
+ * @brief 全部运算符和分隔符的前缀树
+ */
+static const OperatorTrieNode operatorTrie[OPERATOR_NODE_COUNT] = {
+    [OPERATOR_NODE_NONE]            = OPERATOR_LEAF(TOKEN_UNKNOWN),
+
+    [OPERATOR_NODE_PLUS]            = OPERATOR_NODE2(TOKEN_PLUS, '+', OPERATOR_NODE_PLUS_PLUS,
+                                                     '=', OPERATOR_NODE_PLUS_ASSIGN),
+    [OPERATOR_NODE_PLUS_PLUS]       = OPERATOR_LEAF(TOKEN_INCREMENT),
+    [OPERATOR_NODE_PLUS_ASSIGN]     = OPERATOR_LEAF(TOKEN_PLUS_ASSIGN),
+
+    [OPERATOR_NODE_MINUS]           = OPERATOR_NODE3(TOKEN_MINUS, '-', OPERATOR_NODE_MINUS_MINUS,
+                                                     '=', OPERATOR_NODE_MINUS_ASSIGN,
+                                                     '>', OPERATOR_NODE_ARROW),
+    [OPERATOR_NODE_MINUS_MINUS]     = OPERATOR_LEAF(TOKEN_DECREMENT),
+    [OPERATOR_NODE_MINUS_ASSIGN]    = OPERATOR_LEAF(TOKEN_MINUS_ASSIGN),
+    [OPERATOR_NODE_ARROW]           = OPERATOR_LEAF(TOKEN_ARROW),
+
+    [OPERATOR_NODE_STAR]            = OPERATOR_NODE1(TOKEN_MULTIPLY, '=', OPERATOR_NODE_STAR_ASSIGN),
+    [OPERATOR_NODE_STAR_ASSIGN]     = OPERATOR_LEAF(TOKEN_MULTIPLY_ASSIGN),
+
+    [OPERATOR_NODE_SLASH]           = OPERATOR_NODE1(TOKEN_DIVIDE, '=', OPERATOR_NODE_SLASH_ASSIGN),
+    [OPERATOR_NODE_SLASH_ASSIGN]    = OPERATOR_LEAF(TOKEN_DIVIDE_ASSIGN),
+
+    [OPERATOR_NODE_PERCENT]         = OPERATOR_NODE1(TOKEN_MODULO, '=', OPERATOR_NODE_PERCENT_ASSIGN),
+    [OPERATOR_NODE_PERCENT_ASSIGN]  = OPERATOR_LEAF(TOKEN_MODULO_ASSIGN),
+
+    [OPERATOR_NODE_ASSIGN]          = OPERATOR_NODE1(TOKEN_ASSIGN, '=', OPERATOR_NODE_EQUAL),
+    [OPERATOR_NODE_EQUAL]           = OPERATOR_LEAF(TOKEN_EQUAL),
+
+    [OPERATOR_NODE_NOT]             = OPERATOR_NODE1(TOKEN_LOGICAL_NOT, '=', OPERATOR_NODE_NOT_EQUAL),
+    [OPERATOR_NODE_NOT_EQUAL]       = OPERATOR_LEAF(TOKEN_NOT_EQUAL),
+
+    [OPERATOR_NODE_LESS]            = OPERATOR_NODE2(TOKEN_LESS, '=', OPERATOR_NODE_LESS_EQUAL,
+                                                     '<', OPERATOR_NODE_SHL),
+    [OPERATOR_NODE_LESS_EQUAL]      = OPERATOR_LEAF(TOKEN_LESS_EQUAL),
+    [OPERATOR_NODE_SHL]             = OPERATOR_NODE1(TOKEN_LEFT_SHIFT, '=', OPERATOR_NODE_SHL_ASSIGN),
+    [OPERATOR_NODE_SHL_ASSIGN]      = OPERATOR_LEAF(TOKEN_LEFT_SHIFT_ASSIGN),
+
+    [OPERATOR_NODE_GREATER]         = OPERATOR_NODE2(TOKEN_GREATER, '=', OPERATOR_NODE_GREATER_EQUAL,
+                                                     '>', OPERATOR_NODE_SHR),
+    [OPERATOR_NODE_GREATER_EQUAL]   = OPERATOR_LEAF(TOKEN_GREATER_EQUAL),
+    [OPERATOR_NODE_SHR]             = OPERATOR_NODE1(TOKEN_RIGHT_SHIFT, '=', OPERATOR_NODE_SHR_ASSIGN),
+    [OPERATOR_NODE_SHR_ASSIGN]      = OPERATOR_LEAF(TOKEN_RIGHT_SHIFT_ASSIGN),
+
+    [OPERATOR_NODE_AMP]             = OPERATOR_NODE2(TOKEN_BITWISE_AND, '&', OPERATOR_NODE_AMP_AMP,
+                                                     '=', OPERATOR_NODE_AMP_ASSIGN),
+    [OPERATOR_NODE_AMP_AMP]         = OPERATOR_LEAF(TOKEN_LOGICAL_AND),
+    [OPERATOR_NODE_AMP_ASSIGN]      = OPERATOR_LEAF(TOKEN_AND_ASSIGN),
+
+    [OPERATOR_NODE_PIPE]            = OPERATOR_NODE2(TOKEN_BITWISE_OR, '|', OPERATOR_NODE_PIPE_PIPE,
+                                                     '=', OPERATOR_NODE_PIPE_ASSIGN),
+    [OPERATOR_NODE_PIPE_PIPE]       = OPERATOR_LEAF(TOKEN_LOGICAL_OR),
+    [OPERATOR_NODE_PIPE_ASSIGN]     = OPERATOR_LEAF(TOKEN_OR_ASSIGN),
+
+    [OPERATOR_NODE_CARET]           = OPERATOR_NODE1(TOKEN_BITWISE_XOR, '=', OPERATOR_NODE_CARET_ASSIGN),
+    [OPERATOR_NODE_CARET_ASSIGN]    = OPERATOR_LEAF(TOKEN_XOR_ASSIGN),
+
+    [OPERATOR_NODE_TILDE]           = OPERATOR_LEAF(TOKEN_BITWISE_NOT),
+
+    // ".."不是合法token，遇到"..x"时回退到最后一个可结束的节点"."
+    [OPERATOR_NODE_DOT]             = OPERATOR_NODE1(TOKEN_DOT, '.', OPERATOR_NODE_DOT_DOT),
+    [OPERATOR_NODE_DOT_DOT]         = OPERATOR_NODE1(TOKEN_UNKNOWN, '.', OPERATOR_NODE_ELLIPSIS),
+    [OPERATOR_NODE_ELLIPSIS]        = OPERATOR_LEAF(TOKEN_ELLIPSSIS),
+
+    [OPERATOR_NODE_LPAREN]          = OPERATOR_LEAF(TOKEN_LPAREN),
+    [OPERATOR_NODE_RPAREN]          = OPERATOR_LEAF(TOKEN_RPAREN),
+    [OPERATOR_NODE_LBRACKET]        = OPERATOR_LEAF(TOKEN_LBRACKET),
+    [OPERATOR_NODE_RBRACKET]        = OPERATOR_LEAF(TOKEN_RBRACKET),
+    [OPERATOR_NODE_LBRACE]          = OPERATOR_LEAF(TOKEN_LBRACE),
+    [OPERATOR_NODE_RBRACE]          = OPERATOR_LEAF(TOKEN_RBRACE),
+    [OPERATOR_NODE_SEMICOLON]       = OPERATOR_LEAF(TOKEN_SEMICOLON),
+    [OPERATOR_NODE_COMMA]           = OPERATOR_LEAF(TOKEN_COMMA),
+    [OPERATOR_NODE_COLON]           = OPERATOR_LEAF(TOKEN_COLON),
+    [OPERATOR_NODE_QUESTION]        = OPERATOR_LEAF(TOKEN_QUESTION),
+};
 
-        case '>':
-            lexerAdvance(lexer);
-            if (next == '=') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_GREATER_EQUAL, location);
-            }
-            if (next == '>') {
-                lexerAdvance(lexer);
-                if (lexerPeekNext(lexer) == '=') {
-                    lexerAdvance(lexer);
-                    return *createOperatorToken(TOKEN_RIGHT_SHIFT, location);  // >>= 需要后续处理
-                }
-                return *createOperatorToken(TOKEN_RIGHT_SHIFT, location);
-            }
-            return *createOperatorToken(TOKEN_GREATER, location);
+/**
+ * @brief 运算符首字符到前缀树根节点的映射
+ */
+static const uint8_t operatorTrieRoots[256] = {
+    ['+'] = OPERATOR_NODE_PLUS,     ['-'] = OPERATOR_NODE_MINUS,
+    ['*'] = OPERATOR_NODE_STAR,     ['/'] = OPERATOR_NODE_SLASH,
+    ['%'] = OPERATOR_NODE_PERCENT,  ['='] = OPERATOR_NODE_ASSIGN,
+    ['!'] = OPERATOR_NODE_NOT,      ['<'] = OPERATOR_NODE_LESS,
+    ['>'] = OPERATOR_NODE_GREATER,  ['&'] = OPERATOR_NODE_AMP,
+    ['|'] = OPERATOR_NODE_PIPE,     ['^'] = OPERATOR_NODE_CARET,
+    ['~'] = OPERATOR_NODE_TILDE,    ['.'] = OPERATOR_NODE_DOT,
+    ['('] = OPERATOR_NODE_LPAREN,   [')'] = OPERATOR_NODE_RPAREN,
+    ['['] = OPERATOR_NODE_LBRACKET, [']'] = OPERATOR_NODE_RBRACKET,
+    ['{'] = OPERATOR_NODE_LBRACE,   ['}'] = OPERATOR_NODE_RBRACE,
+    [';'] = OPERATOR_NODE_SEMICOLON, [','] = OPERATOR_NODE_COMMA,
+    [':'] = OPERATOR_NODE_COLON,    ['?'] = OPERATOR_NODE_QUESTION,
+};
 
-        case '&':
-            lexerAdvance(lexer);
-            if (next == '&') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_LOGICAL_AND, location);
-            }
-            if (next == '=') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_BITWISE_AND, location);  // &= 需要后续处理
+/**
+ * @brief 扫描运算符或分隔符
+ *
+ * 沿前缀树做最长匹配，记住最后一个可以结束的节点；运算符内不会有换行。
+ * 源码以'\0'结尾，且'\0'不会出现在任何边上，向前读取不需要边界检查。
+ *
+ * @return 识别出的token类型
+ */
+static TokenType lexerScanOperatorOrPunctuation(Lexer* lexer) {
+    const char* start = lexer->source + lexer->position;
+    const OperatorTrieNode* node = &operatorTrie[operatorTrieRoots[(unsigned char)start[0]]];
+
+    TokenType matched = node->token;
+    size_t matchedLength = 1;
+    size_t length = 1;
+
+    while (node->childCount > 0) {
+        char next = start[length];
+        uint8_t child = OPERATOR_NODE_NONE;
+        for (uint8_t i = 0; i < node->childCount; i++) {
+            if (node->childChars[i] == next) {
+                child = node->children[i];
+                break;
             }
-            return *createOperatorToken(TOKEN_BITWISE_AND, location);
+        }
+        if (child == OPERATOR_NODE_NONE) {
+            break;
+        }
 
-        case '|':
-            lexerAdvance(lexer);
-            if (next == '|') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_LOGICAL_OR, location);
-            }
-            if (next == '=') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_BITWISE_OR, location);  // |= 需要后续处理
-            }
-            return *createOperatorToken(TOKEN_BITWISE_OR, location);
+        node = &operatorTrie[child];
+        length++;
+        if (node->token != TOKEN_UNKNOWN) {
+            matched = node->token;
+            matchedLength = length;
+        }
+    }
 
-        case '^':
-            lexerAdvance(lexer);
-            if (next == '=') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_BITWISE_XOR, location);  // ^= 需要后续处理
-            }
-            return *createOperatorToken(TOKEN_BITWISE_XOR, location);
+    lexer->position += matchedLength;
+    return matched;
+}
 
-        case '+':
-            lexerAdvance(lexer);
-            if (next == '+') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_INCREMENT, location);
-            }
-            if (next == '=') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_PLUS_ASSIGN, location);
-            }
-            return *createOperatorToken(TOKEN_PLUS, location);
+// ==================== 主词法分析函数 ====================
 
-        case '-':
-            lexerAdvance(lexer);
-            if (next == '-') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_DECREMENT, location);
-            }
-            if (next == '=') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_MINUS_ASSIGN, location);
-            }
-            if (next == '>') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_ARROW, location);
-            }
-            return *createOperatorToken(TOKEN_MINUS, location);
+/**
+ * @brief 跳过空白字符和注释
+ */
+static void lexerSkipTrivia(Lexer* lexer) {
+    lexerSkipWhitespace(lexer);
+    while (lexerSkipComment(lexer)) {
+        lexerSkipWhitespace(lexer);
+    }
+}
 
-        case '*':
-            lexerAdvance(lexer);
-            if (next == '=') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_MULTIPLY_ASSIGN, location);
-            }
-            return *createOperatorToken(TOKEN_MULTIPLY, location);
+/**
+ * @brief 扫描下一个token
+ */
+bool lexerScanToken(Lexer* lexer, LexedToken* out) {
+    if (!lexer || !out) {
+        return false;
+    }
 
-        case '/':
-            lexerAdvance(lexer);
-            if (next == '=') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_DIVIDE_ASSIGN, location);
-            }
-            return *createOperatorToken(TOKEN_DIVIDE, location);
+    lexerSkipTrivia(lexer);
 
-        case '%':
-            lexerAdvance(lexer);
-            if (next == '=') {
-                lexerAdvance(lexer);
-                return *createOperatorToken(TOKEN_MODULO_ASSIGN, location);
-            }
-            return *createOperatorToken(TOKEN_MODULO, location);
+    out->offset = lexer->position;
+    out->flags = 0;
+    out->hasValue = false;
+    out->isWide = false;
+    out->literalType = LITERAL_TYPE_DECIMAL;
+    out->value.intValue = 0;
+    out->stringValue = NULL;
+    out->stringLength = 0;
 
-        // 分隔符
-        case '(':
-            lexerAdvance(lexer);
-            return *createPunctuationToken(TOKEN_LPAREN, location);
+    // 检查文件结束
+    if (lexerIsAtEnd(lexer)) {
+        out->type = TOKEN_EOF;
+        out->length = 0;
+        return true;
+    }
 
-        case ')':
-            lexerAdvance(lexer);
-            return *createPunctuationToken(TOKEN_RPAREN, location);
+    // 按首字符的类别一次分派（编译为跳转表）
+    char ch = lexerCurrentChar(lexer);
+    switch (charKind(ch)) {
+        case CHAR_KIND_HASH:
+            // 预处理指令
+            lexerScanPreprocessorDirective(lexer, out);
+            break;
 
-        case '[':
-            lexerAdvance(lexer);
-            return *createPunctuationToken(TOKEN_LBRACKET, location);
+        case CHAR_KIND_WIDE_PREFIX:
+            // L'x'、u"..."、u8"..."等带编码前缀的字面量，或以L、u、U开头的标识符
+            lexerScanPrefixedLiteral(lexer, out);
+            break;
 
-        case ']':
-            lexerAdvance(lexer);
-            return *createPunctuationToken(TOKEN_RBRACKET, location);
+        case CHAR_KIND_IDENTIFIER:
+            // 标识符或关键字
+            lexerScanIdentifier(lexer, out);
+            break;
 
-        case '{':
-            lexerAdvance(lexer);
-            return *createToken(TOKEN_LBRACE, "{", location);
+        case CHAR_KIND_DIGIT:
+            // 数字字面量
+            lexerScanNumber(lexer, out);
+            break;
 
-        case '}':
-            lexerAdvance(lexer);
-            return *createToken(TOKEN_RBRACE, "}", location);
+        case CHAR_KIND_CHAR_QUOTE:
+            // 字符字面量
+            lexerScanChar(lexer, out, LITERAL_TYPE_CHAR, 0);
+            break;
 
-        case ';':
-            lexerAdvance(lexer);
-            return *createPunctuationToken(TOKEN_SEMICOLON, location);
+        case CHAR_KIND_STRING_QUOTE:
+            // 字符串字面量
+            lexerScanString(lexer, out, LITERAL_TYPE_STRING, 0);
+            break;
 
-        case ',':
-            lexerAdvance(lexer);
-            return *createPunctuationToken(TOKEN_COMMA, location);
+        case CHAR_KIND_UNICODE_START:
+            // UTF-8字符或通用字符名开始的标识符
+            lexerScanUnicodeStart(lexer, out);
+            break;
 
-        case '.':
-            lexerAdvance(lexer);
-            if (next == '.') {
-                lexerAdvance(lexer);
-                if (lexerPeekNext(lexer) == '.') {
-                    lexerAdvance(lexer);
-                    return *createPunctuationToken(TOKEN_ELLIPSSIS, location);
-                }
+        case CHAR_KIND_OPERATOR:
+            // .5这样以小数点开头的浮点数
+            if (ch == '.' && charIsDigit(lexerPeekNext(lexer))) {
+                lexerScanNumber(lexer, out);
+                break;
             }
-            return *createPunctuationToken(TOKEN_DOT, location);
-
-        case ':':
-            lexerAdvance(lexer);
-            return *createPunctuationToken(TOKEN_COLON, location);
-
-        case '?':
-            lexerAdvance(lexer);
-            return *createPunctuationToken(TOKEN_QUESTION, location);
-
-        case '~':
-            lexerAdvance(lexer);
-            return *createOperatorToken(TOKEN_BITWISE_NOT, location);
+            // 运算符和分隔符
+            out->type = lexerScanOperatorOrPunctuation(lexer);
+            break;
 
+        case CHAR_KIND_WHITESPACE:
+        case CHAR_KIND_UNKNOWN:
         default:
             // 未知字符
             lexerAdvance(lexer);
-            return *createToken(TOKEN_UNKNOWN, NULL, location);
+            out->type = TOKEN_UNKNOWN;
+            break;
     }
-}
 
-// ==================== 主词法分析函数 ====================
+    out->length = lexer->position - out->offset;
+    return true;
+}
 
 /**
- * @brief 获取下一个token
+ * @brief 把扫描结果转换为完整的Token
+ *
+ * Token本身、词素副本和字符串值都分配在词法分析器的token内存池中；
+ * 设置了驻留器时标识符的词素改为驻留字符串。
  */
-Token lexerNextToken(Lexer* lexer) {
-    // 跳过空白字符
-    lexerSkipWhitespace(lexer);
+static Token* lexerMaterializeToken(Lexer* lexer, const LexedToken* lexed) {
+    Token* token = (Token*)memoryPoolAlloc(lexer->tokenArena, sizeof(Token));
+    if (!token) {
+        return NULL;
+    }
+    memset(token, 0, sizeof(Token));
 
-    // 跳过注释
-    while (lexerSkipComment(lexer)) {
-        lexerSkipWhitespace(lexer);
+    token->type = lexed->type;
+    token->location = createSourceLocation(lexer->fileId, (uint32_t)lexed->offset);
+    token->flags = lexed->flags;
+    token->hasValue = lexed->hasValue;
+    token->isWide = lexed->isWide;
+    token->literalType = lexed->literalType;
+
+    if (lexed->type == TOKEN_IDENTIFIER && lexer->interner) {
+        token->lexeme = (char*)stringInternerIntern(lexer->interner, lexer->source + lexed->offset, lexed->length);
+        if (!token->lexeme) {
+            return NULL;
+        }
+        token->length = lexed->length;
+    } else if (lexed->type != TOKEN_EOF) {
+        token->lexeme = memoryPoolStrndup(lexer->tokenArena, lexer->source + lexed->offset, lexed->length);
+        if (!token->lexeme) {
+            return NULL;
+        }
+        token->length = lexed->length;
     }
 
-    // 检查文件结束
-    if (lexerIsAtEnd(lexer)) {
-        return *createEOFToken(lexerCreateCurrentLocation(lexer));
+    if (lexed->type == TOKEN_STRING_LITERAL) {
+        token->value.stringValue = memoryPoolStrndup(lexer->tokenArena, lexed->stringValue, lexed->stringLength);
+        if (!token->value.stringValue) {
+            return NULL;
+        }
+    } else if (lexed->type == TOKEN_FLOAT_LITERAL) {
+        token->value.floatValue = lexed->value.floatValue;
+    } else if (lexed->type == TOKEN_CHAR_LITERAL && lexed->literalType == LITERAL_TYPE_CHAR) {
+        token->value.charValue = lexed->value.charValue;
+    } else {
+        token->value.intValue = lexed->value.intValue;
     }
 
-    char ch = lexerCurrentChar(lexer);
+    return token;
+}
 
-    // 预处理指令
-    if (ch == '#') {
-        return lexerReadPreprocessorDirective(lexer);
+/**
+ * @brief 获取下一个token
+ */
+Token* lexerNextToken(Lexer* lexer) {
+    if (!lexer) {
+        return NULL;
     }
 
-    // 标识符或关键字
-    if (isalpha(ch) || ch == '_') {
-        return lexerReadIdentifier(lexer);
+    // 刚查看过的token直接取用
+    if (lexer->peekedToken) {
+        Token* token = lexer->peekedToken;
+        bool valid = lexer->peekedStart == lexer->position;
+        lexer->peekedToken = NULL;
+        if (valid) {
+            lexer->position = lexer->peekedEnd;
+            return token;
+        }
     }
 
-    // 数字字面量
-    if (isdigit(ch)) {
-        return lexerReadNumber(lexer);
-    }
+    LexedToken lexed;
+    lexerScanToken(lexer, &lexed);
+    return lexerMaterializeToken(lexer, &lexed);
+}
 
-    // 字符字面量
-    if (ch == '\'' || (ch == 'L' && lexerPeekNext(lexer) == '\'')) {
-        return lexerReadChar(lexer);
+/**
+ * @brief 查看下一个token但不移动位置
+ */
+Token* lexerPeekToken(Lexer* lexer) {
+    if (!lexer) {
+        return NULL;
     }
 
-    // 字符串字面量
-    if (ch == '"' || (ch == 'L' && lexerPeekNext(lexer) == '"')) {
-        return lexerReadString(lexer);
+    if (lexer->peekedToken && lexer->peekedStart == lexer->position) {
+        return lexer->peekedToken;
     }
 
-    // 运算符和分隔符
-    if (ispunct(ch)) {
-        return lexerReadOperatorOrPunctuation(lexer);
-    }
+    // 扫描一次并缓存，位置保持不变，其他扫描接口不受影响
+    size_t start = lexer->position;
+    Token* token = lexerNextToken(lexer);
+    lexer->peekedToken = token;
+    lexer->peekedStart = start;
+    lexer->peekedEnd = lexer->position;
+    lexer->position = start;
 
-    // 未知字符
-    SourceLocation location = lexerCreateCurrentLocation(lexer);
-    lexerAdvance(lexer);
-    return *createToken(TOKEN_UNKNOWN, NULL, location);
+    return token;
 }
 
 /**
- * @brief 查看下一个token但不移动位置
+ * @brief 把扫描结果追加到紧凑token数组
  */
-Token lexerPeekToken(Lexer* lexer) {
-    // 保存当前状态
-    size_t savedPosition = lexer->position;
-    size_t savedLine = lexer->line;
-    size_t savedColumn = lexer->column;
-    size_t savedLineStartOffset = lexer->lineStartOffset;
+bool lexerAppendPackedToken(TokenArray* array, const LexedToken* lexed) {
+    if (!lexed->hasValue) {
+        return tokenArrayPush(array, lexed->type, lexed->offset, lexed->length, lexed->flags, NULL);
+    }
 
-    // 获取下一个token
-    Token token = lexerNextToken(lexer);
+    TokenValue value;
+    memset(&value, 0, sizeof(TokenValue));
+    value.literalType = (uint8_t)lexed->literalType;
+    value.isWide = lexed->isWide;
 
-    // 恢复状态
-    lexer->position = savedPosition;
-    lexer->line = savedLine;
-    lexer->column = savedColumn;
-    lexer->lineStartOffset = savedLineStartOffset;
+    switch (lexed->type) {
+        case TOKEN_STRING_LITERAL:
+            if (!tokenArrayAddString(array, lexed->stringValue, lexed->stringLength, &value)) {
+                return false;
+            }
+            break;
+        case TOKEN_FLOAT_LITERAL:
+            value.as.floatValue = lexed->value.floatValue;
+            break;
+        case TOKEN_CHAR_LITERAL:
+            // L、u、U前缀的字符常量是码点，和整数一样保存在intValue中
+            if (lexed->literalType == LITERAL_TYPE_CHAR) {
+                value.as.charValue = lexed->value.charValue;
+            } else {
+                value.as.intValue = lexed->value.intValue;
+            }
+            break;
+        default:
+            value.as.intValue = lexed->value.intValue;
+            break;
+    }
 
-    return token;
+    return tokenArrayPush(array, lexed->type, lexed->offset, lexed->length, lexed->flags, &value);
 }
 
 /**
  * @brief 对整个源代码进行词法分析
- * @param lexer 词法分析器
- * @return token向量（Vector<Token>），失败返回NULL
  */
-Vector* lexerTokenize(Lexer* lexer) {
+TokenArray* lexerTokenize(Lexer* lexer) {
     if (!lexer) {
         return NULL;
     }
 
-    // 创建Vector来存储Token
-    Vector* tokens = vectorCreate(sizeof(Token), 16);
+    // 按剩余源码长度预估token数量，一次分配连续数组
+    TokenArray* tokens = createTokenArray(lexer->source, lexer->sourceLength, lexer->fileId, 0);
     if (!tokens) {
         return NULL;
     }
 
-    // 循环获取所有token
-    while (true) {
-        Token token = lexerNextToken(lexer);
+    // 扫描直到文件末尾，EOF也写入数组
+    if (!lexerTokenizeRange(lexer, SIZE_MAX, tokens, NULL)) {
+        destroyTokenArray(tokens);
+        return NULL;
+    }
 
-        // 将token添加到Vector
-        if (!vectorPushBack(tokens, &token)) {
-            // 添加失败，清理已创建的token
-            vectorDestroy(tokens, (void (*)(void*))destroyToken);
-            return NULL;
+    // 预估值按每个token 5字节计算，通常偏大，扫描完成后归还多余的容量
+    tokenArrayShrinkToFit(tokens);
+    return tokens;
+}
+
+/**
+ * @brief 扫描下一个token，但不扫描起点在end及之后的token
+ */
+bool lexerScanTokenBefore(Lexer* lexer, size_t end, LexedToken* out) {
+    if (!lexer || !out) {
+        return false;
+    }
+
+    lexerSkipTrivia(lexer);
+    if (lexer->position >= end) {
+        return false;
+    }
+    return lexerScanToken(lexer, out);
+}
+
+/**
+ * @brief 扫描源码的一段，把起点在end之前的token追加到数组
+ */
+bool lexerTokenizeRange(Lexer* lexer, size_t end, TokenArray* tokens, size_t* nextOffset) {
+    if (!lexer || !tokens) {
+        return false;
+    }
+
+    LexedToken lexed;
+    while (lexerScanTokenBefore(lexer, end, &lexed)) {
+        if (!lexerAppendPackedToken(tokens, &lexed)) {
+            return false;
+        }
+        if (lexed.type == TOKEN_EOF) {
+            break;
+        }
+    }
+
+    if (nextOffset) {
+        *nextOffset = lexer->position;
+    }
+    return true;
+}
+
+bool lexerTokenizeRangeUntilSync(Lexer* lexer, size_t end, const TokenArray* sync,
+                                 TokenArray* tokens, size_t* nextOffset, size_t* syncIndex) {
+    if (!lexer || !tokens) {
+        return false;
+    }
+
+    size_t syncCount = sync ? tokenArraySize(sync) : 0;
+    size_t cursor = 0;
+    size_t matched = SIZE_MAX;
+
+    size_t stop = SIZE_MAX;
+    LexedToken lexed;
+    while (lexerScanTokenBefore(lexer, end, &lexed)) {
+        // 两边的起点都单调递增，游标只需向前走
+        while (cursor < syncCount && tokenArrayGet(sync, cursor)->offset < lexed.offset) {
+            cursor++;
+        }
+        if (cursor < syncCount && tokenArrayGet(sync, cursor)->offset == lexed.offset) {
+            matched = cursor;
+            stop = lexed.offset;
+            break;
         }
 
-        // 检查是否到达文件末尾
-        if (token.type == TOKEN_EOF) {
+        if (!lexerAppendPackedToken(tokens, &lexed)) {
+            return false;
+        }
+        if (lexed.type == TOKEN_EOF) {
             break;
         }
     }
 
-    return tokens;
+    if (nextOffset) {
+        *nextOffset = matched != SIZE_MAX ? stop : lexer->position;
+    }
+    if (syncIndex) {
+        *syncIndex = matched;
+    }
+    return true;
 }
 
 // ==================== 状态管理 ====================
@@ -1463,22 +1750,71 @@ Vector* lexerTokenize(Lexer* lexer) {
 void lexerReset(Lexer* lexer) {
     if (lexer) {
         lexer->position = 0;
-        lexer->line = 1;
-        lexer->column = 1;
-        lexer->lineStartOffset = 0;
+        lexer->peekedToken = NULL;
         lexer->inPreprocessor = false;
         lexer->inComment = false;
+        memoryPoolReset(lexer->tokenArena);
     }
 }
 
+/**
+ * @brief 改用新源码（源管理器的登记已由调用者更新）
+ */
+static void lexerAdoptSource(Lexer* lexer, const char* source, size_t length) {
+    if (lexer->ownsSourceBuffer) {
+        destroySourceBuffer(lexer->sourceBuffer);
+    }
+    lexer->sourceBuffer = NULL;
+    lexer->ownsSourceBuffer = false;
+    lexer->source = source;
+    lexer->sourceLength = length;
+
+    lexerReset(lexer);
+}
+
+/**
+ * @brief 改为扫描另一段源码
+ */
+bool lexerSetSource(Lexer* lexer, const char* source, size_t length) {
+    if (!lexer || !source || source[length] != '\0') {
+        return false;
+    }
+    if (!sourceManagerSetFileContent(lexer->fileId, source, length)) {
+        return false;
+    }
+
+    lexerAdoptSource(lexer, source, length);
+    return true;
+}
+
+/**
+ * @brief 改为扫描编辑之后的源码
+ */
+bool lexerSetEditedSource(Lexer* lexer, const char* source, size_t length,
+                          size_t offset, size_t removedLength, size_t insertedLength) {
+    if (!lexer || !source || source[length] != '\0') {
+        return false;
+    }
+    if (!sourceManagerEditFileContent(lexer->fileId, source, length,
+                                      offset, removedLength, insertedLength)) {
+        return false;
+    }
+
+    lexerAdoptSource(lexer, source, length);
+    return true;
+}
+
 /**
  * 
  * @brief 获取当前位置
  */
 void lexerGetPosition(const Lexer* lexer, size_t* line, size_t* column) {
     if (lexer) {
-        if (line) *line = lexer->line;
-        if (column) *column = lexer->column;
+        int resolvedLine = 0;
+        int resolvedColumn = 0;
+        sourceManagerGetLineColumn(lexer->fileId, (uint32_t)lexer->position, &resolvedLine, &resolvedColumn);
+        if (line) *line = (size_t)resolvedLine;
+        if (column) *column = (size_t)resolvedColumn;
     }
 }
 
@@ -1500,6 +1836,15 @@ void lexerSetSupportUnicode(Lexer* lexer, bool support) {
     }
 }
 
+/**
+ * @brief 设置标识符使用的字符串驻留器
+ */
+void lexerSetStringInterner(Lexer* lexer, StringInterner* interner) {
+    if (lexer) {
+        lexer->interner = interner;
+    }
+}
+
 /**
  * @brief 获取当前源位置
  */
@@ -1507,5 +1852,5 @@ SourceLocation lexerGetCurrentLocation(const Lexer* lexer) {
     if (lexer) {
         return lexerCreateCurrentLocation(lexer);
     }
-    return createSourceLocation(NULL, 0, 0, 0);
+    return createSourceLocation(INVALID_FILE_ID, 0);
 }
@@ -2,9 +2,12 @@
 #define LEXER_H
 
 #include "token.h"
+#include "token_array.h"
 #include <stdbool.h>
 #include <stddef.h>
-#include "../../common/containers/vector.h"
+#include "../../common/io/buffer.h"
+#include "../../common/utils/memory_pool.h"
+#include "../../common/utils/string_utils.h"
 
 // 前向声明
 typedef struct DiagnosticEngine DiagnosticEngine;
@@ -25,31 +28,79 @@ typedef enum {
     LEX_ERROR_MISMATCHED_BRACKET          // 括号不匹配
 } LexerErrorType;
 
+/**
+ * @brief 一次扫描的结果
+ *
+ * 词法分析的核心输出，不持有任何内存：词素通过偏移和长度引用源码，
+ * 字符串字面量解码后的内容指向词法分析器内部的暂存缓冲区，只在下一次
+ * 扫描之前有效。lexerNextToken和lexerTokenize都在它的基础上构造各自的token。
+ */
+typedef struct {
+    TokenType type;             // token类型
+    size_t offset;              // 词素起始偏移
+    size_t length;              // 词素长度
+    unsigned int flags;         // TOKEN_FLAG_*
+
+    bool hasValue;              // 是否带字面量值
+    bool isWide;                // 是否宽字符/宽字符串
+    LiteralType literalType;    // 字面量类型
+    union {
+        long long intValue;
+        double floatValue;
+        char charValue;
+    } value;
+    const char* stringValue;    // 字符串字面量解码后的内容
+    size_t stringLength;        // 解码后的长度
+} LexedToken;
+
 /**
  * @brief 词法分析器结构体
  *
  * 负责将源代码字符串分解为token序列
  */
 typedef struct {
-    char* source;           // 源代码
+    const char* source;     // 源代码（以'\0'结尾，可能是内存映射的只读内存）
     size_t sourceLength;    // 源代码长度
-    size_t position;        // 当前位置
-    size_t line;            // 当前行号（从1开始）
-    size_t column;          // 当前列号（从1开始）
-    size_t lineStartOffset; // 当前行起始偏移量
-    char* filename;         // 文件名
+    SourceBuffer* sourceBuffer;  // 源码缓冲区
+    bool ownsSourceBuffer;  // 是否由词法分析器负责销毁缓冲区
+    size_t position;        // 当前位置（不跟踪行列号，需要时由源管理器按偏移计算）
+    FileId fileId;          // 源文件ID（文件名和行索引由源管理器持有）
 
     DiagnosticEngine* diagnostics;  // 诊断引擎
 
     // 关键字表
     HashTable* keywords;
 
+    // 标识符token的词素驻留到这里（为NULL时复制到token内存池），
+    // 与AST、符号表共用同一个驻留器时名称可以按指针比较
+    StringInterner* interner;
+
+    // 字符串字面量解码用的暂存缓冲区（跨token复用）
+    char* scratchBuffer;
+    size_t scratchCapacity;
+
+    // lexerNextToken/lexerPeekToken返回的token及其词素、字符串值都分配在这里，
+    // 随destroyLexer一次性释放
+    MemoryPool* tokenArena;
+
+    // lexerPeekToken扫描过的下一个token，lexerNextToken直接取用，不重复扫描
+    Token* peekedToken;
+    size_t peekedStart;     // 查看时的起始位置
+    size_t peekedEnd;       // 该token结束后的位置
+
     // 状态标志
     bool inPreprocessor;    // 是否处于预处理状态
     bool inComment;         // 是否处于注释状态
     bool supportUnicode;    // 是否支持Unicode
     bool preserveComments;  // 是否保留注释token
 
+    // 已报告的词法错误和警告数（没有诊断引擎时也计数）
+    size_t errorCount;
+    size_t warningCount;
+
+    // 与另一个词法分析器共享源码和文件ID（并行扫描的工作者），销毁时不注销源码
+    bool sharesSource;
+
     // 私有数据
     void* privateData;
 
@@ -66,16 +117,44 @@ typedef struct {
  */
 Lexer* createLexer(const char* source, const char* filename, DiagnosticEngine* diagnostics);
 
+/**
+ * @brief 借用已有源码缓冲区创建词法分析器（零拷贝）
+ * @param buffer 源码缓冲区，必须在词法分析器销毁前保持有效
+ * @param filename 文件名（用于错误报告）
+ * @param diagnostics 诊断引擎（可为NULL）
+ * @return 新创建的词法分析器，失败返回NULL
+ */
+Lexer* createLexerFromBuffer(SourceBuffer* buffer, const char* filename, DiagnosticEngine* diagnostics);
+
 /**
  * @brief 从文件创建词法分析器
+ *
+ * 文件通过内存映射读入，词法分析器直接在映射内存上扫描，不复制源码。
+ *
  * @param filename 文件路径
  * @param diagnostics 诊断引擎（可为NULL）
  * @return 新创建的词法分析器，失败返回NULL
  */
 Lexer* createLexerFromFile(const char* filename, DiagnosticEngine* diagnostics);
 
+/**
+ * @brief 创建共享同一份源码的词法分析器
+ *
+ * 新的词法分析器沿用原词法分析器的源码、文件ID和选项，不在源管理器中登记
+ * 新文件，也不报告诊断（只计入errorCount）。供多个线程并行扫描同一文件的
+ * 不同区域使用，原词法分析器必须比它活得久。
+ *
+ * @param lexer 原词法分析器
+ * @return 新创建的词法分析器，用destroyLexer销毁；失败返回NULL
+ */
+Lexer* createLexerView(const Lexer* lexer);
+
 /**
  * @brief 销毁词法分析器
+ *
+ * 同时释放它在源管理器中登记的缓冲区表项：之后仍需解析其token或AST位置的
+ * 调用者，应在销毁前用sourceManagerRetainBuffer持有该文件ID。
+ *
  * @param lexer 要销毁的词法分析器
  */
 void destroyLexer(Lexer* lexer);
@@ -84,35 +163,152 @@ void destroyLexer(Lexer* lexer);
 
 /**
  * @brief 对整个源代码进行词法分析
+ *
+ * 从当前位置扫描到文件末尾，把结果写入连续的紧凑token数组（包含末尾的EOF）。
+ * 扫描结束后释放多余的预留容量。词素直接引用词法分析器的源码缓冲区，因此返回的数组不能比源码缓冲区活得久。
+ *
+ * @param lexer 词法分析器
+ * @return token数组，失败返回NULL；由调用者用destroyTokenArray释放
+ */
+TokenArray* lexerTokenize(Lexer* lexer);
+
+/**
+ * @brief 扫描源码的一段，把起点在end之前的token追加到数组
+ *
+ * 从当前位置开始扫描，遇到第一个起点不小于end的token时停止，该token不扫描，
+ * 它的诊断也不报告（见lexerScanTokenBefore）。
+ * EOF的起点小于end时会被追加，扫描随之结束。
+ *
+ * @param lexer 词法分析器
+ * @param end 区间终点（字节偏移，不含）
+ * @param tokens 追加的目标数组
+ * @param nextOffset 输出停止处那个token的起点（可为NULL；扫描到EOF时为源码长度）
+ * @return 成功返回true，内存不足时返回false
+ */
+bool lexerTokenizeRange(Lexer* lexer, size_t end, TokenArray* tokens, size_t* nextOffset);
+
+/**
+ * @brief 扫描下一个token，但不扫描起点在end及之后的token
+ *
+ * 先跳过空白和注释；下一个token的起点不在end之前时停在该起点，不扫描它，
+ * 也不报告它的诊断，留给从该起点继续扫描的调用者。分段扫描都用它判断段尾，
+ * 段尾的token不会被两段各扫描一次、重复报告诊断。
+ *
+ * @param lexer 词法分析器
+ * @param end 区间终点（字节偏移，不含）
+ * @param out 输出的扫描结果
+ * @return 扫描了一个token返回true；到达end或参数无效时返回false，
+ *         此时lexer->position是下一个token的起点
+ */
+bool lexerScanTokenBefore(Lexer* lexer, size_t end, LexedToken* out);
+
+/**
+ * @brief 扫描源码的一段，直到与另一次扫描的结果重合
+ *
+ * 与lexerTokenizeRange相同，但每扫描出一个token先在sync中查找起点相同的token：
+ * 找到时说明从这里开始两次扫描结果一致，该token不追加，扫描停止。
+ * sync中的token按起点递增，查找只向前推进，总代价与两者的token数之和成正比。
+ *
+ * @param lexer 词法分析器
+ * @param end 区间终点（字节偏移，不含）
+ * @param sync 用来对齐的token数组（可为NULL，此时等同于lexerTokenizeRange）
+ * @param tokens 追加的目标数组
+ * @param nextOffset 输出停止处那个token的起点（可为NULL）
+ * @param syncIndex 输出重合的token在sync中的下标，没有重合时为SIZE_MAX（可为NULL）
+ * @return 成功返回true，内存不足时返回false
+ */
+bool lexerTokenizeRangeUntilSync(Lexer* lexer, size_t end, const TokenArray* sync,
+                                 TokenArray* tokens, size_t* nextOffset, size_t* syncIndex);
+
+/**
+ * @brief 扫描下一个token，不分配内存
  * @param lexer 词法分析器
- * @return token向量（Vector<Token*>），失败返回NULL
+ * @param out 输出的扫描结果，到达文件末尾时类型为TOKEN_EOF
+ * @return 成功返回true，参数无效时返回false
  */
-Vector* lexerTokenize(Lexer* lexer);
+bool lexerScanToken(Lexer* lexer, LexedToken* out);
+
+/**
+ * @brief 把lexerScanToken的结果追加到紧凑token数组
+ *
+ * 字面量值写入侧表，字符串内容复制到数组的字符串池。
+ *
+ * @param tokens 目标token数组
+ * @param lexed 扫描结果
+ * @return 成功返回true，内存不足时返回false
+ */
+bool lexerAppendPackedToken(TokenArray* tokens, const LexedToken* lexed);
 
 /**
  * @brief 获取下一个token
+ *
+ * 返回的token（包括词素和字符串值）由词法分析器的token内存池持有，
+ * 在destroyLexer或lexerReset之前一直有效；调用者不能对它调用destroyToken。
+ *
  * @param lexer 词法分析器
- * @return 下一个token，到达文件末尾时返回EOF token
+ * @return 下一个token，到达文件末尾时返回EOF token；内存不足时返回NULL
  */
-Token lexerNextToken(Lexer* lexer);
+Token* lexerNextToken(Lexer* lexer);
 
 /**
  * @brief 查看下一个token但不移动位置
+ *
+ * 返回的token同样由词法分析器持有，规则与lexerNextToken相同。
+ * 结果会被缓存，随后的lexerNextToken直接返回它而不再扫描。
+ * 需要多个token的前看时使用TokenStream。
+ *
  * @param lexer 词法分析器
- * @return 下一个token
+ * @return 下一个token；内存不足时返回NULL
  */
-Token lexerPeekToken(Lexer* lexer);
+Token* lexerPeekToken(Lexer* lexer);
 
 // ==================== 状态管理 ====================
 
 /**
  * @brief 重置词法分析器到初始状态
+ *
+ * 同时释放之前lexerNextToken返回的全部token。
+ *
  * @param lexer 词法分析器
  */
 void lexerReset(Lexer* lexer);
 
+/**
+ * @brief 改为扫描另一段源码
+ *
+ * 供增量词法分析在编辑之后使用：文件ID保持不变，源管理器登记的内容随之更新，
+ * 并像lexerReset一样回到开头。词法分析器原来持有的源码缓冲区会被销毁，
+ * 新的源码由调用者持有。
+ *
+ * @param lexer 词法分析器
+ * @param source 新的源码，source[length]必须为'\0'，在词法分析器销毁前保持有效
+ * @param length 源码长度
+ * @return 成功返回true
+ */
+bool lexerSetSource(Lexer* lexer, const char* source, size_t length);
+
+/**
+ * @brief 改为扫描编辑之后的源码
+ *
+ * 与lexerSetSource相同，但告诉源管理器这次编辑的范围：已构建的行索引原地
+ * 更新而不是丢弃，每次按键之后的诊断不必重新扫描整个文件建索引。
+ *
+ * @param lexer 词法分析器
+ * @param source 编辑后的源码，source[length]必须为'\0'，在词法分析器销毁前保持有效
+ * @param length 编辑后的源码长度
+ * @param offset 编辑起始偏移
+ * @param removedLength 删除的字节数（按编辑前的源码计）
+ * @param insertedLength 插入的字节数
+ * @return 成功返回true
+ */
+bool lexerSetEditedSource(Lexer* lexer, const char* source, size_t length,
+                          size_t offset, size_t removedLength, size_t insertedLength);
+
 /**
  * @brief 获取当前位置
+ *
+ * 通过源管理器的行索引计算，首次调用时需要扫描一遍源码。
+ *
  * @param lexer 词法分析器
  * @param line 输出行号
  * @param column 输出列号
@@ -127,12 +323,28 @@ void lexerGetPosition(const Lexer* lexer, size_t* line, size_t* column);
 void lexerSetPreserveComments(Lexer* lexer, bool preserve);
 
 /**
- * @brief 设置是否支持Unicode
+ * @brief 设置是否支持Unicode（默认支持）
+ *
+ * 支持时标识符可以包含UTF-8编码的XID_Start/XID_Continue字符和通用字符名，
+ * 字面量中的UTF-8字符整个读入并检查编码是否合法；不支持时0x80及以上的
+ * 字节逐个作为未知token，字面量中按原字节处理。
+ *
  * @param lexer 词法分析器
  * @param support true支持，false不支持
  */
 void lexerSetSupportUnicode(Lexer* lexer, bool support);
 
+/**
+ * @brief 设置标识符使用的字符串驻留器（默认为NULL，不驻留）
+ *
+ * 设置后lexerNextToken/lexerPeekToken返回的标识符token的lexeme是驻留字符串，
+ * 不能修改，在驻留器销毁之前一直有效（比词法分析器活得更久）。
+ *
+ * @param lexer 词法分析器
+ * @param interner 驻留器（通常是globalStringInterner()），NULL表示不驻留
+ */
+void lexerSetStringInterner(Lexer* lexer, StringInterner* interner);
+
 // ==================== 辅助函数 ====================
 
 /**
@@ -143,6 +355,17 @@ void lexerSetSupportUnicode(Lexer* lexer, bool support);
  */
 TokenType lexerIsKeyword(const Lexer* lexer, const char* str);
 
+/**
+ * @brief 在源码切片上查找关键字
+ *
+ * 使用编译期生成的完美哈希，一次哈希加一次memcmp，不分配内存。
+ *
+ * @param str 切片起始位置（不要求以'\0'结尾）
+ * @param length 切片长度
+ * @return 如果是关键字返回对应的token类型，否则返回TOKEN_IDENTIFIER
+ */
+TokenType lexerLookupKeyword(const char* str, size_t length);
+
 /**
  * @brief 获取当前源位置
  * @param lexer 词法分析器
@@ -0,0 +1,373 @@
+#include "lexer_simd.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// ==================== 平台检测 ====================
+
+#if !defined(LEXER_SIMD_DISABLE)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LEXER_SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// AVX2版本通过target属性单独编译，运行时按CPU能力选择
+#if defined(LEXER_SIMD_SSE2) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define LEXER_SIMD_AVX2 1
+#include <immintrin.h>
+#define LEXER_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// ==================== 位操作辅助函数 ====================
+
+/**
+ * @brief 最低位1的下标（mask不能为0）
+ */
+static inline unsigned simdCountTrailingZeros(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctz(mask);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (unsigned)index;
+#else
+    unsigned index = 0;
+    while (!(mask & 1u)) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+// ==================== 标量实现 ====================
+
+static inline bool simdIsWhitespaceByte(unsigned char ch) {
+    return ch == ' ' || (ch >= '\t' && ch <= '\r');
+}
+
+static inline bool simdIsIdentifierByte(unsigned char ch) {
+    unsigned char lower = ch | 0x20;
+    return (lower >= 'a' && lower <= 'z') || (ch >= '0' && ch <= '9') || ch == '_';
+}
+
+static const char* scalarSkipWhitespace(const char* p, const char* end) {
+    while (p < end && simdIsWhitespaceByte((unsigned char)*p)) {
+        p++;
+    }
+    return p;
+}
+
+static const char* scalarSkipIdentifierChars(const char* p, const char* end) {
+    while (p < end && simdIsIdentifierByte((unsigned char)*p)) {
+        p++;
+    }
+    return p;
+}
+
+static inline bool simdIsPlainStringByte(unsigned char ch) {
+    return ch < 0x80 && ch != '"' && ch != '\\' && ch != '\n';
+}
+
+static const char* scalarSkipStringChars(const char* p, const char* end) {
+    while (p < end && simdIsPlainStringByte((unsigned char)*p)) {
+        p++;
+    }
+    return p;
+}
+
+static const char* scalarFindBlockCommentEnd(const char* p, const char* end) {
+    while (p + 1 < end) {
+        if (p[0] == '*' && p[1] == '/') {
+            return p;
+        }
+        p++;
+    }
+    return end;
+}
+
+// ==================== SSE2实现 ====================
+
+#if defined(LEXER_SIMD_SSE2)
+
+/**
+ * @brief 16字节中空白字符的位掩码
+ */
+static inline uint32_t sse2WhitespaceMask(__m128i bytes) {
+    // 字节按有符号比较，>=0x80的字节是负数，自然落在区间之外
+    __m128i control = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('\t' - 1)),
+                                    _mm_cmplt_epi8(bytes, _mm_set1_epi8('\r' + 1)));
+    __m128i space = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(' '));
+    return (uint32_t)_mm_movemask_epi8(_mm_or_si128(control, space));
+}
+
+/**
+ * @brief 16字节中标识符字符的位掩码
+ */
+static inline uint32_t sse2IdentifierMask(__m128i bytes) {
+    __m128i lower = _mm_or_si128(bytes, _mm_set1_epi8(0x20));
+    __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                  _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('0' - 1)),
+                                  _mm_cmplt_epi8(bytes, _mm_set1_epi8('9' + 1)));
+    __m128i underscore = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('_'));
+    return (uint32_t)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(alpha, digit), underscore));
+}
+
+static const char* sse2SkipWhitespace(const char* p, const char* end) {
+    while (end - p >= 16) {
+        uint32_t stop = ~sse2WhitespaceMask(_mm_loadu_si128((const __m128i*)p)) & 0xFFFFu;
+        if (stop) {
+            return p + simdCountTrailingZeros(stop);
+        }
+        p += 16;
+    }
+    return scalarSkipWhitespace(p, end);
+}
+
+static const char* sse2SkipIdentifierChars(const char* p, const char* end) {
+    while (end - p >= 16) {
+        uint32_t stop = ~sse2IdentifierMask(_mm_loadu_si128((const __m128i*)p)) & 0xFFFFu;
+        if (stop) {
+            return p + simdCountTrailingZeros(stop);
+        }
+        p += 16;
+    }
+    return scalarSkipIdentifierChars(p, end);
+}
+
+static const char* sse2SkipStringChars(const char* p, const char* end) {
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i newline = _mm_set1_epi8('\n');
+    while (end - p >= 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)p);
+        __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, quote),
+                                                    _mm_cmpeq_epi8(bytes, backslash)),
+                                       _mm_cmpeq_epi8(bytes, newline));
+        // movemask直接取每个字节的最高位，非ASCII字节不需要额外比较
+        uint32_t stop = (uint32_t)_mm_movemask_epi8(_mm_or_si128(special, bytes));
+        if (stop) {
+            return p + simdCountTrailingZeros(stop);
+        }
+        p += 16;
+    }
+    return scalarSkipStringChars(p, end);
+}
+
+static const char* sse2FindLineEnd(const char* p, const char* end) {
+    const __m128i newline = _mm_set1_epi8('\n');
+    while (end - p >= 16) {
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)p), newline));
+        if (mask) {
+            return p + simdCountTrailingZeros(mask);
+        }
+        p += 16;
+    }
+    const char* found = (const char*)memchr(p, '\n', (size_t)(end - p));
+    return found ? found : end;
+}
+
+static const char* sse2FindBlockCommentEnd(const char* p, const char* end) {
+    const __m128i star = _mm_set1_epi8('*');
+    const __m128i slash = _mm_set1_epi8('/');
+    // 第二次加载错开一个字节，需要多留一个字节
+    while (end - p >= 17) {
+        __m128i first = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)p), star);
+        __m128i second = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p + 1)), slash);
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(first, second));
+        if (mask) {
+            return p + simdCountTrailingZeros(mask);
+        }
+        p += 16;
+    }
+    return scalarFindBlockCommentEnd(p, end);
+}
+
+#endif
+
+// ==================== AVX2实现 ====================
+
+#if defined(LEXER_SIMD_AVX2)
+
+LEXER_TARGET_AVX2
+static const char* avx2SkipWhitespace(const char* p, const char* end) {
+    while (end - p >= 32) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)p);
+        __m256i control = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, _mm256_set1_epi8('\t' - 1)),
+                                           _mm256_cmpgt_epi8(_mm256_set1_epi8('\r' + 1), bytes));
+        __m256i space = _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(' '));
+        uint32_t stop = ~(uint32_t)_mm256_movemask_epi8(_mm256_or_si256(control, space));
+        if (stop) {
+            return p + simdCountTrailingZeros(stop);
+        }
+        p += 32;
+    }
+    return sse2SkipWhitespace(p, end);
+}
+
+LEXER_TARGET_AVX2
+static const char* avx2SkipIdentifierChars(const char* p, const char* end) {
+    while (end - p >= 32) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)p);
+        __m256i lower = _mm256_or_si256(bytes, _mm256_set1_epi8(0x20));
+        __m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                                         _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+        __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, _mm256_set1_epi8('0' - 1)),
+                                         _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), bytes));
+        __m256i underscore = _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('_'));
+        uint32_t stop = ~(uint32_t)_mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_or_si256(alpha, digit), underscore));
+        if (stop) {
+            return p + simdCountTrailingZeros(stop);
+        }
+        p += 32;
+    }
+    return sse2SkipIdentifierChars(p, end);
+}
+
+LEXER_TARGET_AVX2
+static const char* avx2SkipStringChars(const char* p, const char* end) {
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i newline = _mm256_set1_epi8('\n');
+    while (end - p >= 32) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)p);
+        __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(bytes, quote),
+                                                          _mm256_cmpeq_epi8(bytes, backslash)),
+                                          _mm256_cmpeq_epi8(bytes, newline));
+        uint32_t stop = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(special, bytes));
+        if (stop) {
+            return p + simdCountTrailingZeros(stop);
+        }
+        p += 32;
+    }
+    return sse2SkipStringChars(p, end);
+}
+
+LEXER_TARGET_AVX2
+static const char* avx2FindLineEnd(const char* p, const char* end) {
+    const __m256i newline = _mm256_set1_epi8('\n');
+    while (end - p >= 32) {
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)p), newline));
+        if (mask) {
+            return p + simdCountTrailingZeros(mask);
+        }
+        p += 32;
+    }
+    return sse2FindLineEnd(p, end);
+}
+
+LEXER_TARGET_AVX2
+static const char* avx2FindBlockCommentEnd(const char* p, const char* end) {
+    const __m256i star = _mm256_set1_epi8('*');
+    const __m256i slash = _mm256_set1_epi8('/');
+    while (end - p >= 33) {
+        __m256i first = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)p), star);
+        __m256i second = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(p + 1)), slash);
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(first, second));
+        if (mask) {
+            return p + simdCountTrailingZeros(mask);
+        }
+        p += 32;
+    }
+    return sse2FindBlockCommentEnd(p, end);
+}
+
+/**
+ * @brief CPU是否支持AVX2（__builtin_cpu_supports只读取启动时缓存的结果）
+ */
+static inline bool simdHasAvx2(void) {
+    return __builtin_cpu_supports("avx2");
+}
+
+#endif
+
+// ==================== 公共接口 ====================
+
+const char* simdSkipWhitespace(const char* p, const char* end) {
+#if defined(LEXER_SIMD_AVX2)
+    if (simdHasAvx2()) {
+        return avx2SkipWhitespace(p, end);
+    }
+#endif
+#if defined(LEXER_SIMD_SSE2)
+    return sse2SkipWhitespace(p, end);
+#else
+    return scalarSkipWhitespace(p, end);
+#endif
+}
+
+const char* simdSkipIdentifierChars(const char* p, const char* end) {
+#if defined(LEXER_SIMD_AVX2)
+    if (simdHasAvx2()) {
+        return avx2SkipIdentifierChars(p, end);
+    }
+#endif
+#if defined(LEXER_SIMD_SSE2)
+    return sse2SkipIdentifierChars(p, end);
+#else
+    return scalarSkipIdentifierChars(p, end);
+#endif
+}
+
+const char* simdSkipStringChars(const char* p, const char* end) {
+#if defined(LEXER_SIMD_AVX2)
+    if (simdHasAvx2()) {
+        return avx2SkipStringChars(p, end);
+    }
+#endif
+#if defined(LEXER_SIMD_SSE2)
+    return sse2SkipStringChars(p, end);
+#else
+    return scalarSkipStringChars(p, end);
+#endif
+}
+
+const char* simdFindLineEnd(const char* p, const char* end) {
+#if defined(LEXER_SIMD_AVX2)
+    if (simdHasAvx2()) {
+        return avx2FindLineEnd(p, end);
+    }
+#endif
+#if defined(LEXER_SIMD_SSE2)
+    return sse2FindLineEnd(p, end);
+#else
+    const char* found = (const char*)memchr(p, '\n', (size_t)(end - p));
+    return found ? found : end;
+#endif
+}
+
+const char* simdFindBlockCommentEnd(const char* p, const char* end) {
+#if defined(LEXER_SIMD_AVX2)
+    if (simdHasAvx2()) {
+        return avx2FindBlockCommentEnd(p, end);
+    }
+#endif
+#if defined(LEXER_SIMD_SSE2)
+    return sse2FindBlockCommentEnd(p, end);
+#else
+    return scalarFindBlockCommentEnd(p, end);
+#endif
+}
+
+const char* simdImplementationName(void) {
+#if defined(LEXER_SIMD_AVX2)
+    if (simdHasAvx2()) {
+        return "avx2";
+    }
+#endif
+#if defined(LEXER_SIMD_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
@@ -0,0 +1,56 @@
+#ifndef LEXER_SIMD_H
+#define LEXER_SIMD_H
+
+#include <stddef.h>
+
+/**
+ * @brief 词法分析的批量字符扫描
+ *
+ * 空白、注释、标识符和字符串占了源码的大部分字节，这里一次分类16（SSE2）或
+ * 32（AVX2）个字节，找到第一个需要逐字符处理的位置。AVX2在运行时检测，
+ * 不支持的平台使用逐字节的标量实现，结果与SIMD版本完全一致。
+ *
+ * 所有函数都在[p, end)内扫描，不会读取end之后的字节，返回停止的位置；
+ * 扫描到end仍未找到时返回end。
+ */
+
+/**
+ * @brief 跳过空白字符（' ' '\t' '\n' '\v' '\f' '\r'）
+ * @return 第一个非空白字符的位置
+ */
+const char* simdSkipWhitespace(const char* p, const char* end);
+
+/**
+ * @brief 跳过标识符字符（[A-Za-z0-9_]）
+ * @return 第一个不能出现在标识符中的字符的位置
+ */
+const char* simdSkipIdentifierChars(const char* p, const char* end);
+
+/**
+ * @brief 跳过字符串字面量中不需要特殊处理的ASCII字符
+ *
+ * 在'"'、'\\'、'\n'或任何>=0x80的字节处停止，纯ASCII的内容可以整段复制，
+ * 只有遇到UTF-8多字节字符时才需要逐字符解码。
+ *
+ * @return 第一个需要逐字符处理的字节的位置
+ */
+const char* simdSkipStringChars(const char* p, const char* end);
+
+/**
+ * @brief 查找行尾
+ * @return 第一个'\n'的位置
+ */
+const char* simdFindLineEnd(const char* p, const char* end);
+
+/**
+ * @brief 查找块注释的结束标记
+ * @return 第一个"*\/"中'*'的位置
+ */
+const char* simdFindBlockCommentEnd(const char* p, const char* end);
+
+/**
+ * @brief 当前使用的实现名称（"avx2"、"sse2"或"scalar"）
+ */
+const char* simdImplementationName(void);
+
+#endif
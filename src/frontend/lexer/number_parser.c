@@ -0,0 +1,589 @@
+#include "number_parser.h"
+#include "number_tables.h"
+#include "char_class.h"
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 十进制尾数最多保留的有效数字位数（10^19 < 2^64）
+#define NUMBER_MAX_DECIMAL_DIGITS 19
+
+// 十六进制尾数最多保留的有效数字位数（16 * 4 = 64位）
+#define NUMBER_MAX_HEX_DIGITS 16
+
+// 指数的绝对值超过这个数时结果必然是0或无穷大，继续累加没有意义
+#define NUMBER_EXPONENT_LIMIT 100000
+
+// double的尾数位数（不含隐含的最高位）
+#define DOUBLE_MANTISSA_BITS 52
+
+// ==================== 128位乘法 ====================
+
+#if defined(__SIZEOF_INT128__)
+// __int128是GNU扩展，__extension__避免-Wpedantic警告
+__extension__ typedef unsigned __int128 NumberUint128;
+#endif
+
+/**
+ * @brief 64位乘64位得到128位乘积
+ */
+static inline void numberFullMultiply(uint64_t a, uint64_t b, uint64_t* high, uint64_t* low) {
+#if defined(__SIZEOF_INT128__)
+    NumberUint128 product = (NumberUint128)a * b;
+    *high = (uint64_t)(product >> 64);
+    *low = (uint64_t)product;
+#else
+    uint64_t aLow = a & 0xFFFFFFFFu, aHigh = a >> 32;
+    uint64_t bLow = b & 0xFFFFFFFFu, bHigh = b >> 32;
+    uint64_t lowLow = aLow * bLow;
+    uint64_t highLow = aHigh * bLow;
+    uint64_t lowHigh = aLow * bHigh;
+    uint64_t highHigh = aHigh * bHigh;
+    uint64_t cross = (lowLow >> 32) + (highLow & 0xFFFFFFFFu) + lowHigh;
+    *high = highHigh + (highLow >> 32) + (cross >> 32);
+    *low = (cross << 32) | (lowLow & 0xFFFFFFFFu);
+#endif
+}
+
+/**
+ * @brief 前导零的个数（x不为0）
+ */
+static inline int numberLeadingZeros(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(x);
+#else
+    int count = 0;
+    while (!(x & 0x8000000000000000ULL)) {
+        x <<= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief floor(log2(10^q)) + 63，对|q| <= 342精确
+ */
+static inline int64_t numberBinaryExponent(int64_t q) {
+    // 217706 / 2^16 ≈ log2(10)；负数时向下取整，不依赖有符号右移的实现
+    int64_t scaled = 217706 * q;
+    int64_t quotient = scaled >= 0 ? scaled >> 16 : -((-scaled + 65535) >> 16);
+    return quotient + 63;
+}
+
+// ==================== 十进制到二进制的转换 ====================
+
+static double numberFromBits(uint64_t bits) {
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Clinger快速路径
+ *
+ * 尾数和10^|q|都能被double精确表示时，一次乘法或除法就是正确舍入的结果。
+ * x87等扩展精度的求值方式会产生双重舍入，这时不走快速路径。
+ */
+static bool numberClingerFastPath(uint64_t w, int64_t q, double* result) {
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    static const double powersOfTen[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    if (w > (1ULL << 53) || q < -22 || q > 22) {
+        return false;
+    }
+    double value = (double)w;
+    *result = q >= 0 ? value * powersOfTen[q] : value / powersOfTen[-q];
+    return true;
+#else
+    (void)w;
+    (void)q;
+    (void)result;
+    return false;
+#endif
+}
+
+/**
+ * @brief Eisel-Lemire算法
+ *
+ * 用128位截断的5^q近似值乘以规格化后的尾数，取乘积的高位作为结果尾数。
+ * 截断误差只在乘积恰好落在舍入边界附近时才可能影响结果，这种情况返回false。
+ */
+static bool numberEiselLemire(uint64_t w, int64_t q, double* result) {
+    int lz = numberLeadingZeros(w);
+    w <<= lz;
+
+    const uint64_t* power = numberPowerOfFiveTable[q - NUMBER_POWER_OF_FIVE_MIN_EXPONENT];
+    uint64_t high, low;
+    numberFullMultiply(w, power[0], &high, &low);
+
+    // 结果需要55位（52位尾数+隐含位+舍入位+平局判断位）；
+    // 低9位全为1时，低64位的乘积可能进位，需要补上
+    const uint64_t precisionMask = 0xFFFFFFFFFFFFFFFFULL >> (DOUBLE_MANTISSA_BITS + 3);
+    if ((high & precisionMask) == precisionMask) {
+        uint64_t secondHigh, secondLow;
+        numberFullMultiply(w, power[1], &secondHigh, &secondLow);
+        low += secondHigh;
+        if (secondHigh > low) {
+            high++;
+        }
+    }
+
+    // 仍然无法排除进位的影响，交给慢速路径
+    if (low == 0xFFFFFFFFFFFFFFFFULL && (q < -27 || q > 55)) {
+        return false;
+    }
+
+    int upperBit = (int)(high >> 63);
+    int shift = upperBit + 64 - DOUBLE_MANTISSA_BITS - 3;
+    uint64_t mantissa = high >> shift;
+    int64_t power2 = numberBinaryExponent(q) + upperBit - lz + 1023;
+
+    if (power2 <= 0) {
+        // 非规格化数
+        if (-power2 + 1 >= 64) {
+            *result = 0.0;
+            return true;
+        }
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        // 舍入后可能进位成最小的规格化数，尾数的第52位正好落在指数域
+        *result = numberFromBits(mantissa);
+        return true;
+    }
+
+    // 乘积恰好在两个double的正中间：只有10^q能被精确表示时才可能，按平局取偶处理
+    if (low <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1) {
+        if ((mantissa << shift) == high) {
+            mantissa &= ~1ULL;
+        }
+    }
+
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (2ULL << DOUBLE_MANTISSA_BITS)) {
+        mantissa = 1ULL << DOUBLE_MANTISSA_BITS;
+        power2++;
+    }
+    mantissa &= ~(1ULL << DOUBLE_MANTISSA_BITS);
+
+    if (power2 >= 0x7FF) {
+        *result = HUGE_VAL;
+        return true;
+    }
+    *result = numberFromBits(mantissa | ((uint64_t)power2 << DOUBLE_MANTISSA_BITS));
+    return true;
+}
+
+bool numberDecimalToDouble(uint64_t w, int64_t q, double* result) {
+    if (!result) {
+        return false;
+    }
+    if (w == 0 || q < NUMBER_POWER_OF_FIVE_MIN_EXPONENT) {
+        *result = 0.0;
+        return true;
+    }
+    if (q > NUMBER_POWER_OF_FIVE_MAX_EXPONENT) {
+        *result = HUGE_VAL;
+        return true;
+    }
+    if (numberClingerFastPath(w, q, result)) {
+        return true;
+    }
+    return numberEiselLemire(w, q, result);
+}
+
+// ==================== 字面量扫描 ====================
+
+/**
+ * @brief 扫描游标
+ */
+typedef struct {
+    const char* p;
+    const char* end;
+} NumberCursor;
+
+static inline char numberPeek(const NumberCursor* cursor, size_t k) {
+    return (size_t)(cursor->end - cursor->p) > k ? cursor->p[k] : '\0';
+}
+
+/**
+ * @brief 浮点数尾数的累加状态
+ */
+typedef struct {
+    uint64_t mantissa;          // 保留的有效数字
+    int digits;                 // 保留的有效数字位数
+    int64_t exponent;           // 尾数对应的十进制（或二进制）指数
+    bool truncated;             // 是否丢弃了非零数字
+} NumberMantissa;
+
+/**
+ * @brief 累加一个十进制数字
+ * @param fraction 是否为小数部分的数字
+ */
+static inline void numberAccumulateDecimal(NumberMantissa* m, int digit, bool fraction) {
+    if (m->digits < NUMBER_MAX_DECIMAL_DIGITS) {
+        m->mantissa = m->mantissa * 10 + (uint64_t)digit;
+        if (m->mantissa != 0) {
+            m->digits++;
+        }
+        if (fraction) {
+            m->exponent--;
+        }
+    } else {
+        m->truncated |= digit != 0;
+        if (!fraction) {
+            m->exponent++;
+        }
+    }
+}
+
+/**
+ * @brief 累加一个十六进制数字（指数以2为底）
+ */
+static inline void numberAccumulateHex(NumberMantissa* m, int digit, bool fraction) {
+    if (m->digits < NUMBER_MAX_HEX_DIGITS) {
+        m->mantissa = (m->mantissa << 4) | (uint64_t)digit;
+        if (m->mantissa != 0) {
+            m->digits++;
+        }
+        if (fraction) {
+            m->exponent -= 4;
+        }
+    } else {
+        m->truncated |= digit != 0;
+        if (!fraction) {
+            m->exponent += 4;
+        }
+    }
+}
+
+/**
+ * @brief 扫描指数部分（e/E或p/P之后的[+-]数字）
+ * @return 找到了数字返回true；没有数字时游标仍前进到符号之后
+ */
+static bool numberScanExponent(NumberCursor* cursor, int64_t* exponent) {
+    bool negative = false;
+    char ch = numberPeek(cursor, 0);
+    if (ch == '+' || ch == '-') {
+        negative = ch == '-';
+        cursor->p++;
+    }
+
+    if (!charIsDigit(numberPeek(cursor, 0))) {
+        return false;
+    }
+
+    int64_t value = 0;
+    while (charIsDigit(numberPeek(cursor, 0))) {
+        if (value < NUMBER_EXPONENT_LIMIT) {
+            value = value * 10 + (*cursor->p - '0');
+        }
+        cursor->p++;
+    }
+    *exponent = negative ? -value : value;
+    return true;
+}
+
+/**
+ * @brief 慢速路径：复制数字部分交给strtod
+ */
+static double numberStrtodFallback(const char* start, size_t length) {
+    char local[128];
+    char* buffer = length < sizeof(local) ? local : (char*)malloc(length + 1);
+    if (!buffer) {
+        return 0.0;
+    }
+    memcpy(buffer, start, length);
+    buffer[length] = '\0';
+    double value = strtod(buffer, NULL);
+    if (buffer != local) {
+        free(buffer);
+    }
+    return value;
+}
+
+/**
+ * @brief 由尾数和十进制指数计算浮点值
+ */
+static double numberFinishDecimalFloat(const NumberMantissa* m, const char* start, size_t length) {
+    double value;
+    if (!m->truncated) {
+        if (numberDecimalToDouble(m->mantissa, m->exponent, &value)) {
+            return value;
+        }
+    } else {
+        // 真实值在w和w+1之间，两端舍入到同一个double时它就是答案
+        double upper;
+        if (numberDecimalToDouble(m->mantissa, m->exponent, &value) &&
+            numberDecimalToDouble(m->mantissa + 1, m->exponent, &upper) &&
+            value == upper) {
+            return value;
+        }
+    }
+    return numberStrtodFallback(start, length);
+}
+
+/**
+ * @brief 由尾数和二进制指数计算十六进制浮点值
+ */
+static double numberFinishHexFloat(const NumberMantissa* m, const char* start, size_t length) {
+    if (m->mantissa == 0) {
+        return 0.0;
+    }
+    // 尾数能被double精确表示时，ldexp只做一次舍入
+    if (!m->truncated && m->mantissa < (1ULL << 53)) {
+        int64_t exponent = m->exponent;
+        if (exponent > NUMBER_EXPONENT_LIMIT) exponent = NUMBER_EXPONENT_LIMIT;
+        if (exponent < -NUMBER_EXPONENT_LIMIT) exponent = -NUMBER_EXPONENT_LIMIT;
+        return ldexp((double)m->mantissa, (int)exponent);
+    }
+    return numberStrtodFallback(start, length);
+}
+
+/**
+ * @brief 解析并校验后缀
+ */
+static NumberParseStatus numberParseSuffix(const char* suffix, size_t length, NumberLiteral* out) {
+    if (length == 0) {
+        return NUMBER_PARSE_OK;
+    }
+
+    if (out->isFloat) {
+        if (length == 1 && (suffix[0] == 'f' || suffix[0] == 'F')) {
+            out->isFloatSuffix = true;
+            return NUMBER_PARSE_OK;
+        }
+        if (length == 1 && (suffix[0] == 'l' || suffix[0] == 'L')) {
+            out->isLongDouble = true;
+            return NUMBER_PARSE_OK;
+        }
+        return NUMBER_PARSE_INVALID_SUFFIX;
+    }
+
+    // 整数后缀：u和l/ll各至多出现一次，顺序任意；ll的两个字母大小写必须一致
+    size_t i = 0;
+    bool sawUnsigned = false;
+    bool sawLong = false;
+    while (i < length) {
+        char ch = suffix[i];
+        if ((ch == 'u' || ch == 'U') && !sawUnsigned) {
+            sawUnsigned = true;
+            out->isUnsigned = true;
+            i++;
+        } else if ((ch == 'l' || ch == 'L') && !sawLong) {
+            sawLong = true;
+            if (i + 1 < length && suffix[i + 1] == ch) {
+                out->longCount = 2;
+                i += 2;
+            } else {
+                out->longCount = 1;
+                i++;
+            }
+        } else {
+            return NUMBER_PARSE_INVALID_SUFFIX;
+        }
+    }
+    return NUMBER_PARSE_OK;
+}
+
+/**
+ * @brief 扫描十六进制数字：整数、浮点数，一起累加
+ */
+static NumberParseStatus numberScanHex(NumberCursor* cursor, NumberLiteral* out, NumberMantissa* m) {
+    NumberParseStatus status = NUMBER_PARSE_OK;
+    bool anyDigits = false;
+
+    while (charIsHexDigit(numberPeek(cursor, 0))) {
+        int digit = charHexValue(*cursor->p);
+        if (out->intValue >> 60) {
+            status = NUMBER_PARSE_OVERFLOW;
+        }
+        out->intValue = (out->intValue << 4) | (unsigned long long)digit;
+        numberAccumulateHex(m, digit, false);
+        anyDigits = true;
+        cursor->p++;
+    }
+
+    char ch = numberPeek(cursor, 0);
+    if (ch == '.' || ch == 'p' || ch == 'P') {
+        out->isFloat = true;
+        status = NUMBER_PARSE_OK;
+        if (ch == '.') {
+            cursor->p++;
+            while (charIsHexDigit(numberPeek(cursor, 0))) {
+                numberAccumulateHex(m, charHexValue(*cursor->p), true);
+                anyDigits = true;
+                cursor->p++;
+            }
+        }
+
+        // 十六进制浮点数必须带二进制指数
+        ch = numberPeek(cursor, 0);
+        if (ch != 'p' && ch != 'P') {
+            return NUMBER_PARSE_NO_DIGITS;
+        }
+        cursor->p++;
+        int64_t exponent = 0;
+        if (!numberScanExponent(cursor, &exponent)) {
+            return NUMBER_PARSE_NO_DIGITS;
+        }
+        m->exponent += exponent;
+    }
+
+    return anyDigits ? status : NUMBER_PARSE_NO_DIGITS;
+}
+
+/**
+ * @brief 扫描二进制整数
+ */
+static NumberParseStatus numberScanBinary(NumberCursor* cursor, NumberLiteral* out) {
+    NumberParseStatus status = NUMBER_PARSE_OK;
+    if (!charIsDigit(numberPeek(cursor, 0))) {
+        return NUMBER_PARSE_NO_DIGITS;
+    }
+
+    while (charIsDigit(numberPeek(cursor, 0))) {
+        int digit = *cursor->p - '0';
+        if (digit > 1) {
+            status = NUMBER_PARSE_INVALID_DIGIT;
+        } else {
+            if ((out->intValue >> 63) && status == NUMBER_PARSE_OK) {
+                status = NUMBER_PARSE_OVERFLOW;
+            }
+            out->intValue = (out->intValue << 1) | (unsigned long long)digit;
+        }
+        cursor->p++;
+    }
+    return status;
+}
+
+/**
+ * @brief 扫描十进制/八进制整数或十进制浮点数
+ *
+ * 以0开头的数字序列可能是八进制整数，也可能是十进制浮点数（如09.5），
+ * 所以整数值和浮点尾数在同一趟扫描中一起累加，看到小数点或指数后再决定。
+ */
+static NumberParseStatus numberScanDecimal(NumberCursor* cursor, NumberLiteral* out, NumberMantissa* m) {
+    // 单独的0按十进制处理
+    bool octal = numberPeek(cursor, 0) == '0' && charIsDigit(numberPeek(cursor, 1));
+    unsigned long long base = octal ? 8 : 10;
+    NumberParseStatus status = NUMBER_PARSE_OK;
+
+    while (charIsDigit(numberPeek(cursor, 0))) {
+        int digit = *cursor->p - '0';
+        if ((unsigned long long)digit >= base) {
+            if (status == NUMBER_PARSE_OK) {
+                status = NUMBER_PARSE_INVALID_DIGIT;
+            }
+        } else if (out->intValue > (0xFFFFFFFFFFFFFFFFULL - (unsigned long long)digit) / base) {
+            if (status == NUMBER_PARSE_OK) {
+                status = NUMBER_PARSE_OVERFLOW;
+            }
+            out->intValue = out->intValue * base + (unsigned long long)digit;
+        } else {
+            out->intValue = out->intValue * base + (unsigned long long)digit;
+        }
+        numberAccumulateDecimal(m, digit, false);
+        cursor->p++;
+    }
+
+    char ch = numberPeek(cursor, 0);
+    if (ch == '.') {
+        out->isFloat = true;
+        cursor->p++;
+        while (charIsDigit(numberPeek(cursor, 0))) {
+            numberAccumulateDecimal(m, *cursor->p - '0', true);
+            cursor->p++;
+        }
+        ch = numberPeek(cursor, 0);
+    }
+
+    if (ch == 'e' || ch == 'E') {
+        // 只有e后面跟着（可带符号的）数字才是指数，否则e属于后缀
+        char next = numberPeek(cursor, 1);
+        bool signedExponent = (next == '+' || next == '-') && charIsDigit(numberPeek(cursor, 2));
+        if (charIsDigit(next) || signedExponent) {
+            out->isFloat = true;
+            cursor->p++;
+            int64_t exponent = 0;
+            numberScanExponent(cursor, &exponent);
+            m->exponent += exponent;
+        } else if (next == '+' || next == '-') {
+            cursor->p += 2;
+            out->isFloat = true;
+            return NUMBER_PARSE_NO_DIGITS;
+        }
+    }
+
+    if (out->isFloat) {
+        return NUMBER_PARSE_OK;
+    }
+    out->base = octal ? 8 : 10;
+    return status;
+}
+
+size_t numberParseLiteral(const char* p, const char* end, NumberLiteral* out) {
+    if (!p || !end || !out || p >= end) {
+        return 0;
+    }
+
+    memset(out, 0, sizeof(NumberLiteral));
+    out->base = 10;
+
+    NumberCursor cursor = { p, end };
+    char first = numberPeek(&cursor, 0);
+    if (!charIsDigit(first) && !(first == '.' && charIsDigit(numberPeek(&cursor, 1)))) {
+        return 0;
+    }
+
+    NumberMantissa mantissa = { 0, 0, 0, false };
+    NumberParseStatus status;
+    char second = charToLower(numberPeek(&cursor, 1));
+
+    if (first == '0' && second == 'x') {
+        cursor.p += 2;
+        out->base = 16;
+        status = numberScanHex(&cursor, out, &mantissa);
+    } else if (first == '0' && second == 'b') {
+        cursor.p += 2;
+        out->base = 2;
+        status = numberScanBinary(&cursor, out);
+    } else {
+        status = numberScanDecimal(&cursor, out, &mantissa);
+    }
+
+    // 数字部分结束的位置（不含后缀），慢速路径只需要这一段
+    const char* numberEnd = cursor.p;
+
+    // 紧跟的标识符字符都属于这个字面量
+    while (charIsIdentifier(numberPeek(&cursor, 0))) {
+        cursor.p++;
+    }
+    // 后缀非法时数值仍然有效，便于报错后继续分析
+    bool digitsValid = status == NUMBER_PARSE_OK;
+    NumberParseStatus suffixStatus = numberParseSuffix(numberEnd, (size_t)(cursor.p - numberEnd), out);
+    if (status == NUMBER_PARSE_OK) {
+        status = suffixStatus;
+    }
+
+    if (out->isFloat) {
+        out->base = out->base == 16 ? 16 : 10;
+        out->intValue = 0;
+        if (digitsValid) {
+            size_t numberLength = (size_t)(numberEnd - p);
+            out->floatValue = out->base == 16
+                ? numberFinishHexFloat(&mantissa, p, numberLength)
+                : numberFinishDecimalFloat(&mantissa, p, numberLength);
+        }
+    }
+
+    out->status = status;
+    out->length = (size_t)(cursor.p - p);
+    return out->length;
+}
@@ -0,0 +1,65 @@
+#ifndef NUMBER_PARSER_H
+#define NUMBER_PARSER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief 数字字面量解析结果
+ */
+typedef enum {
+    NUMBER_PARSE_OK,                // 解析成功
+    NUMBER_PARSE_OVERFLOW,          // 整数超出64位（值被截断）
+    NUMBER_PARSE_NO_DIGITS,         // 前缀或指数后缺少数字，如0x、1e+
+    NUMBER_PARSE_INVALID_DIGIT,     // 数字超出进制范围，如八进制的8、9
+    NUMBER_PARSE_INVALID_SUFFIX     // 无法识别的后缀，如1uu、1.0x
+} NumberParseStatus;
+
+/**
+ * @brief 一个数字字面量的解析结果
+ */
+typedef struct {
+    NumberParseStatus status;   // 解析状态
+    bool isFloat;               // 是否浮点数
+    int base;                   // 进制（2/8/10/16）
+    unsigned long long intValue;  // 整数值（按64位无符号保存）
+    double floatValue;          // 浮点值
+    bool isUnsigned;            // 整数后缀u/U
+    int longCount;              // 整数后缀l/ll的个数（0、1、2）
+    bool isFloatSuffix;         // 浮点后缀f/F
+    bool isLongDouble;          // 浮点后缀l/L
+    size_t length;              // 字面量总长度（含后缀）
+} NumberLiteral;
+
+/**
+ * @brief 一趟扫描解析数字字面量
+ *
+ * 识别十进制、十六进制、八进制、二进制整数，十进制和十六进制浮点数，
+ * 以及整数后缀u、l、ll的任意组合和浮点后缀f、l。整数值在扫描数字的同时累加，
+ * 十进制浮点数先走Clinger快速路径，再走Eisel-Lemire算法，都能得到正确舍入的
+ * 结果；极少数两者都无法判定的情况（超过19位有效数字等）回退到strtod。
+ *
+ * 和预处理数一样，字面量之后紧跟的标识符字符都算作后缀，
+ * 因此返回的长度总是延伸到下一个不能出现在数字中的字符。
+ *
+ * @param p 字面量起始位置（数字或'.'后跟数字）
+ * @param end 输入结束位置，不会读取end之后的字节
+ * @param out 输出解析结果
+ * @return 字面量的长度，p处不是数字字面量时返回0
+ */
+size_t numberParseLiteral(const char* p, const char* end, NumberLiteral* out);
+
+/**
+ * @brief 把十进制尾数和指数转换为最接近的double
+ *
+ * 计算w * 10^q并正确舍入（就近舍入，平局取偶）。
+ *
+ * @param w 十进制尾数
+ * @param q 十进制指数
+ * @param result 输出结果
+ * @return 能确定正确舍入的结果时返回true，否则返回false（调用者应回退到strtod）
+ */
+bool numberDecimalToDouble(uint64_t w, int64_t q, double* result);
+
+#endif
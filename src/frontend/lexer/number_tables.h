@@ -0,0 +1,19 @@
+#ifndef NUMBER_TABLES_H
+#define NUMBER_TABLES_H
+
+#include <stdint.h>
+
+// 十的幂次表覆盖的范围：10^-342以下的十进制数舍入为0，10^308以上溢出为无穷大
+#define NUMBER_POWER_OF_FIVE_MIN_EXPONENT (-342)
+#define NUMBER_POWER_OF_FIVE_MAX_EXPONENT 308
+
+/**
+ * @brief 5的幂次的128位近似值
+ *
+ * 第i项对应5^(i + NUMBER_POWER_OF_FIVE_MIN_EXPONENT)，左移到最高位为1，
+ * 保留高128位（[0]为高64位，[1]为低64位）。负指数项是倒数向上取整的结果。
+ * 供Eisel-Lemire算法把十进制尾数乘以10^q，表由脚本生成，不要手工修改。
+ */
+extern const uint64_t numberPowerOfFiveTable[][2];
+
+#endif
@@ -0,0 +1,266 @@
+// sysconf(_SC_NPROCESSORS_ONLN)和pthread需要POSIX接口
+#define _DEFAULT_SOURCE
+#include "parallel_lexer.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/**
+ * @brief 源码的一个分块及其投机扫描结果
+ */
+typedef struct {
+    size_t start;           // 块起点（行首）
+    size_t end;             // 块终点（不含）；最后一块为源码长度+1，以包含EOF
+    TokenArray* tokens;     // 从块首投机扫描出的token，扫描失败时为NULL
+    size_t nextOffset;      // 块之后第一个token的起点
+    size_t reportCount;     // 投机扫描中产生的错误和警告数
+} LexerChunk;
+
+/**
+ * @brief 所有工作线程共享的任务
+ */
+typedef struct {
+    const Lexer* lexer;     // 原词法分析器（只读）
+    LexerChunk* chunks;
+    size_t chunkCount;
+    atomic_size_t nextChunk;  // 下一个待领取的分块
+} ParallelLexJob;
+
+// ==================== 分块 ====================
+
+/**
+ * @brief 在换行处把[start, length)切成最多maxChunks块
+ * @return 实际块数，内存不足返回0
+ */
+static size_t parallelSplitChunks(const char* source, size_t start, size_t length,
+                                  size_t maxChunks, LexerChunk** outChunks) {
+    size_t chunkSize = (length - start) / maxChunks;
+    if (chunkSize < PARALLEL_LEXER_MIN_CHUNK_SIZE) {
+        chunkSize = PARALLEL_LEXER_MIN_CHUNK_SIZE;
+    }
+
+    LexerChunk* chunks = calloc(maxChunks, sizeof(LexerChunk));
+    if (!chunks) {
+        return 0;
+    }
+
+    size_t count = 0;
+    size_t begin = start;
+    while (count + 1 < maxChunks && length - begin > chunkSize) {
+        // 块终点推进到目标位置之后的第一个换行之后
+        const char* newline = memchr(source + begin + chunkSize, '\n',
+                                     length - begin - chunkSize);
+        if (!newline || (size_t)(newline + 1 - source) >= length) {
+            break;
+        }
+        size_t end = (size_t)(newline + 1 - source);
+        chunks[count].start = begin;
+        chunks[count].end = end;
+        count++;
+        begin = end;
+    }
+
+    // 最后一块延伸到源码长度+1，让起点等于源码长度的EOF落在块内
+    chunks[count].start = begin;
+    chunks[count].end = length + 1;
+    count++;
+
+    *outChunks = chunks;
+    return count;
+}
+
+// ==================== 投机扫描 ====================
+
+/**
+ * @brief 从块首开始扫描一块，不输出诊断
+ */
+static void parallelLexChunk(Lexer* view, LexerChunk* chunk) {
+    size_t estimate = (chunk->end - chunk->start) / 5 + 16;
+    chunk->tokens = createTokenArray(view->source, view->sourceLength, view->fileId, estimate);
+    if (!chunk->tokens) {
+        return;
+    }
+
+    view->position = chunk->start;
+    view->errorCount = 0;
+    view->warningCount = 0;
+    if (!lexerTokenizeRange(view, chunk->end, chunk->tokens, &chunk->nextOffset)) {
+        destroyTokenArray(chunk->tokens);
+        chunk->tokens = NULL;
+        return;
+    }
+    chunk->reportCount = view->errorCount + view->warningCount;
+}
+
+/**
+ * @brief 工作线程：不断领取分块直到全部领完
+ */
+static void* parallelLexWorker(void* arg) {
+    ParallelLexJob* job = arg;
+
+    // 视图共享源码但没有诊断引擎；创建失败时不领任务，剩下的块在拼接时顺序扫描
+    Lexer* view = createLexerView(job->lexer);
+    if (!view) {
+        return NULL;
+    }
+
+    for (;;) {
+        size_t index = atomic_fetch_add(&job->nextChunk, 1);
+        if (index >= job->chunkCount) {
+            break;
+        }
+        parallelLexChunk(view, &job->chunks[index]);
+    }
+
+    destroyLexer(view);
+    return NULL;
+}
+
+// ==================== 拼接 ====================
+
+/**
+ * @brief 用原词法分析器重新扫描[from, end)，只为按顺序输出诊断
+ */
+static void parallelReplayDiagnostics(Lexer* lexer, size_t from, size_t end) {
+    LexedToken lexed;
+    lexer->position = from;
+    while (lexerScanTokenBefore(lexer, end, &lexed) && lexed.type != TOKEN_EOF) {
+    }
+}
+
+/**
+ * @brief 沿用块的投机结果中从下标index开始的部分
+ *
+ * 投机扫描产生过诊断时，从replayFrom（重合的token已由原词法分析器扫描过，
+ * 它的诊断已经报告）重放到块尾。
+ */
+static bool parallelSpliceChunk(Lexer* lexer, const LexerChunk* chunk, size_t index,
+                                size_t replayFrom, TokenArray* result) {
+    size_t count = tokenArraySize(chunk->tokens) - index;
+    if (!tokenArrayAppendRange(result, chunk->tokens, index, count)) {
+        return false;
+    }
+    if (chunk->reportCount > 0 && replayFrom < chunk->end) {
+        parallelReplayDiagnostics(lexer, replayFrom, chunk->end);
+    }
+    return true;
+}
+
+/**
+ * @brief 按顺序拼接各块的结果
+ *
+ * expected是真实的下一个token起点。从expected开始用原词法分析器逐个扫描，
+ * 直到扫出的token起点出现在本块的投机结果中，其后的部分直接沿用；
+ * 块首正好是token起点时第一个token就重合，不需要重新扫描。
+ * 一直没有重合（投机扫描失败，或块首之后整块都在注释或字符串里）时扫描到块尾。
+ */
+static bool parallelStitchChunks(Lexer* lexer, LexerChunk* chunks, size_t chunkCount,
+                                 TokenArray* result) {
+    size_t expected = chunks[0].start;
+
+    for (size_t i = 0; i < chunkCount; i++) {
+        LexerChunk* chunk = &chunks[i];
+        if (expected >= chunk->end) {
+            // 上一个token跨过了整块（如很长的块注释后面的token）
+            continue;
+        }
+
+        size_t index;
+        lexer->position = expected;
+        if (!lexerTokenizeRangeUntilSync(lexer, chunk->end, chunk->tokens, result,
+                                         &expected, &index)) {
+            return false;
+        }
+        if (index != SIZE_MAX) {
+            if (!parallelSpliceChunk(lexer, chunk, index, lexer->position, result)) {
+                return false;
+            }
+            expected = chunk->nextOffset;
+        }
+    }
+
+    return true;
+}
+
+// ==================== 入口 ====================
+
+/**
+ * @brief 多线程对整个源代码进行词法分析
+ */
+TokenArray* lexerTokenizeParallel(Lexer* lexer, size_t threadCount) {
+    if (!lexer) {
+        return NULL;
+    }
+
+    if (threadCount == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threadCount = online > 0 ? (size_t)online : 1;
+    }
+
+    size_t length = lexer->sourceLength;
+    if (threadCount <= 1 || lexer->position >= length ||
+        length - lexer->position < 2 * PARALLEL_LEXER_MIN_CHUNK_SIZE) {
+        return lexerTokenize(lexer);
+    }
+
+    LexerChunk* chunks = NULL;
+    size_t chunkCount = parallelSplitChunks(lexer->source, lexer->position, length,
+                                            threadCount * PARALLEL_LEXER_CHUNKS_PER_THREAD,
+                                            &chunks);
+    if (chunkCount == 0) {
+        return NULL;
+    }
+    if (chunkCount < 2) {
+        free(chunks);
+        return lexerTokenize(lexer);
+    }
+    if (threadCount > chunkCount) {
+        threadCount = chunkCount;
+    }
+
+    ParallelLexJob job;
+    job.lexer = lexer;
+    job.chunks = chunks;
+    job.chunkCount = chunkCount;
+    atomic_init(&job.nextChunk, 0);
+
+    // 当前线程也参与扫描；线程创建失败时少开几个，剩下的块照样被领走
+    pthread_t* threads = malloc((threadCount - 1) * sizeof(pthread_t));
+    size_t started = 0;
+    if (threads) {
+        while (started < threadCount - 1 &&
+               pthread_create(&threads[started], NULL, parallelLexWorker, &job) == 0) {
+            started++;
+        }
+    }
+    parallelLexWorker(&job);
+    for (size_t i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    free(threads);
+
+    size_t estimate = 16;
+    for (size_t i = 0; i < chunkCount; i++) {
+        if (chunks[i].tokens) {
+            estimate += tokenArraySize(chunks[i].tokens);
+        }
+    }
+
+    TokenArray* result = createTokenArray(lexer->source, length, lexer->fileId, estimate);
+    if (result && !parallelStitchChunks(lexer, chunks, chunkCount, result)) {
+        destroyTokenArray(result);
+        result = NULL;
+    }
+
+    for (size_t i = 0; i < chunkCount; i++) {
+        if (chunks[i].tokens) {
+            destroyTokenArray(chunks[i].tokens);
+        }
+    }
+    free(chunks);
+
+    lexer->position = length;
+    return result;
+}
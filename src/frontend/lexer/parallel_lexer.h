@@ -0,0 +1,33 @@
+#ifndef PARALLEL_LEXER_H
+#define PARALLEL_LEXER_H
+
+#include <stddef.h>
+#include "lexer.h"
+#include "token_array.h"
+
+// 每个分块的最小字节数，源码不足两块时直接顺序扫描
+#define PARALLEL_LEXER_MIN_CHUNK_SIZE (256 * 1024)
+
+// 每个线程分到的分块数，多切几块让快慢不均的线程互相补位
+#define PARALLEL_LEXER_CHUNKS_PER_THREAD 4
+
+/**
+ * @brief 多线程对整个源代码进行词法分析
+ *
+ * 把源码在换行处切成若干块，每块由工作线程从块首开始投机扫描，假设块首
+ * 不在块注释或续行的字符串里。之后按顺序拼接：从上一块扫描到的下一个token
+ * 起点开始顺序扫描，一旦扫出的token起点出现在本块的投机结果中，说明从这里
+ * 开始投机正确，其余部分直接沿用；块首落在注释或字符串中间时，只重新扫描
+ * 到与投机结果重合为止，而不是整块。
+ *
+ * 结果与lexerTokenize完全相同，包括诊断：投机扫描不输出诊断，
+ * 拼接时对产生过错误或警告的区间用原词法分析器按顺序重新扫描一遍来报告。
+ * 线程数不超过1或源码太小时退化为lexerTokenize。
+ *
+ * @param lexer 词法分析器，从当前位置扫描到文件末尾
+ * @param threadCount 工作线程数（0表示使用在线CPU数）
+ * @return token数组，失败返回NULL；由调用者用destroyTokenArray释放
+ */
+TokenArray* lexerTokenizeParallel(Lexer* lexer, size_t threadCount);
+
+#endif
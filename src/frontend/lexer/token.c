@@ -1,9 +1,12 @@
+// strdup/asprintf是GNU扩展，C11模式下需要显式开启
+#define _GNU_SOURCE
 #include "token.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 #include "../../common/diagnostics/source_location.h"
+#include "number_parser.h"
 
 //Token类型到字符串的映射表
 static const char* tokenTypeStrings[] = {
@@ -19,14 +22,13 @@ static const char* tokenTypeStrings[] = {
     "integer_literal", "float_literal", "char_literal", "string_literal",
     //运算符
     "+", "-", "*", "/", "%", "=",
-    "+=", "-=", "*=", "/=", "%=",
+    "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", "<<=", ">>=",
     "==", "!=", "<", "<=", ">", ">=",
     "&&", "||", "!",
     "&", "|", "~", "^", "<<", ">>",
     "++", "--",
     //分隔符
-    "(", ")", "[", "]", ";", ",", ".", "->", ":", "?", "...",
-    "{", "}",
+    "(", ")", "[", "]", "{", "}", ";", ",", ".", "->", ":", "?", "...",
     // 特殊标记
     "eof", "newline", "whitespace", "comment", "unknown",
     // 预处理指令
@@ -35,6 +37,9 @@ static const char* tokenTypeStrings[] = {
     "#elif", "#else", "#endif", "#line", "#error", "#pragma", "#warning"
 };
 
+_Static_assert(sizeof(tokenTypeStrings) / sizeof(tokenTypeStrings[0]) == TOKEN_TYPE_COUNT,
+               "tokenTypeStrings必须与TokenType一一对应");
+
 // 创建token
 Token* createToken(TokenType type, const char* lexeme, SourceLocation location) {
     Token* token = (Token*)malloc(sizeof(Token));
@@ -64,6 +69,25 @@ Token* createToken(TokenType type, const char* lexeme, SourceLocation location)
 
 }
 
+// 从源码切片创建token（只分配一次词素副本）
+Token* createTokenFromSlice(TokenType type, const char* start, size_t length, SourceLocation location) {
+    Token* token = createToken(type, NULL, location);
+    if (!token || !start) {
+        return token;
+    }
+
+    token->lexeme = (char*)malloc(length + 1);
+    if (!token->lexeme) {
+        free(token);
+        return NULL;
+    }
+    memcpy(token->lexeme, start, length);
+    token->lexeme[length] = '\0';
+    token->length = length;
+
+    return token;
+}
+
 // 创建带整数值的Token
 Token* createTokenWithValue(TokenType type, const char* lexeme, SourceLocation location, long long intValue) {
     Token* token = createToken(type, lexeme, location);
@@ -164,7 +188,7 @@ bool tokenIsPunctuation(TokenType type) {
 
 // 判断是否为赋值运算符
 bool tokenIsAssignmentOperator(TokenType type) {
-    return (type >= TOKEN_ASSIGN && type <= TOKEN_MODULO_ASSIGN) || type == TOKEN_ASSIGN;
+    return (type >= TOKEN_ASSIGN && type <= TOKEN_RIGHT_SHIFT_ASSIGN);
 }
 
 // 判断是否为比较运算符
@@ -192,11 +216,14 @@ char* tokenToString(const Token* token) {
     }
     const char* typeStr = tokenTypeToString(token->type);
     char* result;
+    int line = 0;
+    int column = 0;
+    sourceLocationResolve(&token->location, &line, &column);
 
     if (token->lexeme) {
-        asprintf(&result, "Token{type=%s, lexeme='%s', line=%d, col=%d}",typeStr, token->lexeme, token->location.line, token->location.column);
+        asprintf(&result, "Token{type=%s, lexeme='%s', line=%d, col=%d}",typeStr, token->lexeme, line, column);
     } else {
-        asprintf(&result, "Token{type=%s, line=%d, col=%d}", typeStr, token->location.line, token->location.column);
+        asprintf(&result, "Token{type=%s, line=%d, col=%d}", typeStr, line, column);
     }
     return result;
 
@@ -270,38 +297,6 @@ void tokenDumpVerbose(const Token* token, FILE* output) {
 
     }
 }
-// 创建源位置信息
-SourceLocation createSourceLocation(const char* filename, int line,int column, int offset) {
-    SourceLocation loc;
-    loc.filename = filename ? strdup(filename) : NULL;
-    loc.line = line;
-    loc.column = column;
-    loc.offset = offset;
-    return loc;
-}
-
-// 源位置转字符串
-char* sourceLocationToString(const SourceLocation* location) {
-    if (!location) {
-        return strdup("unknown");
-    }
-    char* result;
-    if(location->filename){
-        asprintf(&result, "%s:%d:%d", location->filename,location->line,location->column);
-    } else {
-        asprintf(&result, "line %d, column %d", location->line, location->column);
-    }
-    return result;
-}
-
-// 销毁源位置信息
-void destroySourceLocation(SourceLocation* location) {
-    if (location && location->filename) {
-        free(location->filename);
-        location->filename = NULL;
-    }
-}
-
 // token工厂函数实现
 Token* createEOFToken(SourceLocation location) {
     return createToken(TOKEN_EOF, NULL, location);
@@ -312,10 +307,16 @@ Token* createIdentifierToken(const char* identifier, SourceLocation location) {
 }
 
 Token* createIntegerToken(const char* lexeme, SourceLocation location, int base) {
-    long long value = strtoll(lexeme, NULL, base);
-    Token* token = createTokenWithValue(TOKEN_INTEGER_LITERAL, lexeme, location, value);
+    // 进制由词素自身的前缀决定，与词法分析器共用同一个一趟扫描的解析器
+    NumberLiteral literal;
+    if (!lexeme || numberParseLiteral(lexeme, lexeme + strlen(lexeme), &literal) == 0) {
+        memset(&literal, 0, sizeof(literal));
+        literal.base = base;
+    }
+    Token* token = createTokenWithValue(TOKEN_INTEGER_LITERAL, lexeme, location,
+                                        (long long)literal.intValue);
     if (token) {
-        switch (base)
+        switch (literal.base)
         {
         case 16: token->literalType = LITERAL_TYPE_HEXADECIMAL;
             break;
@@ -327,16 +328,24 @@ Token* createIntegerToken(const char* lexeme, SourceLocation location, int base)
             token->literalType = LITERAL_TYPE_DECIMAL;
             break;
         }
+        if (literal.isUnsigned) token->flags |= TOKEN_FLAG_UNSIGNED;
+        if (literal.longCount == 1) token->flags |= TOKEN_FLAG_LONG;
+        if (literal.longCount == 2) token->flags |= TOKEN_FLAG_LONG_LONG;
     }
     return token;
 }
 
 // 创建浮点数Token
 Token* createFloatToken(const char* lexeme, SourceLocation location) {
-    double value = strtod(lexeme, NULL);
+    NumberLiteral literal;
+    if (!lexeme || numberParseLiteral(lexeme, lexeme + strlen(lexeme), &literal) == 0) {
+        memset(&literal, 0, sizeof(literal));
+    }
+    double value = literal.isFloat ? literal.floatValue : (double)literal.intValue;
     Token* token = createTokenWithFloatValue(TOKEN_FLOAT_LITERAL, lexeme, location, value);
     if (token) {
-        token->literalType = LITERAL_TYPE_DOUBLE;
+        token->literalType = literal.isFloatSuffix ? LITERAL_TYPE_FLOAT : LITERAL_TYPE_DOUBLE;
+        if (literal.isLongDouble) token->flags |= TOKEN_FLAG_LONG;
     }
     return token;
 }
@@ -404,7 +413,7 @@ bool tokenHasValidLocation(const Token* token) {
         return false;
     }
     // 行号和列号应该大于0
-    return (token->location.line > 0 && token->location.column > 0);
+    return token->location.fileId != INVALID_FILE_ID;
 }
 
 // 验证token词素有效性
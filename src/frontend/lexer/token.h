@@ -74,6 +74,11 @@ typedef enum {
     TOKEN_MULTIPLY_ASSIGN,  // *=
     TOKEN_DIVIDE_ASSIGN,    // /=
     TOKEN_MODULO_ASSIGN,    // %=
+    TOKEN_AND_ASSIGN,       // &=
+    TOKEN_OR_ASSIGN,        // |=
+    TOKEN_XOR_ASSIGN,       // ^=
+    TOKEN_LEFT_SHIFT_ASSIGN,    // <<=
+    TOKEN_RIGHT_SHIFT_ASSIGN,   // >>=
 
     // 比较符
     TOKEN_EQUAL,        // ==
@@ -137,6 +142,7 @@ typedef enum {
     TOKEN_PREPROCESSOR_PRAGMA,     // #pragma
     TOKEN_PREPROCESSOR_WARNING,    // #warning
 
+    TOKEN_TYPE_COUNT               // token类型数量（不是真正的token）
 } TokenType;
 
 
@@ -152,6 +158,11 @@ typedef enum {
     LITERAL_TYPE_WCHAR,
     LITERAL_TYPE_STRING,
     LITERAL_TYPE_WSTRING,
+    LITERAL_TYPE_UTF8_STRING,      // u8"..."
+    LITERAL_TYPE_UTF16_STRING,     // u"..."（char16_t）
+    LITERAL_TYPE_UTF32_STRING,     // U"..."（char32_t）
+    LITERAL_TYPE_UTF16_CHAR,       // u'x'，值为码点
+    LITERAL_TYPE_UTF32_CHAR,       // U'x'，值为码点
 
 } LiteralType;
 
@@ -184,6 +195,7 @@ typedef struct {
 
 // Token构造函数和析构函数
 Token* createToken(TokenType type, const char* lexeme, SourceLocation location);
+Token* createTokenFromSlice(TokenType type, const char* start, size_t length, SourceLocation location);
 Token* createTokenWithValue(TokenType type, const char* lexeme, SourceLocation location, long long intValue);
 Token* createTokenWithFloatValue(TokenType type, const char* lexeme, SourceLocation location, double floatValue);
 Token* createTokenWithStringValue(TokenType type, const char* lexeme, SourceLocation location, const char* stringValue, bool isWide);
@@ -208,11 +220,6 @@ char* tokenToShortString(const Token* token);
 void tokenDump(const Token* token, FILE* output);
 void tokenDumpVerbose(const Token* token, FILE* output);
 
-// 源位置函数
-SourceLocation createSourceLocation(const char* filename, int line, int column, int offset);
-char* sourceLocationToString(const SourceLocation* location);
-void destroySourceLocation(SourceLocation* location);
-
 // Token工厂函数
 Token* createEOFToken(SourceLocation location);
 Token* createIdentifierToken(const char* identifier, SourceLocation location);
@@ -244,8 +251,11 @@ bool tokenHasFlag(const Token* token, unsigned int flag);
 // 预定义的标志位
 #define TOKEN_FLAG_ESCAPE_SEQUENCE (1 << 0) //包含转义序列
 #define TOKEN_FLAG_RAW_STRING (1 << 1)  //原始字符串
-#define TOKEN_FLAG_UNICODE (1 << 2) // Unicode字符串
+#define TOKEN_FLAG_UNICODE (1 << 2) // u8/u/U前缀的字面量，或含非ASCII字符的标识符
 #define TOKEN_FLAG_PREPROCESSOR (1 << 3)    // 预处理
+#define TOKEN_FLAG_UNSIGNED (1 << 4)    // 整数后缀u/U
+#define TOKEN_FLAG_LONG (1 << 5)    // 整数后缀l/L，或浮点后缀l/L（long double）
+#define TOKEN_FLAG_LONG_LONG (1 << 6)   // 整数后缀ll/LL
 
 
 
@@ -0,0 +1,270 @@
+#include "token_array.h"
+#include <stdlib.h>
+#include <string.h>
+
+// 估算token数量时假设的平均字节数
+#define BYTES_PER_TOKEN_ESTIMATE 5
+
+// ==================== 内部辅助函数 ====================
+
+/**
+ * @brief 确保连续数组有足够容量
+ */
+static bool tokenArrayGrow(void** data, size_t* capacity, size_t required, size_t elementSize) {
+    if (*capacity >= required) {
+        return true;
+    }
+
+    size_t newCapacity = *capacity == 0 ? 16 : *capacity * 2;
+    while (newCapacity < required) {
+        newCapacity *= 2;
+    }
+
+    void* newData = realloc(*data, newCapacity * elementSize);
+    if (!newData) {
+        return false;
+    }
+
+    *data = newData;
+    *capacity = newCapacity;
+    return true;
+}
+
+// ==================== 构造函数和析构函数 ====================
+
+TokenArray* createTokenArray(const char* source, size_t sourceLength, FileId fileId, size_t initialCapacity) {
+    if (!source || sourceLength > UINT32_MAX) {
+        return NULL;
+    }
+
+    TokenArray* array = (TokenArray*)calloc(1, sizeof(TokenArray));
+    if (!array) {
+        return NULL;
+    }
+
+    array->source = source;
+    array->sourceLength = sourceLength;
+    array->fileId = fileId;
+
+    // 预留足够容量，避免词法分析过程中反复扩容
+    if (initialCapacity == 0) {
+        initialCapacity = sourceLength / BYTES_PER_TOKEN_ESTIMATE + 16;
+    }
+    array->tokens = (PackedToken*)malloc(initialCapacity * sizeof(PackedToken));
+    if (!array->tokens) {
+        free(array);
+        return NULL;
+    }
+    array->capacity = initialCapacity;
+
+    return array;
+}
+
+void destroyTokenArray(TokenArray* array) {
+    if (!array) {
+        return;
+    }
+    free(array->tokens);
+    free(array->values);
+    free(array->stringPool);
+    free(array);
+}
+
+// ==================== 构建 ====================
+
+bool tokenArrayPush(TokenArray* array, TokenType type, size_t offset, size_t length,
+                    unsigned int flags, const TokenValue* value) {
+    if (!array) {
+        return false;
+    }
+
+    if (!tokenArrayGrow((void**)&array->tokens, &array->capacity,
+                        array->count + 1, sizeof(PackedToken))) {
+        return false;
+    }
+
+    uint32_t valueIndex = TOKEN_NO_VALUE;
+    if (value) {
+        if (!tokenArrayGrow((void**)&array->values, &array->valueCapacity,
+                            array->valueCount + 1, sizeof(TokenValue))) {
+            return false;
+        }
+        valueIndex = (uint32_t)array->valueCount;
+        array->values[array->valueCount++] = *value;
+    }
+
+    PackedToken* token = &array->tokens[array->count++];
+    token->offset = (uint32_t)offset;
+    token->length = (uint32_t)length;
+    token->type = (uint16_t)type;
+    token->flags = (uint16_t)flags;
+    token->valueIndex = valueIndex;
+
+    return true;
+}
+
+bool tokenArrayAddString(TokenArray* array, const char* str, size_t length, TokenValue* value) {
+    if (!array || !value || (!str && length > 0)) {
+        return false;
+    }
+
+    if (!tokenArrayGrow((void**)&array->stringPool, &array->stringPoolCapacity,
+                        array->stringPoolSize + length + 1, sizeof(char))) {
+        return false;
+    }
+
+    value->as.string.offset = (uint32_t)array->stringPoolSize;
+    value->as.string.length = (uint32_t)length;
+    if (length > 0) {
+        memcpy(array->stringPool + array->stringPoolSize, str, length);
+    }
+    array->stringPool[array->stringPoolSize + length] = '\0';
+    array->stringPoolSize += length + 1;
+
+    return true;
+}
+
+bool tokenArrayAppendRange(TokenArray* array, const TokenArray* source, size_t first, size_t count) {
+    if (!array || !source || first > source->count || count > source->count - first) {
+        return false;
+    }
+    if (count == 0) {
+        return true;
+    }
+
+    // 先统计这一段引用的值和字符串，一次扩容到位
+    const PackedToken* tokens = source->tokens + first;
+    size_t valueCount = 0;
+    size_t stringBytes = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (tokens[i].valueIndex != TOKEN_NO_VALUE) {
+            valueCount++;
+            if (tokens[i].type == TOKEN_STRING_LITERAL) {
+                stringBytes += source->values[tokens[i].valueIndex].as.string.length + 1;
+            }
+        }
+    }
+
+    if (!tokenArrayGrow((void**)&array->tokens, &array->capacity,
+                        array->count + count, sizeof(PackedToken)) ||
+        !tokenArrayGrow((void**)&array->values, &array->valueCapacity,
+                        array->valueCount + valueCount, sizeof(TokenValue)) ||
+        !tokenArrayGrow((void**)&array->stringPool, &array->stringPoolCapacity,
+                        array->stringPoolSize + stringBytes, sizeof(char))) {
+        return false;
+    }
+
+    PackedToken* out = array->tokens + array->count;
+    memcpy(out, tokens, count * sizeof(PackedToken));
+    for (size_t i = 0; i < count; i++) {
+        if (out[i].valueIndex == TOKEN_NO_VALUE) {
+            continue;
+        }
+
+        TokenValue value = source->values[out[i].valueIndex];
+        if (out[i].type == TOKEN_STRING_LITERAL) {
+            size_t bytes = value.as.string.length + 1;
+            memcpy(array->stringPool + array->stringPoolSize,
+                   source->stringPool + value.as.string.offset, bytes);
+            value.as.string.offset = (uint32_t)array->stringPoolSize;
+            array->stringPoolSize += bytes;
+        }
+        out[i].valueIndex = (uint32_t)array->valueCount;
+        array->values[array->valueCount++] = value;
+    }
+    array->count += count;
+
+    return true;
+}
+
+void tokenArrayShrinkToFit(TokenArray* array) {
+    if (!array) {
+        return;
+    }
+    if (array->count > 0 && array->count < array->capacity) {
+        PackedToken* tokens = (PackedToken*)realloc(array->tokens, array->count * sizeof(PackedToken));
+        if (tokens) {
+            array->tokens = tokens;
+            array->capacity = array->count;
+        }
+    }
+    if (array->valueCount > 0 && array->valueCount < array->valueCapacity) {
+        TokenValue* values = (TokenValue*)realloc(array->values, array->valueCount * sizeof(TokenValue));
+        if (values) {
+            array->values = values;
+            array->valueCapacity = array->valueCount;
+        }
+    }
+    if (array->stringPoolSize > 0 && array->stringPoolSize < array->stringPoolCapacity) {
+        char* pool = (char*)realloc(array->stringPool, array->stringPoolSize);
+        if (pool) {
+            array->stringPool = pool;
+            array->stringPoolCapacity = array->stringPoolSize;
+        }
+    }
+}
+
+// ==================== 访问 ====================
+
+size_t tokenArraySize(const TokenArray* array) {
+    return array ? array->count : 0;
+}
+
+const PackedToken* tokenArrayGet(const TokenArray* array, size_t index) {
+    if (!array || index >= array->count) {
+        return NULL;
+    }
+    return &array->tokens[index];
+}
+
+const char* tokenArrayGetLexeme(const TokenArray* array, size_t index, size_t* length) {
+    const PackedToken* token = tokenArrayGet(array, index);
+    if (!token) {
+        return NULL;
+    }
+    if (length) {
+        *length = token->length;
+    }
+    return array->source + token->offset;
+}
+
+const TokenValue* tokenArrayGetValue(const TokenArray* array, size_t index) {
+    const PackedToken* token = tokenArrayGet(array, index);
+    if (!token || token->valueIndex == TOKEN_NO_VALUE) {
+        return NULL;
+    }
+    return &array->values[token->valueIndex];
+}
+
+const char* tokenArrayGetString(const TokenArray* array, size_t index, size_t* length) {
+    const PackedToken* token = tokenArrayGet(array, index);
+    if (!token || token->type != TOKEN_STRING_LITERAL) {
+        return NULL;
+    }
+    const TokenValue* value = tokenArrayGetValue(array, index);
+    if (!value) {
+        return NULL;
+    }
+    if (length) {
+        *length = value->as.string.length;
+    }
+    return array->stringPool + value->as.string.offset;
+}
+
+SourceLocation tokenArrayGetLocation(const TokenArray* array, size_t index) {
+    const PackedToken* token = tokenArrayGet(array, index);
+    if (!token) {
+        return createSourceLocation(array ? array->fileId : INVALID_FILE_ID, 0);
+    }
+    return createSourceLocation(array->fileId, token->offset);
+}
+
+size_t tokenArrayMemoryUsage(const TokenArray* array) {
+    if (!array) {
+        return 0;
+    }
+    return sizeof(TokenArray)
+         + array->capacity * sizeof(PackedToken)
+         + array->valueCapacity * sizeof(TokenValue)
+         + array->stringPoolCapacity;
+}
@@ -0,0 +1,182 @@
+#ifndef TOKEN_ARRAY_H
+#define TOKEN_ARRAY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "token.h"
+
+/**
+ * @brief 紧凑token
+ *
+ * 固定16字节，只记录类型、标志位和词素在源码中的位置；词素直接引用源码
+ * 缓冲区（通常是内存映射的文件），不复制字符串。字面量的解码值存放在
+ * TokenArray的侧表中，通过valueIndex引用。行列号由源管理器按偏移量计算。
+ */
+typedef struct {
+    uint32_t offset;      // 词素在源码中的字节偏移
+    uint32_t length;      // 词素长度
+    uint16_t type;        // TokenType
+    uint16_t flags;       // TOKEN_FLAG_*
+    uint32_t valueIndex;  // 字面量值侧表下标，无值时为TOKEN_NO_VALUE
+} PackedToken;
+
+#define TOKEN_NO_VALUE UINT32_MAX
+
+/**
+ * @brief 字面量值侧表项
+ *
+ * 字符串字面量解码后的内容保存在TokenArray的字符串池中，这里只记录位置。
+ */
+typedef struct {
+    union {
+        long long intValue;      // 整数值
+        double floatValue;       // 浮点数值
+        char charValue;          // 字符值
+        struct {
+            uint32_t offset;     // 字符串池中的偏移
+            uint32_t length;     // 解码后的长度
+        } string;
+    } as;
+    uint8_t literalType;         // LiteralType
+    bool isWide;                 // 是否宽字符/宽字符串
+} TokenValue;
+
+/**
+ * @brief 连续存放的紧凑token序列
+ *
+ * lexerTokenize的输出。token、字面量值和字符串内容分别存放在三块连续内存中，
+ * 解析器向前查看时只需顺序访问16字节的token数组。
+ */
+typedef struct {
+    const char* source;          // 词素引用的源码（借用，需比数组活得久）
+    size_t sourceLength;         // 源码长度
+    FileId fileId;               // 源文件ID
+
+    PackedToken* tokens;         // token数组
+    size_t count;                // token数量
+    size_t capacity;             // token容量
+
+    TokenValue* values;          // 字面量值侧表
+    size_t valueCount;
+    size_t valueCapacity;
+
+    char* stringPool;            // 解码后的字符串内容（每个字符串以'\0'结尾）
+    size_t stringPoolSize;
+    size_t stringPoolCapacity;
+} TokenArray;
+
+// ==================== 构造函数和析构函数 ====================
+
+/**
+ * @brief 创建token数组
+ * @param source 词素引用的源码
+ * @param sourceLength 源码长度（不能超过UINT32_MAX）
+ * @param fileId 源文件ID
+ * @param initialCapacity 预留的token数量（0表示按源码长度估算）
+ * @return 新创建的token数组，失败返回NULL
+ */
+TokenArray* createTokenArray(const char* source, size_t sourceLength, FileId fileId, size_t initialCapacity);
+
+/**
+ * @brief 销毁token数组
+ * @param array 要销毁的token数组
+ */
+void destroyTokenArray(TokenArray* array);
+
+// ==================== 构建 ====================
+
+/**
+ * @brief 追加一个token
+ * @param array token数组
+ * @param type token类型
+ * @param offset 词素偏移
+ * @param length 词素长度
+ * @param flags 标志位
+ * @param value 字面量值（可为NULL）
+ * @return 成功返回true
+ */
+bool tokenArrayPush(TokenArray* array, TokenType type, size_t offset, size_t length,
+                    unsigned int flags, const TokenValue* value);
+
+/**
+ * @brief 把解码后的字符串放入字符串池，并填写value中的位置信息
+ * @param array token数组
+ * @param str 字符串内容（可以包含'\0'）
+ * @param length 字符串长度
+ * @param value 输出的字面量值
+ * @return 成功返回true
+ */
+bool tokenArrayAddString(TokenArray* array, const char* str, size_t length, TokenValue* value);
+
+/**
+ * @brief 把另一个token数组中的一段token追加到末尾
+ *
+ * 字面量值和字符串内容一并复制，下标和字符串偏移随之调整。
+ * 两个数组应引用同一份源码。
+ *
+ * @param array 目标token数组
+ * @param source 来源token数组
+ * @param first 第一个要复制的token下标
+ * @param count 要复制的token数量
+ * @return 成功返回true
+ */
+bool tokenArrayAppendRange(TokenArray* array, const TokenArray* source, size_t first, size_t count);
+
+/**
+ * @brief 释放token、字面量值和字符串池多余的预留容量
+ * @param array token数组
+ */
+void tokenArrayShrinkToFit(TokenArray* array);
+
+// ==================== 访问 ====================
+
+/**
+ * @brief 获取token数量
+ */
+size_t tokenArraySize(const TokenArray* array);
+
+/**
+ * @brief 获取指定位置的token
+ * @return 越界返回NULL
+ */
+const PackedToken* tokenArrayGet(const TokenArray* array, size_t index);
+
+/**
+ * @brief 获取token的词素
+ * @param array token数组
+ * @param index token下标
+ * @param length 输出词素长度（可为NULL）
+ * @return 指向源码中词素起始位置的指针（不以'\0'结尾），越界返回NULL
+ */
+const char* tokenArrayGetLexeme(const TokenArray* array, size_t index, size_t* length);
+
+/**
+ * @brief 获取token的字面量值
+ * @return 没有值或越界返回NULL
+ */
+const TokenValue* tokenArrayGetValue(const TokenArray* array, size_t index);
+
+/**
+ * @brief 获取字符串字面量解码后的内容
+ * @param array token数组
+ * @param index token下标
+ * @param length 输出长度（可为NULL）
+ * @return 以'\0'结尾的字符串，不是字符串字面量时返回NULL
+ */
+const char* tokenArrayGetString(const TokenArray* array, size_t index, size_t* length);
+
+/**
+ * @brief 获取token的源位置（文件ID加字节偏移，行列号用sourceLocationResolve解析）
+ * @param array token数组
+ * @param index token下标
+ * @return 源位置，越界返回偏移为0的位置
+ */
+SourceLocation tokenArrayGetLocation(const TokenArray* array, size_t index);
+
+/**
+ * @brief 统计token数组占用的堆内存（字节，按已分配的容量计算）
+ */
+size_t tokenArrayMemoryUsage(const TokenArray* array);
+
+#endif
@@ -0,0 +1,150 @@
+#include "token_stream.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ==================== 内部辅助函数 ====================
+
+/**
+ * @brief 把字符串值复制到槽位自己的缓冲区
+ */
+static bool tokenStreamKeepString(TokenStreamSlot* slot) {
+    size_t required = slot->token.stringLength + 1;
+    if (required > slot->stringCapacity) {
+        size_t newCapacity = slot->stringCapacity == 0 ? 64 : slot->stringCapacity;
+        while (newCapacity < required) {
+            newCapacity *= 2;
+        }
+        char* newBuffer = (char*)realloc(slot->stringBuffer, newCapacity);
+        if (!newBuffer) {
+            return false;
+        }
+        slot->stringBuffer = newBuffer;
+        slot->stringCapacity = newCapacity;
+    }
+
+    if (slot->token.stringLength > 0) {
+        memcpy(slot->stringBuffer, slot->token.stringValue, slot->token.stringLength);
+    }
+    slot->stringBuffer[slot->token.stringLength] = '\0';
+    slot->token.stringValue = slot->stringBuffer;
+    return true;
+}
+
+/**
+ * @brief 扫描一个token追加到环形缓冲区末尾
+ */
+static bool tokenStreamFill(TokenStream* stream) {
+    TokenStreamSlot* slot = &stream->slots[(stream->head + stream->count) & stream->mask];
+
+    if (stream->reachedEnd) {
+        // 文件末尾之后不再扫描，重复EOF
+        memset(&slot->token, 0, sizeof(LexedToken));
+        slot->token.type = TOKEN_EOF;
+        slot->token.offset = stream->lexer->sourceLength;
+    } else {
+        lexerScanToken(stream->lexer, &slot->token);
+        if (slot->token.type == TOKEN_EOF) {
+            stream->reachedEnd = true;
+        } else if (slot->token.type == TOKEN_STRING_LITERAL && !tokenStreamKeepString(slot)) {
+            return false;
+        }
+    }
+
+    stream->count++;
+    return true;
+}
+
+// ==================== 构造函数和析构函数 ====================
+
+TokenStream* createTokenStream(Lexer* lexer, size_t lookahead) {
+    if (!lexer) {
+        return NULL;
+    }
+    if (lookahead == 0) {
+        lookahead = TOKEN_STREAM_DEFAULT_LOOKAHEAD;
+    }
+
+    // 多留一个槽位，保证刚消费的token在下一次消费前不被覆盖
+    size_t capacity = 2;
+    while (capacity < lookahead + 1) {
+        capacity *= 2;
+    }
+
+    TokenStream* stream = (TokenStream*)calloc(1, sizeof(TokenStream));
+    if (!stream) {
+        return NULL;
+    }
+    stream->slots = (TokenStreamSlot*)calloc(capacity, sizeof(TokenStreamSlot));
+    if (!stream->slots) {
+        free(stream);
+        return NULL;
+    }
+
+    stream->lexer = lexer;
+    stream->capacity = capacity;
+    stream->mask = capacity - 1;
+    stream->lookahead = lookahead;
+    return stream;
+}
+
+void destroyTokenStream(TokenStream* stream) {
+    if (!stream) {
+        return;
+    }
+    for (size_t i = 0; i < stream->capacity; i++) {
+        free(stream->slots[i].stringBuffer);
+    }
+    free(stream->slots);
+    free(stream);
+}
+
+// ==================== 主要接口 ====================
+
+const LexedToken* tokenStreamPeek(TokenStream* stream, size_t k) {
+    if (!stream || k >= stream->lookahead) {
+        return NULL;
+    }
+
+    while (stream->count <= k) {
+        if (!tokenStreamFill(stream)) {
+            return NULL;
+        }
+    }
+    return &stream->slots[(stream->head + k) & stream->mask].token;
+}
+
+TokenType tokenStreamPeekType(TokenStream* stream, size_t k) {
+    const LexedToken* token = tokenStreamPeek(stream, k);
+    return token ? token->type : TOKEN_EOF;
+}
+
+const LexedToken* tokenStreamConsume(TokenStream* stream) {
+    const LexedToken* token = tokenStreamPeek(stream, 0);
+    if (!token) {
+        return NULL;
+    }
+
+    stream->head = (stream->head + 1) & stream->mask;
+    stream->count--;
+    stream->consumedCount++;
+    return token;
+}
+
+// ==================== 辅助函数 ====================
+
+const char* tokenStreamGetLexeme(const TokenStream* stream, const LexedToken* token, size_t* length) {
+    if (!stream || !token) {
+        return NULL;
+    }
+    if (length) {
+        *length = token->length;
+    }
+    return stream->lexer->source + token->offset;
+}
+
+SourceLocation tokenStreamGetLocation(const TokenStream* stream, const LexedToken* token) {
+    if (!stream || !token) {
+        return createSourceLocation(INVALID_FILE_ID, 0);
+    }
+    return createSourceLocation(stream->lexer->fileId, (uint32_t)token->offset);
+}
@@ -0,0 +1,99 @@
+#ifndef TOKEN_STREAM_H
+#define TOKEN_STREAM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "lexer.h"
+
+/**
+ * @brief 前看缓冲区中的一个槽位
+ *
+ * 词法分析器的字符串暂存区在下一次扫描时会被覆盖，因此每个槽位持有
+ * 自己的字符串缓冲区，槽位复用时缓冲区也一起复用。
+ */
+typedef struct {
+    LexedToken token;           // 扫描结果（字符串值指向stringBuffer）
+    char* stringBuffer;         // 字符串字面量解码后的内容
+    size_t stringCapacity;      // 缓冲区容量
+} TokenStreamSlot;
+
+/**
+ * @brief 流式token源
+ *
+ * 按需从词法分析器拉取token，放入固定大小的环形缓冲区，支持向前查看k个token。
+ * 每个token只扫描一次，内存占用只与前看深度有关，与文件大小无关。
+ */
+typedef struct {
+    Lexer* lexer;               // 词法分析器（借用）
+    TokenStreamSlot* slots;     // 环形缓冲区
+    size_t capacity;            // 槽位数（2的幂）
+    size_t mask;                // capacity - 1
+    size_t lookahead;           // 最大前看深度
+    size_t head;                // 下一个待消费token所在槽位
+    size_t count;               // 已扫描、尚未消费的token数量
+    bool reachedEnd;            // 是否已经扫描到EOF
+    size_t consumedCount;       // 已消费的token数量
+} TokenStream;
+
+// 默认前看深度
+#define TOKEN_STREAM_DEFAULT_LOOKAHEAD 4
+
+// ==================== 构造函数和析构函数 ====================
+
+/**
+ * @brief 创建流式token源
+ * @param lexer 词法分析器，必须比token源活得久
+ * @param lookahead 最大前看深度（0表示使用默认值）
+ * @return 新创建的token源，失败返回NULL
+ */
+TokenStream* createTokenStream(Lexer* lexer, size_t lookahead);
+
+/**
+ * @brief 销毁流式token源（不销毁词法分析器）
+ * @param stream 要销毁的token源
+ */
+void destroyTokenStream(TokenStream* stream);
+
+// ==================== 主要接口 ====================
+
+/**
+ * @brief 查看第k个未消费的token（k为0表示当前token）
+ *
+ * 到达文件末尾后，继续查看总是得到EOF token。
+ *
+ * @param stream token源
+ * @param k 前看距离，必须小于创建时指定的前看深度
+ * @return token，k越界或内存不足时返回NULL；在下一次tokenStreamConsume之前有效
+ */
+const LexedToken* tokenStreamPeek(TokenStream* stream, size_t k);
+
+/**
+ * @brief 查看第k个未消费token的类型
+ * @return token类型，k越界时返回TOKEN_EOF
+ */
+TokenType tokenStreamPeekType(TokenStream* stream, size_t k);
+
+/**
+ * @brief 消费当前token
+ * @param stream token源
+ * @return 被消费的token，在下一次tokenStreamConsume之前有效；内存不足时返回NULL
+ */
+const LexedToken* tokenStreamConsume(TokenStream* stream);
+
+// ==================== 辅助函数 ====================
+
+/**
+ * @brief 获取token的词素
+ * @param stream token源
+ * @param token 由本token源返回的token
+ * @param length 输出词素长度（可为NULL）
+ * @return 指向源码中词素的指针（不以'\0'结尾）
+ */
+const char* tokenStreamGetLexeme(const TokenStream* stream, const LexedToken* token, size_t* length);
+
+/**
+ * @brief 获取token的源位置
+ */
+SourceLocation tokenStreamGetLocation(const TokenStream* stream, const LexedToken* token);
+
+#endif
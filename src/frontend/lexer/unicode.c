@@ -0,0 +1,88 @@
+#include "unicode.h"
+
+/**
+ * @brief 解码一个UTF-8字符
+ */
+size_t unicodeDecodeUtf8(const char* p, const char* end, uint32_t* codePoint) {
+    if (p >= end) {
+        return 0;
+    }
+
+    const unsigned char* s = (const unsigned char*)p;
+    size_t available = (size_t)(end - p);
+    uint32_t value;
+    size_t length;
+    uint32_t minimum;
+
+    if (s[0] < 0x80) {
+        *codePoint = s[0];
+        return 1;
+    } else if (s[0] >= 0xC2 && s[0] <= 0xDF) {
+        // 0xC0、0xC1只能构成过长编码
+        value = s[0] & 0x1F;
+        length = 2;
+        minimum = 0x80;
+    } else if ((s[0] & 0xF0) == 0xE0) {
+        value = s[0] & 0x0F;
+        length = 3;
+        minimum = 0x800;
+    } else if (s[0] >= 0xF0 && s[0] <= 0xF4) {
+        value = s[0] & 0x07;
+        length = 4;
+        minimum = 0x10000;
+    } else {
+        return 0;
+    }
+
+    if (available < length) {
+        return 0;
+    }
+    for (size_t i = 1; i < length; i++) {
+        if ((s[i] & 0xC0) != 0x80) {
+            return 0;
+        }
+        value = (value << 6) | (s[i] & 0x3F);
+    }
+
+    if (value < minimum || value > UNICODE_MAX_CODE_POINT ||
+        (value >= 0xD800 && value <= 0xDFFF)) {
+        return 0;
+    }
+
+    *codePoint = value;
+    return length;
+}
+
+/**
+ * @brief 把码点编码为UTF-8
+ */
+size_t unicodeEncodeUtf8(uint32_t codePoint, char* out) {
+    unsigned char* s = (unsigned char*)out;
+
+    if (codePoint < 0x80) {
+        s[0] = (unsigned char)codePoint;
+        return 1;
+    }
+    if (codePoint < 0x800) {
+        s[0] = (unsigned char)(0xC0 | (codePoint >> 6));
+        s[1] = (unsigned char)(0x80 | (codePoint & 0x3F));
+        return 2;
+    }
+    if (codePoint >= 0xD800 && codePoint <= 0xDFFF) {
+        return 0;
+    }
+    if (codePoint < 0x10000) {
+        s[0] = (unsigned char)(0xE0 | (codePoint >> 12));
+        s[1] = (unsigned char)(0x80 | ((codePoint >> 6) & 0x3F));
+        s[2] = (unsigned char)(0x80 | (codePoint & 0x3F));
+        return 3;
+    }
+    if (codePoint <= UNICODE_MAX_CODE_POINT) {
+        s[0] = (unsigned char)(0xF0 | (codePoint >> 18));
+        s[1] = (unsigned char)(0x80 | ((codePoint >> 12) & 0x3F));
+        s[2] = (unsigned char)(0x80 | ((codePoint >> 6) & 0x3F));
+        s[3] = (unsigned char)(0x80 | (codePoint & 0x3F));
+        return 4;
+    }
+    return 0;
+}
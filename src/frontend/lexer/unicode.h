@@ -0,0 +1,62 @@
+#ifndef UNICODE_H
+#define UNICODE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "unicode_tables.h"
+
+// 最大的Unicode码点
+#define UNICODE_MAX_CODE_POINT 0x10FFFF
+
+// 一个码点的UTF-8编码最多4个字节
+#define UNICODE_UTF8_MAX_LENGTH 4
+
+/**
+ * @brief 解码一个UTF-8字符
+ *
+ * 拒绝过长编码、代理区码点（U+D800..U+DFFF）、超过U+10FFFF的码点
+ * 以及在end之前被截断的序列。
+ *
+ * @param p 字符的第一个字节
+ * @param end 输入结束位置，不会读取end之后的字节
+ * @param codePoint 输出码点
+ * @return 字符占用的字节数（1~4），不是合法的UTF-8时返回0
+ */
+size_t unicodeDecodeUtf8(const char* p, const char* end, uint32_t* codePoint);
+
+/**
+ * @brief 把码点编码为UTF-8
+ * @param codePoint 码点
+ * @param out 输出缓冲区，至少UNICODE_UTF8_MAX_LENGTH字节
+ * @return 写入的字节数，码点是代理区或超出范围时返回0
+ */
+size_t unicodeEncodeUtf8(uint32_t codePoint, char* out);
+
+/**
+ * @brief 码点的标识符属性（UNICODE_IDENTIFIER_*的组合）
+ */
+static inline unsigned unicodeIdentifierProperty(uint32_t codePoint) {
+    if (codePoint > UNICODE_MAX_CODE_POINT) {
+        return 0;
+    }
+    uint8_t block = unicodeIdentifierStage1[codePoint >> UNICODE_IDENTIFIER_BLOCK_SHIFT];
+    uint8_t packed = unicodeIdentifierStage2[block][(codePoint & 0xFF) >> 2];
+    return (packed >> ((codePoint & 3) * 2)) & 3;
+}
+
+/**
+ * @brief 码点能否作为标识符首字符（XID_Start）
+ */
+static inline bool unicodeIsIdentifierStart(uint32_t codePoint) {
+    return (unicodeIdentifierProperty(codePoint) & UNICODE_IDENTIFIER_START) != 0;
+}
+
+/**
+ * @brief 码点能否出现在标识符中（XID_Continue）
+ */
+static inline bool unicodeIsIdentifierContinue(uint32_t codePoint) {
+    return (unicodeIdentifierProperty(codePoint) & UNICODE_IDENTIFIER_CONTINUE) != 0;
+}
+
+#endif
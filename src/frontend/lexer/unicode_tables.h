@@ -0,0 +1,28 @@
+#ifndef UNICODE_TABLES_H
+#define UNICODE_TABLES_H
+
+#include <stdint.h>
+
+// 码点按256个一块划分，二级表每个码点占2位
+#define UNICODE_IDENTIFIER_BLOCK_SHIFT 8
+#define UNICODE_IDENTIFIER_STAGE1_SIZE (0x110000 >> UNICODE_IDENTIFIER_BLOCK_SHIFT)
+#define UNICODE_IDENTIFIER_BLOCK_BYTES ((1 << UNICODE_IDENTIFIER_BLOCK_SHIFT) / 4)
+
+// 二级表中每个码点的属性位
+#define UNICODE_IDENTIFIER_CONTINUE 1   // XID_Continue
+#define UNICODE_IDENTIFIER_START    2   // XID_Start
+
+/**
+ * @brief 标识符属性一级表：码点高位 -> 二级表块号
+ *
+ * 内容相同的块共用一份二级表，整个表约12KB。
+ * 两张表由gen_unicode_tables.py生成，不要手工修改。
+ */
+extern const uint8_t unicodeIdentifierStage1[UNICODE_IDENTIFIER_STAGE1_SIZE];
+
+/**
+ * @brief 标识符属性二级表：每块256个码点，每字节依次存放4个码点的属性
+ */
+extern const uint8_t unicodeIdentifierStage2[][UNICODE_IDENTIFIER_BLOCK_BYTES];
+
+#endif
@@ -0,0 +1,112 @@
+#include "parser.h"
+#include "../../common/diagnostics/diagnostic_engine.h"
+#include <stdlib.h>
+
+// ==================== 构造函数和析构函数 ====================
+
+Parser* createParser(Lexer* lexer, DiagnosticEngine* diagnostics) {
+    if (!lexer) {
+        return NULL;
+    }
+
+    Parser* parser = (Parser*)calloc(1, sizeof(Parser));
+    if (!parser) {
+        return NULL;
+    }
+
+    // 只保留PARSER_LOOKAHEAD个token，内存占用与文件大小无关
+    parser->tokens = createTokenStream(lexer, PARSER_LOOKAHEAD);
+    if (!parser->tokens) {
+        free(parser);
+        return NULL;
+    }
+
+    parser->lexer = lexer;
+    parser->diagnostics = diagnostics;
+    return parser;
+}
+
+void destroyParser(Parser* parser) {
+    if (!parser) {
+        return;
+    }
+    destroyTokenStream(parser->tokens);
+    free(parser);
+}
+
+// ==================== token访问 ====================
+
+const LexedToken* parserPeek(Parser* parser, size_t k) {
+    if (!parser) {
+        return NULL;
+    }
+    return tokenStreamPeek(parser->tokens, k);
+}
+
+const LexedToken* parserAdvance(Parser* parser) {
+    if (!parser) {
+        return NULL;
+    }
+    const LexedToken* token = tokenStreamConsume(parser->tokens);
+    if (token) {
+        parser->previous = token;
+    }
+    return token;
+}
+
+bool parserCheck(Parser* parser, TokenType type) {
+    return parser && tokenStreamPeekType(parser->tokens, 0) == type;
+}
+
+bool parserMatch(Parser* parser, TokenType type) {
+    if (!parserCheck(parser, type)) {
+        return false;
+    }
+    parserAdvance(parser);
+    return true;
+}
+
+const LexedToken* parserExpect(Parser* parser, TokenType type, const char* message) {
+    if (parserCheck(parser, type)) {
+        return parserAdvance(parser);
+    }
+    parserReportError(parser, message);
+    return NULL;
+}
+
+bool parserIsAtEnd(Parser* parser) {
+    return !parser || tokenStreamPeekType(parser->tokens, 0) == TOKEN_EOF;
+}
+
+// ==================== 错误处理 ====================
+
+void parserReportError(Parser* parser, const char* message) {
+    if (!parser || parser->panicMode) {
+        return;
+    }
+
+    parser->panicMode = true;
+    parser->errorCount++;
+
+    if (parser->diagnostics) {
+        const LexedToken* token = parserPeek(parser, 0);
+        SourceLocation location = tokenStreamGetLocation(parser->tokens, token);
+        diagnosticEngineReport(parser->diagnostics, DIAGNOSTIC_LEVEL_ERROR, location,
+                               "parser: %s", message ? message : "syntax error");
+    }
+}
+
+void parserSynchronize(Parser* parser) {
+    if (!parser) {
+        return;
+    }
+
+    parser->panicMode = false;
+    while (!parserIsAtEnd(parser)) {
+        TokenType type = tokenStreamPeekType(parser->tokens, 0);
+        parserAdvance(parser);
+        if (type == TOKEN_SEMICOLON || type == TOKEN_RBRACE) {
+            return;
+        }
+    }
+}
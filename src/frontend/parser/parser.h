@@ -0,0 +1,105 @@
+#ifndef PARSER_H
+#define PARSER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "../lexer/token_stream.h"
+
+// 前向声明
+typedef struct DiagnosticEngine DiagnosticEngine;
+
+// 语法分析所需的最大前看深度
+#define PARSER_LOOKAHEAD 4
+
+/**
+ * @brief 语法分析器结构体
+ *
+ * 通过流式token源按需拉取token，不预先对整个文件做词法分析。
+ */
+typedef struct {
+    TokenStream* tokens;            // 流式token源
+    Lexer* lexer;                   // 词法分析器（借用）
+    DiagnosticEngine* diagnostics;  // 诊断引擎（可为NULL）
+
+    const LexedToken* previous;     // 上一个被消费的token
+    size_t errorCount;              // 语法错误数量
+    bool panicMode;                 // 是否处于错误恢复状态
+} Parser;
+
+// ==================== 构造函数和析构函数 ====================
+
+/**
+ * @brief 创建语法分析器
+ * @param lexer 词法分析器，必须比语法分析器活得久
+ * @param diagnostics 诊断引擎（可为NULL）
+ * @return 新创建的语法分析器，失败返回NULL
+ */
+Parser* createParser(Lexer* lexer, DiagnosticEngine* diagnostics);
+
+/**
+ * @brief 销毁语法分析器（不销毁词法分析器）
+ * @param parser 要销毁的语法分析器
+ */
+void destroyParser(Parser* parser);
+
+// ==================== token访问 ====================
+
+/**
+ * @brief 查看第k个未消费的token（k为0表示当前token）
+ * @param parser 语法分析器
+ * @param k 前看距离（小于PARSER_LOOKAHEAD）
+ * @return token，在下一次parserAdvance之前有效
+ */
+const LexedToken* parserPeek(Parser* parser, size_t k);
+
+/**
+ * @brief 消费当前token
+ * @param parser 语法分析器
+ * @return 被消费的token
+ */
+const LexedToken* parserAdvance(Parser* parser);
+
+/**
+ * @brief 当前token是否为指定类型
+ */
+bool parserCheck(Parser* parser, TokenType type);
+
+/**
+ * @brief 当前token为指定类型时消费它
+ * @return 消费了token返回true
+ */
+bool parserMatch(Parser* parser, TokenType type);
+
+/**
+ * @brief 要求当前token为指定类型，否则报告错误
+ * @param parser 语法分析器
+ * @param type 期望的token类型
+ * @param message 错误消息
+ * @return 被消费的token，类型不符时返回NULL（不消费）
+ */
+const LexedToken* parserExpect(Parser* parser, TokenType type, const char* message);
+
+/**
+ * @brief 是否已到达文件末尾
+ */
+bool parserIsAtEnd(Parser* parser);
+
+// ==================== 错误处理 ====================
+
+/**
+ * @brief 在当前token处报告语法错误
+ *
+ * 处于错误恢复状态时不重复报告。
+ *
+ * @param parser 语法分析器
+ * @param message 错误消息
+ */
+void parserReportError(Parser* parser, const char* message);
+
+/**
+ * @brief 跳过token直到语句边界，退出错误恢复状态
+ * @param parser 语法分析器
+ */
+void parserSynchronize(Parser* parser);
+
+#endif
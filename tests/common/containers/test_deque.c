@@ -0,0 +1,187 @@
+/**
+ * @file test_deque.c
+ * @brief Deque的单元测试
+ */
+
+#include "test_framework.h"
+#include "common/containers/deque.h"
+#include <string.h>
+
+/**
+ * @brief 检查Deque中的元素依次为first, first + 1, ...
+ * @return 不符合的元素个数
+ */
+static size_t countOutOfOrder(const Deque* deque, int first) {
+    size_t mismatches = 0;
+    for (size_t i = 0; i < dequeSize(deque); i++) {
+        const int* value = (const int*)dequeGet(deque, i);
+        if (!value || *value != first + (int)i) {
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * @brief 先进先出，跨越多次扩容
+ */
+static void testFifoAcrossGrowth(void) {
+    Deque* deque = dequeCreate(sizeof(int), 0);
+    TEST_ASSERT(deque != NULL);
+
+    for (int i = 0; i < 10000; i++) {
+        TEST_ASSERT(dequePushBack(deque, &i));
+    }
+    TEST_ASSERT_EQ(10000, dequeSize(deque));
+    TEST_ASSERT(dequeCapacity(deque) >= 10000);
+    TEST_ASSERT_EQ(0, countOutOfOrder(deque, 0));
+
+    for (int i = 0; i < 10000; i++) {
+        int value = -1;
+        TEST_ASSERT(dequePopFront(deque, &value));
+        TEST_ASSERT_EQ(i, value);
+    }
+    TEST_ASSERT(dequeIsEmpty(deque));
+    TEST_ASSERT(!dequePopFront(deque, NULL));
+    TEST_ASSERT(dequeFront(deque) == NULL);
+
+    dequeDestroy(deque, NULL);
+}
+
+/**
+ * @brief 队首位于块中间、队尾回绕进同一块时扩容，顺序不变
+ */
+static void testGrowWithWrappedTail(void) {
+    Deque* deque = dequeCreate(sizeof(int), 0);
+    size_t capacity = dequeCapacity(deque);
+
+    // 让队首移到块中间，再填满整个环，队尾回绕进队首所在的块
+    int next = 0;
+    for (size_t i = 0; i < capacity / 2 + 3; i++) {
+        DEQUE_PUSH_BACK(deque, int, next++);
+    }
+    int first = 0;
+    for (size_t i = 0; i < capacity / 2 + 1; i++) {
+        TEST_ASSERT_EQ(first, DEQUE_POP_FRONT(deque, int));
+        first++;
+    }
+    while (dequeSize(deque) < capacity) {
+        DEQUE_PUSH_BACK(deque, int, next++);
+    }
+    TEST_ASSERT_EQ(capacity, dequeCapacity(deque));
+    TEST_ASSERT_EQ(0, countOutOfOrder(deque, first));
+
+    // 下一次插入触发扩容
+    TEST_ASSERT(DEQUE_PUSH_BACK(deque, int, next++));
+    TEST_ASSERT(dequeCapacity(deque) > capacity);
+    TEST_ASSERT_EQ(0, countOutOfOrder(deque, first));
+
+    while (!dequeIsEmpty(deque)) {
+        TEST_ASSERT_EQ(first, DEQUE_POP_FRONT(deque, int));
+        first++;
+    }
+    TEST_ASSERT_EQ(next, first);
+
+    dequeDestroy(deque, NULL);
+}
+
+/**
+ * @brief 两端交替插入和删除
+ */
+static void testBothEnds(void) {
+    Deque* deque = dequeCreate(sizeof(int), 4);
+
+    // 队首依次放入-1, -2, ...，队尾依次放入0, 1, ...
+    for (int i = 0; i < 3000; i++) {
+        int back = i;
+        int front = -1 - i;
+        TEST_ASSERT(dequePushBack(deque, &back));
+        TEST_ASSERT(dequePushFront(deque, &front));
+    }
+    TEST_ASSERT_EQ(6000, dequeSize(deque));
+    TEST_ASSERT_EQ(0, countOutOfOrder(deque, -3000));
+    TEST_ASSERT_EQ(-3000, *(int*)dequeFront(deque));
+    TEST_ASSERT_EQ(2999, *(int*)dequeBack(deque));
+
+    int value = 0;
+    TEST_ASSERT(dequePopBack(deque, &value));
+    TEST_ASSERT_EQ(2999, value);
+    TEST_ASSERT(dequePopFront(deque, &value));
+    TEST_ASSERT_EQ(-3000, value);
+    TEST_ASSERT_EQ(5998, dequeSize(deque));
+    TEST_ASSERT(dequeGet(deque, 5998) == NULL);
+
+    dequeDestroy(deque, NULL);
+}
+
+/**
+ * @brief 预留容量后元素顺序不变，之后插入不再扩容
+ */
+static void testReserve(void) {
+    Deque* deque = dequeCreate(sizeof(int), 0);
+    for (int i = 0; i < 100; i++) {
+        dequePushFront(deque, &i);
+    }
+
+    TEST_ASSERT(dequeReserve(deque, 50000));
+    size_t capacity = dequeCapacity(deque);
+    TEST_ASSERT(capacity >= 50000);
+    for (size_t i = 0; i < dequeSize(deque); i++) {
+        TEST_ASSERT_EQ(99 - (int)i, DEQUE_AT(deque, int, i));
+    }
+
+    for (int i = 100; i < 50000; i++) {
+        DEQUE_PUSH_BACK(deque, int, i);
+    }
+    TEST_ASSERT_EQ(capacity, dequeCapacity(deque));
+
+    dequeDestroy(deque, NULL);
+}
+
+typedef struct {
+    char payload[1500];
+    int id;
+} LargeElement;
+
+static int destroyedCount = 0;
+
+static void countDestroyed(void* element) {
+    (void)element;
+    destroyedCount++;
+}
+
+/**
+ * @brief 元素大于一块的目标字节数时仍能正常存取，清空时调用析构函数
+ */
+static void testLargeElementsAndClear(void) {
+    Deque* deque = dequeCreate(sizeof(LargeElement), 0);
+    TEST_ASSERT(deque != NULL);
+
+    LargeElement element;
+    memset(&element, 0, sizeof(element));
+    for (int i = 0; i < 100; i++) {
+        element.id = i;
+        element.payload[sizeof(element.payload) - 1] = (char)i;
+        TEST_ASSERT(dequePushBack(deque, &element));
+    }
+    for (int i = 0; i < 100; i++) {
+        LargeElement* stored = (LargeElement*)dequeGet(deque, (size_t)i);
+        TEST_ASSERT(stored->id == i && stored->payload[sizeof(stored->payload) - 1] == (char)i);
+    }
+
+    destroyedCount = 0;
+    dequeClear(deque, countDestroyed);
+    TEST_ASSERT_EQ(100, destroyedCount);
+    TEST_ASSERT(dequeIsEmpty(deque));
+
+    dequeDestroy(deque, NULL);
+}
+
+int main(void) {
+    RUN_TEST(testFifoAcrossGrowth);
+    RUN_TEST(testGrowWithWrappedTail);
+    RUN_TEST(testBothEnds);
+    RUN_TEST(testReserve);
+    RUN_TEST(testLargeElementsAndClear);
+    return TEST_REPORT();
+}
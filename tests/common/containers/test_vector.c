@@ -0,0 +1,160 @@
+/**
+ * @file test_vector.c
+ * @brief Vector内联缓冲区与类型化接口的单元测试
+ */
+
+#include "test_framework.h"
+#include "common/containers/vector.h"
+#include <string.h>
+
+/**
+ * @brief vectorCreate的初始容量在内联缓冲区中，超出后搬到堆上且内容不变
+ */
+static void testInlineThenSpill(void) {
+    Vector* vector = vectorCreate(sizeof(int), 4);
+    TEST_ASSERT(vector != NULL);
+    TEST_ASSERT(vector->data == vector->inlineBuffer);
+    TEST_ASSERT_EQ(4, vectorCapacity(vector));
+
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT(VECTOR_PUSH_BACK(vector, int, i * 10));
+    }
+    TEST_ASSERT(vector->data == vector->inlineBuffer);
+
+    TEST_ASSERT(VECTOR_PUSH_BACK(vector, int, 40));
+    TEST_ASSERT(vector->data != vector->inlineBuffer);
+    TEST_ASSERT(vectorCapacity(vector) > 4);
+    for (int i = 0; i < 5; i++) {
+        TEST_ASSERT_EQ(i * 10, VECTOR_AT(vector, int, i));
+    }
+    TEST_ASSERT_EQ(40, VECTOR_BACK(vector, int));
+
+    vectorDestroy(vector, NULL);
+}
+
+/**
+ * @brief 栈上缓冲区：不超过容量时不分配，超过后溢出到堆上
+ */
+static void testStackBuffer(void) {
+    long buffer[8];
+    Vector vector;
+    TEST_ASSERT(vectorInitWithBuffer(&vector, sizeof(long), buffer, 8));
+    TEST_ASSERT(vector.data == (void*)buffer);
+
+    for (long i = 0; i < 8; i++) {
+        TEST_ASSERT(vectorPushBack(&vector, &i));
+    }
+    TEST_ASSERT(vector.data == (void*)buffer);
+    TEST_ASSERT_EQ(7, buffer[7]);
+
+    for (long i = 8; i < 100; i++) {
+        TEST_ASSERT(VECTOR_PUSH_BACK(&vector, long, i));
+    }
+    TEST_ASSERT(vector.data != (void*)buffer);
+    TEST_ASSERT_EQ(100, vectorSize(&vector));
+    for (long i = 0; i < 100; i++) {
+        TEST_ASSERT_EQ(i, VECTOR_AT(&vector, long, i));
+    }
+
+    // 缩小到内联容量以内时回到缓冲区或保持在堆上都可以，但内容不变
+    vectorResize(&vector, 3, NULL);
+    vectorShrinkToFit(&vector);
+    TEST_ASSERT_EQ(3, vectorSize(&vector));
+    TEST_ASSERT_EQ(2, VECTOR_AT(&vector, long, 2));
+
+    vectorRelease(&vector, NULL);
+
+    // 没有缓冲区时第一次添加元素才分配
+    Vector empty;
+    TEST_ASSERT(vectorInitWithBuffer(&empty, sizeof(int), NULL, 0));
+    TEST_ASSERT(VECTOR_PUSH_BACK(&empty, int, 7));
+    TEST_ASSERT_EQ(7, VECTOR_AT(&empty, int, 0));
+    vectorRelease(&empty, NULL);
+}
+
+typedef struct {
+    int id;
+    char name[12];
+} Item;
+
+/**
+ * @brief 原地构造元素
+ */
+static void testEmplace(void) {
+    Vector* vector = vectorCreate(sizeof(Item), 0);
+
+    for (int i = 0; i < 10; i++) {
+        Item* item = (Item*)vectorEmplaceBack(vector);
+        TEST_ASSERT(item != NULL);
+        item->id = i;
+        strcpy(item->name, "item");
+    }
+
+    Item* middle = (Item*)vectorEmplace(vector, 5);
+    TEST_ASSERT(middle != NULL);
+    middle->id = 100;
+    TEST_ASSERT(vectorEmplace(vector, 12) == NULL);
+
+    TEST_ASSERT_EQ(11, vectorSize(vector));
+    TEST_ASSERT_EQ(4, VECTOR_AT(vector, Item, 4).id);
+    TEST_ASSERT_EQ(100, VECTOR_AT(vector, Item, 5).id);
+    TEST_ASSERT_EQ(5, VECTOR_AT(vector, Item, 6).id);
+    TEST_ASSERT_EQ(9, VECTOR_BACK(vector, Item).id);
+
+    vectorDestroy(vector, NULL);
+}
+
+/**
+ * @brief 交换内联存储的Vector与堆上的Vector后内容各自正确
+ */
+static void testSwapInlineAndHeap(void) {
+    Vector* small = vectorCreate(sizeof(int), 4);
+    Vector* large = vectorCreate(sizeof(int), 4);
+    VECTOR_PUSH_BACK(small, int, 1);
+    for (int i = 0; i < 20; i++) {
+        VECTOR_PUSH_BACK(large, int, i);
+    }
+
+    vectorSwap(small, large);
+    TEST_ASSERT_EQ(20, vectorSize(small));
+    TEST_ASSERT_EQ(1, vectorSize(large));
+    TEST_ASSERT_EQ(19, VECTOR_BACK(small, int));
+    TEST_ASSERT_EQ(1, VECTOR_AT(large, int, 0));
+
+    // 交换后继续添加，不会写到对方的内联缓冲区里
+    VECTOR_PUSH_BACK(large, int, 2);
+    TEST_ASSERT_EQ(0, VECTOR_AT(small, int, 0));
+    TEST_ASSERT_EQ(2, VECTOR_AT(large, int, 1));
+
+    vectorDestroy(small, NULL);
+    vectorDestroy(large, NULL);
+}
+
+/**
+ * @brief 内存池中的Vector扩容后内容不变
+ */
+static void testPoolVector(void) {
+    MemoryPool* pool = createMemoryPool(4096);
+    Vector* vector = vectorCreateInPool(pool, sizeof(int), 2);
+    TEST_ASSERT(vector != NULL);
+
+    for (int i = 0; i < 50; i++) {
+        TEST_ASSERT(VECTOR_PUSH_BACK(vector, int, i));
+    }
+    for (int i = 0; i < 50; i++) {
+        TEST_ASSERT_EQ(i, VECTOR_AT(vector, int, i));
+    }
+    TEST_ASSERT(!vectorShrinkToFit(vector));
+
+    vectorDestroy(vector, NULL);
+    destroyMemoryPool(pool);
+}
+
+int main(void) {
+    RUN_TEST(testInlineThenSpill);
+    RUN_TEST(testStackBuffer);
+    RUN_TEST(testEmplace);
+    RUN_TEST(testSwapInlineAndHeap);
+    RUN_TEST(testPoolVector);
+    return TEST_REPORT();
+}
@@ -0,0 +1,234 @@
+/**
+ * @file test_source_manager.c
+ * @brief 源管理器文件ID与行列号解析的单元测试
+ */
+
+#include "test_framework.h"
+#include "common/diagnostics/source_manager.h"
+#include "common/diagnostics/source_location.h"
+#include "frontend/lexer/lexer.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 取第n个token（从0开始）的行列号
+ */
+static void resolveNthToken(Lexer* lexer, int n, int* line, int* column) {
+    Token* token = NULL;
+    for (int i = 0; i <= n; i++) {
+        token = lexerNextToken(lexer);
+    }
+    *line = 0;
+    *column = 0;
+    if (token) {
+        sourceLocationResolve(&token->location, line, column);
+    }
+}
+
+/**
+ * @brief 按文件名注册时同名文件共用一个ID
+ */
+static void testAddFileDeduplicates(void) {
+    FileId first = sourceManagerAddFile("dedup.c");
+    FileId second = sourceManagerAddFile("dedup.c");
+    TEST_ASSERT(first != INVALID_FILE_ID);
+    TEST_ASSERT_EQ(first, second);
+    TEST_ASSERT_STR_EQ("dedup.c", sourceManagerGetFilename(first));
+    TEST_ASSERT_EQ(INVALID_FILE_ID, sourceManagerAddFile(NULL));
+}
+
+/**
+ * @brief 按缓冲区注册时每次都得到新的ID，匿名缓冲区也有ID
+ */
+static void testAddBufferIsDistinct(void) {
+    FileId first = sourceManagerAddBuffer("buffer.c");
+    FileId second = sourceManagerAddBuffer("buffer.c");
+    FileId anonymous = sourceManagerAddBuffer(NULL);
+    TEST_ASSERT(first != INVALID_FILE_ID);
+    TEST_ASSERT(second != INVALID_FILE_ID && second != first);
+    TEST_ASSERT(anonymous != INVALID_FILE_ID);
+    TEST_ASSERT_STR_EQ("buffer.c", sourceManagerGetFilename(second));
+    TEST_ASSERT(sourceManagerGetFilename(anonymous) == NULL);
+}
+
+/**
+ * @brief 同名的两个缓冲区各自解析行列号
+ */
+static void testSameNameBuffersKeepOwnLines(void) {
+    Lexer* first = createLexer("a\nb\n  c", "same.c", NULL);
+    Lexer* second = createLexer("x y z w", "same.c", NULL);
+    TEST_ASSERT(first != NULL && second != NULL);
+
+    int line;
+    int column;
+    resolveNthToken(first, 2, &line, &column);
+    TEST_ASSERT_EQ(3, line);
+    TEST_ASSERT_EQ(3, column);
+
+    resolveNthToken(second, 2, &line, &column);
+    TEST_ASSERT_EQ(1, line);
+    TEST_ASSERT_EQ(5, column);
+
+    destroyLexer(first);
+    destroyLexer(second);
+}
+
+/**
+ * @brief 没有文件名的源码也能解析行列号，持有引用时销毁词法分析器后仍可解析
+ */
+static void testAnonymousSourceResolves(void) {
+    Lexer* lexer = createLexer("p\n q", NULL, NULL);
+    TEST_ASSERT(lexer != NULL);
+
+    lexerNextToken(lexer);
+    Token* token = lexerNextToken(lexer);
+    TEST_ASSERT(token != NULL);
+    SourceLocation location = token->location;
+    TEST_ASSERT(location.fileId != INVALID_FILE_ID);
+    sourceManagerRetainBuffer(location.fileId);
+    destroyLexer(lexer);
+
+    int line = 0;
+    int column = 0;
+    TEST_ASSERT(sourceLocationResolve(&location, &line, &column));
+    TEST_ASSERT_EQ(2, line);
+    TEST_ASSERT_EQ(2, column);
+
+    sourceManagerReleaseBuffer(location.fileId);
+    TEST_ASSERT(!sourceLocationResolve(&location, &line, &column));
+}
+
+/**
+ * @brief 词法分析器销毁时释放表项，旧ID失效，槽位被重用时分配到新ID
+ */
+static void testLexerReleasesEntry(void) {
+    size_t before = sourceManagerGetFileCount();
+
+    Lexer* lexer = createLexer("int x;", "released.c", NULL);
+    TEST_ASSERT(lexer != NULL);
+    Token* token = lexerNextToken(lexer);
+    TEST_ASSERT(token != NULL);
+    SourceLocation stale = token->location;
+    TEST_ASSERT_EQ(before + 1, sourceManagerGetFileCount());
+    destroyLexer(lexer);
+
+    TEST_ASSERT_EQ(before, sourceManagerGetFileCount());
+    TEST_ASSERT(sourceManagerGetFilename(stale.fileId) == NULL);
+    TEST_ASSERT(!sourceLocationResolve(&stale, NULL, NULL));
+    TEST_ASSERT(sourceManagerGetLineIndex(stale.fileId) == NULL);
+    // 对已释放的ID重复释放或持有都不起作用
+    sourceManagerReleaseBuffer(stale.fileId);
+    sourceManagerRetainBuffer(stale.fileId);
+
+    FileId reused = sourceManagerAddBuffer("reused.c");
+    TEST_ASSERT(reused != INVALID_FILE_ID && reused != stale.fileId);
+    TEST_ASSERT(sourceManagerGetFilename(stale.fileId) == NULL);
+    TEST_ASSERT_STR_EQ("reused.c", sourceManagerGetFilename(reused));
+    sourceManagerReleaseBuffer(reused);
+
+    // 按文件名注册的表项不受释放影响
+    FileId named = sourceManagerAddFile("named.c");
+    sourceManagerReleaseBuffer(named);
+    TEST_ASSERT_STR_EQ("named.c", sourceManagerGetFilename(named));
+}
+
+/**
+ * @brief 反复创建和销毁词法分析器，源管理器不随之增长
+ */
+static void testRepeatedLexersDoNotGrow(void) {
+    size_t before = sourceManagerGetFileCount();
+    FileId first = INVALID_FILE_ID;
+    FileId last = INVALID_FILE_ID;
+
+    for (int i = 0; i < 1000; i++) {
+        Lexer* lexer = createLexer("a\nb\n\"unterminated", "cycle.c", NULL);
+        TEST_ASSERT(lexer != NULL);
+        while (lexerNextToken(lexer)->type != TOKEN_EOF) {
+        }
+        if (i == 0) {
+            first = lexer->fileId;
+        }
+        last = lexer->fileId;
+        destroyLexer(lexer);
+    }
+
+    TEST_ASSERT_EQ(before, sourceManagerGetFileCount());
+    // 同一个槽位被反复重用，ID的槽位部分相同、代数不同
+    TEST_ASSERT(first != last);
+    TEST_ASSERT_EQ(first & 0xFFFFFFu, last & 0xFFFFFFu);
+}
+
+/**
+ * @brief 随机编辑后原地更新的行索引与重新构建的一致
+ */
+static void testEditUpdatesLineIndexInPlace(void) {
+    static const char* const pieces[] = { "", "\n", "x", "ab\ncd", "\n\n", "int y;\n" };
+    size_t capacity = 1 << 16;
+    char* text = (char*)malloc(capacity);
+    char* next = (char*)malloc(capacity);
+    strcpy(text, "int a;\nint b;\n\nint c;");
+    size_t length = strlen(text);
+
+    FileId fileId = sourceManagerAddBuffer("edited.c");
+    TEST_ASSERT(sourceManagerSetFileContent(fileId, text, length));
+    const LineIndex* index = sourceManagerGetLineIndex(fileId);
+    TEST_ASSERT(index != NULL);
+
+    srand(2024);
+    size_t mismatches = 0;
+    for (int round = 0; round < 2000; round++) {
+        size_t offset = (size_t)rand() % (length + 1);
+        size_t removed = (size_t)rand() % 6;
+        if (removed > length - offset) {
+            removed = length - offset;
+        }
+        const char* inserted = pieces[rand() % (int)(sizeof(pieces) / sizeof(pieces[0]))];
+        size_t insertedLength = strlen(inserted);
+        if (length - removed + insertedLength + 1 > capacity) {
+            insertedLength = 0;
+        }
+
+        memcpy(next, text, offset);
+        memcpy(next + offset, inserted, insertedLength);
+        memcpy(next + offset + insertedLength, text + offset + removed, length - offset - removed + 1);
+        char* swap = text;
+        text = next;
+        next = swap;
+        length = length - removed + insertedLength;
+        TEST_ASSERT(sourceManagerEditFileContent(fileId, text, length, offset, removed, insertedLength));
+
+        // 已构建的索引原地更新，不重建
+        TEST_ASSERT(sourceManagerGetLineIndex(fileId) == index);
+        LineIndex* rebuilt = createLineIndex(text, length);
+        if (rebuilt->lineCount != index->lineCount ||
+            memcmp(rebuilt->lineStarts, index->lineStarts, rebuilt->lineCount * sizeof(uint32_t)) != 0) {
+            mismatches++;
+        }
+        destroyLineIndex(rebuilt);
+    }
+    TEST_ASSERT_EQ(0, mismatches);
+
+    // 编辑与登记的长度不符时丢弃索引，下一次查询按新内容重建
+    TEST_ASSERT(sourceManagerEditFileContent(fileId, text, length, 0, 1, 0));
+    int line = 0;
+    TEST_ASSERT(sourceManagerGetLineColumn(fileId, (uint32_t)length, &line, NULL));
+    LineIndex* rebuilt = createLineIndex(text, length);
+    TEST_ASSERT_EQ((int)rebuilt->lineCount, line);
+    destroyLineIndex(rebuilt);
+
+    sourceManagerReleaseBuffer(fileId);
+    free(text);
+    free(next);
+}
+
+int main(void) {
+    RUN_TEST(testAddFileDeduplicates);
+    RUN_TEST(testAddBufferIsDistinct);
+    RUN_TEST(testSameNameBuffersKeepOwnLines);
+    RUN_TEST(testAnonymousSourceResolves);
+    RUN_TEST(testLexerReleasesEntry);
+    RUN_TEST(testRepeatedLexersDoNotGrow);
+    RUN_TEST(testEditUpdatesLineIndexInPlace);
+    sourceManagerReset();
+    return TEST_REPORT();
+}
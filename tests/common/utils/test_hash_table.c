@@ -0,0 +1,169 @@
+/**
+ * @file test_hash_table.c
+ * @brief HashTable的单元测试
+ */
+
+#include "test_framework.h"
+#include "common/utils/hash_table.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 字符串表的插入、查找、替换与删除
+ */
+static void testStringTableBasics(void) {
+    HashTable* table = createStringHashTable(0);
+    TEST_ASSERT(table != NULL);
+
+    int one = 1, two = 2;
+    TEST_ASSERT(hashTableInsert(table, "alpha", &one));
+    TEST_ASSERT(hashTableInsert(table, "beta", &two));
+    TEST_ASSERT_EQ(2, hashTableSize(table));
+    TEST_ASSERT(hashTableGet(table, "alpha") == &one);
+    TEST_ASSERT(hashTableGet(table, "beta") == &two);
+    TEST_ASSERT(!hashTableContains(table, "gamma"));
+
+    // 键已存在时替换值；用另一块内存中的相同字符串查找
+    char copy[] = "alpha";
+    TEST_ASSERT(hashTableInsert(table, copy, &two));
+    TEST_ASSERT_EQ(2, hashTableSize(table));
+    TEST_ASSERT(hashTableGet(table, "alpha") == &two);
+
+    const void* removedKey = NULL;
+    void* removedValue = NULL;
+    TEST_ASSERT(hashTableRemove(table, "beta", &removedKey, &removedValue));
+    TEST_ASSERT_STR_EQ("beta", (const char*)removedKey);
+    TEST_ASSERT(removedValue == &two);
+    TEST_ASSERT(!hashTableContains(table, "beta"));
+    TEST_ASSERT(!hashTableRemove(table, "beta", NULL, NULL));
+    TEST_ASSERT_EQ(1, hashTableSize(table));
+
+    destroyHashTable(table);
+}
+
+/**
+ * @brief 按片段查找：长度不同、内联部分相同、超过内联长度上限的键都能区分
+ */
+static void testStringFragments(void) {
+    // 15字节以内、正好15和16字节、共享前15字节、超过255字节的键
+    static const char* const keys[] = {
+        "x", "xy", "fifteen_chars_x", "fifteen_chars_xy", "fifteen_chars_xz",
+    };
+    const size_t keyCount = sizeof(keys) / sizeof(keys[0]);
+    char longA[301], longB[401];
+    memset(longA, 'a', 300);
+    longA[300] = '\0';
+    memset(longB, 'a', 400);
+    longB[400] = '\0';
+
+    HashTable* table = createStringHashTable(0);
+    for (size_t i = 0; i < keyCount; i++) {
+        TEST_ASSERT(hashTableInsert(table, keys[i], (void*)keys[i]));
+    }
+    TEST_ASSERT(hashTableInsert(table, longA, longA));
+    TEST_ASSERT(hashTableInsert(table, longB, longB));
+
+    // 片段嵌在更长的文本中，不以'\0'结尾
+    const char* text = "fifteen_chars_xyz";
+    void* value = NULL;
+    for (size_t length = 1; length <= 17; length++) {
+        bool found = hashTableGetString(table, text, length, hashTableHashBytes(text, length), &value);
+        bool expected = length == 15 || length == 16;
+        TEST_ASSERT(found == expected);
+    }
+    TEST_ASSERT(hashTableGetString(table, text, 16, hashTableHashBytes(text, 16), &value));
+    TEST_ASSERT(value == keys[3]);
+
+    // 超过内联上限的两个键长度不同，内联的长度字节相同
+    TEST_ASSERT(hashTableGetString(table, longB, 300, hashTableHashBytes(longB, 300), &value));
+    TEST_ASSERT(value == longA);
+    TEST_ASSERT(hashTableGetString(table, longB, 400, hashTableHashBytes(longB, 400), &value));
+    TEST_ASSERT(value == longB);
+    TEST_ASSERT(!hashTableGetString(table, longB, 350, hashTableHashBytes(longB, 350), NULL));
+    TEST_ASSERT(!hashTableGetString(table, "x", 0, hashTableHashBytes("x", 0), NULL));
+
+    destroyHashTable(table);
+}
+
+/**
+ * @brief 多次扩容与删除后所有键仍能找到
+ */
+static void testGrowthAndRemoval(void) {
+    enum { COUNT = 5000 };
+    char (*names)[16] = malloc(COUNT * sizeof(*names));
+    TEST_ASSERT(names != NULL);
+
+    HashTable* table = createStringHashTable(0);
+    for (int i = 0; i < COUNT; i++) {
+        snprintf(names[i], sizeof(names[i]), "name_%d", i);
+        TEST_ASSERT(hashTableInsert(table, names[i], names[i]));
+    }
+    TEST_ASSERT_EQ(COUNT, hashTableSize(table));
+
+    // 删除偶数项
+    for (int i = 0; i < COUNT; i += 2) {
+        TEST_ASSERT(hashTableRemove(table, names[i], NULL, NULL));
+    }
+    TEST_ASSERT_EQ(COUNT / 2, hashTableSize(table));
+
+    int found = 0;
+    for (int i = 0; i < COUNT; i++) {
+        void* value = NULL;
+        bool present = hashTableFind(table, names[i], &value);
+        TEST_ASSERT(present == (i % 2 == 1));
+        if (present) {
+            TEST_ASSERT(value == names[i]);
+            found++;
+        }
+    }
+    TEST_ASSERT_EQ(COUNT / 2, found);
+
+    // 遍历得到的键值对与表中的一致
+    size_t iterator = 0;
+    size_t visited = 0;
+    const void* key;
+    void* value;
+    while (hashTableNext(table, &iterator, &key, &value)) {
+        TEST_ASSERT(key == value);
+        visited++;
+    }
+    TEST_ASSERT_EQ(COUNT / 2, visited);
+
+    destroyHashTable(table);
+    free(names);
+}
+
+/**
+ * @brief 以指针为键的通用表
+ */
+static void testPointerTable(void) {
+    int items[64];
+    HashTable* table = createHashTable(hashTableHashPointer, hashTablePointerEquals, 8);
+    TEST_ASSERT(table != NULL);
+
+    for (int i = 0; i < 64; i++) {
+        items[i] = i;
+        TEST_ASSERT(hashTableInsert(table, &items[i], &items[i]));
+    }
+    TEST_ASSERT_EQ(64, hashTableSize(table));
+    for (int i = 0; i < 64; i++) {
+        int* value = (int*)hashTableGet(table, &items[i]);
+        TEST_ASSERT(value != NULL && *value == i);
+    }
+
+    hashTableClear(table);
+    TEST_ASSERT_EQ(0, hashTableSize(table));
+    TEST_ASSERT(!hashTableContains(table, &items[0]));
+
+    TEST_ASSERT(createHashTable(NULL, hashTablePointerEquals, 0) == NULL);
+    destroyHashTable(table);
+}
+
+int main(void) {
+    RUN_TEST(testStringTableBasics);
+    RUN_TEST(testStringFragments);
+    RUN_TEST(testGrowthAndRemoval);
+    RUN_TEST(testPointerTable);
+    return TEST_REPORT();
+}
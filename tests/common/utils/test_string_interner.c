@@ -0,0 +1,207 @@
+/**
+ * @file test_string_interner.c
+ * @brief 字符串驻留器的单元测试
+ */
+
+#include "test_framework.h"
+#include "common/utils/string_utils.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief 内容相同的字符串得到同一个句柄，片段与C字符串等价
+ */
+static void testInternReturnsSameHandle(void) {
+    StringInterner* interner = createStringInterner(0);
+    TEST_ASSERT(interner != NULL);
+
+    InternedString a = stringInternerInternCString(interner, "counter");
+    const char* source = "int counter = 0;";
+    InternedString b = stringInternerIntern(interner, source + 4, 7);
+    TEST_ASSERT(a != NULL);
+    TEST_ASSERT(a == b);
+    TEST_ASSERT_STR_EQ("counter", a);
+    TEST_ASSERT_EQ(7, internedStringLength(a));
+
+    // 前缀相同但长度不同的片段是不同的字符串
+    InternedString prefix = stringInternerIntern(interner, source + 4, 5);
+    TEST_ASSERT(prefix != a);
+    TEST_ASSERT_STR_EQ("count", prefix);
+    TEST_ASSERT_EQ(2, stringInternerCount(interner));
+
+    // 空字符串也可以驻留
+    InternedString empty = stringInternerIntern(interner, source, 0);
+    TEST_ASSERT(empty != NULL);
+    TEST_ASSERT_EQ(0, internedStringLength(empty));
+    TEST_ASSERT(stringInternerInternCString(interner, "") == empty);
+
+    destroyStringInterner(interner);
+}
+
+/**
+ * @brief Find只查找不插入
+ */
+static void testFindDoesNotInsert(void) {
+    StringInterner* interner = createStringInterner(16);
+
+    TEST_ASSERT(stringInternerFind(interner, "value", 5) == NULL);
+    TEST_ASSERT_EQ(0, stringInternerCount(interner));
+
+    InternedString value = stringInternerInternCString(interner, "value");
+    TEST_ASSERT(stringInternerFind(interner, "value", 5) == value);
+    TEST_ASSERT_EQ(1, stringInternerCount(interner));
+
+    destroyStringInterner(interner);
+}
+
+/**
+ * @brief 大量字符串（跨越所有分片、多次扩容）后句柄保持不变
+ */
+static void testManyStrings(void) {
+    enum { COUNT = 20000 };
+    static InternedString handles[COUNT];
+    StringInterner* interner = createStringInterner(0);
+
+    char buffer[32];
+    for (int i = 0; i < COUNT; i++) {
+        snprintf(buffer, sizeof(buffer), "identifier_%d", i);
+        handles[i] = stringInternerInternCString(interner, buffer);
+        TEST_ASSERT(handles[i] != NULL);
+    }
+    TEST_ASSERT_EQ(COUNT, stringInternerCount(interner));
+
+    for (int i = 0; i < COUNT; i++) {
+        snprintf(buffer, sizeof(buffer), "identifier_%d", i);
+        TEST_ASSERT(stringInternerInternCString(interner, buffer) == handles[i]);
+        TEST_ASSERT_STR_EQ(buffer, handles[i]);
+    }
+    TEST_ASSERT_EQ(COUNT, stringInternerCount(interner));
+
+    destroyStringInterner(interner);
+}
+
+/**
+ * @brief 内容含'\0'的片段按完整长度驻留，扩容前后句柄都不变
+ */
+static void testEmbeddedNul(void) {
+    enum { COUNT = 5000, LONG_LENGTH = 300 };
+    static InternedString shortHandles[COUNT];
+    static InternedString longHandles[COUNT];
+    StringInterner* interner = createStringInterner(0);
+
+    InternedString first = stringInternerIntern(interner, "a\0b", 3);
+    TEST_ASSERT(first != NULL);
+    TEST_ASSERT(stringInternerIntern(interner, "a\0b", 3) == first);
+    TEST_ASSERT(stringInternerFind(interner, "a\0b", 3) == first);
+    TEST_ASSERT_EQ(3, internedStringLength(first));
+    TEST_ASSERT(memcmp(first, "a\0b", 4) == 0);
+    TEST_ASSERT(stringInternerIntern(interner, "a", 1) != first);
+    TEST_ASSERT(stringInternerIntern(interner, "a\0c", 3) != first);
+    TEST_ASSERT_EQ(3, stringInternerCount(interner));
+
+    // 短键只在'\0'之后不同；长键超过内联长度上限，'\0'之后才不同
+    char shortKey[16];
+    char longKey[LONG_LENGTH];
+    memset(longKey, 'x', sizeof(longKey));
+    longKey[10] = '\0';
+    for (int i = 0; i < COUNT; i++) {
+        memset(shortKey, 0, sizeof(shortKey));
+        snprintf(shortKey + 1, sizeof(shortKey) - 1, "%d", i);
+        shortHandles[i] = stringInternerIntern(interner, shortKey, sizeof(shortKey));
+        snprintf(longKey + LONG_LENGTH - 8, 8, "%07d", i);
+        longHandles[i] = stringInternerIntern(interner, longKey, LONG_LENGTH);
+        TEST_ASSERT(shortHandles[i] != NULL && longHandles[i] != NULL);
+    }
+    TEST_ASSERT_EQ(3 + 2 * COUNT, stringInternerCount(interner));
+
+    size_t mismatches = 0;
+    for (int i = 0; i < COUNT; i++) {
+        memset(shortKey, 0, sizeof(shortKey));
+        snprintf(shortKey + 1, sizeof(shortKey) - 1, "%d", i);
+        snprintf(longKey + LONG_LENGTH - 8, 8, "%07d", i);
+        if (stringInternerIntern(interner, shortKey, sizeof(shortKey)) != shortHandles[i] ||
+            stringInternerIntern(interner, longKey, LONG_LENGTH) != longHandles[i] ||
+            internedStringLength(longHandles[i]) != LONG_LENGTH ||
+            memcmp(longHandles[i], longKey, LONG_LENGTH) != 0) {
+            mismatches++;
+        }
+    }
+    TEST_ASSERT_EQ(0, mismatches);
+    TEST_ASSERT(stringInternerIntern(interner, "a\0b", 3) == first);
+    TEST_ASSERT_EQ(3 + 2 * COUNT, stringInternerCount(interner));
+
+    // 长键的前缀（同样含'\0'）是另一个字符串
+    TEST_ASSERT(stringInternerFind(interner, longKey, LONG_LENGTH - 1) == NULL);
+
+    destroyStringInterner(interner);
+}
+
+typedef struct {
+    StringInterner* interner;
+    InternedString handles[1000];
+} InternThreadData;
+
+static void* internThread(void* arg) {
+    InternThreadData* data = (InternThreadData*)arg;
+    char buffer[32];
+    for (int i = 0; i < 1000; i++) {
+        snprintf(buffer, sizeof(buffer), "shared_%d", i);
+        data->handles[i] = stringInternerInternCString(data->interner, buffer);
+    }
+    return NULL;
+}
+
+/**
+ * @brief 多个线程同时驻留相同的字符串，得到同一个句柄
+ */
+static void testConcurrentIntern(void) {
+    enum { THREADS = 4 };
+    static InternThreadData data[THREADS];
+    pthread_t threads[THREADS];
+    StringInterner* interner = createStringInterner(0);
+
+    for (int i = 0; i < THREADS; i++) {
+        data[i].interner = interner;
+        TEST_ASSERT(pthread_create(&threads[i], NULL, internThread, &data[i]) == 0);
+    }
+    for (int i = 0; i < THREADS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    TEST_ASSERT_EQ(1000, stringInternerCount(interner));
+    for (int t = 1; t < THREADS; t++) {
+        for (int i = 0; i < 1000; i++) {
+            TEST_ASSERT(data[t].handles[i] == data[0].handles[i]);
+        }
+    }
+
+    destroyStringInterner(interner);
+}
+
+/**
+ * @brief 全局驻留器重置后重新创建
+ */
+static void testGlobalInternerReset(void) {
+    StringInterner* global = globalStringInterner();
+    TEST_ASSERT(global != NULL);
+    TEST_ASSERT(globalStringInterner() == global);
+
+    TEST_ASSERT(stringInternerInternCString(global, "main") != NULL);
+    globalStringInternerReset();
+
+    StringInterner* recreated = globalStringInterner();
+    TEST_ASSERT(recreated != NULL);
+    TEST_ASSERT_EQ(0, stringInternerCount(recreated));
+    globalStringInternerReset();
+}
+
+int main(void) {
+    RUN_TEST(testInternReturnsSameHandle);
+    RUN_TEST(testFindDoesNotInsert);
+    RUN_TEST(testManyStrings);
+    RUN_TEST(testEmbeddedNul);
+    RUN_TEST(testConcurrentIntern);
+    RUN_TEST(testGlobalInternerReset);
+    return TEST_REPORT();
+}
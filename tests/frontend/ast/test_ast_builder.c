@@ -0,0 +1,103 @@
+/**
+ * @file test_ast_builder.c
+ * @brief ASTBuilder与slab内存池的单元测试
+ */
+
+#include "test_framework.h"
+#include "frontend/ast/ast_builder.h"
+#include <stdlib.h>
+
+static SourceLocation testLocation(void) {
+    return createSourceLocation(INVALID_FILE_ID, 0);
+}
+
+/**
+ * @brief 构建器创建的节点分配在它的slab内存池中，调用返回后不改变线程设置
+ */
+static void testBuilderNodesLiveInArena(void) {
+    DiagnosticEngine* diagnostics = createDiagnosticEngine(NULL);
+    ASTBuilder* builder = createASTBuilder(diagnostics);
+    TEST_ASSERT(builder != NULL);
+    TEST_ASSERT(astGetSlabArena() == NULL);
+
+    Expression* left = astBuilderCreateIdentifierExpr(builder, "a", testLocation());
+    Expression* right = astBuilderCreateIdentifierExpr(builder, "b", testLocation());
+    Expression* sum = astBuilderCreateBinaryOpExpr(builder, BINOP_ADD, left, right, testLocation());
+    TEST_ASSERT(sum != NULL);
+    TEST_ASSERT(sum->base.arenaAllocated);
+    TEST_ASSERT(astGetSlabArena() == NULL);
+
+    // 根节点 + 3个表达式
+    TEST_ASSERT_EQ(4, astBuilderGetNodeCount(builder));
+
+    destroyASTBuilder(builder);
+    destroyDiagnosticEngine(diagnostics);
+}
+
+/**
+ * @brief 构建器存在期间，构建器之外的create*调用仍从堆分配
+ */
+static void testDirectCreateIsNotCaptured(void) {
+    DiagnosticEngine* diagnostics = createDiagnosticEngine(NULL);
+    ASTBuilder* builder = createASTBuilder(diagnostics);
+
+    Expression* expr = createIdentifierExpr("x", testLocation());
+    TEST_ASSERT(expr != NULL);
+    TEST_ASSERT(!expr->base.arenaAllocated);
+    TEST_ASSERT_EQ(1, astBuilderGetNodeCount(builder));
+    destroyASTNode(&expr->base);
+
+    destroyASTBuilder(builder);
+    destroyDiagnosticEngine(diagnostics);
+}
+
+/**
+ * @brief 构建器不按后进先出的顺序销毁后，线程上不会留下已释放的内存池
+ */
+static void testOutOfOrderDestroy(void) {
+    DiagnosticEngine* diagnostics = createDiagnosticEngine(NULL);
+    ASTBuilder* first = createASTBuilder(diagnostics);
+    ASTBuilder* second = createASTBuilder(diagnostics);
+    TEST_ASSERT(first != NULL && second != NULL);
+
+    destroyASTBuilder(first);
+    Expression* inSecond = astBuilderCreateIdentifierExpr(second, "y", testLocation());
+    TEST_ASSERT(inSecond != NULL);
+    TEST_ASSERT_EQ(2, astBuilderGetNodeCount(second));
+    destroyASTBuilder(second);
+
+    TEST_ASSERT(astGetSlabArena() == NULL);
+    Expression* expr = createIdentifierExpr("z", testLocation());
+    TEST_ASSERT(expr != NULL);
+    TEST_ASSERT(!expr->base.arenaAllocated);
+    destroyASTNode(&expr->base);
+
+    destroyDiagnosticEngine(diagnostics);
+}
+
+/**
+ * @brief 直接调用create*时临时设置构建器的内存池，节点归构建器所有
+ */
+static void testExplicitArenaScope(void) {
+    DiagnosticEngine* diagnostics = createDiagnosticEngine(NULL);
+    ASTBuilder* builder = createASTBuilder(diagnostics);
+
+    ASTSlabArena* previous = astSetSlabArena(astBuilderGetArena(builder));
+    Expression* expr = createIdentifierExpr("w", testLocation());
+    astSetSlabArena(previous);
+
+    TEST_ASSERT(expr != NULL);
+    TEST_ASSERT(expr->base.arenaAllocated);
+    TEST_ASSERT_EQ(2, astBuilderGetNodeCount(builder));
+
+    destroyASTBuilder(builder);
+    destroyDiagnosticEngine(diagnostics);
+}
+
+int main(void) {
+    RUN_TEST(testBuilderNodesLiveInArena);
+    RUN_TEST(testDirectCreateIsNotCaptured);
+    RUN_TEST(testOutOfOrderDestroy);
+    RUN_TEST(testExplicitArenaScope);
+    return TEST_REPORT();
+}
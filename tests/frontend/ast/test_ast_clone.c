@@ -0,0 +1,275 @@
+/**
+ * @file test_ast_clone.c
+ * @brief AST克隆、结构比较与子树哈希合并的单元测试
+ */
+
+#include "test_framework.h"
+#include "frontend/ast/ast_utils.h"
+#include "frontend/ast/ast_nodes.h"
+#include <stdlib.h>
+
+static SourceLocation testLocation(void) {
+    return createSourceLocation(INVALID_FILE_ID, 0);
+}
+
+static Expression* createSum(const char* left, const char* right) {
+    return createBinaryOperatorExpr(BINOP_ADD,
+                                    createIdentifierExpr(left, testLocation()),
+                                    createIdentifierExpr(right, testLocation()),
+                                    testLocation());
+}
+
+/**
+ * @brief 克隆与原树结构相等，节点都是新分配的，父指针指向克隆出的父节点
+ */
+static void testCloneIsDeepAndEqual(void) {
+    Token* one = createIntegerToken("1", testLocation(), 10);
+    Expression* original = createBinaryOperatorExpr(BINOP_MUL, createSum("a", "b"),
+                                                    createLiteralExpr(one, testLocation()),
+                                                    testLocation());
+    TEST_ASSERT(original != NULL);
+
+    ASTNode* clone = astNodeClone(&original->base);
+    TEST_ASSERT(clone != NULL);
+    TEST_ASSERT(clone != &original->base);
+    TEST_ASSERT(!clone->arenaAllocated);
+    TEST_ASSERT(clone->parent == NULL);
+    TEST_ASSERT(astNodeEquals(&original->base, clone));
+    TEST_ASSERT_EQ(astNodeStructuralHash(&original->base), astNodeStructuralHash(clone));
+
+    BinaryOperatorExpr* clonedProduct = (BinaryOperatorExpr*)clone;
+    BinaryOperatorExpr* clonedSum = (BinaryOperatorExpr*)clonedProduct->left;
+    TEST_ASSERT(&clonedSum->base != ((BinaryOperatorExpr*)original)->left);
+    TEST_ASSERT(clonedSum->base.base.parent == clone);
+    TEST_ASSERT(clonedSum->left->base.parent == &clonedSum->base.base);
+
+    // 字面量的Token是引用，与原节点共享
+    TEST_ASSERT(((LiteralExpr*)clonedProduct->right)->literalToken == one);
+
+    destroyASTNode(clone);
+    destroyASTNode(&original->base);
+    destroyToken(one);
+}
+
+/**
+ * @brief 语句随子树一起克隆，子节点的父指针指向克隆出的语句
+ */
+static void testCloneStatement(void) {
+    ASTSlabArena* arena = createASTSlabArena();
+    ASTSlabArena* previous = astSetSlabArena(arena);
+
+    Statement* original = createReturnStatement(createSum("a", "b"), testLocation());
+    ASTNode* clone = astNodeClone(&original->base);
+    TEST_ASSERT(clone != NULL);
+    TEST_ASSERT(clone != &original->base);
+    TEST_ASSERT(astNodeEquals(&original->base, clone));
+
+    Expression* value = ((ReturnStatement*)clone)->returnValue;
+    TEST_ASSERT(value != ((ReturnStatement*)original)->returnValue);
+    TEST_ASSERT(value->base.parent == clone);
+
+    Statement* bare = createReturnStatement(NULL, testLocation());
+    TEST_ASSERT(!astNodeEquals(&bare->base, clone));
+
+    astSetSlabArena(previous);
+    destroyASTSlabArena(arena);
+}
+
+/**
+ * @brief 结构比较忽略源位置，但区分运算符、名称和字面量
+ */
+static void testEqualsComparesStructure(void) {
+    TEST_ASSERT(astNodeEquals(NULL, NULL));
+    TEST_ASSERT_EQ(0, astNodeStructuralHash(NULL));
+
+    Expression* sum = createSum("a", "b");
+    Expression* moved = createBinaryOperatorExpr(BINOP_ADD,
+                                                 createIdentifierExpr("a", createSourceLocation(INVALID_FILE_ID, 7)),
+                                                 createIdentifierExpr("b", createSourceLocation(INVALID_FILE_ID, 9)),
+                                                 createSourceLocation(INVALID_FILE_ID, 8));
+    Expression* renamed = createSum("a", "c");
+    Expression* difference = createBinaryOperatorExpr(BINOP_SUB,
+                                                      createIdentifierExpr("a", testLocation()),
+                                                      createIdentifierExpr("b", testLocation()),
+                                                      testLocation());
+
+    TEST_ASSERT(astNodeStructuralHash(&sum->base) != 0);
+    TEST_ASSERT(astNodeEquals(&sum->base, &moved->base));
+    TEST_ASSERT(!astNodeEquals(&sum->base, &renamed->base));
+    TEST_ASSERT(!astNodeEquals(&sum->base, &difference->base));
+    TEST_ASSERT(!astNodeEquals(&sum->base, NULL));
+
+    Token* one = createIntegerToken("1", testLocation(), 10);
+    Token* two = createIntegerToken("2", testLocation(), 10);
+    Expression* first = createLiteralExpr(one, testLocation());
+    Expression* second = createLiteralExpr(two, testLocation());
+    TEST_ASSERT(!astNodeEquals(&first->base, &second->base));
+
+    destroyASTNode(&sum->base);
+    destroyASTNode(&moved->base);
+    destroyASTNode(&renamed->base);
+    destroyASTNode(&difference->base);
+    destroyASTNode(&first->base);
+    destroyASTNode(&second->base);
+    destroyToken(one);
+    destroyToken(two);
+}
+
+/**
+ * @brief 就地修改克隆并使缓存的哈希失效后，克隆与原树不再相等
+ */
+static void testInvalidateAfterMutation(void) {
+    Expression* original = createSum("x", "y");
+    uint64_t originalHash = astNodeStructuralHash(&original->base);
+
+    ASTNode* clone = astNodeClone(&original->base);
+    TEST_ASSERT(clone != NULL);
+    TEST_ASSERT_EQ(originalHash, astNodeStructuralHash(clone));
+
+    ((BinaryOperatorExpr*)clone)->op = BINOP_MUL;
+    astNodeInvalidateStructuralHash(clone);
+    TEST_ASSERT(astNodeStructuralHash(clone) != originalHash);
+    TEST_ASSERT(!astNodeEquals(&original->base, clone));
+
+    // 修改子节点后也要从被修改的节点开始失效，祖先的缓存一并清除
+    ((BinaryOperatorExpr*)clone)->op = BINOP_ADD;
+    Expression* operand = createIdentifierExpr("y", testLocation());
+    UnaryOperatorExpr* negated = (UnaryOperatorExpr*)createUnaryOperatorExpr(UNOP_MINUS, operand, true, testLocation());
+    BinaryOperatorExpr* cloneSum = (BinaryOperatorExpr*)clone;
+    destroyASTNode(&cloneSum->right->base);
+    cloneSum->right = &negated->base;
+    astNodeSetParent(&negated->base.base, clone);
+    astNodeInvalidateStructuralHash(&negated->base.base);
+    TEST_ASSERT(!astNodeEquals(&original->base, clone));
+
+    destroyASTNode(clone);
+    destroyASTNode(&original->base);
+}
+
+/**
+ * @brief 很深的表达式链可以克隆、哈希、比较和销毁，不会栈溢出
+ */
+static void testDeepChain(void) {
+    enum { DEPTH = 1000000 };
+    ASTSlabArena* arena = createASTSlabArena();
+    TEST_ASSERT(arena != NULL);
+    ASTSlabArena* previous = astSetSlabArena(arena);
+
+    Expression* chain = createIdentifierExpr("v", testLocation());
+    for (int i = 0; i < DEPTH; i++) {
+        chain = createUnaryOperatorExpr(UNOP_MINUS, chain, true, testLocation());
+    }
+
+    ASTNode* clone = astNodeClone(&chain->base);
+    TEST_ASSERT(clone != NULL);
+    TEST_ASSERT(astNodeEquals(&chain->base, clone));
+
+    // 修改最深处的运算符，差异要一路传到根
+    UnaryOperatorExpr* innermost = (UnaryOperatorExpr*)clone;
+    while (innermost->operand->base.nodeType == AST_NODE_UNARY_OPERATOR_EXPR) {
+        innermost = (UnaryOperatorExpr*)innermost->operand;
+    }
+    innermost->op = UNOP_PREFIX_INC;
+    astNodeInvalidateStructuralHash(&innermost->base.base);
+    TEST_ASSERT(!astNodeEquals(&chain->base, clone));
+
+    astSetSlabArena(previous);
+    destroyASTSlabArena(arena);
+
+    // 堆上的a+b+c+...链及其克隆逐个销毁，同样不会栈溢出
+    Expression* sum = createIdentifierExpr("a", testLocation());
+    for (int i = 0; i < DEPTH; i++) {
+        sum = createBinaryOperatorExpr(BINOP_ADD, sum, createIdentifierExpr("b", testLocation()), testLocation());
+    }
+    ASTNode* heapClone = astNodeClone(&sum->base);
+    TEST_ASSERT(heapClone != NULL);
+    TEST_ASSERT(!heapClone->arenaAllocated);
+    TEST_ASSERT(astNodeEquals(&sum->base, heapClone));
+
+    destroyASTNode(heapClone);
+    destroyASTNode(&sum->base);
+}
+
+/**
+ * @brief 内存池中结构相同的表达式合并为同一个规范节点，堆上的节点不合并
+ */
+static void testHashConsIntern(void) {
+    ASTHashConsTable* table = createASTHashConsTable(0);
+    TEST_ASSERT(table != NULL);
+
+    Expression* heapNode = createIdentifierExpr("h", testLocation());
+    TEST_ASSERT(astHashConsIntern(table, &heapNode->base) == &heapNode->base);
+    TEST_ASSERT_EQ(0, astHashConsUniqueCount(table));
+    destroyASTNode(&heapNode->base);
+
+    ASTSlabArena* arena = createASTSlabArena();
+    ASTSlabArena* previous = astSetSlabArena(arena);
+
+    ASTNode* a1 = astHashConsIntern(table, &createIdentifierExpr("a", testLocation())->base);
+    ASTNode* b1 = astHashConsIntern(table, &createIdentifierExpr("b", testLocation())->base);
+    ASTNode* sum1 = astHashConsIntern(table, &createBinaryOperatorExpr(BINOP_ADD, (Expression*)a1, (Expression*)b1,
+                                                                       testLocation())->base);
+
+    ASTNode* a2 = astHashConsIntern(table, &createIdentifierExpr("a", testLocation())->base);
+    ASTNode* b2 = astHashConsIntern(table, &createIdentifierExpr("b", testLocation())->base);
+    ASTNode* sum2 = astHashConsIntern(table, &createBinaryOperatorExpr(BINOP_ADD, (Expression*)a2, (Expression*)b2,
+                                                                       testLocation())->base);
+
+    TEST_ASSERT(a1 == a2);
+    TEST_ASSERT(b1 == b2);
+    TEST_ASSERT(sum1 == sum2);
+    TEST_ASSERT_EQ(3, astHashConsUniqueCount(table));
+    TEST_ASSERT_EQ(3, astHashConsSharedCount(table));
+
+    // 语句不参与合并
+    Statement* ret1 = createReturnStatement((Expression*)sum1, testLocation());
+    Statement* ret2 = createReturnStatement((Expression*)sum1, testLocation());
+    TEST_ASSERT(astHashConsIntern(table, &ret1->base) == &ret1->base);
+    TEST_ASSERT(astHashConsIntern(table, &ret2->base) == &ret2->base);
+    TEST_ASSERT_EQ(3, astHashConsUniqueCount(table));
+
+    astSetSlabArena(previous);
+    destroyASTHashConsTable(table);
+    destroyASTSlabArena(arena);
+}
+
+/**
+ * @brief 合并克隆复用已有的相同子树，结果与原树结构相等
+ */
+static void testHashConsClone(void) {
+    ASTSlabArena* arena = createASTSlabArena();
+    ASTSlabArena* previous = astSetSlabArena(arena);
+    ASTHashConsTable* table = createASTHashConsTable(16);
+
+    // (a + b) * (a + b)：两棵相同的子树克隆后共享一份
+    Expression* product = createBinaryOperatorExpr(BINOP_MUL, createSum("a", "b"), createSum("a", "b"),
+                                                   testLocation());
+    ASTNode* clone = astHashConsClone(table, &product->base);
+    TEST_ASSERT(clone != NULL);
+    TEST_ASSERT(clone != &product->base);
+    TEST_ASSERT(astNodeEquals(&product->base, clone));
+
+    BinaryOperatorExpr* clonedProduct = (BinaryOperatorExpr*)clone;
+    TEST_ASSERT(clonedProduct->left == clonedProduct->right);
+    TEST_ASSERT(astHashConsSharedCount(table) > 0);
+
+    // 再次克隆整棵树直接得到同一个规范节点
+    size_t unique = astHashConsUniqueCount(table);
+    TEST_ASSERT(astHashConsClone(table, &product->base) == clone);
+    TEST_ASSERT_EQ(unique, astHashConsUniqueCount(table));
+
+    destroyASTHashConsTable(table);
+    astSetSlabArena(previous);
+    destroyASTSlabArena(arena);
+}
+
+int main(void) {
+    RUN_TEST(testCloneIsDeepAndEqual);
+    RUN_TEST(testCloneStatement);
+    RUN_TEST(testEqualsComparesStructure);
+    RUN_TEST(testInvalidateAfterMutation);
+    RUN_TEST(testDeepChain);
+    RUN_TEST(testHashConsIntern);
+    RUN_TEST(testHashConsClone);
+    return TEST_REPORT();
+}
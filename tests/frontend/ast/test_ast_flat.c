@@ -0,0 +1,96 @@
+/**
+ * @file test_ast_flat.c
+ * @brief 扁平AST构建器的单元测试
+ */
+
+#include "test_framework.h"
+#include "frontend/ast/ast_flat.h"
+#include <stdlib.h>
+
+static SourceLocation testLocation(void) {
+    return createSourceLocation(INVALID_FILE_ID, 0);
+}
+
+/**
+ * @brief 可选子节点为FLAT_AST_NONE表示没有这个子节点，构建成功
+ */
+static void testAbsentOptionalChild(void) {
+    FlatASTBuilder* builder = createFlatASTBuilder(INVALID_FILE_ID);
+    TEST_ASSERT(builder != NULL);
+
+    FlatNodeIndex type = flatAstBuilderCreateBasicType(builder, BASIC_TYPE_INT, testLocation());
+    TEST_ASSERT(type != FLAT_AST_NONE && type != FLAT_AST_INVALID);
+    FlatNodeIndex decl = flatAstBuilderAddVariableDecl(builder, "x", type, FLAT_AST_NONE,
+                                                       testLocation());
+    TEST_ASSERT(decl != FLAT_AST_NONE && decl != FLAT_AST_INVALID);
+
+    FlatAST* ast = flatAstBuilderFinish(builder);
+    TEST_ASSERT(ast != NULL);
+    TEST_ASSERT_EQ(3, flatAstNodeCount(ast));
+    TEST_ASSERT_EQ(1, flatAstGetChildren(ast, 0, NULL, 0));
+
+    destroyFlatAST(ast);
+    destroyFlatASTBuilder(builder);
+}
+
+/**
+ * @brief 失败的子节点不会被当成"没有子节点"，失败一直传到Finish
+ */
+static void testFailedOptionalChildPropagates(void) {
+    FlatASTBuilder* builder = createFlatASTBuilder(INVALID_FILE_ID);
+    FlatNodeIndex type = flatAstBuilderCreateBasicType(builder, BASIC_TYPE_INT, testLocation());
+
+    // 模拟初始化表达式构建失败
+    FlatNodeIndex failed = flatAstBuilderCreateUnaryOpExpr(builder, UNOP_MINUS, FLAT_AST_NONE,
+                                                           true, testLocation());
+    TEST_ASSERT(failed == FLAT_AST_INVALID);
+
+    FlatNodeIndex decl = flatAstBuilderAddVariableDecl(builder, "x", type, failed,
+                                                       testLocation());
+    TEST_ASSERT(decl == FLAT_AST_INVALID);
+    TEST_ASSERT(flatAstBuilderFinish(builder) == NULL);
+
+    destroyFlatASTBuilder(builder);
+}
+
+/**
+ * @brief 列表中的失败节点同样使父节点失败
+ */
+static void testFailedListItemPropagates(void) {
+    FlatASTBuilder* builder = createFlatASTBuilder(INVALID_FILE_ID);
+    FlatNodeIndex callee = flatAstBuilderCreateIdentifierExpr(builder, "f", testLocation());
+    FlatNodeIndex arguments[2] = {
+        flatAstBuilderCreateIdentifierExpr(builder, "a", testLocation()),
+        FLAT_AST_INVALID,
+    };
+
+    FlatNodeIndex call = flatAstBuilderCreateFunctionCallExpr(builder, callee, arguments, 2,
+                                                              testLocation());
+    TEST_ASSERT(call == FLAT_AST_INVALID);
+    TEST_ASSERT(flatAstBuilderFinish(builder) == NULL);
+
+    destroyFlatASTBuilder(builder);
+}
+
+/**
+ * @brief 没有列表项时可以传入NULL数组
+ */
+static void testEmptyListAcceptsNull(void) {
+    FlatASTBuilder* builder = createFlatASTBuilder(INVALID_FILE_ID);
+    FlatNodeIndex body = flatAstBuilderCreateCompoundStmt(builder, NULL, 0, NULL, 0,
+                                                          testLocation());
+    TEST_ASSERT(body != FLAT_AST_NONE && body != FLAT_AST_INVALID);
+
+    FlatAST* ast = flatAstBuilderFinish(builder);
+    TEST_ASSERT(ast != NULL);
+    destroyFlatAST(ast);
+    destroyFlatASTBuilder(builder);
+}
+
+int main(void) {
+    RUN_TEST(testAbsentOptionalChild);
+    RUN_TEST(testFailedOptionalChildPropagates);
+    RUN_TEST(testFailedListItemPropagates);
+    RUN_TEST(testEmptyListAcceptsNull);
+    return TEST_REPORT();
+}
@@ -0,0 +1,355 @@
+/**
+ * @file test_ast_parallel.c
+ * @brief 顶层声明并行访问的单元测试：访问次数、诊断顺序与线程数据的合并顺序
+ */
+
+#include "test_framework.h"
+#include "frontend/ast/ast_parallel.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DECLARATION_COUNT 5000
+#define MAX_WORKERS 16
+#define DIAGNOSTIC_BUFFER_SIZE (1 << 20)
+
+/**
+ * @brief 一次并行访问的共享状态
+ */
+typedef struct {
+    _Atomic int visits[DECLARATION_COUNT];
+    _Atomic size_t identifierVisits;
+    _Atomic size_t workersStarted;
+    size_t barrierWorkers;          // 非0时每个线程第一次访问后等到这么多线程都开始
+    size_t slowDeclarations;        // 下标小于它的声明做额外的计算，制造负载不均
+    bool failOnCaller;              // 调用线程上的createWorkerData返回NULL
+    pthread_t caller;
+    struct WorkerData* merged[MAX_WORKERS];
+    size_t mergedCount;
+    bool mergedOffCaller;
+} ParallelState;
+
+/**
+ * @brief 每个工作线程的privateData
+ */
+typedef struct WorkerData {
+    ParallelState* state;
+    DiagnosticEngine* diagnostics;
+    pthread_t thread;
+    size_t firstDeclaration;
+    size_t visited;
+} WorkerData;
+
+static void* createWorkerData(DiagnosticEngine* diagnostics, void* userData) {
+    ParallelState* state = (ParallelState*)userData;
+    if (state->failOnCaller && pthread_equal(pthread_self(), state->caller)) {
+        return NULL;
+    }
+    WorkerData* data = (WorkerData*)calloc(1, sizeof(WorkerData));
+    if (data) {
+        data->state = state;
+        data->diagnostics = diagnostics;
+        data->thread = pthread_self();
+        data->firstDeclaration = SIZE_MAX;
+    }
+    return data;
+}
+
+static void mergeWorkerData(void* workerData, void* userData) {
+    ParallelState* state = (ParallelState*)userData;
+    if (!pthread_equal(pthread_self(), state->caller)) {
+        state->mergedOffCaller = true;
+    }
+    if (state->mergedCount < MAX_WORKERS) {
+        state->merged[state->mergedCount++] = (WorkerData*)workerData;
+    } else {
+        free(workerData);
+    }
+}
+
+/**
+ * @brief 声明的下标记在源位置的偏移里；每个声明报告一到两条诊断
+ */
+static void visitVariableDeclaration(ASTVisitor* self, VariableDeclaration* node) {
+    WorkerData* data = (WorkerData*)self->privateData;
+    ParallelState* state = data->state;
+    size_t index = node->base.base.location.offset;
+
+    atomic_fetch_add(&state->visits[index], 1);
+    if (data->visited++ == 0) {
+        data->firstDeclaration = index;
+        // 所有线程都领到自己区间的第一个声明之后才继续，此前不会发生窃取
+        if (state->barrierWorkers) {
+            atomic_fetch_add(&state->workersStarted, 1);
+            while (atomic_load(&state->workersStarted) < state->barrierWorkers) {
+                sched_yield();
+            }
+        }
+    }
+    if (index < state->slowDeclarations) {
+        volatile unsigned sink = 0;
+        for (unsigned i = 0; i < 200000; i++) {
+            sink += i;
+        }
+    }
+
+    diagnosticEngineReport(data->diagnostics,
+                           index % 3 == 0 ? DIAGNOSTIC_WARNING : DIAGNOSTIC_ERROR,
+                           node->base.base.location, "declaration %zu", index);
+    if (index % 5 == 0) {
+        diagnosticEngineReport(data->diagnostics, DIAGNOSTIC_NOTE, node->base.base.location,
+                               "declaration %zu again", index);
+    }
+}
+
+static void visitIdentifierExpr(ASTVisitor* self, IdentifierExpr* node) {
+    (void)node;
+    WorkerData* data = (WorkerData*)self->privateData;
+    atomic_fetch_add(&data->state->identifierVisits, 1);
+}
+
+/**
+ * @brief 在arena中构造count个变量声明，第i个的源位置偏移为i，初始化式是一个标识符
+ */
+static TranslationUnit* buildUnit(ASTSlabArena* arena, size_t count) {
+    ASTSlabArena* previous = astSetSlabArena(arena);
+    TranslationUnit* unit = createTranslationUnit();
+    for (size_t i = 0; i < count; i++) {
+        SourceLocation location = createSourceLocation(INVALID_FILE_ID, (uint32_t)i);
+        Declaration* declaration = createVariableDeclaration(
+            "v", NULL, createIdentifierExpr("x", location), location);
+        vectorPushBack(unit->declarations, &declaration);
+    }
+    astSetSlabArena(previous);
+    return unit;
+}
+
+/**
+ * @brief 诊断输出和计数
+ */
+typedef struct {
+    char* output;
+    size_t errors;
+    size_t warnings;
+} DiagnosticResult;
+
+static DiagnosticEngine* createResultEngine(DiagnosticResult* result) {
+    result->output = (char*)calloc(1, DIAGNOSTIC_BUFFER_SIZE);
+    return createDiagnosticEngine(createBufferDiagnosticConsumer(result->output, DIAGNOSTIC_BUFFER_SIZE));
+}
+
+static void finishResult(DiagnosticResult* result, DiagnosticEngine* engine) {
+    result->errors = diagnosticEngineGetErrorCount(engine);
+    result->warnings = diagnosticEngineGetWarningCount(engine);
+    destroyDiagnosticEngine(engine);
+}
+
+static void initVisitor(ASTVisitor* visitor) {
+    memset(visitor, 0, sizeof(*visitor));
+    visitor->visitVariableDeclaration = visitVariableDeclaration;
+    visitor->visitIdentifierExpr = visitIdentifierExpr;
+}
+
+/**
+ * @brief 在调用线程上逐个访问声明，得到作为基准的诊断输出
+ */
+static DiagnosticResult visitSequentially(TranslationUnit* unit) {
+    DiagnosticResult result;
+    DiagnosticEngine* engine = createResultEngine(&result);
+    ParallelState* state = (ParallelState*)calloc(1, sizeof(ParallelState));
+    WorkerData data = { state, engine, pthread_self(), SIZE_MAX, 0 };
+
+    ASTVisitor visitor;
+    initVisitor(&visitor);
+    visitor.privateData = &data;
+    for (size_t i = 0; i < vectorSize(unit->declarations); i++) {
+        astNodeAccept(VECTOR_AT(unit->declarations, ASTNode*, i), &visitor);
+    }
+
+    free(state);
+    finishResult(&result, engine);
+    return result;
+}
+
+/**
+ * @brief 并行访问，诊断合并到结果引擎
+ */
+static bool visitInParallel(TranslationUnit* unit, ParallelState* state, size_t threadCount,
+                            bool walkSubtrees, DiagnosticResult* result) {
+    DiagnosticEngine* engine = createResultEngine(result);
+    ASTVisitor visitor;
+    initVisitor(&visitor);
+
+    state->caller = pthread_self();
+    ASTParallelVisitOptions options;
+    memset(&options, 0, sizeof(options));
+    options.visitor = &visitor;
+    options.walkSubtrees = walkSubtrees;
+    options.threadCount = threadCount;
+    options.createWorkerData = createWorkerData;
+    options.mergeWorkerData = mergeWorkerData;
+    options.userData = state;
+    options.diagnostics = engine;
+
+    bool completed = astVisitDeclarationsParallel(unit, &options);
+    finishResult(result, engine);
+    return completed;
+}
+
+/**
+ * @brief 每个声明恰好访问一次
+ */
+static size_t countBadVisits(const ParallelState* state, size_t count) {
+    size_t bad = 0;
+    for (size_t i = 0; i < count; i++) {
+        bad += atomic_load(&state->visits[i]) != 1;
+    }
+    return bad;
+}
+
+static void assertSameDiagnostics(const DiagnosticResult* expected, const DiagnosticResult* actual) {
+    TEST_ASSERT_EQ(expected->errors, actual->errors);
+    TEST_ASSERT_EQ(expected->warnings, actual->warnings);
+    TEST_ASSERT(strcmp(expected->output, actual->output) == 0);
+}
+
+static void freeMerged(ParallelState* state) {
+    for (size_t i = 0; i < state->mergedCount; i++) {
+        free(state->merged[i]);
+    }
+}
+
+/**
+ * @brief 数千个声明分给多个线程：每个声明访问一次，诊断按源码顺序，线程数据按线程编号合并
+ */
+static void testVisitsEachDeclarationOnce(void) {
+    const size_t threads = 4;
+    ASTSlabArena* arena = createASTSlabArena();
+    TranslationUnit* unit = buildUnit(arena, DECLARATION_COUNT);
+    DiagnosticResult expected = visitSequentially(unit);
+
+    ParallelState* state = (ParallelState*)calloc(1, sizeof(ParallelState));
+    state->barrierWorkers = threads;
+    DiagnosticResult actual;
+    TEST_ASSERT(visitInParallel(unit, state, threads, false, &actual));
+
+    TEST_ASSERT_EQ(0, countBadVisits(state, DECLARATION_COUNT));
+    TEST_ASSERT_EQ(0, atomic_load(&state->identifierVisits));
+    TEST_ASSERT(strstr(expected.output, "declaration 4999") != NULL);
+    assertSameDiagnostics(&expected, &actual);
+
+    // 第k个合并的是k号线程：它第一个访问的是自己区间的起点；0号线程就是调用线程
+    TEST_ASSERT_EQ(threads, state->mergedCount);
+    TEST_ASSERT(!state->mergedOffCaller);
+    size_t total = 0;
+    for (size_t k = 0; k < state->mergedCount; k++) {
+        TEST_ASSERT_EQ(DECLARATION_COUNT * k / threads, state->merged[k]->firstDeclaration);
+        total += state->merged[k]->visited;
+    }
+    TEST_ASSERT_EQ(DECLARATION_COUNT, total);
+    TEST_ASSERT(pthread_equal(state->merged[0]->thread, state->caller));
+
+    freeMerged(state);
+    free(state);
+    free(expected.output);
+    free(actual.output);
+    destroyASTSlabArena(arena);
+}
+
+/**
+ * @brief 负载不均时发生窃取，遍历子树，结果仍与顺序访问一致
+ */
+static void testUnevenWorkWithStealing(void) {
+    const size_t threads = 8;
+    ASTSlabArena* arena = createASTSlabArena();
+    TranslationUnit* unit = buildUnit(arena, DECLARATION_COUNT);
+    DiagnosticResult expected = visitSequentially(unit);
+
+    for (int round = 0; round < 3; round++) {
+        ParallelState* state = (ParallelState*)calloc(1, sizeof(ParallelState));
+        state->slowDeclarations = 200;
+        DiagnosticResult actual;
+        TEST_ASSERT(visitInParallel(unit, state, threads, true, &actual));
+
+        TEST_ASSERT_EQ(0, countBadVisits(state, DECLARATION_COUNT));
+        TEST_ASSERT_EQ(DECLARATION_COUNT, atomic_load(&state->identifierVisits));
+        assertSameDiagnostics(&expected, &actual);
+        TEST_ASSERT_EQ(threads, state->mergedCount);
+        TEST_ASSERT(!state->mergedOffCaller);
+        TEST_ASSERT(pthread_equal(state->merged[0]->thread, state->caller));
+
+        freeMerged(state);
+        free(state);
+        free(actual.output);
+    }
+
+    free(expected.output);
+    destroyASTSlabArena(arena);
+}
+
+/**
+ * @brief 初始化失败的线程不领任务也不合并，它的区间由其他线程偷走
+ */
+static void testFailedWorkerRangeIsStolen(void) {
+    ASTSlabArena* arena = createASTSlabArena();
+    TranslationUnit* unit = buildUnit(arena, DECLARATION_COUNT);
+    DiagnosticResult expected = visitSequentially(unit);
+
+    ParallelState* state = (ParallelState*)calloc(1, sizeof(ParallelState));
+    state->failOnCaller = true;
+    DiagnosticResult actual;
+    TEST_ASSERT(visitInParallel(unit, state, 4, false, &actual));
+
+    TEST_ASSERT_EQ(0, countBadVisits(state, DECLARATION_COUNT));
+    assertSameDiagnostics(&expected, &actual);
+    TEST_ASSERT_EQ(3, state->mergedCount);
+    for (size_t k = 0; k < state->mergedCount; k++) {
+        TEST_ASSERT(!pthread_equal(state->merged[k]->thread, state->caller));
+    }
+
+    freeMerged(state);
+    free(state);
+    free(expected.output);
+    free(actual.output);
+    destroyASTSlabArena(arena);
+}
+
+/**
+ * @brief 声明太少时在调用线程上顺序访问；参数无效返回false
+ */
+static void testFewDeclarationsRunOnCaller(void) {
+    const size_t count = AST_PARALLEL_MIN_DECLS_PER_THREAD * 2 - 1;
+    ASTSlabArena* arena = createASTSlabArena();
+    TranslationUnit* unit = buildUnit(arena, count);
+    DiagnosticResult expected = visitSequentially(unit);
+
+    ParallelState* state = (ParallelState*)calloc(1, sizeof(ParallelState));
+    DiagnosticResult actual;
+    TEST_ASSERT(visitInParallel(unit, state, 8, false, &actual));
+    TEST_ASSERT_EQ(0, countBadVisits(state, count));
+    assertSameDiagnostics(&expected, &actual);
+    TEST_ASSERT_EQ(1, state->mergedCount);
+    TEST_ASSERT(pthread_equal(state->merged[0]->thread, state->caller));
+
+    ASTParallelVisitOptions options;
+    memset(&options, 0, sizeof(options));
+    TEST_ASSERT(!astVisitDeclarationsParallel(unit, &options));
+    TEST_ASSERT(!astVisitDeclarationsParallel(NULL, &options));
+
+    freeMerged(state);
+    free(state);
+    free(expected.output);
+    free(actual.output);
+    destroyASTSlabArena(arena);
+}
+
+int main(void) {
+    RUN_TEST(testVisitsEachDeclarationOnce);
+    RUN_TEST(testUnevenWorkWithStealing);
+    RUN_TEST(testFailedWorkerRangeIsStolen);
+    RUN_TEST(testFewDeclarationsRunOnCaller);
+    return TEST_REPORT();
+}
@@ -0,0 +1,461 @@
+/**
+ * @file test_ast_walk.c
+ * @brief AST子节点布局表、分段遍历栈与迭代遍历的单元测试
+ */
+
+#include "test_framework.h"
+#include "frontend/ast/ast_walk.h"
+#include <stdlib.h>
+
+static SourceLocation testLocation(void) {
+    return createSourceLocation(INVALID_FILE_ID, 0);
+}
+
+static Expression* identifier(const char* name) {
+    return createIdentifierExpr(name, testLocation());
+}
+
+// ==================== 遍历顺序 ====================
+
+/**
+ * @brief 记录遍历过程的用户数据
+ */
+typedef struct {
+    ASTNode* pre[64];
+    size_t preDepth[64];
+    size_t preCount;
+    ASTNode* post[64];
+    size_t postCount;
+    ASTNode* skipAt;           // 前序访问到它时返回SKIP_CHILDREN
+    ASTNode* stopPreAt;        // 前序访问到它时返回STOP
+    ASTNode* stopPostAt;       // 后序访问到它时返回STOP
+} WalkRecord;
+
+static ASTWalkAction recordPreorder(ASTNode* node, size_t depth, void* userData) {
+    WalkRecord* record = (WalkRecord*)userData;
+    if (record->preCount < 64) {
+        record->preDepth[record->preCount] = depth;
+        record->pre[record->preCount++] = node;
+    }
+    if (node == record->stopPreAt) {
+        return AST_WALK_STOP;
+    }
+    return node == record->skipAt ? AST_WALK_SKIP_CHILDREN : AST_WALK_CONTINUE;
+}
+
+static ASTWalkAction recordPostorder(ASTNode* node, size_t depth, void* userData) {
+    (void)depth;
+    WalkRecord* record = (WalkRecord*)userData;
+    if (record->postCount < 64) {
+        record->post[record->postCount++] = node;
+    }
+    return node == record->stopPostAt ? AST_WALK_STOP : AST_WALK_CONTINUE;
+}
+
+/**
+ * @brief 测试用的树：(a + b) * f(c, d)
+ */
+typedef struct {
+    Expression* a;
+    Expression* b;
+    Expression* sum;
+    Expression* callee;
+    Expression* c;
+    Expression* d;
+    Expression* call;
+    Expression* product;
+} SampleTree;
+
+static void buildSampleTree(SampleTree* tree) {
+    tree->a = identifier("a");
+    tree->b = identifier("b");
+    tree->sum = createBinaryOperatorExpr(BINOP_ADD, tree->a, tree->b, testLocation());
+    tree->callee = identifier("f");
+    tree->c = identifier("c");
+    tree->d = identifier("d");
+    Vector* arguments = astCreateNodeVector(sizeof(Expression*), 2);
+    vectorPushBack(arguments, &tree->c);
+    vectorPushBack(arguments, &tree->d);
+    tree->call = createFunctionCallExpr(tree->callee, arguments, testLocation());
+    tree->product = createBinaryOperatorExpr(BINOP_MUL, tree->sum, tree->call, testLocation());
+}
+
+/**
+ * @brief 前序先父后子、后序先子后父，子节点按源码顺序，深度从0开始
+ */
+static void testPreorderAndPostorder(void) {
+    ASTSlabArena* arena = createASTSlabArena();
+    ASTSlabArena* previous = astSetSlabArena(arena);
+    SampleTree tree;
+    buildSampleTree(&tree);
+
+    WalkRecord record = {0};
+    TEST_ASSERT(astWalk(&tree.product->base, recordPreorder, recordPostorder, &record));
+
+    ASTNode* expectedPre[] = { &tree.product->base, &tree.sum->base, &tree.a->base, &tree.b->base,
+                               &tree.call->base, &tree.callee->base, &tree.c->base, &tree.d->base };
+    size_t expectedDepth[] = { 0, 1, 2, 2, 1, 2, 2, 2 };
+    ASTNode* expectedPost[] = { &tree.a->base, &tree.b->base, &tree.sum->base, &tree.callee->base,
+                                &tree.c->base, &tree.d->base, &tree.call->base, &tree.product->base };
+    TEST_ASSERT_EQ(8, record.preCount);
+    TEST_ASSERT_EQ(8, record.postCount);
+    for (size_t i = 0; i < 8; i++) {
+        TEST_ASSERT(record.pre[i] == expectedPre[i]);
+        TEST_ASSERT_EQ(expectedDepth[i], record.preDepth[i]);
+        TEST_ASSERT(record.post[i] == expectedPost[i]);
+    }
+
+    // 只给一种回调、根是叶子、根为NULL
+    WalkRecord postOnly = {0};
+    TEST_ASSERT(astWalk(&tree.product->base, NULL, recordPostorder, &postOnly));
+    TEST_ASSERT_EQ(8, postOnly.postCount);
+    WalkRecord leaf = {0};
+    TEST_ASSERT(astWalk(&tree.a->base, recordPreorder, recordPostorder, &leaf));
+    TEST_ASSERT_EQ(1, leaf.preCount);
+    TEST_ASSERT_EQ(1, leaf.postCount);
+    TEST_ASSERT(astWalk(NULL, recordPreorder, recordPostorder, &leaf));
+
+    astSetSlabArena(previous);
+    destroyASTSlabArena(arena);
+}
+
+/**
+ * @brief SKIP_CHILDREN跳过子树但仍后序访问该节点；STOP立即结束并返回false
+ */
+static void testSkipChildrenAndStop(void) {
+    ASTSlabArena* arena = createASTSlabArena();
+    ASTSlabArena* previous = astSetSlabArena(arena);
+    SampleTree tree;
+    buildSampleTree(&tree);
+
+    WalkRecord skip = {0};
+    skip.skipAt = &tree.sum->base;
+    TEST_ASSERT(astWalk(&tree.product->base, recordPreorder, recordPostorder, &skip));
+    TEST_ASSERT_EQ(6, skip.preCount);
+    TEST_ASSERT(skip.pre[2] == &tree.call->base);
+    TEST_ASSERT(skip.post[0] == &tree.sum->base);
+    TEST_ASSERT(skip.post[skip.postCount - 1] == &tree.product->base);
+
+    // 在根上跳过：只访问根
+    WalkRecord skipRoot = {0};
+    skipRoot.skipAt = &tree.product->base;
+    TEST_ASSERT(astWalk(&tree.product->base, recordPreorder, recordPostorder, &skipRoot));
+    TEST_ASSERT_EQ(1, skipRoot.preCount);
+    TEST_ASSERT_EQ(1, skipRoot.postCount);
+
+    // 前序停止：之后不再有任何回调，已入栈的祖先也不做后序访问
+    WalkRecord stopPre = {0};
+    stopPre.stopPreAt = &tree.b->base;
+    TEST_ASSERT(!astWalk(&tree.product->base, recordPreorder, recordPostorder, &stopPre));
+    TEST_ASSERT_EQ(4, stopPre.preCount);
+    TEST_ASSERT_EQ(1, stopPre.postCount);
+    TEST_ASSERT(stopPre.post[0] == &tree.a->base);
+
+    // 后序停止
+    WalkRecord stopPost = {0};
+    stopPost.stopPostAt = &tree.sum->base;
+    TEST_ASSERT(!astWalk(&tree.product->base, recordPreorder, recordPostorder, &stopPost));
+    TEST_ASSERT_EQ(4, stopPost.preCount);
+    TEST_ASSERT_EQ(3, stopPost.postCount);
+
+    // 在叶子根上停止
+    WalkRecord stopLeaf = {0};
+    stopLeaf.stopPostAt = &tree.a->base;
+    TEST_ASSERT(!astWalk(&tree.a->base, recordPreorder, recordPostorder, &stopLeaf));
+
+    astSetSlabArena(previous);
+    destroyASTSlabArena(arena);
+}
+
+// ==================== 分段遍历栈 ====================
+
+/**
+ * @brief 超过内联层数后按段增长，出栈顺序正确，回退后再加深时复用已分配的段
+ */
+static void testSegmentedStackGrowth(void) {
+    const size_t total = AST_WALK_INLINE_FRAMES + 2 * AST_WALK_SEGMENT_FRAMES + 10;
+    ASTNode* nodes = (ASTNode*)calloc(total, sizeof(ASTNode));
+    TEST_ASSERT(nodes != NULL);
+
+    ASTWalkStack stack;
+    astWalkStackInit(&stack);
+    for (int round = 0; round < 2; round++) {
+        for (size_t i = 0; i < total; i++) {
+            ASTWalkFrame* frame = astWalkStackPush(&stack, &nodes[i]);
+            TEST_ASSERT(frame != NULL);
+            TEST_ASSERT(astWalkStackTop(&stack) == frame);
+        }
+        TEST_ASSERT_EQ(total, stack.depth);
+        TEST_ASSERT(stack.pool != NULL);
+        TEST_ASSERT(stack.top != &stack.first);
+
+        ASTWalkSegment* second = stack.first.next;
+        size_t mismatches = 0;
+        for (size_t i = total; i > 0; i--) {
+            if (astWalkStackTop(&stack)->node != &nodes[i - 1]) {
+                mismatches++;
+            }
+            astWalkStackPop(&stack);
+        }
+        TEST_ASSERT_EQ(0, mismatches);
+        TEST_ASSERT_EQ(0, stack.depth);
+        TEST_ASSERT(stack.top == &stack.first);
+        TEST_ASSERT(stack.first.next == second);
+    }
+    astWalkStackRelease(&stack);
+    TEST_ASSERT(stack.pool == NULL);
+    free(nodes);
+}
+
+/**
+ * @brief 构造一元运算链，返回根；叶子在最深处
+ */
+static Expression* buildUnaryChain(size_t depth, Expression** leaf) {
+    *leaf = identifier("x");
+    Expression* chain = *leaf;
+    for (size_t i = 0; i < depth; i++) {
+        chain = createUnaryOperatorExpr(UNOP_MINUS, chain, true, testLocation());
+    }
+    return chain;
+}
+
+/**
+ * @brief 统计节点数和最大深度，并检查后序访问时子树已遍历完
+ */
+typedef struct {
+    size_t preCount;
+    size_t postCount;
+    size_t maxDepth;
+    ASTNode* firstPost;
+    ASTNode* lastPost;
+} ChainStats;
+
+static ASTWalkAction countPreorder(ASTNode* node, size_t depth, void* userData) {
+    (void)node;
+    ChainStats* stats = (ChainStats*)userData;
+    stats->preCount++;
+    if (depth > stats->maxDepth) {
+        stats->maxDepth = depth;
+    }
+    return AST_WALK_CONTINUE;
+}
+
+static ASTWalkAction countPostorder(ASTNode* node, size_t depth, void* userData) {
+    (void)depth;
+    ChainStats* stats = (ChainStats*)userData;
+    if (stats->postCount++ == 0) {
+        stats->firstPost = node;
+    }
+    stats->lastPost = node;
+    return AST_WALK_CONTINUE;
+}
+
+/**
+ * @brief 跨越内联层数和段边界的链都能完整遍历
+ */
+static void testWalkAcrossSegments(void) {
+    ASTSlabArena* arena = createASTSlabArena();
+    ASTSlabArena* previous = astSetSlabArena(arena);
+
+    const size_t depths[] = { AST_WALK_INLINE_FRAMES - 1, AST_WALK_INLINE_FRAMES,
+                              AST_WALK_INLINE_FRAMES + 1,
+                              AST_WALK_INLINE_FRAMES + AST_WALK_SEGMENT_FRAMES,
+                              AST_WALK_INLINE_FRAMES + AST_WALK_SEGMENT_FRAMES + 1 };
+    for (size_t i = 0; i < sizeof(depths) / sizeof(depths[0]); i++) {
+        Expression* leaf;
+        Expression* root = buildUnaryChain(depths[i], &leaf);
+        ChainStats stats = {0};
+        TEST_ASSERT(astWalk(&root->base, countPreorder, countPostorder, &stats));
+        TEST_ASSERT_EQ(depths[i] + 1, stats.preCount);
+        TEST_ASSERT_EQ(depths[i] + 1, stats.postCount);
+        TEST_ASSERT_EQ(depths[i], stats.maxDepth);
+        TEST_ASSERT(stats.firstPost == &leaf->base);
+        TEST_ASSERT(stats.lastPost == &root->base);
+    }
+
+    astSetSlabArena(previous);
+    destroyASTSlabArena(arena);
+}
+
+/**
+ * @brief 十万层的链不会耗尽调用栈
+ */
+static void testDeepChain(void) {
+    const size_t DEPTH = 100000;
+    ASTSlabArena* arena = createASTSlabArena();
+    ASTSlabArena* previous = astSetSlabArena(arena);
+
+    Expression* leaf;
+    Expression* root = buildUnaryChain(DEPTH, &leaf);
+    ChainStats stats = {0};
+    TEST_ASSERT(astWalk(&root->base, countPreorder, countPostorder, &stats));
+    TEST_ASSERT_EQ(DEPTH + 1, stats.preCount);
+    TEST_ASSERT_EQ(DEPTH + 1, stats.postCount);
+    TEST_ASSERT_EQ(DEPTH, stats.maxDepth);
+    TEST_ASSERT(stats.firstPost == &leaf->base);
+    TEST_ASSERT(stats.lastPost == &root->base);
+
+    astSetSlabArena(previous);
+    destroyASTSlabArena(arena);
+}
+
+// ==================== 布局表 ====================
+
+/**
+ * @brief 检查节点的子节点恰好是expected（按顺序），并登记该类型已检查
+ */
+static void expectChildren(bool* covered, const ASTNode* node, ASTNode* const* expected, size_t count) {
+    TEST_ASSERT(node != NULL);
+    if (!node) {
+        return;
+    }
+    covered[node->nodeType] = true;
+
+    ASTNode* children[AST_MAX_CHILD_SLOTS + 4];
+    size_t actual = astNodeGetChildren(node, children, AST_MAX_CHILD_SLOTS + 4);
+    TEST_ASSERT_EQ(count, actual);
+    for (size_t i = 0; i < count && i < actual; i++) {
+        TEST_ASSERT(children[i] == expected[i]);
+    }
+    TEST_ASSERT_EQ(count == 0, astNodeIsLeafKind(node->nodeType));
+}
+
+static Vector* nodeList(ASTNode* first, ASTNode* second) {
+    Vector* list = astCreateNodeVector(sizeof(ASTNode*), 2);
+    vectorPushBack(list, &first);
+    if (second) {
+        vectorPushBack(list, &second);
+    }
+    return list;
+}
+
+/**
+ * @brief 每种节点类型的布局表项与其结构体字段一致，子节点按源码顺序排列
+ */
+static void testLayoutCoversEveryKind(void) {
+    ASTSlabArena* arena = createASTSlabArena();
+    ASTSlabArena* previous = astSetSlabArena(arena);
+    bool covered[AST_CHILD_LAYOUT_COUNT] = {false};
+
+#define N(x) (&(x)->base)
+#define CHILDREN(node, ...) do { \
+        ASTNode* expected_[] = { __VA_ARGS__ }; \
+        expectChildren(covered, node, expected_, sizeof(expected_) / sizeof(expected_[0])); \
+    } while (0)
+#define NO_CHILDREN(node) expectChildren(covered, node, NULL, 0)
+
+    Expression* e1 = identifier("e1");
+    Expression* e2 = identifier("e2");
+    Expression* e3 = identifier("e3");
+    Expression* e4 = identifier("e4");
+    Statement* s1 = createBreakStatement(testLocation());
+    Statement* s2 = createContinueStatement(testLocation());
+    TypeSpecifier* t1 = createBasicTypeSpecifier(BASIC_TYPE_INT, testLocation());
+    TypeSpecifier* t2 = createBasicTypeSpecifier(BASIC_TYPE_CHAR, testLocation());
+    Declaration* d1 = createVariableDeclaration("d1", NULL, NULL, testLocation());
+    Declaration* d2 = createVariableDeclaration("d2", NULL, NULL, testLocation());
+
+    // 翻译单元和表达式
+    TranslationUnit* unit = createTranslationUnit();
+    vectorPushBack(unit->declarations, &d1);
+    vectorPushBack(unit->declarations, &d2);
+    CHILDREN(N(unit), N(d1), N(d2));
+
+    Token* one = createIntegerToken("1", testLocation(), 10);
+    NO_CHILDREN(N(createLiteralExpr(one, testLocation())));
+    NO_CHILDREN(N(e1));
+    CHILDREN(N(createBinaryOperatorExpr(BINOP_ADD, e1, e2, testLocation())), N(e1), N(e2));
+    CHILDREN(N(createUnaryOperatorExpr(UNOP_MINUS, e1, true, testLocation())), N(e1));
+    CHILDREN(N(createAssignmentExpr(ASSIGN_SIMPLE, e1, e2, testLocation())), N(e1), N(e2));
+    CHILDREN(N(createTernaryExpr(e1, e2, e3, testLocation())), N(e1), N(e2), N(e3));
+    CHILDREN(N(createFunctionCallExpr(e1, nodeList(N(e2), N(e3)), testLocation())),
+             N(e1), N(e2), N(e3));
+    CHILDREN(N(createArraySubscriptExpr(e1, e2, testLocation())), N(e1), N(e2));
+    CHILDREN(N(createMemberAccessExpr(e1, "field", true, testLocation())), N(e1));
+    CHILDREN(N(createCastExpr(t1, e1, testLocation())), N(t1), N(e1));
+
+    // 语句
+    CHILDREN(N(createExpressionStatement(e1, testLocation())), N(e1));
+    Statement* compound = createCompoundStatement(testLocation());
+    vectorPushBack(((CompoundStatement*)compound)->statements, &s1);
+    vectorPushBack(((CompoundStatement*)compound)->declarations, &d1);
+    CHILDREN(N(compound), N(d1), N(s1));
+    CHILDREN(N(createIfStatement(e1, s1, s2, testLocation())), N(e1), N(s1), N(s2));
+    CHILDREN(N(createWhileStatement(e1, s1, testLocation())), N(e1), N(s1));
+    CHILDREN(N(createDoWhileStatement(s1, e1, testLocation())), N(s1), N(e1));
+    CHILDREN(N(createForStatement(e1, e2, e3, s1, testLocation())), N(e1), N(e2), N(e3), N(s1));
+    CHILDREN(N(createForStatement(NULL, NULL, e4, s1, testLocation())), N(e4), N(s1));
+    CHILDREN(N(createReturnStatement(e1, testLocation())), N(e1));
+    NO_CHILDREN(N(s1));
+    NO_CHILDREN(N(s2));
+    Statement* caseStmt = createCaseStatement(CASE_LABEL, e2, s1, testLocation());
+    CHILDREN(N(caseStmt), N(e2), N(s1));
+    CHILDREN(N(createSwitchStatement(e1, nodeList(N(caseStmt), NULL), testLocation())),
+             N(e1), N(caseStmt));
+    CHILDREN(N(createLabeledStatement("label", s1, testLocation())), N(s1));
+    NO_CHILDREN(N(createGotoStatement("label", testLocation())));
+
+    // 声明
+    CHILDREN(N(createVariableDeclaration("v", t1, e1, testLocation())), N(t1), N(e1));
+    CHILDREN(N(createFunctionDeclaration("f", t1, nodeList(N(d1), N(d2)),
+                                         (CompoundStatement*)compound, testLocation())),
+             N(t1), N(d1), N(d2), N(compound));
+    CHILDREN(N(createStructDeclaration("s", nodeList(N(d1), N(d2)), testLocation())), N(d1), N(d2));
+    CHILDREN(N(createUnionDeclaration("u", nodeList(N(d1), NULL), testLocation())), N(d1));
+    // 没有值的枚举常量不产生子节点
+    EnumConstant constants[3] = { { NULL, e1 }, { NULL, NULL }, { NULL, e2 } };
+    Vector* constantList = astCreateNodeVector(sizeof(EnumConstant*), 3);
+    for (int i = 0; i < 3; i++) {
+        EnumConstant* constant = &constants[i];
+        vectorPushBack(constantList, &constant);
+    }
+    Declaration* enumDecl = createEnumDeclaration("e", constantList, testLocation());
+    CHILDREN(N(enumDecl), N(e1), N(e2));
+    CHILDREN(N(createTypedefDeclaration("t", t1, testLocation())), N(t1));
+
+    // 类型说明符：结构体/联合体/枚举引用的声明不算子节点
+    NO_CHILDREN(N(t1));
+    CHILDREN(N(createPointerTypeSpecifier(t1, testLocation())), N(t1));
+    CHILDREN(N(createArrayTypeSpecifier(t1, e1, testLocation())), N(t1), N(e1));
+    CHILDREN(N(createFunctionTypeSpecifier(t1, nodeList(N(t2), N(t1)), false, testLocation())),
+             N(t1), N(t2), N(t1));
+    Declaration* structDecl = createStructDeclaration("s", NULL, testLocation());
+    Declaration* unionDecl = createUnionDeclaration("u", NULL, testLocation());
+    NO_CHILDREN(N(createStructTypeSpecifier("s", (StructDeclaration*)structDecl, testLocation())));
+    NO_CHILDREN(N(createUnionTypeSpecifier("u", (UnionDeclaration*)unionDecl, testLocation())));
+    NO_CHILDREN(N(createEnumTypeSpecifier("e", (EnumDeclaration*)enumDecl, testLocation())));
+    NO_CHILDREN(N(createTypedefNameSpecifier("t", testLocation())));
+
+#undef N
+#undef CHILDREN
+#undef NO_CHILDREN
+
+    // 抽象基类类型没有布局，其余每种类型都检查过
+    const ASTNodeType abstractKinds[] = { AST_NODE_EXPRESSION, AST_NODE_STATEMENT,
+                                          AST_NODE_DECLARATION, AST_NODE_TYPE_SPECIFIER };
+    for (size_t i = 0; i < sizeof(abstractKinds) / sizeof(abstractKinds[0]); i++) {
+        TEST_ASSERT(astNodeIsLeafKind(abstractKinds[i]));
+        TEST_ASSERT_EQ(0, astNodeChildLayout(abstractKinds[i])->slotCount);
+        covered[abstractKinds[i]] = true;
+    }
+    size_t uncovered = 0;
+    for (size_t i = 0; i < AST_CHILD_LAYOUT_COUNT; i++) {
+        uncovered += !covered[i];
+    }
+    TEST_ASSERT_EQ(0, uncovered);
+    TEST_ASSERT_EQ(0, astNodeChildLayout((ASTNodeType)AST_CHILD_LAYOUT_COUNT)->slotCount);
+
+    destroyToken(one);
+    astSetSlabArena(previous);
+    destroyASTSlabArena(arena);
+}
+
+int main(void) {
+    RUN_TEST(testPreorderAndPostorder);
+    RUN_TEST(testSkipChildrenAndStop);
+    RUN_TEST(testSegmentedStackGrowth);
+    RUN_TEST(testWalkAcrossSegments);
+    RUN_TEST(testDeepChain);
+    RUN_TEST(testLayoutCoversEveryKind);
+    return TEST_REPORT();
+}
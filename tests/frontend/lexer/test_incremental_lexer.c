@@ -0,0 +1,206 @@
+/**
+ * @file test_incremental_lexer.c
+ * @brief 增量词法分析与完整重新扫描结果一致性的单元测试
+ */
+
+#include "test_framework.h"
+#include "frontend/lexer/incremental_lexer.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 比较两个token数组的类型、位置、标志和字面量值
+ */
+static void assertSameTokens(const TokenArray* expected, const TokenArray* actual) {
+    TEST_ASSERT(expected != NULL && actual != NULL);
+    if (!expected || !actual) {
+        return;
+    }
+    TEST_ASSERT_EQ(tokenArraySize(expected), tokenArraySize(actual));
+    size_t count = tokenArraySize(expected) < tokenArraySize(actual)
+                       ? tokenArraySize(expected) : tokenArraySize(actual);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < count; i++) {
+        const PackedToken* a = tokenArrayGet(expected, i);
+        const PackedToken* b = tokenArrayGet(actual, i);
+        if (a->offset != b->offset || a->length != b->length || a->type != b->type ||
+            a->flags != b->flags) {
+            mismatches++;
+            continue;
+        }
+
+        const TokenValue* va = tokenArrayGetValue(expected, i);
+        const TokenValue* vb = tokenArrayGetValue(actual, i);
+        if ((va == NULL) != (vb == NULL)) {
+            mismatches++;
+        } else if (a->type == TOKEN_STRING_LITERAL && va) {
+            size_t la = 0, lb = 0;
+            const char* sa = tokenArrayGetString(expected, i, &la);
+            const char* sb = tokenArrayGetString(actual, i, &lb);
+            if (la != lb || memcmp(sa, sb, la) != 0) {
+                mismatches++;
+            }
+        } else if (a->type == TOKEN_INTEGER_LITERAL && va && va->as.intValue != vb->as.intValue) {
+            mismatches++;
+        }
+    }
+    TEST_ASSERT_EQ(0, mismatches);
+}
+
+/**
+ * @brief 对text做一次完整扫描
+ */
+static TokenArray* fullLex(const char* text) {
+    Lexer* lexer = createLexer(text, "full.c", NULL);
+    TokenArray* tokens = lexer ? lexerTokenize(lexer) : NULL;
+    TEST_ASSERT(tokens != NULL);
+    // token只在比较时按偏移使用，不再访问词素
+    destroyLexer(lexer);
+    return tokens;
+}
+
+/**
+ * @brief 返回应用编辑后的新源码（malloc分配）
+ */
+static char* applyEdit(const char* text, const TextEdit* edit) {
+    size_t length = strlen(text);
+    size_t newLength = length - edit->removedLength + edit->insertedLength;
+    char* result = (char*)malloc(newLength + 1);
+    memcpy(result, text, edit->offset);
+    if (edit->insertedLength > 0) {
+        memcpy(result + edit->offset, edit->insertedText, edit->insertedLength);
+    }
+    size_t tail = edit->offset + edit->removedLength;
+    memcpy(result + edit->offset + edit->insertedLength, text + tail, length - tail);
+    result[newLength] = '\0';
+    return result;
+}
+
+/**
+ * @brief 在text中第一次出现anchor的位置（加上delta）替换removed个字节
+ */
+static TextEdit makeEdit(const char* text, const char* anchor, size_t delta,
+                         size_t removed, const char* inserted) {
+    const char* at = anchor ? strstr(text, anchor) : text + strlen(text);
+    TEST_ASSERT(at != NULL);
+    TextEdit edit;
+    edit.offset = (size_t)(at - text) + delta;
+    edit.removedLength = removed;
+    edit.insertedText = inserted;
+    edit.insertedLength = inserted ? strlen(inserted) : 0;
+    return edit;
+}
+
+typedef struct {
+    const char* anchor;     // 编辑位置所在的文本（NULL表示源码末尾）
+    size_t delta;           // 相对anchor的偏移
+    size_t removed;         // 删除的字节数
+    const char* inserted;   // 插入的文本
+} EditStep;
+
+static const char* const initialSource =
+    "int main(void) {\n"
+    "    int count = 42;\n"
+    "    const char* s = \"hello\";\n"
+    "    double d = count + 1.5;\n"
+    "    return count;\n"
+    "}\n";
+
+static const EditStep editSteps[] = {
+    { "count = 42", 0, 5, "total_count" },   // 改名，标识符变长
+    { "42", 1, 0, " " },                      // 把数字拆成两个
+    { "    const", 0, 0, "/*" },              // 未闭合的块注释吞掉后面的全部
+    { "double", 0, 0, "*/" },                 // 闭合注释
+    { "hello", 5, 0, " world\\n" },           // 修改字符串内容
+    { "int total", 0, 10, NULL },             // 删除跨越多个token的一段
+    { NULL, 0, 0, "int tail = 0x10;\n" },     // 在末尾追加
+    { "\"", 0, 0, "L" },                      // 普通字符串改成宽字符串
+};
+
+/**
+ * @brief 逐步编辑后，IncrementalLexer的快照与完整重新扫描一致
+ */
+static void testIncrementalLexerMatchesFullLex(void) {
+    char* text = (char*)malloc(strlen(initialSource) + 1);
+    strcpy(text, initialSource);
+    IncrementalLexer* lexer = createIncrementalLexer(text, strlen(text), "incremental.c", NULL);
+    TEST_ASSERT(lexer != NULL);
+
+    for (size_t i = 0; i < sizeof(editSteps) / sizeof(editSteps[0]); i++) {
+        const EditStep* step = &editSteps[i];
+        TextEdit edit = makeEdit(text, step->anchor, step->delta, step->removed, step->inserted);
+        char* edited = applyEdit(text, &edit);
+        free(text);
+        text = edited;
+
+        TEST_ASSERT(incrementalLexerApplyEdit(lexer, &edit));
+        TEST_ASSERT_STR_EQ(text, incrementalLexerGetSource(lexer, NULL));
+
+        TokenArray* expected = fullLex(text);
+        TokenArray* actual = incrementalLexerSnapshot(lexer);
+        assertSameTokens(expected, actual);
+        destroyTokenArray(expected);
+        destroyTokenArray(actual);
+    }
+
+    destroyIncrementalLexer(lexer);
+    free(text);
+}
+
+/**
+ * @brief 逐步编辑后，由旧token数组得到的新数组与完整重新扫描一致
+ */
+static void testRelexTokenArrayMatchesFullLex(void) {
+    char* text = (char*)malloc(strlen(initialSource) + 1);
+    strcpy(text, initialSource);
+    Lexer* lexer = createLexer(text, "stateless.c", NULL);
+    TokenArray* previous = lexerTokenize(lexer);
+    TEST_ASSERT(previous != NULL);
+
+    for (size_t i = 0; i < sizeof(editSteps) / sizeof(editSteps[0]); i++) {
+        const EditStep* step = &editSteps[i];
+        TextEdit edit = makeEdit(text, step->anchor, step->delta, step->removed, step->inserted);
+        char* edited = applyEdit(text, &edit);
+        TEST_ASSERT(lexerSetEditedSource(lexer, edited, strlen(edited),
+                                         edit.offset, edit.removedLength, edit.insertedLength));
+        free(text);
+        text = edited;
+
+        TokenArray* actual = incrementalRelexTokenArray(lexer, previous, &edit);
+        TokenArray* expected = fullLex(text);
+        assertSameTokens(expected, actual);
+        destroyTokenArray(expected);
+
+        destroyTokenArray(previous);
+        previous = actual;
+    }
+
+    destroyTokenArray(previous);
+    destroyLexer(lexer);
+    free(text);
+}
+
+/**
+ * @brief 编辑与源码长度不符时返回NULL
+ */
+static void testRelexRejectsMismatchedEdit(void) {
+    Lexer* lexer = createLexer("int a;", "mismatch.c", NULL);
+    TokenArray* previous = lexerTokenize(lexer);
+
+    TextEdit outOfRange = { 10, 1, NULL, 0 };
+    TEST_ASSERT(incrementalRelexTokenArray(lexer, previous, &outOfRange) == NULL);
+
+    // lexer的源码没有随编辑变长
+    TextEdit insert = { 4, 0, "b", 1 };
+    TEST_ASSERT(incrementalRelexTokenArray(lexer, previous, &insert) == NULL);
+
+    destroyTokenArray(previous);
+    destroyLexer(lexer);
+}
+
+int main(void) {
+    RUN_TEST(testIncrementalLexerMatchesFullLex);
+    RUN_TEST(testRelexTokenArrayMatchesFullLex);
+    RUN_TEST(testRelexRejectsMismatchedEdit);
+    return TEST_REPORT();
+}
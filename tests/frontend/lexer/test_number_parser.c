@@ -0,0 +1,220 @@
+/**
+ * @file test_number_parser.c
+ * @brief 数字字面量解析的单元测试
+ */
+
+#include "test_framework.h"
+#include "frontend/lexer/number_parser.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 解析整个字符串
+ */
+static NumberLiteral parse(const char* text) {
+    NumberLiteral literal;
+    memset(&literal, 0, sizeof(literal));
+    numberParseLiteral(text, text + strlen(text), &literal);
+    return literal;
+}
+
+/**
+ * @brief 解析结果与strtod逐位相同
+ */
+static bool sameAsStrtod(const char* text) {
+    NumberLiteral literal = parse(text);
+    double expected = strtod(text, NULL);
+    return literal.status == NUMBER_PARSE_OK && literal.isFloat &&
+           memcmp(&literal.floatValue, &expected, sizeof(double)) == 0;
+}
+
+/**
+ * @brief 各进制的整数
+ */
+static void testIntegerBases(void) {
+    NumberLiteral literal = parse("12345");
+    TEST_ASSERT_EQ(NUMBER_PARSE_OK, literal.status);
+    TEST_ASSERT(!literal.isFloat);
+    TEST_ASSERT_EQ(10, literal.base);
+    TEST_ASSERT_EQ(12345, literal.intValue);
+    TEST_ASSERT_EQ(5, literal.length);
+
+    literal = parse("0x1fA0");
+    TEST_ASSERT_EQ(16, literal.base);
+    TEST_ASSERT_EQ(0x1FA0, literal.intValue);
+
+    literal = parse("0755");
+    TEST_ASSERT_EQ(8, literal.base);
+    TEST_ASSERT_EQ(0755, literal.intValue);
+
+    literal = parse("0b1011");
+    TEST_ASSERT_EQ(2, literal.base);
+    TEST_ASSERT_EQ(11, literal.intValue);
+
+    literal = parse("0");
+    TEST_ASSERT_EQ(NUMBER_PARSE_OK, literal.status);
+    TEST_ASSERT_EQ(0, literal.intValue);
+
+    literal = parse("18446744073709551615");
+    TEST_ASSERT_EQ(NUMBER_PARSE_OK, literal.status);
+    TEST_ASSERT(literal.intValue == 18446744073709551615ULL);
+}
+
+/**
+ * @brief 整数后缀
+ */
+static void testIntegerSuffixes(void) {
+    NumberLiteral literal = parse("10ull");
+    TEST_ASSERT_EQ(NUMBER_PARSE_OK, literal.status);
+    TEST_ASSERT(literal.isUnsigned);
+    TEST_ASSERT_EQ(2, literal.longCount);
+    TEST_ASSERT_EQ(5, literal.length);
+
+    literal = parse("10LU");
+    TEST_ASSERT_EQ(NUMBER_PARSE_OK, literal.status);
+    TEST_ASSERT(literal.isUnsigned);
+    TEST_ASSERT_EQ(1, literal.longCount);
+
+    literal = parse("0x10l");
+    TEST_ASSERT_EQ(NUMBER_PARSE_OK, literal.status);
+    TEST_ASSERT(!literal.isUnsigned);
+    TEST_ASSERT_EQ(1, literal.longCount);
+}
+
+/**
+ * @brief 格式错误和溢出
+ */
+static void testMalformedLiterals(void) {
+    TEST_ASSERT_EQ(NUMBER_PARSE_NO_DIGITS, parse("0x").status);
+    TEST_ASSERT_EQ(NUMBER_PARSE_NO_DIGITS, parse("1e+").status);
+    TEST_ASSERT_EQ(NUMBER_PARSE_INVALID_DIGIT, parse("089").status);
+    TEST_ASSERT_EQ(NUMBER_PARSE_INVALID_SUFFIX, parse("1uu").status);
+    TEST_ASSERT_EQ(NUMBER_PARSE_INVALID_SUFFIX, parse("1.0x").status);
+    TEST_ASSERT_EQ(NUMBER_PARSE_OVERFLOW, parse("18446744073709551616").status);
+    TEST_ASSERT_EQ(NUMBER_PARSE_OVERFLOW, parse("0x10000000000000000").status);
+
+    // 和预处理数一样，紧跟的标识符字符都属于字面量
+    NumberLiteral literal = parse("123abc+1");
+    TEST_ASSERT_EQ(NUMBER_PARSE_INVALID_SUFFIX, literal.status);
+    TEST_ASSERT_EQ(6, literal.length);
+
+    NumberLiteral none;
+    TEST_ASSERT_EQ(0, numberParseLiteral("abc", "abc" + 3, &none));
+}
+
+/**
+ * @brief 不读取end之后的字节
+ */
+static void testStopsAtEnd(void) {
+    const char* text = "123456";
+    NumberLiteral literal;
+    TEST_ASSERT_EQ(3, numberParseLiteral(text, text + 3, &literal));
+    TEST_ASSERT_EQ(123, literal.intValue);
+
+    const char* hex = "0x";
+    TEST_ASSERT_EQ(1, numberParseLiteral(hex, hex + 1, &literal));
+    TEST_ASSERT_EQ(0, literal.intValue);
+}
+
+/**
+ * @brief 浮点数与后缀
+ */
+static void testFloatForms(void) {
+    NumberLiteral literal = parse("2.5e-3f");
+    TEST_ASSERT_EQ(NUMBER_PARSE_OK, literal.status);
+    TEST_ASSERT(literal.isFloat);
+    TEST_ASSERT(literal.isFloatSuffix);
+    TEST_ASSERT(literal.floatValue == 2.5e-3);
+
+    literal = parse("1.0L");
+    TEST_ASSERT(literal.isFloat && literal.isLongDouble);
+    TEST_ASSERT(literal.floatValue == 1.0);
+
+    literal = parse(".5");
+    TEST_ASSERT(literal.isFloat);
+    TEST_ASSERT(literal.floatValue == 0.5);
+
+    literal = parse("1.");
+    TEST_ASSERT(literal.isFloat);
+    TEST_ASSERT(literal.floatValue == 1.0);
+
+    literal = parse("0x1.8p1");
+    TEST_ASSERT_EQ(NUMBER_PARSE_OK, literal.status);
+    TEST_ASSERT(literal.isFloat);
+    TEST_ASSERT(literal.floatValue == 3.0);
+
+    literal = parse("1e10");
+    TEST_ASSERT(literal.isFloat);
+    TEST_ASSERT(literal.floatValue == 1e10);
+}
+
+/**
+ * @brief 难以正确舍入的十进制浮点数与strtod逐位相同
+ */
+static void testFloatRounding(void) {
+    static const char* const cases[] = {
+        "0.1", "0.3", "3.14159265358979323846264338327950288",
+        "9007199254740993.0", "9007199254740995e0",
+        "2.2250738585072011e-308", "2.2250738585072014e-308",
+        "4.9406564584124654e-324", "2.4703282292062327e-324",
+        "1.7976931348623157e308", "1.7976931348623159e308",
+        "1e-400", "1e400", "123456789012345678901234567890e-10",
+        "7.038531e-26", "8.988465674311579e307",
+    };
+    size_t mismatches = 0;
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        if (!sameAsStrtod(cases[i])) {
+            fprintf(stderr, "  与strtod不同: %s\n", cases[i]);
+            mismatches++;
+        }
+    }
+    TEST_ASSERT_EQ(0, mismatches);
+}
+
+/**
+ * @brief 随机的double按17位和7位有效数字格式化后解析，与strtod逐位相同
+ */
+static void testRandomFloatsRoundTrip(void) {
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    size_t mismatches = 0;
+    char text[64];
+    for (int i = 0; i < 20000; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        double value;
+        uint64_t bits = state & 0x7FEFFFFFFFFFFFFFULL;  // 正的有限值
+        memcpy(&value, &bits, sizeof(double));
+
+        snprintf(text, sizeof(text), "%.16e", value);
+        mismatches += !sameAsStrtod(text);
+        snprintf(text, sizeof(text), "%.6e", value);
+        mismatches += !sameAsStrtod(text);
+    }
+    TEST_ASSERT_EQ(0, mismatches);
+}
+
+/**
+ * @brief 快速路径能判定的值直接给出结果
+ */
+static void testDecimalToDouble(void) {
+    double result = 0.0;
+    TEST_ASSERT(numberDecimalToDouble(15, -1, &result));
+    TEST_ASSERT(result == 1.5);
+    TEST_ASSERT(numberDecimalToDouble(0, 100, &result));
+    TEST_ASSERT(result == 0.0);
+}
+
+int main(void) {
+    RUN_TEST(testIntegerBases);
+    RUN_TEST(testIntegerSuffixes);
+    RUN_TEST(testMalformedLiterals);
+    RUN_TEST(testStopsAtEnd);
+    RUN_TEST(testFloatForms);
+    RUN_TEST(testFloatRounding);
+    RUN_TEST(testRandomFloatsRoundTrip);
+    RUN_TEST(testDecimalToDouble);
+    return TEST_REPORT();
+}
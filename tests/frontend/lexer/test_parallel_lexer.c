@@ -0,0 +1,235 @@
+/**
+ * @file test_parallel_lexer.c
+ * @brief 并行词法分析与顺序词法分析结果一致性的单元测试
+ */
+
+#include "test_framework.h"
+#include "frontend/lexer/parallel_lexer.h"
+#include "common/diagnostics/diagnostic_engine.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 比较两个token数组的类型、偏移和长度
+ */
+static void assertSameTokens(const TokenArray* expected, const TokenArray* actual) {
+    TEST_ASSERT(expected != NULL && actual != NULL);
+    if (!expected || !actual) {
+        return;
+    }
+    TEST_ASSERT_EQ(tokenArraySize(expected), tokenArraySize(actual));
+    size_t count = tokenArraySize(expected) < tokenArraySize(actual)
+                       ? tokenArraySize(expected) : tokenArraySize(actual);
+    size_t mismatches = 0;
+    for (size_t i = 0; i < count; i++) {
+        const PackedToken* a = tokenArrayGet(expected, i);
+        const PackedToken* b = tokenArrayGet(actual, i);
+        if (a->offset != b->offset || a->length != b->length || a->type != b->type) {
+            mismatches++;
+        }
+    }
+    TEST_ASSERT_EQ(0, mismatches);
+}
+
+/**
+ * @brief 一次词法分析的结果：token、诊断计数和输出的诊断文本
+ */
+typedef struct {
+    TokenArray* tokens;
+    size_t lexerErrors;
+    size_t lexerWarnings;
+    size_t engineErrors;
+    size_t engineWarnings;
+    char* output;
+} LexResult;
+
+#define DIAGNOSTIC_BUFFER_SIZE (16 * 1024 * 1024)
+
+/**
+ * @brief 顺序（threadCount为0）或并行扫描source，收集诊断
+ */
+static LexResult lexWithDiagnostics(const char* source, size_t threadCount) {
+    LexResult result;
+    memset(&result, 0, sizeof(result));
+    result.output = (char*)malloc(DIAGNOSTIC_BUFFER_SIZE);
+
+    DiagnosticConsumer* consumer = createBufferDiagnosticConsumer(result.output, DIAGNOSTIC_BUFFER_SIZE);
+    DiagnosticEngine* engine = createDiagnosticEngine(consumer);
+    // 两次扫描用同一个文件名，格式化后的诊断文本才能逐字比较
+    Lexer* lexer = createLexer(source, "input.c", engine);
+
+    result.tokens = threadCount == 0 ? lexerTokenize(lexer) : lexerTokenizeParallel(lexer, threadCount);
+    result.lexerErrors = lexer->errorCount;
+    result.lexerWarnings = lexer->warningCount;
+    result.engineErrors = diagnosticEngineGetErrorCount(engine);
+    result.engineWarnings = diagnosticEngineGetWarningCount(engine);
+
+    destroyLexer(lexer);
+    destroyDiagnosticEngine(engine);
+    return result;
+}
+
+static void destroyLexResult(LexResult* result) {
+    destroyTokenArray(result->tokens);
+    free(result->output);
+}
+
+/**
+ * @brief 比较两次扫描的token、诊断计数和逐条诊断
+ */
+static void assertSameResult(const LexResult* expected, const LexResult* actual) {
+    assertSameTokens(expected->tokens, actual->tokens);
+    TEST_ASSERT_EQ(expected->lexerErrors, actual->lexerErrors);
+    TEST_ASSERT_EQ(expected->lexerWarnings, actual->lexerWarnings);
+    TEST_ASSERT_EQ(expected->engineErrors, actual->engineErrors);
+    TEST_ASSERT_EQ(expected->engineWarnings, actual->engineWarnings);
+    TEST_ASSERT(strcmp(expected->output, actual->output) == 0);
+}
+
+/**
+ * @brief 生成约size字节的源码，每隔几行放一段很长的多行块注释
+ *
+ * 块注释内部也像代码，分块点落在注释里时投机扫描的结果与真实结果不同。
+ */
+static char* makeSource(size_t size) {
+    char* source = (char*)malloc(size + 256);
+    size_t length = 0;
+    size_t line = 0;
+    while (length < size) {
+        const char* text;
+        if (line % 97 == 0) {
+            text = "/* int commented = 1;\n   char* s = \"not a string\n   x = y + z;\n"
+                   "   more */ int after = 2;\n";
+        } else if (line % 13 == 0) {
+            text = "const char* s = \"a // b /* c\";\n";
+        } else {
+            text = "int value = a + b * 42; // trailing comment\n";
+        }
+        size_t textLength = strlen(text);
+        memcpy(source + length, text, textLength);
+        length += textLength;
+        line++;
+    }
+    source[length] = '\0';
+    return source;
+}
+
+/**
+ * @brief 多个分块点落在块注释中时，结果与顺序扫描相同
+ */
+static void testMatchesSerialLexing(void) {
+    char* source = makeSource(3 * 1024 * 1024);
+
+    LexResult expected = lexWithDiagnostics(source, 0);
+    LexResult actual = lexWithDiagnostics(source, 4);
+    assertSameResult(&expected, &actual);
+
+    destroyLexResult(&expected);
+    destroyLexResult(&actual);
+    free(source);
+}
+
+/**
+ * @brief 分块点附近全部落在同一个超长块注释中时，结果与顺序扫描相同
+ */
+static void testCommentSpanningChunks(void) {
+    size_t size = 2 * 1024 * 1024;
+    char* source = (char*)malloc(size + 64);
+    size_t length = 0;
+    memcpy(source, "int a;\n/*", 9);
+    length = 9;
+    while (length < size) {
+        memcpy(source + length, " int x;\n", 8);
+        length += 8;
+    }
+    memcpy(source + length, "*/ int b;\n", 10);
+    length += 10;
+    source[length] = '\0';
+
+    LexResult expected = lexWithDiagnostics(source, 0);
+    LexResult actual = lexWithDiagnostics(source, 4);
+    assertSameResult(&expected, &actual);
+
+    destroyLexResult(&expected);
+    destroyLexResult(&actual);
+    free(source);
+}
+
+/**
+ * @brief 块首的token有错误时只报告一次
+ *
+ * 块首的token是上一块的停止点，两块都不能把它的诊断各报告一遍。
+ */
+static void testBoundaryTokenReportedOnce(void) {
+    size_t size = 600 * 1024;
+    char* source = (char*)malloc(size + 1);
+    for (size_t i = 0; i < size; i += 2) {
+        source[i] = 'a';
+        source[i + 1] = '\n';
+    }
+    source[size] = '\0';
+
+    // 2个线程时块长为最小块长，第二块从其后第一个换行之后开始
+    const char* newline = strchr(source + PARALLEL_LEXER_MIN_CHUNK_SIZE, '\n');
+    TEST_ASSERT(newline != NULL);
+    source[newline + 1 - source] = (char)0xFF;
+
+    LexResult expected = lexWithDiagnostics(source, 0);
+    LexResult actual = lexWithDiagnostics(source, 2);
+    TEST_ASSERT_EQ(1, expected.lexerErrors);
+    assertSameResult(&expected, &actual);
+
+    destroyLexResult(&expected);
+    destroyLexResult(&actual);
+    free(source);
+}
+
+/**
+ * @brief 随机散布错误和警告的大文件，诊断与顺序扫描逐条相同
+ */
+static void testRandomDiagnosticsMatchSerial(void) {
+    static const char* const fragments[] = {
+        "int value = a + b * 42; // trailing comment\n",
+        "const char* s = \"a // b /* c\";\n",
+        "/* block\n   comment */ x = y;\n",
+        "99999999999999999999;\n",                 // 整数溢出（警告）
+        "\xff bad byte;\n",                        // 非法UTF-8（错误）
+        "'\xc3\xa9' + c;\n",                       // 多字符常量（警告）
+    };
+    size_t fragmentCount = sizeof(fragments) / sizeof(fragments[0]);
+    size_t size = 1024 * 1024;
+
+    srand(12345);
+    for (int round = 0; round < 3; round++) {
+        char* source = (char*)malloc(size + 256);
+        size_t length = 0;
+        while (length < size) {
+            // 带诊断的token放在行首，分块点落在它前面时就是块首的token
+            size_t pick = rand() % 4 != 0 ? (size_t)(rand() % 3) : 3 + (size_t)rand() % (fragmentCount - 3);
+            size_t textLength = strlen(fragments[pick]);
+            memcpy(source + length, fragments[pick], textLength);
+            length += textLength;
+        }
+        source[length] = '\0';
+
+        LexResult expected = lexWithDiagnostics(source, 0);
+        TEST_ASSERT(expected.lexerErrors > 0);
+        TEST_ASSERT(expected.lexerWarnings > 0);
+        for (size_t threads = 2; threads <= 4; threads += 2) {
+            LexResult actual = lexWithDiagnostics(source, threads);
+            assertSameResult(&expected, &actual);
+            destroyLexResult(&actual);
+        }
+
+        destroyLexResult(&expected);
+        free(source);
+    }
+}
+
+int main(void) {
+    RUN_TEST(testMatchesSerialLexing);
+    RUN_TEST(testCommentSpanningChunks);
+    RUN_TEST(testBoundaryTokenReportedOnce);
+    RUN_TEST(testRandomDiagnosticsMatchSerial);
+    return TEST_REPORT();
+}
@@ -0,0 +1,87 @@
+/**
+ * @file test_token_array.c
+ * @brief 紧凑token数组容量管理与内存统计的单元测试
+ */
+
+#include "test_framework.h"
+#include "frontend/lexer/lexer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 按已使用的元素数计算的堆内存
+ */
+static size_t usedBytes(const TokenArray* array) {
+    return sizeof(TokenArray)
+         + array->count * sizeof(PackedToken)
+         + array->valueCount * sizeof(TokenValue)
+         + array->stringPoolSize;
+}
+
+/**
+ * @brief lexerTokenize返回的数组没有多余容量，内存统计等于实际使用量
+ */
+static void testTokenizeReleasesReserve(void) {
+    // 长标识符和长字符串让token数远少于按5字节估算的数量
+    enum { STATEMENTS = 2000 };
+    size_t capacity = STATEMENTS * 96 + 1;
+    char* source = (char*)malloc(capacity);
+    size_t length = 0;
+    for (size_t i = 0; i < STATEMENTS; i++) {
+        length += (size_t)snprintf(source + length, capacity - length,
+                                   "const char* a_rather_long_identifier_%zu = \"a fairly long string\";\n", i);
+    }
+
+    Lexer* lexer = createLexer(source, "array.c", NULL);
+    TokenArray* tokens = lexerTokenize(lexer);
+    TEST_ASSERT(tokens != NULL);
+    TEST_ASSERT_EQ(STATEMENTS * 7 + 1, tokenArraySize(tokens));
+    TEST_ASSERT_EQ(tokens->count, tokens->capacity);
+    TEST_ASSERT_EQ(tokens->valueCount, tokens->valueCapacity);
+    TEST_ASSERT_EQ(tokens->stringPoolSize, tokens->stringPoolCapacity);
+    TEST_ASSERT_EQ(usedBytes(tokens), tokenArrayMemoryUsage(tokens));
+    TEST_ASSERT(tokenArrayMemoryUsage(tokens) < sizeof(TokenArray) +
+                (length / 5 + 16) * sizeof(PackedToken));
+
+    // 收缩后内容不变
+    size_t lexemeLength = 0;
+    const char* lexeme = tokenArrayGetLexeme(tokens, 7, &lexemeLength);
+    TEST_ASSERT(lexemeLength == 5 && memcmp(lexeme, "const", 5) == 0);
+    TEST_ASSERT_STR_EQ("a fairly long string", tokenArrayGetString(tokens, 5, NULL));
+
+    destroyTokenArray(tokens);
+    destroyLexer(lexer);
+    free(source);
+}
+
+/**
+ * @brief 收缩后仍可继续追加，空数组收缩不改变预留容量
+ */
+static void testShrinkThenAppend(void) {
+    static const char source[] = "x";
+    TokenArray* array = createTokenArray(source, 1, INVALID_FILE_ID, 64);
+    TEST_ASSERT(array != NULL);
+    tokenArrayShrinkToFit(array);
+    TEST_ASSERT_EQ(64, array->capacity);
+
+    TEST_ASSERT(tokenArrayPush(array, TOKEN_IDENTIFIER, 0, 1, 0, NULL));
+    tokenArrayShrinkToFit(array);
+    TEST_ASSERT_EQ(1, array->capacity);
+
+    for (size_t i = 0; i < 100; i++) {
+        TEST_ASSERT(tokenArrayPush(array, TOKEN_IDENTIFIER, 0, 1, 0, NULL));
+    }
+    TEST_ASSERT_EQ(101, tokenArraySize(array));
+    TEST_ASSERT(array->capacity >= 101);
+    TEST_ASSERT_EQ(TOKEN_IDENTIFIER, tokenArrayGet(array, 100)->type);
+
+    tokenArrayShrinkToFit(NULL);
+    destroyTokenArray(array);
+}
+
+int main(void) {
+    RUN_TEST(testTokenizeReleasesReserve);
+    RUN_TEST(testShrinkThenAppend);
+    return TEST_REPORT();
+}
@@ -0,0 +1,194 @@
+/**
+ * @file test_token_stream.c
+ * @brief 流式token源的前看、环形缓冲区回绕和文件末尾行为的单元测试
+ */
+
+#include "test_framework.h"
+#include "frontend/lexer/token_stream.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 生成count个语句，每个语句含标识符、整数和内容各不相同的字符串
+ */
+static char* makeSource(size_t count) {
+    size_t capacity = count * 48 + 1;
+    char* source = (char*)malloc(capacity);
+    size_t length = 0;
+    for (size_t i = 0; i < count; i++) {
+        length += (size_t)snprintf(source + length, capacity - length,
+                                   "v%zu = %zu + \"s%zu\";\n", i, i * 7, i);
+    }
+    return source;
+}
+
+/**
+ * @brief 比较流中的token与完整扫描得到的第index个token
+ */
+static bool sameToken(const TokenArray* expected, size_t index, const LexedToken* actual) {
+    if (!actual) {
+        return false;
+    }
+    if (index >= tokenArraySize(expected)) {
+        return actual->type == TOKEN_EOF;
+    }
+    const PackedToken* token = tokenArrayGet(expected, index);
+    if (token->type != actual->type || token->offset != actual->offset || token->length != actual->length) {
+        return false;
+    }
+    if (token->type == TOKEN_STRING_LITERAL) {
+        size_t length = 0;
+        const char* value = tokenArrayGetString(expected, index, &length);
+        return length == actual->stringLength && memcmp(value, actual->stringValue, length) == 0 &&
+               actual->stringValue[length] == '\0';
+    }
+    return true;
+}
+
+/**
+ * @brief 每一步都查看全部前看深度，结果与完整扫描一致，缓冲区回绕多次
+ */
+static void testLookaheadMatchesFullLex(void) {
+    enum { STATEMENTS = 500 };
+    char* source = makeSource(STATEMENTS);
+    Lexer* reference = createLexer(source, "stream.c", NULL);
+    TokenArray* expected = lexerTokenize(reference);
+    TEST_ASSERT(expected != NULL);
+
+    static const size_t depths[] = {1, 2, 3, 4, 7};
+    for (size_t d = 0; d < sizeof(depths) / sizeof(depths[0]); d++) {
+        size_t lookahead = depths[d];
+        Lexer* lexer = createLexer(source, "stream.c", NULL);
+        TokenStream* stream = createTokenStream(lexer, lookahead);
+        TEST_ASSERT(stream != NULL);
+        TEST_ASSERT(stream->capacity > lookahead);
+        TEST_ASSERT_EQ(0, stream->capacity & stream->mask);
+
+        size_t mismatches = 0;
+        size_t index = 0;
+        while (tokenStreamPeekType(stream, 0) != TOKEN_EOF) {
+            for (size_t k = 0; k < lookahead; k++) {
+                if (!sameToken(expected, index + k, tokenStreamPeek(stream, k))) {
+                    mismatches++;
+                }
+            }
+            if (!sameToken(expected, index, tokenStreamConsume(stream))) {
+                mismatches++;
+            }
+            index++;
+        }
+        TEST_ASSERT_EQ(0, mismatches);
+        // 完整扫描的结果以EOF结尾
+        TEST_ASSERT_EQ(tokenArraySize(expected) - 1, index);
+        TEST_ASSERT_EQ(index, stream->consumedCount);
+        TEST_ASSERT(stream->count <= lookahead);
+
+        destroyTokenStream(stream);
+        destroyLexer(lexer);
+    }
+
+    destroyTokenArray(expected);
+    destroyLexer(reference);
+    free(source);
+}
+
+/**
+ * @brief 前看深度之外的查看返回NULL，类型视为EOF，不影响流的状态
+ */
+static void testPeekBeyondLookahead(void) {
+    Lexer* lexer = createLexer("a b c d e f", "stream.c", NULL);
+    TokenStream* stream = createTokenStream(lexer, 2);
+    TEST_ASSERT(stream != NULL);
+
+    TEST_ASSERT(tokenStreamPeek(stream, 2) == NULL);
+    TEST_ASSERT_EQ(TOKEN_EOF, tokenStreamPeekType(stream, 2));
+    TEST_ASSERT(tokenStreamPeek(NULL, 0) == NULL);
+
+    const LexedToken* second = tokenStreamPeek(stream, 1);
+    TEST_ASSERT(second != NULL);
+    TEST_ASSERT_EQ(2, second->offset);
+    TEST_ASSERT_EQ(2, stream->count);
+    TEST_ASSERT_EQ(0, tokenStreamConsume(stream)->offset);
+    TEST_ASSERT_EQ(2, tokenStreamPeek(stream, 0)->offset);
+
+    // 0表示默认前看深度
+    TokenStream* defaults = createTokenStream(lexer, 0);
+    TEST_ASSERT(defaults != NULL);
+    TEST_ASSERT_EQ(TOKEN_STREAM_DEFAULT_LOOKAHEAD, defaults->lookahead);
+    TEST_ASSERT(createTokenStream(NULL, 1) == NULL);
+
+    destroyTokenStream(defaults);
+    destroyTokenStream(stream);
+    destroyLexer(lexer);
+}
+
+/**
+ * @brief 刚消费的token在把前看缓冲区填满之后仍然有效
+ */
+static void testConsumedTokenSurvivesFullLookahead(void) {
+    enum { LOOKAHEAD = 3 };
+    Lexer* lexer = createLexer("\"first\" \"second\" \"third\" \"fourth\" \"fifth\" \"sixth\"",
+                               "stream.c", NULL);
+    TokenStream* stream = createTokenStream(lexer, LOOKAHEAD);
+    TEST_ASSERT(stream != NULL);
+
+    static const char* const values[] = {"first", "second", "third", "fourth"};
+    for (size_t i = 0; i < 3; i++) {
+        const LexedToken* consumed = tokenStreamConsume(stream);
+        TEST_ASSERT(consumed != NULL);
+        for (size_t k = 0; k < LOOKAHEAD; k++) {
+            TEST_ASSERT(tokenStreamPeek(stream, k) != NULL);
+        }
+        TEST_ASSERT_EQ(TOKEN_STRING_LITERAL, consumed->type);
+        TEST_ASSERT_STR_EQ(values[i], consumed->stringValue);
+        TEST_ASSERT_STR_EQ(values[i + 1], tokenStreamPeek(stream, 0)->stringValue);
+    }
+
+    destroyTokenStream(stream);
+    destroyLexer(lexer);
+}
+
+/**
+ * @brief 到达文件末尾后查看和消费都重复返回EOF
+ */
+static void testEofRepeats(void) {
+    static const char source[] = "x;";
+    Lexer* lexer = createLexer(source, "stream.c", NULL);
+    TokenStream* stream = createTokenStream(lexer, 4);
+    TEST_ASSERT(stream != NULL);
+
+    TEST_ASSERT_EQ(TOKEN_IDENTIFIER, tokenStreamPeekType(stream, 0));
+    TEST_ASSERT_EQ(TOKEN_SEMICOLON, tokenStreamPeekType(stream, 1));
+    TEST_ASSERT_EQ(TOKEN_EOF, tokenStreamPeekType(stream, 2));
+    TEST_ASSERT_EQ(TOKEN_EOF, tokenStreamPeekType(stream, 3));
+    TEST_ASSERT(stream->reachedEnd);
+
+    for (size_t i = 0; i < 20; i++) {
+        tokenStreamConsume(stream);
+    }
+    for (size_t k = 0; k < 4; k++) {
+        const LexedToken* token = tokenStreamPeek(stream, k);
+        TEST_ASSERT(token != NULL);
+        TEST_ASSERT_EQ(TOKEN_EOF, token->type);
+        TEST_ASSERT_EQ(sizeof(source) - 1, token->offset);
+    }
+    const LexedToken* eof = tokenStreamConsume(stream);
+    TEST_ASSERT(eof != NULL && eof->type == TOKEN_EOF);
+    TEST_ASSERT_EQ(21, stream->consumedCount);
+
+    size_t length = 0;
+    TEST_ASSERT(tokenStreamGetLexeme(stream, eof, &length) == lexer->source + sizeof(source) - 1);
+    TEST_ASSERT_EQ(0, length);
+
+    destroyTokenStream(stream);
+    destroyLexer(lexer);
+}
+
+int main(void) {
+    RUN_TEST(testLookaheadMatchesFullLex);
+    RUN_TEST(testPeekBeyondLookahead);
+    RUN_TEST(testConsumedTokenSurvivesFullLookahead);
+    RUN_TEST(testEofRepeats);
+    return TEST_REPORT();
+}
@@ -0,0 +1,309 @@
+/**
+ * @file test_unicode_lexer.c
+ * @brief UTF-8解码、Unicode标识符、通用字符名和带前缀字面量的单元测试
+ */
+
+#include "test_framework.h"
+#include "frontend/lexer/lexer.h"
+#include "frontend/lexer/unicode.h"
+#include "common/diagnostics/diagnostic_engine.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_TOKENS 16
+#define DIAGNOSTIC_BUFFER_SIZE 4096
+
+/**
+ * @brief 一次扫描的结果：token的类型、长度、字面量信息和诊断
+ */
+typedef struct {
+    size_t count;
+    TokenType types[MAX_TOKENS];
+    size_t lengths[MAX_TOKENS];
+    LiteralType literalTypes[MAX_TOKENS];
+    uint32_t flags[MAX_TOKENS];
+    long long intValues[MAX_TOKENS];
+    char strings[MAX_TOKENS][32];
+    size_t errors;
+    size_t warnings;
+    char output[DIAGNOSTIC_BUFFER_SIZE];
+} LexResult;
+
+/**
+ * @brief 扫描source直到EOF（不计入结果），收集每个token和诊断
+ */
+static void lexSource(const char* source, bool supportUnicode, LexResult* result) {
+    memset(result, 0, sizeof(*result));
+    DiagnosticConsumer* consumer = createBufferDiagnosticConsumer(result->output, DIAGNOSTIC_BUFFER_SIZE);
+    DiagnosticEngine* engine = createDiagnosticEngine(consumer);
+    Lexer* lexer = createLexer(source, "unicode.c", engine);
+    TEST_ASSERT(lexer != NULL);
+    if (!lexer) {
+        destroyDiagnosticEngine(engine);
+        return;
+    }
+    lexerSetSupportUnicode(lexer, supportUnicode);
+
+    for (;;) {
+        Token* token = lexerNextToken(lexer);
+        if (!token || token->type == TOKEN_EOF || result->count == MAX_TOKENS) {
+            break;
+        }
+        size_t i = result->count++;
+        result->types[i] = token->type;
+        result->lengths[i] = token->length;
+        result->literalTypes[i] = token->literalType;
+        result->flags[i] = token->flags;
+        if (token->type == TOKEN_CHAR_LITERAL) {
+            result->intValues[i] = token->value.intValue;
+        } else if (token->type == TOKEN_STRING_LITERAL && token->value.stringValue) {
+            strncpy(result->strings[i], token->value.stringValue, sizeof(result->strings[i]) - 1);
+        }
+    }
+    result->errors = lexer->errorCount;
+    result->warnings = lexer->warningCount;
+
+    destroyLexer(lexer);
+    destroyDiagnosticEngine(engine);
+}
+
+/**
+ * @brief 合法的1到4字节序列解码为对应码点，编码后得到原字节
+ */
+static void testDecodeValidSequences(void) {
+    static const struct {
+        const char* bytes;
+        uint32_t codePoint;
+    } cases[] = {
+        {"A", 0x41},
+        {"\xC3\xA9", 0xE9},
+        {"\xE2\x82\xAC", 0x20AC},
+        {"\xEF\xBF\xBF", 0xFFFF},
+        {"\xF0\x9F\x98\x80", 0x1F600},
+        {"\xF4\x8F\xBF\xBF", 0x10FFFF},
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const char* bytes = cases[i].bytes;
+        size_t length = strlen(bytes);
+        uint32_t codePoint = 0;
+        TEST_ASSERT_EQ(length, unicodeDecodeUtf8(bytes, bytes + length, &codePoint));
+        TEST_ASSERT_EQ(cases[i].codePoint, codePoint);
+
+        char encoded[4];
+        TEST_ASSERT_EQ(length, unicodeEncodeUtf8(cases[i].codePoint, encoded));
+        TEST_ASSERT(memcmp(encoded, bytes, length) == 0);
+    }
+}
+
+/**
+ * @brief 过长编码、代理项、超出范围和截断的序列都解码失败
+ */
+static void testDecodeRejectsMalformed(void) {
+    static const char* const cases[] = {
+        "\x80",                 // 单独的续字节
+        "\xFF",                 // 不可能出现的首字节
+        "\xC0\x80",             // U+0000的过长编码
+        "\xE0\x80\xAF",         // '/'的过长编码
+        "\xF0\x80\x80\x80",     // 四字节过长编码
+        "\xED\xA0\x80",         // U+D800代理项
+        "\xF4\x90\x80\x80",     // U+110000超出范围
+        "\xE2\x82",             // 截断的三字节序列
+        "\xC3\x41",             // 续字节不是10xxxxxx
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        uint32_t codePoint = 0;
+        TEST_ASSERT_EQ(0, unicodeDecodeUtf8(cases[i], cases[i] + strlen(cases[i]), &codePoint));
+    }
+
+    // 序列完整但end截在中间时同样失败
+    const char* euro = "\xE2\x82\xAC";
+    uint32_t codePoint = 0;
+    TEST_ASSERT_EQ(0, unicodeDecodeUtf8(euro, euro + 2, &codePoint));
+
+    char encoded[4];
+    TEST_ASSERT_EQ(0, unicodeEncodeUtf8(0xD800, encoded));
+    TEST_ASSERT_EQ(0, unicodeEncodeUtf8(0x110000, encoded));
+}
+
+/**
+ * @brief XID_Start/XID_Continue属性：字母可开头，组合符和数字只能跟在后面
+ */
+static void testIdentifierProperties(void) {
+    TEST_ASSERT(unicodeIsIdentifierStart(0xE9));        // é
+    TEST_ASSERT(unicodeIsIdentifierStart(0x53D8));      // 变
+    TEST_ASSERT(unicodeIsIdentifierStart(0x03B1));      // α
+    TEST_ASSERT(!unicodeIsIdentifierStart(0x0301));     // 组合锐音符
+    TEST_ASSERT(unicodeIsIdentifierContinue(0x0301));
+    TEST_ASSERT(!unicodeIsIdentifierStart(0x0661));     // 阿拉伯-印度数字1
+    TEST_ASSERT(unicodeIsIdentifierContinue(0x0661));
+    TEST_ASSERT(!unicodeIsIdentifierStart(0x00D7));     // ×
+    TEST_ASSERT(!unicodeIsIdentifierContinue(0x00D7));
+    TEST_ASSERT(!unicodeIsIdentifierContinue(0x3000));  // 全角空格
+}
+
+/**
+ * @brief UTF-8标识符整体扫描为一个带Unicode标志的标识符
+ */
+static void testUtf8Identifiers(void) {
+    LexResult result;
+    lexSource("caf\xC3\xA9 \xE5\x8F\x98\xE9\x87\x8Fx1 x\xD9\xA1 a\xCC\x81", true, &result);
+    TEST_ASSERT_EQ(4, result.count);
+    TEST_ASSERT_EQ(0, result.errors);
+    static const size_t lengths[] = {5, 8, 3, 3};
+    for (size_t i = 0; i < 4 && i < result.count; i++) {
+        TEST_ASSERT_EQ(TOKEN_IDENTIFIER, result.types[i]);
+        TEST_ASSERT_EQ(lengths[i], result.lengths[i]);
+        TEST_ASSERT(result.flags[i] & TOKEN_FLAG_UNICODE);
+    }
+
+    // 只能出现在后面的组合符不能开始标识符，扫描为未知token且不报错
+    lexSource("\xCC\x81" "a", true, &result);
+    TEST_ASSERT_EQ(2, result.count);
+    TEST_ASSERT_EQ(TOKEN_UNKNOWN, result.types[0]);
+    TEST_ASSERT_EQ(2, result.lengths[0]);
+    TEST_ASSERT_EQ(TOKEN_IDENTIFIER, result.types[1]);
+    TEST_ASSERT_EQ(0, result.errors);
+
+    // 关闭Unicode支持后每个非ASCII字节都是一个未知token
+    lexSource("caf\xC3\xA9", false, &result);
+    TEST_ASSERT_EQ(3, result.count);
+    TEST_ASSERT_EQ(TOKEN_IDENTIFIER, result.types[0]);
+    TEST_ASSERT_EQ(3, result.lengths[0]);
+    TEST_ASSERT_EQ(TOKEN_UNKNOWN, result.types[1]);
+    TEST_ASSERT_EQ(TOKEN_UNKNOWN, result.types[2]);
+    TEST_ASSERT_EQ(0, result.errors);
+}
+
+/**
+ * @brief 非法UTF-8字节逐个报告为无效Unicode错误，字符串字面量中也一样
+ */
+static void testMalformedUtf8(void) {
+    LexResult result;
+    lexSource("\xFF", true, &result);
+    TEST_ASSERT_EQ(1, result.count);
+    TEST_ASSERT_EQ(TOKEN_UNKNOWN, result.types[0]);
+    TEST_ASSERT_EQ(1, result.errors);
+    TEST_ASSERT(strstr(result.output, "invalid UTF-8 byte 0xFF") != NULL);
+
+    // 代理项和超出范围的编码被拒绝后，每个字节各报一次
+    lexSource("\xED\xA0\x80", true, &result);
+    TEST_ASSERT_EQ(3, result.count);
+    TEST_ASSERT_EQ(3, result.errors);
+    TEST_ASSERT(strstr(result.output, "invalid UTF-8 byte 0xED") != NULL);
+
+    // 文件末尾被截断的序列
+    lexSource("x \xE2\x82", true, &result);
+    TEST_ASSERT_EQ(3, result.count);
+    TEST_ASSERT_EQ(TOKEN_IDENTIFIER, result.types[0]);
+    TEST_ASSERT_EQ(2, result.errors);
+
+    // 字符串里的错误字节报错，字面量本身仍然完整扫描
+    lexSource("\"a\xC3\" \"\xC0\x80\"", true, &result);
+    TEST_ASSERT_EQ(2, result.count);
+    TEST_ASSERT_EQ(TOKEN_STRING_LITERAL, result.types[0]);
+    TEST_ASSERT_EQ(4, result.lengths[0]);
+    TEST_ASSERT_EQ(TOKEN_STRING_LITERAL, result.types[1]);
+    TEST_ASSERT_EQ(3, result.errors);
+    TEST_ASSERT(strstr(result.output, "invalid UTF-8 byte 0xC3") != NULL);
+    TEST_ASSERT(strstr(result.output, "invalid UTF-8 byte 0xC0") != NULL);
+}
+
+/**
+ * @brief 通用字符名：合法的可以组成标识符或写进字面量，基本字符集、代理项和不完整的报错
+ */
+static void testUniversalCharacterNames(void) {
+    LexResult result;
+    lexSource("\\u00e9t\\u00E9 \\U000003B1", true, &result);
+    TEST_ASSERT_EQ(2, result.count);
+    TEST_ASSERT_EQ(TOKEN_IDENTIFIER, result.types[0]);
+    TEST_ASSERT_EQ(13, result.lengths[0]);
+    TEST_ASSERT(result.flags[0] & TOKEN_FLAG_UNICODE);
+    TEST_ASSERT_EQ(TOKEN_IDENTIFIER, result.types[1]);
+    TEST_ASSERT_EQ(0, result.errors);
+
+    // 'A'属于基本字符集，D800是代理项，都不能写成通用字符名
+    lexSource("\\u0041 \\uD800", true, &result);
+    TEST_ASSERT_EQ(2, result.count);
+    TEST_ASSERT_EQ(TOKEN_UNKNOWN, result.types[0]);
+    TEST_ASSERT_EQ(2, result.errors);
+    TEST_ASSERT(strstr(result.output, "universal character name \\U00000041 is not valid") != NULL);
+    TEST_ASSERT(strstr(result.output, "universal character name \\U0000D800 is not valid") != NULL);
+
+    // 字面量中的通用字符名按UTF-8写入字符串值
+    lexSource("\"\\u00e9\" \"\\U00110000\" \"\\u12\"", true, &result);
+    TEST_ASSERT_EQ(3, result.count);
+    TEST_ASSERT(strcmp(result.strings[0], "\xC3\xA9") == 0);
+    TEST_ASSERT(result.flags[0] & TOKEN_FLAG_ESCAPE_SEQUENCE);
+    TEST_ASSERT_EQ(2, result.errors);
+    TEST_ASSERT(strstr(result.output, "universal character name \\U00110000 is not valid") != NULL);
+    TEST_ASSERT(strstr(result.output, "incomplete universal character name") != NULL);
+
+    // '$'、'@'、'`'是基本字符集之外允许的例外
+    lexSource("'\\u0024' '\\u0040' '\\u0060'", true, &result);
+    TEST_ASSERT_EQ(3, result.count);
+    TEST_ASSERT_EQ('$', result.intValues[0]);
+    TEST_ASSERT_EQ('@', result.intValues[1]);
+    TEST_ASSERT_EQ('`', result.intValues[2]);
+    TEST_ASSERT_EQ(0, result.errors);
+}
+
+/**
+ * @brief u8/u/U/L前缀决定字面量类型，u/U字符的值是码点
+ */
+static void testPrefixedLiteralTypes(void) {
+    LexResult result;
+    lexSource("u8\"x\" u\"x\" U\"x\" L\"x\" \"x\"", true, &result);
+    TEST_ASSERT_EQ(5, result.count);
+    static const LiteralType stringTypes[] = {
+        LITERAL_TYPE_UTF8_STRING, LITERAL_TYPE_UTF16_STRING, LITERAL_TYPE_UTF32_STRING,
+        LITERAL_TYPE_WSTRING, LITERAL_TYPE_STRING,
+    };
+    for (size_t i = 0; i < 5 && i < result.count; i++) {
+        TEST_ASSERT_EQ(TOKEN_STRING_LITERAL, result.types[i]);
+        TEST_ASSERT_EQ(stringTypes[i], result.literalTypes[i]);
+        TEST_ASSERT(strcmp(result.strings[i], "x") == 0);
+        TEST_ASSERT_EQ(i < 3, (result.flags[i] & TOKEN_FLAG_UNICODE) != 0);
+    }
+    TEST_ASSERT_EQ(0, result.errors);
+
+    lexSource("u'\xC3\xA9' U'\xF0\x9F\x98\x80' U'\\U0001F600' L'a' 'a'", true, &result);
+    TEST_ASSERT_EQ(5, result.count);
+    static const LiteralType charTypes[] = {
+        LITERAL_TYPE_UTF16_CHAR, LITERAL_TYPE_UTF32_CHAR, LITERAL_TYPE_UTF32_CHAR,
+        LITERAL_TYPE_WCHAR, LITERAL_TYPE_CHAR,
+    };
+    static const long long charValues[] = {0xE9, 0x1F600, 0x1F600, 'a', 'a'};
+    for (size_t i = 0; i < 5 && i < result.count; i++) {
+        TEST_ASSERT_EQ(TOKEN_CHAR_LITERAL, result.types[i]);
+        TEST_ASSERT_EQ(charTypes[i], result.literalTypes[i]);
+        TEST_ASSERT_EQ(charValues[i], result.intValues[i]);
+    }
+    TEST_ASSERT_EQ(0, result.errors);
+    TEST_ASSERT_EQ(0, result.warnings);
+
+    // 基本平面之外的字符放不进一个UTF-16码元，只给警告
+    lexSource("u'\xF0\x9F\x98\x80'", true, &result);
+    TEST_ASSERT_EQ(1, result.count);
+    TEST_ASSERT_EQ(LITERAL_TYPE_UTF16_CHAR, result.literalTypes[0]);
+    TEST_ASSERT_EQ(0, result.errors);
+    TEST_ASSERT_EQ(1, result.warnings);
+    TEST_ASSERT(strstr(result.output, "not representable in a single UTF-16 code unit") != NULL);
+
+    // 字符字面量没有u8前缀，u8是普通标识符
+    lexSource("u8'a'", true, &result);
+    TEST_ASSERT_EQ(2, result.count);
+    TEST_ASSERT_EQ(TOKEN_IDENTIFIER, result.types[0]);
+    TEST_ASSERT_EQ(TOKEN_CHAR_LITERAL, result.types[1]);
+    TEST_ASSERT_EQ(LITERAL_TYPE_CHAR, result.literalTypes[1]);
+}
+
+int main(void) {
+    RUN_TEST(testDecodeValidSequences);
+    RUN_TEST(testDecodeRejectsMalformed);
+    RUN_TEST(testIdentifierProperties);
+    RUN_TEST(testUtf8Identifiers);
+    RUN_TEST(testMalformedUtf8);
+    RUN_TEST(testUniversalCharacterNames);
+    RUN_TEST(testPrefixedLiteralTypes);
+    return TEST_REPORT();
+}
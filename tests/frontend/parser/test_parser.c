@@ -0,0 +1,162 @@
+/**
+ * @file test_parser.c
+ * @brief 语法分析器token访问、期望匹配和错误恢复的单元测试
+ */
+
+#include "test_framework.h"
+#include "frontend/parser/parser.h"
+#include "common/diagnostics/diagnostic_engine.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define DIAGNOSTIC_BUFFER_SIZE 4096
+
+/**
+ * @brief 一个语法分析器及其依赖的词法分析器和诊断引擎
+ */
+typedef struct {
+    DiagnosticEngine* engine;
+    Lexer* lexer;
+    Parser* parser;
+    char output[DIAGNOSTIC_BUFFER_SIZE];
+} ParserFixture;
+
+static void setUpParser(ParserFixture* fixture, const char* source) {
+    memset(fixture->output, 0, sizeof(fixture->output));
+    DiagnosticConsumer* consumer = createBufferDiagnosticConsumer(fixture->output, DIAGNOSTIC_BUFFER_SIZE);
+    fixture->engine = createDiagnosticEngine(consumer);
+    fixture->lexer = createLexer(source, "parse.c", fixture->engine);
+    fixture->parser = createParser(fixture->lexer, fixture->engine);
+    TEST_ASSERT(fixture->parser != NULL);
+}
+
+static void tearDownParser(ParserFixture* fixture) {
+    destroyParser(fixture->parser);
+    destroyLexer(fixture->lexer);
+    destroyDiagnosticEngine(fixture->engine);
+}
+
+/**
+ * @brief check只查看不消费，match和expect在类型相符时消费并记录previous
+ */
+static void testCheckMatchExpect(void) {
+    ParserFixture fixture;
+    setUpParser(&fixture, "x = 1;");
+    Parser* parser = fixture.parser;
+
+    TEST_ASSERT(parserCheck(parser, TOKEN_IDENTIFIER));
+    TEST_ASSERT(!parserCheck(parser, TOKEN_SEMICOLON));
+    TEST_ASSERT(!parserMatch(parser, TOKEN_SEMICOLON));
+    TEST_ASSERT(parser->previous == NULL);
+
+    TEST_ASSERT(parserMatch(parser, TOKEN_IDENTIFIER));
+    TEST_ASSERT(parser->previous != NULL);
+    TEST_ASSERT_EQ(0, parser->previous->offset);
+
+    const LexedToken* assign = parserExpect(parser, TOKEN_ASSIGN, "expected '='");
+    TEST_ASSERT(assign != NULL);
+    TEST_ASSERT(assign == parser->previous);
+    TEST_ASSERT_EQ(2, assign->offset);
+    TEST_ASSERT_EQ(TOKEN_INTEGER_LITERAL, parserPeek(parser, 0)->type);
+    TEST_ASSERT_EQ(TOKEN_SEMICOLON, parserPeek(parser, 1)->type);
+
+    TEST_ASSERT(parserExpect(parser, TOKEN_INTEGER_LITERAL, "expected value") != NULL);
+    TEST_ASSERT(parserExpect(parser, TOKEN_SEMICOLON, "expected ';'") != NULL);
+    TEST_ASSERT(parserIsAtEnd(parser));
+    TEST_ASSERT_EQ(0, parser->errorCount);
+    TEST_ASSERT_EQ(0, strlen(fixture.output));
+
+    tearDownParser(&fixture);
+}
+
+/**
+ * @brief expect失败时不消费token，在当前token处报错并进入错误恢复状态
+ */
+static void testExpectFailureReports(void) {
+    ParserFixture fixture;
+    setUpParser(&fixture, "x = 1\ny = 2;");
+    Parser* parser = fixture.parser;
+
+    parserAdvance(parser);
+    parserAdvance(parser);
+    parserAdvance(parser);
+    TEST_ASSERT(parserExpect(parser, TOKEN_SEMICOLON, "expected ';'") == NULL);
+    TEST_ASSERT(parserCheck(parser, TOKEN_IDENTIFIER));
+    TEST_ASSERT_EQ(1, parser->errorCount);
+    TEST_ASSERT(parser->panicMode);
+    TEST_ASSERT(strstr(fixture.output, "parse.c:2:1: error: parser: expected ';'") != NULL);
+    TEST_ASSERT_EQ(1, diagnosticEngineGetErrorCount(fixture.engine));
+
+    // 错误恢复状态下的后续错误不再报告
+    TEST_ASSERT(parserExpect(parser, TOKEN_LPAREN, "expected '('") == NULL);
+    TEST_ASSERT_EQ(1, parser->errorCount);
+    TEST_ASSERT(strstr(fixture.output, "expected '('") == NULL);
+
+    tearDownParser(&fixture);
+}
+
+/**
+ * @brief synchronize跳到分号或右花括号之后，退出错误恢复状态
+ */
+static void testSynchronize(void) {
+    ParserFixture fixture;
+    setUpParser(&fixture, "a b c; d } e f");
+    Parser* parser = fixture.parser;
+
+    parserReportError(parser, "unexpected token");
+    TEST_ASSERT(parser->panicMode);
+    parserSynchronize(parser);
+    TEST_ASSERT(!parser->panicMode);
+    TEST_ASSERT_EQ(TOKEN_SEMICOLON, parser->previous->type);
+    TEST_ASSERT(parserCheck(parser, TOKEN_IDENTIFIER));
+    TEST_ASSERT_EQ(7, parserPeek(parser, 0)->offset);
+
+    // 恢复后新的错误照常报告
+    parserReportError(parser, "second error");
+    TEST_ASSERT_EQ(2, parser->errorCount);
+    TEST_ASSERT(strstr(fixture.output, "parse.c:1:8: error: parser: second error") != NULL);
+    parserSynchronize(parser);
+    TEST_ASSERT_EQ(TOKEN_RBRACE, parser->previous->type);
+    TEST_ASSERT_EQ(11, parserPeek(parser, 0)->offset);
+
+    // 没有语句边界时一直跳到文件末尾
+    parserReportError(parser, "third error");
+    parserSynchronize(parser);
+    TEST_ASSERT(parserIsAtEnd(parser));
+    TEST_ASSERT(!parser->panicMode);
+    TEST_ASSERT_EQ(3, parser->errorCount);
+
+    // 在文件末尾继续前进停留在EOF
+    parserAdvance(parser);
+    TEST_ASSERT(parserIsAtEnd(parser));
+    TEST_ASSERT(!parserExpect(parser, TOKEN_SEMICOLON, "expected ';'"));
+    TEST_ASSERT(strstr(fixture.output, "parse.c:1:15: error: parser: expected ';'") != NULL);
+
+    tearDownParser(&fixture);
+}
+
+/**
+ * @brief 没有诊断引擎时照常计数，NULL参数安全返回
+ */
+static void testWithoutDiagnostics(void) {
+    Lexer* lexer = createLexer("(", "parse.c", NULL);
+    Parser* parser = createParser(lexer, NULL);
+    TEST_ASSERT(parser != NULL);
+
+    TEST_ASSERT(parserExpect(parser, TOKEN_RPAREN, NULL) == NULL);
+    TEST_ASSERT_EQ(1, parser->errorCount);
+    TEST_ASSERT(createParser(NULL, NULL) == NULL);
+    TEST_ASSERT(parserPeek(NULL, 0) == NULL);
+    TEST_ASSERT(parserIsAtEnd(NULL));
+
+    destroyParser(parser);
+    destroyLexer(lexer);
+}
+
+int main(void) {
+    RUN_TEST(testCheckMatchExpect);
+    RUN_TEST(testExpectFailureReports);
+    RUN_TEST(testSynchronize);
+    RUN_TEST(testWithoutDiagnostics);
+    return TEST_REPORT();
+}
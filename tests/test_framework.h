@@ -0,0 +1,93 @@
+#ifndef TEST_FRAMEWORK_H
+#define TEST_FRAMEWORK_H
+
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief 单元测试公共宏
+ *
+ * 每个测试文件编译成一个可执行程序并注册为一个CTest测试。
+ * 断言失败时打印位置并计数，当前测试函数继续执行；
+ * 全部测试函数运行完后，有失败则以非零状态退出。
+ *
+ * 使用示例：
+ * @code
+ * static void testPushBack(void) {
+ *     Vector* v = vectorCreate(sizeof(int), 0);
+ *     TEST_ASSERT(v != NULL);
+ *     ...
+ * }
+ *
+ * int main(void) {
+ *     RUN_TEST(testPushBack);
+ *     return TEST_REPORT();
+ * }
+ * @endcode
+ */
+
+static int testFailureCount = 0;
+static int testRunCount = 0;
+
+/**
+ * @brief 断言条件成立
+ */
+#define TEST_ASSERT(cond)                                                      \
+    do {                                                                       \
+        if (!(cond)) {                                                         \
+            fprintf(stderr, "%s:%d: 断言失败: %s\n", __FILE__, __LINE__, #cond); \
+            testFailureCount++;                                                \
+        }                                                                      \
+    } while (0)
+
+/**
+ * @brief 断言两个整数相等（失败时打印两边的值）
+ */
+#define TEST_ASSERT_EQ(expected, actual)                                       \
+    do {                                                                       \
+        long long testExpected_ = (long long)(expected);                       \
+        long long testActual_ = (long long)(actual);                           \
+        if (testExpected_ != testActual_) {                                    \
+            fprintf(stderr, "%s:%d: 断言失败: %s == %s（期望%lld，实际%lld）\n", \
+                    __FILE__, __LINE__, #expected, #actual,                    \
+                    testExpected_, testActual_);                               \
+            testFailureCount++;                                                \
+        }                                                                      \
+    } while (0)
+
+/**
+ * @brief 断言两个C字符串相等
+ */
+#define TEST_ASSERT_STR_EQ(expected, actual)                                   \
+    do {                                                                       \
+        const char* testExpected_ = (expected);                                \
+        const char* testActual_ = (actual);                                    \
+        if (!testExpected_ || !testActual_ ||                                  \
+            strcmp(testExpected_, testActual_) != 0) {                         \
+            fprintf(stderr, "%s:%d: 断言失败: %s == %s（期望\"%s\"，实际\"%s\"）\n", \
+                    __FILE__, __LINE__, #expected, #actual,                    \
+                    testExpected_ ? testExpected_ : "(null)",                  \
+                    testActual_ ? testActual_ : "(null)");                     \
+            testFailureCount++;                                                \
+        }                                                                      \
+    } while (0)
+
+/**
+ * @brief 运行一个测试函数
+ */
+#define RUN_TEST(fn)                                                           \
+    do {                                                                       \
+        int testFailuresBefore_ = testFailureCount;                            \
+        testRunCount++;                                                        \
+        fn();                                                                  \
+        printf("%s %s\n", testFailureCount == testFailuresBefore_ ? "[通过]" : "[失败]", #fn); \
+    } while (0)
+
+/**
+ * @brief 打印汇总并返回进程退出状态
+ */
+#define TEST_REPORT()                                                          \
+    (printf("%d个测试，%d处断言失败\n", testRunCount, testFailureCount),         \
+     testFailureCount == 0 ? 0 : 1)
+
+#endif // TEST_FRAMEWORK_H